@@ -129,6 +129,7 @@ set(BS_BANSHEECORE_INC_RENDERAPI
 	"Include/BsGpuParams.h"
 	"Include/BsGpuParamDesc.h"
 	"Include/BsGpuParamBlockBuffer.h"
+	"Include/BsGpuParamBlockRing.h"
 	"Include/BsGpuParam.h"
 	"Include/BsGpuBuffer.h"
 	"Include/BsEventQuery.h"
@@ -403,6 +404,7 @@ set(BS_BANSHEECORE_SRC_RENDERAPI
 	"Source/BsGpuBuffer.cpp"
 	"Source/BsGpuParam.cpp"
 	"Source/BsGpuParamBlockBuffer.cpp"
+	"Source/BsGpuParamBlockRing.cpp"
 	"Source/BsGpuParams.cpp"
 	"Source/BsGpuProgram.cpp"
 	"Source/BsIndexBuffer.cpp"
@@ -547,6 +549,20 @@ if(WIN32)
 	list(APPEND BS_BANSHEECORE_SRC_PLATFORM ${BS_BANSHEECORE_SRC_PLATFORM_WIN32})
 endif()
 
+set(BS_BANSHEECORE_INC_TESTING
+	"Include/BsAnimationTestSuite.h"
+	"Include/BsCoreThreadTestSuite.h"
+	"Include/BsCoreObjectTestSuite.h"
+	"Include/BsMaterialParamsTestSuite.h"
+)
+
+set(BS_BANSHEECORE_SRC_TESTING
+	"Source/BsAnimationTestSuite.cpp"
+	"Source/BsCoreThreadTestSuite.cpp"
+	"Source/BsCoreObjectTestSuite.cpp"
+	"Source/BsMaterialParamsTestSuite.cpp"
+)
+
 source_group("Header Files\\Components" FILES ${BS_BANSHEECORE_INC_COMPONENTS})
 source_group("Header Files\\Physics" FILES ${BS_BANSHEECORE_INC_PHYSICS})
 source_group("Header Files\\CoreThread" FILES ${BS_BANSHEECORE_INC_CORETHREAD})
@@ -587,6 +603,8 @@ source_group("Header Files\\Audio" FILES ${BS_BANSHEECORE_INC_AUDIO})
 source_group("Source Files\\Audio" FILES ${BS_BANSHEECORE_SRC_AUDIO})
 source_group("Header Files\\Animation" FILES ${BS_BANSHEECORE_INC_ANIMATION})
 source_group("Source Files\\Animation" FILES ${BS_BANSHEECORE_SRC_ANIMATION})
+source_group("Header Files\\Testing" FILES ${BS_BANSHEECORE_INC_TESTING})
+source_group("Source Files\\Testing" FILES ${BS_BANSHEECORE_SRC_TESTING})
 
 set(BS_BANSHEECORE_SRC
 	${BS_BANSHEECORE_INC_COMPONENTS}
@@ -629,4 +647,6 @@ set(BS_BANSHEECORE_SRC
 	${BS_BANSHEECORE_SRC_ANIMATION}
 	${BS_BANSHEECORE_INC_RENDERAPI_MANAGERS}
 	${BS_BANSHEECORE_SRC_RENDERAPI_MANAGERS}
+	${BS_BANSHEECORE_INC_TESTING}
+	${BS_BANSHEECORE_SRC_TESTING}
 )
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "BsModule.h"
 #include "BsCoreThread.h"
 #include "BsConvexVolume.h"
+#include "BsMatrix4.h"
 #include "BsVertexDataDesc.h"
 
 namespace BansheeEngine
@@ -102,6 +103,9 @@ namespace BansheeEngine
 	private:
 		friend class Animation;
 
+		/** Maximum number of animation proxies evaluated by a single task, when evaluating in parallel. */
+		static const UINT32 PROXIES_PER_TASK = 4;
+
 		/** Possible states the worker thread can be in, used for synchronization. */
 		enum class WorkerState
 		{
@@ -121,6 +125,15 @@ namespace BansheeEngine
 		/** Worker method ran on the animation thread that evaluates all animation at the provided time. */
 		void evaluateAnimation();
 
+		/**
+		 * Evaluates a single animation proxy. Skeleton pose is written to @p boneDst, and information about the output
+		 * is written to @p animInfo. Returns false if the animation was culled and has no output.
+		 *
+		 * @note	Thread safe, as long as no two threads evaluate the same proxy.
+		 */
+		bool evaluateProxy(AnimationProxy& anim, Matrix4* boneDst, UINT32 boneIdx, 
+			const RendererAnimationData& prevRenderData, RendererAnimationData::AnimInfo& animInfo);
+
 		UINT64 mNextId;
 		UnorderedMap<UINT64, Animation*> mAnimations;
 		
@@ -137,6 +150,9 @@ namespace BansheeEngine
 		// Animation thread
 		Vector<SPtr<AnimationProxy>> mProxies;
 		Vector<ConvexVolume> mCullFrustums;
+		Vector<UINT32> mProxyBoneOffsets;
+		Vector<RendererAnimationData::AnimInfo> mProxyInfos;
+		Vector<UINT8> mProxyHasInfo;
 		RendererAnimationData mAnimData[CoreThread::NUM_SYNC_BUFFERS];
 
 		UINT32 mPoseReadBufferIdx;
@@ -109,6 +109,12 @@ namespace BansheeEngine
 		/** Determines will the clip be played a spatial 3D sound, or as a normal sound (for example music). */
 		bool is3D() const { return mDesc.is3D; }
 
+		/** @copydoc Resource::getMemorySize */
+		UINT64 getMemorySize() const override;
+
+		/** @copydoc Resource::getMemoryType */
+		ResourceMemoryType getMemoryType() const override { return ResourceMemoryType::Audio; }
+
 		/**
 		 * Creates a new AudioClip and populates it with provided samples.
 		 *
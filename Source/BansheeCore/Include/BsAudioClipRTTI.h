@@ -41,7 +41,9 @@ namespace BansheeEngine
 
 		void setData(AudioClip* obj, const SPtr<DataStream>& val, UINT32 size)
 		{
-			obj->mStreamData = val->clone(); // Making sure that the AudioClip cannot modify the source stream, which is still used by the deserializer
+			// Making sure that the AudioClip cannot modify the source stream, which is still used by the deserializer.
+			// Mapped streams are cloned without copying, as the clone only needs its own read position.
+			obj->mStreamData = val->clone(!val->isMapped());
 			obj->mStreamSize = size;
 			obj->mStreamOffset = (UINT32)val->tell();
 		}
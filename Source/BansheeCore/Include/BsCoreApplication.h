@@ -26,6 +26,9 @@ namespace BansheeEngine
 		RENDER_WINDOW_DESC primaryWindowDesc; /**< Describes the window to create during start-up. */
 
 		Vector<String> importers; /**< A list of importer plugins to load. */
+
+		/** Number of threads used for asynchronous file reads. Zero picks the number based on the hardware. */
+		UINT32 numIOThreads = 0;
 	};
 
 	/**
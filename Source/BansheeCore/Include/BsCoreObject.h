@@ -64,6 +64,12 @@ namespace BansheeEngine
 		 */
 		void blockUntilCoreInitialized() const;
 
+		/**
+		 * Checks if the core thread counterpart of this object is done initializing. Also returns true if the object has no
+		 * core thread counterpart, or if its initialization isn't scheduled on the core thread.
+		 */
+		bool isCoreInitialized() const;
+
 		/** Returns an unique identifier for this object. */
 		UINT64 getInternalID() const { return mInternalID; }
 
@@ -56,9 +56,24 @@ namespace BansheeEngine
 		struct DirtyObjectData
 		{
 			CoreObject* object;
+			UINT64 internalId;
 			INT32 syncDataId;
 		};
 
+		/** 
+		 * Contains information about a registered CoreObject. Each object occupies a single slot, which is reused once
+		 * the object is destroyed.
+		 */
+		struct ObjectSlot
+		{
+			CoreObject* object = nullptr;
+			UINT64 internalId = 0; /**< ID of the object occupying the slot, used for detecting IDs of destroyed objects. */
+			UINT32 dirtyIdx = INVALID_INDEX; /**< Index into the dirty object list, if the object is in it. */
+
+			Vector<CoreObject*> dependencies;
+			Vector<CoreObject*> dependants;
+		};
+
 	public:
 		CoreObjectManager();
 		~CoreObjectManager();
@@ -119,11 +134,34 @@ namespace BansheeEngine
 		 */
 		void updateDependencies(CoreObject* object, Vector<CoreObject*>* dependencies);
 
+		/** Returns the slot of a registered object with the provided internal ID. Caller must hold the objects mutex. */
+		ObjectSlot& getSlot(UINT64 internalId);
+
+		/**
+		 * Returns the entry in the dirty object list for the object in the provided slot, adding a new entry if the object
+		 * isn't yet dirty. Caller must hold the objects mutex.
+		 */
+		DirtyObjectData& getDirtyEntry(ObjectSlot& slot);
+
+		/** Removes the object in the provided slot from the dirty object list, if present. Caller must hold the mutex. */
+		void removeDirtyEntry(ObjectSlot& slot);
+
+		/** Returns the index of the slot an object with the provided ID is stored in. */
+		static UINT32 getSlotIdx(UINT64 internalId) { return (UINT32)(internalId & 0xFFFFFFFF); }
+
+		static const UINT32 INVALID_INDEX = (UINT32)-1;
+
+		/**
+		 * Counter used for generating internal IDs. Lower 32 bits of an ID contain the slot index, while the upper 32 bits
+		 * contain the value of this counter at the time the object was registered. This keeps IDs unique even when slots
+		 * are reused, and ensures objects created later always have larger IDs.
+		 */
 		UINT64 mNextAvailableID;
-		Map<UINT64, CoreObject*> mObjects;
-		Map<UINT64, DirtyObjectData> mDirtyObjects;
-		Map<UINT64, Vector<CoreObject*>> mDependencies;
-		Map<UINT64, Vector<CoreObject*>> mDependants;
+		UINT32 mNumObjects;
+
+		Vector<ObjectSlot> mSlots;
+		Vector<UINT32> mFreeSlots;
+		Vector<DirtyObjectData> mDirtyObjects;
 
 		Vector<CoreStoredSyncObjData> mDestroyedSyncData;
 		List<CoreStoredSyncData> mCoreSyncData;
@@ -224,6 +224,7 @@ namespace BansheeEngine
 {
 	static const StringID RenderAPIAny = "AnyRenderAPI";
 	static const StringID RendererAny = "AnyRenderer";
+	static const StringID RenderAPINull = "NullRenderAPI";
 
     class Color;
     class GpuProgram;
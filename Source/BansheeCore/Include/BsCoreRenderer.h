@@ -42,6 +42,7 @@ namespace BansheeEngine
 	static StringID RTag_Skinned = "Skinned";
 	static StringID RTag_Morph = "Morph";
 	static StringID RTag_SkinnedMorph = "SkinnedMorph";
+	static StringID RTag_Instanced = "Instanced";
 
 	/**	Set of options that can be used for controlling the renderer. */	
 	struct BS_CORE_EXPORT CoreRendererOptions
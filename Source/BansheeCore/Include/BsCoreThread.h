@@ -7,6 +7,7 @@
 #include "BsCommandQueue.h"
 #include "BsCoreThreadAccessor.h"
 #include "BsThreadPool.h"
+#include "BsMPSCQueue.h"
 
 namespace BansheeEngine
 {
@@ -49,6 +50,56 @@ namespace BansheeEngine
 			static BS_THREADLOCAL AccessorContainer* current;
 		};
 
+		/**
+		 * Command queued for execution on the core thread. Callables up to INLINE_SIZE bytes are stored within the command
+		 * itself, and larger ones are allocated on the heap.
+		 */
+		class Command
+		{
+		public:
+			template<class T>
+			Command(T&& callback, UINT32 notifyId)
+				:notifyId(notifyId)
+			{
+				typedef typename std::decay<T>::type Callable;
+
+				if (sizeof(Callable) <= INLINE_SIZE && alignof(Callable) <= alignof(Storage))
+				{
+					mCallable = new (&mStorage) Callable(std::forward<T>(callback));
+					mDestroy = [](void* callable) { static_cast<Callable*>(callable)->~Callable(); };
+				}
+				else
+				{
+					mCallable = bs_new<Callable>(std::forward<T>(callback));
+					mDestroy = [](void* callable) { bs_delete(static_cast<Callable*>(callable)); };
+				}
+
+				mExecute = [](void* callable) { (*static_cast<Callable*>(callable))(); };
+			}
+
+			~Command() { mDestroy(mCallable); }
+
+			Command(const Command&) = delete;
+			Command& operator=(const Command&) = delete;
+
+			/** Executes the stored callable. */
+			void execute() { mExecute(mCallable); }
+
+			/** Identifier to report to any threads waiting on the command, or NO_NOTIFY if nobody is waiting. */
+			UINT32 notifyId;
+
+			static const UINT32 INLINE_SIZE = 64;
+			static const UINT32 NO_NOTIFY = (UINT32)-1;
+
+		private:
+			typedef std::aligned_storage<INLINE_SIZE, 16>::type Storage;
+
+			Storage mStorage;
+			void* mCallable;
+			void(*mExecute)(void*);
+			void(*mDestroy)(void*);
+		};
+
 public:
 	CoreThread();
 	~CoreThread();
@@ -84,7 +135,7 @@ public:
 
 	/**
 	 * Queues a new command that will be added to the global command queue. You are allowed to call this from any thread,
-	 * however be aware that it involves possibly slow synchronization primitives, so limit your usage.
+	 * however when queuing many commands it is more efficient to use an accessor.
 	 * 		
 	 * @param[in]	commandCallback		Command to queue.
 	 * @param[in]	blockUntilComplete	If true the thread will be blocked until the command executes. Be aware that there 
@@ -96,17 +147,44 @@ public:
 	AsyncOp queueReturnCommand(std::function<void(AsyncOp&)> commandCallback, bool blockUntilComplete = false);
 
 	/**
-	 * Queues a new command that will be added to the global command queue.You are allowed to call this from any thread,
-	 * however be aware that it involves possibly slow synchronization primitives, so limit your usage.
+	 * Queues a new command that will be added to the global command queue. You are allowed to call this from any thread.
+	 * The queue is lock-free and small callables are stored without allocating memory.
 	 * 	
-	 * @param[in]	commandCallback		Command to queue.
+	 * @param[in]	commandCallback		Command to queue. Any callable with a void() signature.
 	 * @param[in]	blockUntilComplete	If true the thread will be blocked until the command executes. Be aware that there 
 	 *									may be many commands queued before it and they all need to be executed in order 
 	 *									before the current command is reached, which might take a long time.
 	 *
+	 * @note	
+	 * The queue holds at most COMMAND_QUEUE_CAPACITY commands. If it is full the calling thread is put to sleep until
+	 * the core thread executes enough commands to make room. 
+	 *
 	 * @see		CommandQueue::queue()
 	 */
-	void queueCommand(std::function<void()> commandCallback, bool blockUntilComplete = false);
+	template<class T>
+	void queueCommand(T&& commandCallback, bool blockUntilComplete = false)
+	{
+		assert(BS_THREAD_CURRENT_ID != getCoreThreadId() && "Cannot queue commands on the core thread for the core thread");
+
+		UINT32 commandId = blockUntilComplete ? mMaxCommandNotifyId.fetch_add(1) : Command::NO_NOTIFY;
+
+		if (!mCommandQueue.tryEmplace(std::forward<T>(commandCallback), commandId))
+		{
+			// Queue is full, sleep until the core thread makes room. The fence ensures that either we see the space freed
+			// by the core thread, or it sees the waiting producer (see executeCommands()).
+			Lock lock(mCommandSpaceMutex);
+
+			mNumWaitingProducers.fetch_add(1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			while (!mCommandQueue.tryEmplace(std::forward<T>(commandCallback), commandId))
+				mCommandSpaceCondition.wait(lock);
+
+			mNumWaitingProducers.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		submitCommand(commandId);
+	}
 
 	/**
 	 * Called once every frame.
@@ -151,23 +229,34 @@ private:
 	static AccessorData mAccessor;
 	Vector<AccessorContainer*> mAccessors;
 
+	/** 
+	 * Maximum number of commands that can be queued on the global command queue. Threads queuing commands while the
+	 * queue is full are blocked until the core thread catches up. 
+	 */
+	static const UINT32 COMMAND_QUEUE_CAPACITY = 2048;
+
 	volatile bool mCoreThreadShutdown;
 
 	HThread mCoreThread;
 	bool mCoreThreadStarted;
 	ThreadId mSimThreadId;
 	ThreadId mCoreThreadId;
-	Mutex mCommandQueueMutex;
 	Mutex mAccessorMutex;
+	Mutex mCommandReadyMutex;
 	Signal mCommandReadyCondition;
+	std::atomic<bool> mCoreThreadWaiting;
+	Mutex mCommandSpaceMutex;
+	Signal mCommandSpaceCondition;
+	std::atomic<UINT32> mNumWaitingProducers;
 	Mutex mCommandNotifyMutex;
 	Signal mCommandCompleteCondition;
 	Mutex mThreadStartedMutex;
 	Signal mCoreThreadStartedCondition;
 
-	CommandQueue<CommandQueueSync>* mCommandQueue;
+	MPSCQueue<Command> mCommandQueue;
+	SPtr<AsyncOpSyncData> mAsyncOpSyncData;
 
-	UINT32 mMaxCommandNotifyId; /**< ID that will be assigned to the next command with a notifier callback. */
+	std::atomic<UINT32> mMaxCommandNotifyId; /**< ID that will be assigned to the next command with a notifier callback. */
 	Vector<UINT32> mCommandsCompleted; /**< Completed commands that have notifier callbacks set up */
 
 	SyncedCoreAccessor* mSyncedCoreAccessor;
@@ -181,6 +270,15 @@ private:
 	/** Shutdowns the core thread. It will complete all ready commands before shutdown. */
 	void shutdownCoreThread();
 
+	/** Executes all commands currently in the global command queue. Must be called from the core thread. */
+	void executeCommands();
+
+	/**
+	 * Wakes up the core thread after a command has been added to the global command queue and, if the command has a
+	 * notify ID, blocks until the command completes.
+	 */
+	void submitCommand(UINT32 commandId);
+
 	/**
 	 * Blocks the calling thread until the command with the specified ID completes. Make sure that the specified ID 
 	 * actually exists, otherwise this will block forever.
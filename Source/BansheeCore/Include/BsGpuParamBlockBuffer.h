@@ -57,6 +57,9 @@ namespace BansheeEngine
 		 */
 		void zeroOut(UINT32 offset, UINT32 size);
 
+		/** Returns internal cached data of the buffer. */
+		const UINT8* getCachedData() const { return mCachedData; }
+
 		/**	Returns the size of the buffer in bytes. */
 		UINT32 getSize() const { return mSize; }
 
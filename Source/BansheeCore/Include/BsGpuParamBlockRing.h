@@ -0,0 +1,82 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup RenderAPI-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Provides parameter block buffers for data that changes every draw call (e.g. per-object data), recycling them
+	 * between frames. 
+	 *
+	 * Each frame in flight has its own region of buffers, and buffers allocated during a frame are not handed out again 
+	 * until the region of that frame is reused, @p numFramesInFlight frames later. By then the GPU is done with them, so
+	 * they can be written to without stalling. If a buffer is re-allocated with the same contents it had when its region
+	 * was last used, the upload is skipped entirely, meaning draws with unchanged data (e.g. static objects) don't 
+	 * upload anything.
+	 *
+	 * @note	Core thread only.
+	 */
+	class BS_CORE_EXPORT GpuParamBlockRing
+	{
+	public:
+		/** Counters for the allocations made from the ring during a single frame. */
+		struct FrameStats
+		{
+			UINT32 numAllocations = 0;
+			UINT32 numUploads = 0;
+			UINT32 numBytesUploaded = 0;
+		};
+
+		/**
+		 * Creates a new ring.
+		 *
+		 * @param[in]	blockSize			Size of the parameter block buffers provided by the ring, in bytes.
+		 * @param[in]	numFramesInFlight	Number of frames the GPU can lag behind the CPU. Determines how many frames pass
+		 *									before a buffer can be handed out again.
+		 */
+		GpuParamBlockRing(UINT32 blockSize, UINT32 numFramesInFlight = 3);
+
+		/** Moves to the region of the next frame. Must be called once at the start of every frame. */
+		void beginFrame();
+
+		/**
+		 * Returns a parameter block buffer holding the provided data, valid for the rest of the current frame. The buffer
+		 * contents are marked for upload only if they differ from the last time the buffer was used.
+		 *
+		 * @param[in]	data	Data to initialize the buffer with. Must be getBlockSize() bytes.
+		 */
+		SPtr<GpuParamBlockBufferCore> allocate(const UINT8* data);
+
+		/** Returns the size of the parameter block buffers provided by the ring, in bytes. */
+		UINT32 getBlockSize() const { return mBlockSize; }
+
+		/** Returns counters for the allocations made during the current frame. */
+		const FrameStats& getFrameStats() const { return mCurrentStats; }
+
+		/** Returns counters for the allocations made during the previous frame. */
+		const FrameStats& getLastFrameStats() const { return mLastStats; }
+
+	private:
+		/** Buffers owned by a single frame in flight. */
+		struct FrameRegion
+		{
+			Vector<SPtr<GpuParamBlockBufferCore>> buffers;
+			UINT32 numUsed = 0;
+		};
+
+		UINT32 mBlockSize;
+		Vector<FrameRegion> mRegions;
+		UINT32 mCurrentRegion;
+
+		FrameStats mCurrentStats;
+		FrameStats mLastStats;
+	};
+
+	/** @} */
+}
@@ -112,6 +112,23 @@ namespace BansheeEngine
 		 */
 		void setParamBlockBuffer(const String& name, const ParamBlockPtrType& paramBlock, bool ignoreInUpdate = false);
 
+		/**
+		 * Assign a parameter block buffer with the specified index to all the relevant child GpuParams. Faster than
+		 * setParamBlockBuffer(const String&, const ParamBlockPtrType&, bool) as the buffer doesn't need to be searched
+		 * for, and therefore better suited for buffers that are re-assigned often.
+		 *
+		 * @param[in]	index			Index of the buffer, as returned by getParamBlockBufferIndex().
+		 * @param[in]	paramBlock		Parameter block to assign.
+		 * @param[in]	ignoreInUpdate	If true the buffer will not be updated during the update() call.
+		 */
+		void setParamBlockBuffer(UINT32 index, const ParamBlockPtrType& paramBlock, bool ignoreInUpdate = false);
+
+		/** 
+		 * Returns the index of an assignable parameter block buffer with the specified name, or -1 if such buffer 
+		 * doesn't exist.
+		 */
+		UINT32 getParamBlockBufferIndex(const String& name) const;
+
 		/** Returns the number of passes the set contains the parameters for. */
 		UINT32 getNumPasses() const { return (UINT32)mPassParams.size(); }
 
@@ -125,6 +142,11 @@ namespace BansheeEngine
 		 *								(each with their own index).
 		 * @param[in]	updateAll		By default the system will only update parameters marked as dirty in @p params. If this
 		 *								is set to true, all parameters will be updated instead.
+		 *
+		 * @note	
+		 * Data parameters changed since the last call are found through the dirty ring in @p params, so the cost is
+		 * proportional to the number of changed parameters. All parameters are checked only on the first call, or if
+		 * more parameters changed than the ring can hold.
 		 */
 		void update(const SPtr<MaterialParamsType>& params, UINT32 dirtyBitIdx, bool updateAll = false);
 
@@ -135,7 +157,9 @@ namespace BansheeEngine
 		Vector<SPtr<GpuParamsType>> mPassParams;
 		Vector<BlockInfo> mBlocks;
 		Vector<DataParamInfo> mDataParamInfos;
+		Vector<UINT32> mDataParamInfoOffsets; // Per material parameter, index of its first entry in mDataParamInfos
 		PassParamInfo* mPassParamInfos;
+		UINT64 mDirtyVersion = (UINT64)-1;
 	};
 
 	/** Sim thread version of TGpuParamsSet<Core>. */
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "BsCorePrerequisites.h"
+#include "BsCompression.h"
 
 namespace BansheeEngine
 {
@@ -66,6 +67,24 @@ namespace BansheeEngine
 		 */
 		void setExternalBuffer(UINT8* data);
 
+		/**
+		 * Makes the internal data pointer point to data owned by a data stream, such as a region of a memory mapped file
+		 * (see MappedFileDataStream). No copying is done. The stream is referenced for as long as this object (or any of
+		 * its copies) uses the data, so it must keep the data at a fixed location until it is destroyed.
+		 *
+		 * @note	If any internal data is allocated, it is freed.
+		 */
+		void setExternalBuffer(UINT8* data, const SPtr<DataStream>& source);
+
+		/**
+		 * Sets the compression to apply to the data when it is serialized. Data is compressed in independent chunks, so
+		 * it can be decompressed in parallel when loaded.
+		 */
+		void setCompression(CompressionType compression) { mCompression = compression; }
+
+		/** Returns the compression to apply to the data when it is serialized. */
+		CompressionType getCompression() const { return mCompression; }
+
 		/** Checks if the internal buffer is locked due to some other thread using it. */
 		bool isLocked() const { return mLocked; }
 
@@ -75,6 +94,22 @@ namespace BansheeEngine
 		/**	Unlocks the data and makes it available to all threads.  */
 		void _unlock() const;
 
+		/**
+		 * Compresses the first @p size bytes of the internal buffer using the compression set by setCompression(), into
+		 * a block that can be decompressed by _decompressData().
+		 */
+		SPtr<DataStream> _compressData(UINT32 size) const;
+
+		/**
+		 * Allocates an internal buffer and fills it by decompressing a block created by _compressData(). Data stored in
+		 * memory, including mapped files, is decompressed directly from its location.
+		 *
+		 * @param[in]	stream	Stream positioned at the start of the compressed block. Advanced past the block.
+		 * @param[in]	size	Size of the compressed block, in bytes.
+		 * @return				True if the data was decompressed, false if the block is corrupt.
+		 */
+		bool _decompressData(const SPtr<DataStream>& stream, UINT32 size);
+
 	protected:
 		/**
 		 * Returns the size of the internal buffer in bytes. This is calculated based on parameters provided upon 
@@ -82,8 +117,11 @@ namespace BansheeEngine
 		 */
 		virtual UINT32 getInternalBufferSize() const = 0;
 
+		CompressionType mCompression;
+
 	private:
 		UINT8* mData;
+		SPtr<DataStream> mSourceStream;
 		bool mOwnsData;
 		mutable bool mLocked;
 
@@ -504,6 +504,194 @@ namespace BansheeEngine
 		template <typename T>
 		void getParam(const String& name, TMaterialDataParam<T, Core>& output) const;
 
+		/**
+		 * Returns a handle that may be used for quickly setting and retrieving the value of the parameter with the
+		 * specified name. Unlike the handles returned by getParam*() methods, this handle isn't tied to this material
+		 * and may be used with any material using the same shader, allowing it to be created once per shader. Returned
+		 * handle is invalid if the parameter doesn't exist.
+		 */
+		MaterialParamHandle getParamHandle(const StringID& name) const;
+
+		/**
+		 * Equivalent to setFloat(const String&, float, UINT32) except it uses a precompiled handle, avoiding the name
+		 * lookup.
+		 */
+		void setFloat(const MaterialParamHandle& handle, float value, UINT32 arrayIdx = 0)
+		{
+			setDataParam(handle, value, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to setColor(const String&, const Color&, UINT32) except it uses a precompiled handle, avoiding the
+		 * name lookup.
+		 */
+		void setColor(const MaterialParamHandle& handle, const Color& value, UINT32 arrayIdx = 0)
+		{
+			setDataParam(handle, value, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to setVec2(const String&, const Vector2&, UINT32) except it uses a precompiled handle, avoiding
+		 * the name lookup.
+		 */
+		void setVec2(const MaterialParamHandle& handle, const Vector2& value, UINT32 arrayIdx = 0)
+		{
+			setDataParam(handle, value, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to setVec3(const String&, const Vector3&, UINT32) except it uses a precompiled handle, avoiding
+		 * the name lookup.
+		 */
+		void setVec3(const MaterialParamHandle& handle, const Vector3& value, UINT32 arrayIdx = 0)
+		{
+			setDataParam(handle, value, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to setVec4(const String&, const Vector4&, UINT32) except it uses a precompiled handle, avoiding
+		 * the name lookup.
+		 */
+		void setVec4(const MaterialParamHandle& handle, const Vector4& value, UINT32 arrayIdx = 0)
+		{
+			setDataParam(handle, value, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to setMat3(const String&, const Matrix3&, UINT32) except it uses a precompiled handle, avoiding
+		 * the name lookup.
+		 */
+		void setMat3(const MaterialParamHandle& handle, const Matrix3& value, UINT32 arrayIdx = 0)
+		{
+			setDataParam(handle, value, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to setMat4(const String&, const Matrix4&, UINT32) except it uses a precompiled handle, avoiding
+		 * the name lookup.
+		 */
+		void setMat4(const MaterialParamHandle& handle, const Matrix4& value, UINT32 arrayIdx = 0)
+		{
+			setDataParam(handle, value, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to getFloat(const String&, UINT32) except it uses a precompiled handle, avoiding the name lookup.
+		 */
+		float getFloat(const MaterialParamHandle& handle, UINT32 arrayIdx = 0) const
+		{
+			return getDataParam<float>(handle, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to getColor(const String&, UINT32) except it uses a precompiled handle, avoiding the name lookup.
+		 */
+		Color getColor(const MaterialParamHandle& handle, UINT32 arrayIdx = 0) const
+		{
+			return getDataParam<Color>(handle, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to getVec2(const String&, UINT32) except it uses a precompiled handle, avoiding the name lookup.
+		 */
+		Vector2 getVec2(const MaterialParamHandle& handle, UINT32 arrayIdx = 0) const
+		{
+			return getDataParam<Vector2>(handle, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to getVec3(const String&, UINT32) except it uses a precompiled handle, avoiding the name lookup.
+		 */
+		Vector3 getVec3(const MaterialParamHandle& handle, UINT32 arrayIdx = 0) const
+		{
+			return getDataParam<Vector3>(handle, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to getVec4(const String&, UINT32) except it uses a precompiled handle, avoiding the name lookup.
+		 */
+		Vector4 getVec4(const MaterialParamHandle& handle, UINT32 arrayIdx = 0) const
+		{
+			return getDataParam<Vector4>(handle, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to getMat3(const String&, UINT32) except it uses a precompiled handle, avoiding the name lookup.
+		 */
+		Matrix3 getMat3(const MaterialParamHandle& handle, UINT32 arrayIdx = 0) const
+		{
+			return getDataParam<Matrix3>(handle, arrayIdx);
+		}
+
+		/**
+		 * Equivalent to getMat4(const String&, UINT32) except it uses a precompiled handle, avoiding the name lookup.
+		 */
+		Matrix4 getMat4(const MaterialParamHandle& handle, UINT32 arrayIdx = 0) const
+		{
+			return getDataParam<Matrix4>(handle, arrayIdx);
+		}
+
+		/**
+		 * Assigns a value to the data parameter referenced by the provided handle. If the handle wasn't created for
+		 * this material's shader, or the parameter type or array index are not valid, a warning will be logged and
+		 * the value will not be set.
+		 */
+		template <typename T>
+		void setDataParam(const MaterialParamHandle& handle, const T& value, UINT32 arrayIdx = 0)
+		{
+			const MaterialParamsBase::ParamData* param = findDataParam<T>(handle, arrayIdx);
+			if (param == nullptr)
+				return;
+
+			mParams->setDataParam(param->index, arrayIdx, value);
+			mParams->setParamDirty(handle.paramIdx);
+			_markCoreDirty();
+		}
+
+		/**
+		 * Returns the value of the data parameter referenced by the provided handle. If the handle wasn't created for
+		 * this material's shader, or the parameter type or array index are not valid, a warning will be logged and
+		 * a default value will be returned.
+		 */
+		template <typename T>
+		T getDataParam(const MaterialParamHandle& handle, UINT32 arrayIdx = 0) const
+		{
+			T output = T();
+
+			const MaterialParamsBase::ParamData* param = findDataParam<T>(handle, arrayIdx);
+			if (param != nullptr)
+				mParams->getDataParam(param->index, arrayIdx, output);
+
+			return output;
+		}
+
+		/**
+		 * Assigns values to multiple data parameters at once. Parameters are assigned the same way as with
+		 * setDataParam(), except that the material is only marked dirty once for the entire batch.
+		 *
+		 * @param[in]	handles		Handles of the parameters to assign, @p count entries in total.
+		 * @param[in]	values		Values to assign, one per handle.
+		 * @param[in]	count		Number of parameters to assign.
+		 */
+		template <typename T>
+		void setDataParams(const MaterialParamHandle* handles, const T* values, UINT32 count)
+		{
+			bool anySet = false;
+			for (UINT32 i = 0; i < count; i++)
+			{
+				const MaterialParamsBase::ParamData* param = findDataParam<T>(handles[i], 0);
+				if (param == nullptr)
+					continue;
+
+				mParams->setDataParam(param->index, 0, values[i]);
+				mParams->setParamDirty(handles[i].paramIdx);
+				anySet = true;
+			}
+
+			if (anySet)
+				_markCoreDirty();
+		}
+
 		/**
 		 * @name Internal
 		 * @{
@@ -526,6 +714,29 @@ namespace BansheeEngine
 		template <typename T>
 		void setParamValue(const String& name, UINT8* buffer, UINT32 numElements);
 
+		/** 
+		 * Returns the data parameter referenced by the provided handle, or null (and logs a warning) if the handle is
+		 * not valid for this material or doesn't match the requested type and array index.
+		 */
+		template <typename T>
+		const MaterialParamsBase::ParamData* findDataParam(const MaterialParamHandle& handle, UINT32 arrayIdx) const
+		{
+			if (mParams == nullptr)
+				return nullptr;
+
+			const MaterialParamsBase::ParamData* param = nullptr;
+			auto result = mParams->getParamData(handle, MaterialParamsBase::ParamType::Data, 
+				(GpuParamDataType)TGpuDataParamInfo<T>::TypeId, arrayIdx, &param);
+
+			if (result != MaterialParamsBase::GetParamResult::Success)
+			{
+				mParams->reportGetParamError(result, handle, arrayIdx);
+				return nullptr;
+			}
+
+			return param;
+		}
+
 		/**
 		 * Initializes the material by using the compatible techniques from the currently set shader. Shader must contain 
 		 * the techniques that matches the current renderer and render system.
@@ -223,6 +223,27 @@ namespace BansheeEngine
 	 *  @{
 	 */
 
+	/**
+	 * Precompiled handle to a material parameter, allowing its value to be accessed without a name lookup. Parameter
+	 * layout depends only on the shader, so unlike TMaterialDataParam the same handle may be used with any material
+	 * using the shader the handle was created for.
+	 *
+	 * @see		Material::getParamHandle
+	 */
+	struct MaterialParamHandle
+	{
+		MaterialParamHandle()
+			:shaderId((UINT32)-1), paramIdx((UINT32)-1)
+		{ }
+
+		/** Checks if the handle references an existing parameter. */
+		bool isValid() const { return paramIdx != (UINT32)-1; }
+
+		StringID name;
+		UINT32 shaderId;
+		UINT32 paramIdx;
+	};
+
 	typedef TMaterialDataParam<float, false> MaterialParamFloat;
 	typedef TMaterialDataParam<Vector2, false> MaterialParamVec2;
 	typedef TMaterialDataParam<Vector3, false> MaterialParamVec3;
@@ -7,6 +7,7 @@
 #include "BsStaticAlloc.h"
 #include "BsVector2.h"
 #include "BsGpuParams.h"
+#include "BsMaterialParam.h"
 
 namespace BansheeEngine
 {
@@ -33,7 +34,8 @@ namespace BansheeEngine
 			Success,
 			NotFound,
 			InvalidType,
-			IndexOutOfBounds
+			IndexOutOfBounds,
+			InvalidHandle
 		};
 
 		/** Meta-data about a parameter. */
@@ -156,6 +158,14 @@ namespace BansheeEngine
 		GetParamResult getParamData(const String& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
 			const ParamData** output) const;
 
+		/**
+		 * Equivalent to getParamData(const String&, ParamType, GpuParamDataType, UINT32, const ParamData**) except it
+		 * uses a precompiled handle, avoiding the name lookup. Reports InvalidHandle if the handle wasn't created for the
+		 * shader these parameters were created from.
+		 */
+		GetParamResult getParamData(const MaterialParamHandle& handle, ParamType type, GpuParamDataType dataType,
+			UINT32 arrayIdx, const ParamData** output) const;
+
 		/**
 		 * Returns information about a parameter at the specified global index, as retrieved by getParamIndex(). 
 		 */
@@ -173,6 +183,12 @@ namespace BansheeEngine
 		 */
 		void reportGetParamError(GetParamResult errorCode, const String& name, UINT32 arrayIdx) const;
 
+		/** @copydoc reportGetParamError(GetParamResult, const String&, UINT32) const */
+		void reportGetParamError(GetParamResult errorCode, const MaterialParamHandle& handle, UINT32 arrayIdx) const;
+
+		/** Returns the ID of the shader these parameters were created from, or -1 if unknown. */
+		UINT32 getShaderId() const { return mShaderId; }
+
 		/**
 		 * Equivalent to getDataParam(const String&, UINT32, T&) except it uses the internal parameter index
 		 * directly, avoiding the name lookup. Caller must guarantee the index is valid.
@@ -218,6 +234,40 @@ namespace BansheeEngine
 		 */
 		void clearDirtyFlags(UINT32 index);
 
+		/** 
+		 * Marks the parameter at the specified index as dirty for every dirty bit, and records it in the dirty ring so
+		 * consumers can find it without scanning all parameters.
+		 */
+		void setParamDirty(UINT32 index)
+		{
+			ParamData& param = mParams[index];
+
+			// If all bits are still set no consumer has cleared its bit since the parameter was last recorded, so it is
+			// already in the ring for all of them
+			if (param.dirtyFlags == 0xFFFFFFFF)
+				return;
+
+			param.dirtyFlags = 0xFFFFFFFF;
+
+			mDirtyRing[mDirtyVersion % DIRTY_RING_SIZE] = index;
+			mDirtyVersion++;
+		}
+
+		/** 
+		 * Returns a counter that is incremented every time a parameter gets recorded in the dirty ring. Consumers can
+		 * store this value and on their next update use getDirtyParam() to find the parameters that changed in-between.
+		 */
+		UINT64 getDirtyVersion() const { return mDirtyVersion; }
+
+		/** 
+		 * Returns the index of the parameter recorded in the dirty ring at the specified version. Only the last 
+		 * DIRTY_RING_SIZE versions are available, if the consumer fell further behind it must check all parameters.
+		 */
+		UINT32 getDirtyParam(UINT64 version) const { return mDirtyRing[version % DIRTY_RING_SIZE]; }
+
+		/** Number of entries in the dirty ring. */
+		static const UINT32 DIRTY_RING_SIZE = 64;
+
 	protected:
 		const static UINT32 STATIC_BUFFER_SIZE = 256;
 
@@ -231,6 +281,10 @@ namespace BansheeEngine
 		UINT32 mNumTextureParams = 0;
 		UINT32 mNumBufferParams = 0;
 		UINT32 mNumSamplerParams = 0;
+		UINT32 mShaderId = (UINT32)-1;
+
+		UINT32 mDirtyRing[DIRTY_RING_SIZE];
+		UINT64 mDirtyVersion = 0;
 
 		mutable StaticAlloc<STATIC_BUFFER_SIZE, STATIC_BUFFER_SIZE> mAlloc;
 	};
@@ -0,0 +1,19 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsTestSuite.h"
+
+namespace BansheeEngine
+{
+	class MaterialParamsTestSuite : public TestSuite
+	{
+	public:
+		MaterialParamsTestSuite();
+
+	private:
+		void testHandles();
+		void testDirtyRing();
+		void testSetParams_benchmark();
+	};
+}
@@ -135,6 +135,12 @@ namespace BansheeEngine
 		/** Retrieves a core implementation of a mesh usable only from the core thread. */
 		SPtr<MeshCore> getCore() const;
 
+		/** @copydoc Resource::getMemorySize */
+		UINT64 getMemorySize() const override;
+
+		/** @copydoc Resource::getMemoryType */
+		ResourceMemoryType getMemoryType() const override { return ResourceMemoryType::Mesh; }
+
 		/**	Returns a dummy mesh, containing just one triangle. Don't modify the returned mesh. */
 		static HMesh dummy();
 
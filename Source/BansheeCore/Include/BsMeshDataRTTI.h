@@ -32,15 +32,44 @@ namespace BansheeEngine
 		UINT32& getNumIndices(MeshData* obj) { return obj->mNumIndices; }
 		void setNumIndices(MeshData* obj, UINT32& value) { obj->mNumIndices = value; }
 
+		CompressionType& getCompression(MeshData* obj) { return obj->mCompression; }
+		void setCompression(MeshData* obj, CompressionType& value) { obj->mCompression = value; }
+
 		SPtr<DataStream> getData(MeshData* obj, UINT32& size)
 		{
 			size = obj->getInternalBufferSize();
 
+			if (obj->getCompression() != CompressionType::None)
+			{
+				SPtr<DataStream> compressed = obj->_compressData(size);
+				size = (UINT32)compressed->size();
+
+				return compressed;
+			}
+
 			return bs_shared_ptr_new<MemoryDataStream>(obj->getData(), size, false);
 		}
 
 		void setData(MeshData* obj, const SPtr<DataStream>& value, UINT32 size)
 		{
+			if (obj->getCompression() != CompressionType::None)
+			{
+				if (!obj->_decompressData(value, size))
+					LOGERR("Unable to decompress mesh data. Data is corrupt.");
+
+				return;
+			}
+
+			// Reference data in mapped files directly, keeping the mapping alive through a shared clone of the stream
+			if (value->isMapped())
+			{
+				SPtr<MappedFileDataStream> mappedStream = std::static_pointer_cast<MappedFileDataStream>(value);
+				obj->setExternalBuffer(mappedStream->getCurrentPtr(), mappedStream->clone(false));
+
+				value->skip(size);
+				return;
+			}
+
 			obj->allocateInternalBuffer(size);
 			value->read(obj->getData(), size);
 		}
@@ -54,6 +83,9 @@ namespace BansheeEngine
 			addPlainField("mNumVertices", 2, &MeshDataRTTI::getNumVertices, &MeshDataRTTI::setNumVertices);
 			addPlainField("mNumIndices", 3, &MeshDataRTTI::getNumIndices, &MeshDataRTTI::setNumIndices);
 
+			// Must be registered before the data, as it determines how the data is decoded
+			addPlainField("mCompression", 5, &MeshDataRTTI::getCompression, &MeshDataRTTI::setCompression);
+
 			addDataBlockField("data", 4, &MeshDataRTTI::getData, &MeshDataRTTI::setData, 0);
 		}
 
@@ -162,6 +162,12 @@ namespace BansheeEngine
 		 */
 		bool getImportRootMotion() const { return mImportRootMotion; }
 
+		/** Sets the compression to apply to the vertex and index data when the imported mesh is saved. */
+		void setDataCompression(CompressionType compression) { mDataCompression = compression; }
+
+		/** Returns the compression to apply to the vertex and index data when the imported mesh is saved. */
+		CompressionType getDataCompression() const { return mDataCompression; }
+
 	private:
 		bool mCPUReadable;
 		bool mImportNormals;
@@ -173,6 +179,7 @@ namespace BansheeEngine
 		bool mImportRootMotion;
 		float mImportScale;
 		CollisionMeshType mCollisionMeshType;
+		CompressionType mDataCompression;
 		Vector<AnimationSplitInfo> mAnimationSplits;
 		Vector<ImportedAnimationEvents> mAnimationEvents;
 
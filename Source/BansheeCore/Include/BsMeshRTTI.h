@@ -34,6 +34,7 @@ namespace BansheeEngine
 			obj->readSubresource(gCoreAccessor(), 0, meshData);
 			gCoreAccessor().submitToCoreThread(true);
 
+			meshData->setCompression(obj->getDataCompression());
 			return meshData;
 		}
 
@@ -43,15 +43,44 @@ namespace BansheeEngine
 		PixelFormat& getFormat(PixelData* obj) { return obj->mFormat; }
 		void setFormat(PixelData* obj, PixelFormat& val) { obj->mFormat = val; }
 
+		CompressionType& getCompression(PixelData* obj) { return obj->mCompression; }
+		void setCompression(PixelData* obj, CompressionType& val) { obj->mCompression = val; }
+
 		SPtr<DataStream> getData(PixelData* obj, UINT32& size)
 		{
 			size = obj->getConsecutiveSize();
 
+			if (obj->getCompression() != CompressionType::None)
+			{
+				SPtr<DataStream> compressed = obj->_compressData(size);
+				size = (UINT32)compressed->size();
+
+				return compressed;
+			}
+
 			return bs_shared_ptr_new<MemoryDataStream>(obj->getData(), size, false);
 		}
 
 		void setData(PixelData* obj, const SPtr<DataStream>& value, UINT32 size)
 		{
+			if (obj->getCompression() != CompressionType::None)
+			{
+				if (!obj->_decompressData(value, size))
+					LOGERR("Unable to decompress pixel data. Data is corrupt.");
+
+				return;
+			}
+
+			// Reference data in mapped files directly, keeping the mapping alive through a shared clone of the stream
+			if (value->isMapped())
+			{
+				SPtr<MappedFileDataStream> mappedStream = std::static_pointer_cast<MappedFileDataStream>(value);
+				obj->setExternalBuffer(mappedStream->getCurrentPtr(), mappedStream->clone(false));
+
+				value->skip(size);
+				return;
+			}
+
 			obj->allocateInternalBuffer(size);
 			value->read(obj->getData(), size);
 		}
@@ -68,6 +97,9 @@ namespace BansheeEngine
 			addPlainField("rowPitch", 6, &PixelDataRTTI::getRowPitch, &PixelDataRTTI::setRowPitch);
 			addPlainField("slicePitch", 7, &PixelDataRTTI::getSlicePitch, &PixelDataRTTI::setSlicePitch);
 			addPlainField("format", 8, &PixelDataRTTI::getFormat, &PixelDataRTTI::setFormat);
+
+			// Must be registered before the data, as it determines how the data is decoded
+			addPlainField("compression", 10, &PixelDataRTTI::getCompression, &PixelDataRTTI::setCompression);
 			addDataBlockField("data", 9, &PixelDataRTTI::getData, &PixelDataRTTI::setData, 0);
 		}
 
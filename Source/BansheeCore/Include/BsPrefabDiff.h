@@ -24,6 +24,13 @@ namespace BansheeEngine
 		INT32 id;
 		SPtr<SerializedObject> data;
 
+		/** 
+		 * Hashes of the prefab and instance component data the diff was generated from. Used for reusing the diff when
+		 * the diff is re-created and neither of the components has changed. Not serialized.
+		 */
+		UINT64 prefabHash = 0;
+		UINT64 instanceHash = 0;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
@@ -93,6 +100,17 @@ namespace BansheeEngine
 		 */
 		static SPtr<PrefabDiff> create(const HSceneObject& prefab, const HSceneObject& instance);
 
+		/**
+		 * Creates new prefab diffs for multiple instanced scene object hierarchies at once. This is more efficient than
+		 * creating the diffs one by one, as unchanged components are detected in parallel, and differences between
+		 * identical pairs of prefab and instance components are only generated once.
+		 *
+		 * @param[in]	prefabs		Prefab scene object hierarchies, one for each instance.
+		 * @param[in]	instances	Instanced scene object hierarchies to generate the diffs for.
+		 * @return					A diff for each instance, in the same order as @p instances.
+		 */
+		static Vector<SPtr<PrefabDiff>> create(const Vector<HSceneObject>& prefabs, const Vector<HSceneObject>& instances);
+
 		/**
 		 * Applies the internal prefab diff to the provided object. The object should have similar hierarchy as the prefab
 		 * the diff was created for, otherwise the results are undefined.
@@ -111,12 +129,48 @@ namespace BansheeEngine
 			UINT64 originalId;
 		};
 
+		/** A pair of prefab and instance components whose differences are yet to be generated. */
+		struct ComponentDiffJob
+		{
+			SPtr<PrefabObjectDiff> objectDiff; /**< Diff of the scene object the components belong to. */
+			INT32 linkId;
+			IDiff* diffHandler;
+			SPtr<SerializedObject> prefabData;
+			SPtr<SerializedObject> instanceData;
+			UINT64 prefabHash;
+			UINT64 instanceHash;
+		};
+
+		/** Component differences, keyed by hashes of the prefab and the instance component data. */
+		typedef Map<std::pair<UINT64, UINT64>, SPtr<SerializedObject>> ComponentDiffCache;
+
+		/** Maximum number of component pairs hashed by a single task. */
+		static const UINT32 HASH_GRAIN_SIZE = 16;
+
 		/**
 		 * Recurses over every scene object in the prefab a generates differences between itself and the instanced version.
+		 * Differences between matching components are not generated immediately, and instead a job is queued for each pair
+		 * of components. Diffs for all scene objects that have matching components are output, even if they end up empty.
 		 *
 		 * @see		create
 		 */
-		static SPtr<PrefabObjectDiff> generateDiff(const HSceneObject& prefab, const HSceneObject& instance);
+		static SPtr<PrefabObjectDiff> generateDiff(const HSceneObject& prefab, const HSceneObject& instance, 
+			Vector<ComponentDiffJob>& jobs);
+
+		/**
+		 * Generates differences for all the queued pairs of components, and adds them to their scene object diffs. 
+		 * Differences that are already present in the cache are reused.
+		 */
+		static void generateComponentDiffs(Vector<ComponentDiffJob>& jobs, ComponentDiffCache& cache);
+
+		/** Adds all component differences from the provided diff hierarchy to the cache. */
+		static void addToCache(const SPtr<PrefabObjectDiff>& diff, ComponentDiffCache& cache);
+
+		/** 
+		 * Removes all scene object diffs that contain no differences from the hierarchy. Returns null if the provided diff
+		 * itself contains no differences.
+		 */
+		static SPtr<PrefabObjectDiff> removeEmptyDiffs(const SPtr<PrefabObjectDiff>& diff);
 
 		/**
 		 * Recursively applies a per-object set of prefab differences to a specific object.
@@ -201,6 +201,14 @@ namespace BansheeEngine
 		 */
 		virtual const String& getShadingLanguageName() const = 0;
 
+		/**
+		 * Returns the names of the render APIs whose techniques this render API can run. By default only techniques
+		 * written for this render API are accepted.
+		 *
+		 * @note	Thread safe.
+		 */
+		virtual Vector<StringID> getTechniqueRenderAPIs() const;
+
 		/**
 		 * Applies a set of parameters that control execution of all currently bound GPU programs. These are the uniforms
 		 * like textures, samplers, or uniform buffers. Caller is expected to ensure the provided parameters actually
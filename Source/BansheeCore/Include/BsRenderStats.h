@@ -29,7 +29,7 @@ namespace BansheeEngine
 		RenderStatsData()
 		: numDrawCalls(0), numComputeCalls(0), numRenderTargetChanges(0), numPresents(0), numClears(0)
 		, numVertices(0), numPrimitives(0), numPipelineStateChanges(0), numGpuParamBinds(0), numVertexBufferBinds(0)
-		, numIndexBufferBinds(0)
+		, numIndexBufferBinds(0), numVisibleObjects(0), numCulledObjects(0)
 		{ }
 
 		UINT64 numDrawCalls;
@@ -52,6 +52,9 @@ namespace BansheeEngine
 
 		UINT64 numObjectsCreated; 
 		UINT64 numObjectsDestroyed;
+
+		UINT64 numVisibleObjects;
+		UINT64 numCulledObjects;
 	};
 
 	/**
@@ -98,6 +101,12 @@ namespace BansheeEngine
 		/** Increments index buffer change counter indicating how many times was a index buffer bound to the pipeline. */
 		void incNumIndexBufferBinds() { mData.numIndexBufferBinds++; }
 
+		/** Increments visible object counter indicating how many renderable objects passed visibility tests. */
+		void addNumVisibleObjects(UINT32 count) { mData.numVisibleObjects += count; }
+
+		/** Increments culled object counter indicating how many renderable objects failed visibility tests. */
+		void addNumCulledObjects(UINT32 count) { mData.numCulledObjects += count; }
+
 		/**
 		 * Increments created GPU resource counter. 
 		 *
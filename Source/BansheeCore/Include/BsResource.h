@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsIReflectable.h"
 #include "BsCoreObject.h"
+#include "BsCompression.h"
 
 namespace BansheeEngine
 {
@@ -12,6 +13,16 @@ namespace BansheeEngine
 	 *  @{
 	 */
 
+	/** Categories of memory used by resources, used for tracking how much memory loaded resources occupy. */
+	enum class ResourceMemoryType
+	{
+		Texture, /**< Texture pixels. */
+		Mesh, /**< Mesh vertices and indices. */
+		Audio, /**< Audio samples. */
+		Other, /**< Memory used by all other resource types. */
+		Count // Keep at end
+	};
+
 	/**	Base class for all resources. */
 	class BS_CORE_EXPORT Resource : public IReflectable, public CoreObject
 	{
@@ -31,6 +42,24 @@ namespace BansheeEngine
 		/**	Returns whether or not this resource is allowed to be asynchronously loaded. */
 		virtual bool allowAsyncLoading() const { return true; }
 
+		/**
+		 * Sets the compression to apply to the bulk data of the resource (for example texture pixels or mesh vertices)
+		 * when it is saved. Resources without bulk data ignore this setting.
+		 */
+		void setDataCompression(CompressionType compression) { mDataCompression = compression; }
+
+		/** Returns the compression to apply to the bulk data of the resource when it is saved. */
+		CompressionType getDataCompression() const { return mDataCompression; }
+
+		/** 
+		 * Returns an estimate of the memory occupied by the bulk data of the resource (for example texture pixels or mesh
+		 * vertices), in bytes. Includes memory on the GPU. Used by Resources for enforcing the residency budget.
+		 */
+		virtual UINT64 getMemorySize() const { return 0; }
+
+		/** Returns the category the memory reported by getMemorySize() belongs to. */
+		virtual ResourceMemoryType getMemoryType() const { return ResourceMemoryType::Other; }
+
 	protected:
 		friend class Resources;
 		friend class ResourceHandleBase;
@@ -43,6 +72,7 @@ namespace BansheeEngine
 
 		UINT32 mSize;
 		SPtr<ResourceMetaData> mMetaData;
+		CompressionType mDataCompression;
 
 		/** 
 		 * Signal to the resource implementation if original data should be kept in memory. This is sometimes needed if
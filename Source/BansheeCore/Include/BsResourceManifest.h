@@ -12,7 +12,8 @@ namespace BansheeEngine
 	 */
 
 	/**
-	 * Serializable class that contains UUID <-> file path mapping for resources.
+	 * Serializable class that contains UUID <-> file path mapping for resources. Optionally also contains a table of
+	 * resource dependencies, allowing dependencies to be found without opening the resource files.
 	 * 			
 	 * @note	
 	 * This class allows you to reference resources between sessions. At the end of a session save the resource manifest, 
@@ -34,9 +35,24 @@ namespace BansheeEngine
 		/**	Registers a new resource in the manifest. */
 		void registerResource(const String& uuid, const Path& filePath);
 
-		/**	Removes a resource from the manifest. */
+		/**	Removes a resource from the manifest, including its dependencies if registered. */
 		void unregisterResource(const String& uuid);
 
+		/** 
+		 * Registers a list of resources the resource with the provided UUID depends on, replacing any previously registered
+		 * list.
+		 */
+		void registerDependencies(const String& uuid, const Vector<String>& dependencies);
+
+		/**
+		 * Attempts to find dependencies registered with registerDependencies() for the resource with the provided UUID.
+		 * Returns true if the dependencies were found, false otherwise.
+		 */
+		bool getDependencies(const String& uuid, Vector<String>& dependencies) const;
+
+		/** Returns UUIDs of all resources registered in the manifest. */
+		Vector<String> getUUIDs() const;
+
 		/**
 		 * Attempts to find a resource with the provided UUID and outputs the path to the resource if found. Returns true
 		 * if UUID was found, false otherwise.
@@ -80,6 +96,7 @@ namespace BansheeEngine
 		String mName;
 		UnorderedMap<String, Path> mUUIDToFilePath;
 		UnorderedMap<Path, String> mFilePathToUUID;
+		UnorderedMap<String, Vector<String>> mDependencies;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
@@ -23,11 +23,15 @@ namespace BansheeEngine
 		SPtr<ResourceMetaData> getMetaData(Resource* obj) { return obj->mMetaData; }
 		void setMetaData(Resource* obj, SPtr<ResourceMetaData> value) { obj->mMetaData = value; }
 
+		CompressionType& getDataCompression(Resource* obj) { return obj->mDataCompression; }
+		void setDataCompression(Resource* obj, CompressionType& value) { obj->mDataCompression = value; }
+
 	public:
 		ResourceRTTI()
 		{
 			addPlainField("mSize", 0, &ResourceRTTI::getSize, &ResourceRTTI::setSize);
 			addReflectablePtrField("mMetaData", 1, &ResourceRTTI::getMetaData, &ResourceRTTI::setMetaData);
+			addPlainField("mDataCompression", 2, &ResourceRTTI::getDataCompression, &ResourceRTTI::setDataCompression);
 		}
 
 		void onDeserializationStarted(IReflectable* obj, const UnorderedMap<bool, UINT64>& params)
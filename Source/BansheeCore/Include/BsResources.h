@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "BsModule.h"
+#include "BsResource.h"
 
 namespace BansheeEngine
 {
@@ -32,6 +33,13 @@ namespace BansheeEngine
 		 * use up extra memory. Normally you want to keep this enabled if you plan on saving the resource to disk.
 		 */
 		KeepSourceData = 1 << 2,
+		/**
+		 * If enabled the resource file will be mapped into memory instead of being read, and large data blocks (e.g.
+		 * texture pixels or mesh vertices) will reference the mapped file directly instead of being copied. Resource files
+		 * must not be modified while any such resource is loaded. Ignored if KeepSourceData is set, as such resources are
+		 * expected to be saved.
+		 */
+		MapFile = 1 << 3,
 		/** Default set of flags used for resource loading. */
 		Default = LoadDependencies | KeepInternalRef
 	};
@@ -39,6 +47,76 @@ namespace BansheeEngine
 	typedef Flags<ResourceLoadFlag> ResourceLoadFlags;
 	BS_FLAGS_OPERATORS(ResourceLoadFlag);
 
+	/** Limits on the amount of work each stage of Resources::loadBatch() is allowed to have in progress at once. */
+	struct BS_CORE_EXPORT ResourceBatchLoadLimits
+	{
+		ResourceBatchLoadLimits()
+			:maxReads(4), maxBufferedBytes(256 * 1024 * 1024), maxDecompressions(BS_THREAD_HARDWARE_CONCURRENCY)
+			, maxDeserializations(BS_THREAD_HARDWARE_CONCURRENCY), maxPendingUploads(64)
+		{ }
+
+		/** Maximum number of resource files being read at once. */
+		UINT32 maxReads;
+
+		/** 
+		 * Maximum number of bytes read from resource files whose resources haven't been deserialized yet. New reads are
+		 * not started while the limit is exceeded.
+		 */
+		UINT64 maxBufferedBytes;
+
+		/** Maximum number of resources whose data, compressed in a resource package, is being decompressed at once. */
+		UINT32 maxDecompressions;
+
+		/** Maximum number of resources being deserialized at once. */
+		UINT32 maxDeserializations;
+
+		/**
+		 * Maximum number of deserialized resources waiting for the core thread to initialize them. New deserializations
+		 * are not started while the limit is reached.
+		 */
+		UINT32 maxPendingUploads;
+	};
+
+	/** 
+	 * Information about a batch of resources loaded through Resources::loadBatch(). Stage times are summed over all the
+	 * resources in the batch, in microseconds. Since stages of different resources run in parallel, their sum can be
+	 * larger than the total time.
+	 */
+	struct BS_CORE_EXPORT ResourceBatchLoadStats
+	{
+		ResourceBatchLoadStats()
+			:numResources(0), numDiscoveredDependencies(0), numBytesRead(0), resolveTime(0), readTime(0)
+			, decompressTime(0), deserializeTime(0), uploadTime(0), totalTime(0)
+		{ }
+
+		/** Number of resources read and deserialized by the batch. Doesn't include already loaded resources. */
+		UINT32 numResources;
+
+		/** Number of dependencies missing from the dependency tables, found in the resource files instead. */
+		UINT32 numDiscoveredDependencies;
+
+		/** Total size of all resource files read by the batch, in bytes. Compressed data is counted before decompression. */
+		UINT64 numBytesRead;
+
+		/** Time spent looking up file paths and dependencies of the requested resources. */
+		UINT64 resolveTime;
+
+		/** Time spent reading resource files. */
+		UINT64 readTime;
+
+		/** Time spent decompressing data of resources stored compressed in resource packages. */
+		UINT64 decompressTime;
+
+		/** Time spent deserializing resources from the read data. */
+		UINT64 deserializeTime;
+
+		/** Time between resource deserialization and the core thread finishing the resource's initialization. */
+		UINT64 uploadTime;
+
+		/** Time from the start to the end of the batch. */
+		UINT64 totalTime;
+	};
+
 	/**
 	 * Manager for dealing with all engine resources. It allows you to save new resources and load existing ones.
 	 *
@@ -50,15 +128,19 @@ namespace BansheeEngine
 		struct LoadedResourceData
 		{
 			LoadedResourceData()
-				:numInternalRefs(0)
+				:numInternalRefs(0), memorySize(0), memoryType(ResourceMemoryType::Other), lastUse(0)
 			{ }
 
 			LoadedResourceData(const WeakResourceHandle<Resource>& resource)
-				:resource(resource), numInternalRefs(0)
+				:resource(resource), numInternalRefs(0), memorySize(0), memoryType(ResourceMemoryType::Other), lastUse(0)
 			{ }
 
 			WeakResourceHandle<Resource> resource;
 			UINT32 numInternalRefs;
+
+			UINT64 memorySize; /**< Memory the resource was accounted for in the resident byte counts. */
+			ResourceMemoryType memoryType;
+			UINT64 lastUse; /**< Key of the resource in the usage order. Zero if not in the usage order. */
 		};
 
 		/** Information about a resource that's currently being loaded. */
@@ -75,6 +157,9 @@ namespace BansheeEngine
 			bool notifyImmediately;
 		};
 
+		struct BatchLoadEntry;
+		struct BatchLoadState;
+
 	public:
 		Resources();
 		~Resources();
@@ -149,6 +234,44 @@ namespace BansheeEngine
 		 */
 		HResource loadFromUUID(const String& uuid, bool async = false, ResourceLoadFlags loadFlags = ResourceLoadFlag::Default);
 
+		/**
+		 * Loads a set of resources with the provided UUIDs, and blocks until they are all loaded.
+		 *
+		 * Dependencies of the resources are retrieved from the dependency tables of registered resource manifests (see
+		 * ResourceManifest::registerDependencies), so loading of all resources can start right away instead of waiting
+		 * for their parents to be read. Dependencies missing from the tables are found in the resource files as they are
+		 * read.
+		 *
+		 * Loading is split into stages (reading of resource files, deserialization and waiting for the core thread to 
+		 * initialize the resources), with different resources going through each stage at the same time. Amount of work in
+		 * progress in each stage is bounded as set by setBatchLoadLimits().
+		 *
+		 * @param[in]	uuids		UUIDs of the resources to load.
+		 * @param[in]	loadFlags	Flags used to control the load process.
+		 * @param[out]	stats		Optional output for information about the time spent in each stage of the load.
+		 * @return					Handles to the loaded resources, in the same order as @p uuids. Handles of resources
+		 *							that couldn't be loaded remain unloaded.
+		 *
+		 * @see		load(const Path&, ResourceLoadFlags)
+		 */
+		Vector<HResource> loadBatch(const Vector<String>& uuids, ResourceLoadFlags loadFlags = ResourceLoadFlag::Default,
+			ResourceBatchLoadStats* stats = nullptr);
+
+		/**
+		 * Loads all resources contained in the provided manifest, and blocks until they are all loaded. File paths and
+		 * dependencies found in the manifest take priority over the ones in registered manifests. 
+		 *
+		 * @see		loadBatch(const Vector<String>&, ResourceLoadFlags, ResourceBatchLoadStats*)
+		 */
+		Vector<HResource> loadBatch(const SPtr<ResourceManifest>& manifest, 
+			ResourceLoadFlags loadFlags = ResourceLoadFlag::Default, ResourceBatchLoadStats* stats = nullptr);
+
+		/** Sets limits on the amount of work in progress in each stage of loadBatch(). */
+		void setBatchLoadLimits(const ResourceBatchLoadLimits& limits) { mBatchLoadLimits = limits; }
+
+		/** Returns limits on the amount of work in progress in each stage of loadBatch(). */
+		const ResourceBatchLoadLimits& getBatchLoadLimits() const { return mBatchLoadLimits; }
+
 		/**
 		 * Releases an internal reference to the resource held by the resources system. This allows the resource to be 
 		 * unloaded when it goes out of scope, if the resource was loaded with @p keepInternalReference parameter.
@@ -168,6 +291,27 @@ namespace BansheeEngine
 		 */
 		void unloadAllUnused();
 
+		/**
+		 * Sets the maximum amount of memory loaded resources are allowed to occupy. Once exceeded, resources that are only
+		 * referenced by the resources system (through internal references) are unloaded, least recently used first, until
+		 * memory usage fits in the budget again. Resources are considered used when loaded, or when released.
+		 *
+		 * @param[in]	numBytes	Maximum number of bytes loaded resources may occupy, as reported by 
+		 *							Resource::getMemorySize(). Zero means there is no limit.
+		 *
+		 * @note	Budget is checked once per frame, and when it is set.
+		 */
+		void setResidencyBudget(UINT64 numBytes);
+
+		/** Returns the maximum amount of memory loaded resources are allowed to occupy. Zero if unlimited. */
+		UINT64 getResidencyBudget() const { return mResidencyBudget; }
+
+		/** Returns the number of bytes occupied by loaded resources of the specified type. */
+		UINT64 getResidentBytes(ResourceMemoryType type) const { return mResidentBytes[(UINT32)type]; }
+
+		/** Returns the number of bytes occupied by all loaded resources. */
+		UINT64 getResidentBytes() const;
+
 		/**
 		 * Saves the resource at the specified location.
 		 *
@@ -248,6 +392,16 @@ namespace BansheeEngine
 		 */
 		SPtr<ResourceManifest> getResourceManifest(const String& name) const;
 
+		/**
+		 * Registers a package containing data of multiple resources. Resources contained in a registered package are 
+		 * loaded from the package instead of from their individual files, regardless of the paths in resource manifests.
+		 * If multiple packages contain the same resource, the most recently registered one is used.
+		 */
+		void registerResourcePackage(const SPtr<ResourcePackage>& package);
+
+		/**	Unregisters a resource package previously registered with registerResourcePackage(). */
+		void unregisterResourcePackage(const SPtr<ResourcePackage>& package);
+
 		/** Attempts to retrieve file path from the provided UUID. Returns true if successful, false otherwise. */
 		bool getFilePathFromUUID(const String& uuid, Path& filePath) const;
 
@@ -299,6 +453,9 @@ namespace BansheeEngine
 		/** Returns an existing handle for the specified UUID if one exists, or creates a new one. */
 		HResource _getResourceHandle(const String& uuid);
 
+		/** Unloads least recently used resources if the residency budget is exceeded. Called once per frame. */
+		void _update();
+
 		/** @} */
 	private:
 		friend class ResourceHandleBase;
@@ -311,20 +468,109 @@ namespace BansheeEngine
 		HResource loadInternal(const String& UUID, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags);
 
 		/** Performs actually reading and deserializing of the resource file. Called from various worker threads. */
-		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData);
+		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData, bool mapFile);
+
+		/** 
+		 * Deserializes a resource using a decoder positioned after the saved resource data. Called from various worker
+		 * threads.
+		 */
+		SPtr<Resource> deserialize(FileDecoder& decoder, const Path& filePath, bool loadWithSaveData);
 
 		/**	Triggered when individual resource has finished loading. */
 		void loadComplete(HResource& resource);
 
-		/**	Callback triggered when the task manager is ready to process the loading task. */
-		void loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData);
+		/**	
+		 * Callback triggered when the task manager is ready to process the loading task. If @p packageData is provided
+		 * the resource is deserialized from it, instead of from the file at @p filePath. Package data must be positioned
+		 * after the saved resource data.
+		 */
+		void loadCallback(const Path& filePath, const SPtr<DataStream>& packageData, HResource& resource, 
+			bool loadWithSaveData, bool mapFile);
+
+		/** Returns the registered package containing the resource with the specified UUID, or null if there is none. */
+		SPtr<ResourcePackage> findResourcePackage(const String& uuid) const;
+
+		/** 
+		 * Assigns deserialized data to a resource that is being loaded, and completes the load if the resource isn't 
+		 * waiting on any dependencies.
+		 */
+		void setLoadedData(HResource& resource, const SPtr<Resource>& loadedData);
+
+		/** @copydoc loadBatch(const Vector<String>&, ResourceLoadFlags, ResourceBatchLoadStats*) */
+		Vector<HResource> loadBatchInternal(const Vector<String>& uuids, const SPtr<ResourceManifest>& manifest, 
+			ResourceLoadFlags loadFlags, ResourceBatchLoadStats* stats);
+
+		/**
+		 * Adds resources to a batch being loaded by loadBatch(), along with all of their dependencies found in dependency
+		 * tables. Resources that aren't already loaded or in progress are registered as in progress.
+		 */
+		void addBatchEntries(BatchLoadState& state, const Vector<String>& uuids, bool isRoot);
+
+		/** 
+		 * Makes the load of a batch entry wait until the loads of the provided dependencies complete. Dependencies must 
+		 * already be a part of the batch, and mInProgressResourcesMutex must be locked.
+		 */
+		void waitForBatchDependencies(BatchLoadState& state, BatchLoadEntry* entry, const Vector<String>& dependencies);
+
+		/** Reads the resource file of a batch entry into memory. Called from worker threads. */
+		void readBatchEntry(BatchLoadState& state, BatchLoadEntry* entry);
+
+		/** 
+		 * Decodes the saved resource data of a batch entry from the contents of its resource file. Called from worker 
+		 * threads.
+		 *
+		 * @param[in]	entry		Entry whose file was read.
+		 * @param[in]	stream		Contents of the resource file, or null if it couldn't be read.
+		 */
+		void decodeBatchEntry(BatchLoadEntry* entry, const SPtr<DataStream>& stream);
+
+		/** 
+		 * Notifies the batch that the read of a batch entry finished, so it can be queued for the next stage. Called from 
+		 * worker threads.
+		 *
+		 * @param[in]	state		Batch the entry belongs to.
+		 * @param[in]	entry		Entry whose file was read.
+		 * @param[in]	startTime	Time at which the read started, as reported by the batch timer.
+		 */
+		void completeBatchRead(BatchLoadState& state, BatchLoadEntry* entry, UINT64 startTime);
+
+		/** 
+		 * Decompresses the read data of a batch entry stored compressed in a resource package, and decodes it. Called from
+		 * worker threads.
+		 */
+		void decompressBatchEntry(BatchLoadState& state, BatchLoadEntry* entry);
+
+		/** Deserializes a resource of a batch entry from its read data. Called from worker threads. */
+		void deserializeBatchEntry(BatchLoadState& state, BatchLoadEntry* entry);
+
+		/** 
+		 * Notifies the batch that the core thread finished initializing the resource of a batch entry. Called from the 
+		 * core thread.
+		 */
+		void completeBatchUpload(BatchLoadState& state, BatchLoadEntry* entry);
 
 		/**	Destroys a resource, freeing its memory. */
 		void destroy(ResourceHandleBase& resource);
 
+		/** 
+		 * Accounts for the memory used by a loaded resource in the resident byte counts, and marks it as the most 
+		 * recently used. mLoadedResourceMutex must be locked.
+		 */
+		void addResidency(const String& uuid, LoadedResourceData& resData, const SPtr<Resource>& resource);
+
+		/** Removes a loaded resource from the resident byte counts and usage order. mLoadedResourceMutex must be locked. */
+		void removeResidency(LoadedResourceData& resData);
+
+		/** Marks a loaded resource as the most recently used. mLoadedResourceMutex must be locked. */
+		void markUsed(const String& uuid, LoadedResourceData& resData);
+
+		/** Unloads unreferenced resources, least recently used first, until the residency budget is met. */
+		void enforceResidencyBudget();
+
 	private:
 		Vector<SPtr<ResourceManifest>> mResourceManifests;
 		SPtr<ResourceManifest> mDefaultResourceManifest;
+		Vector<SPtr<ResourcePackage>> mResourcePackages;
 
 		Mutex mInProgressResourcesMutex;
 		Mutex mLoadedResourceMutex;
@@ -333,6 +579,13 @@ namespace BansheeEngine
 		UnorderedMap<String, LoadedResourceData> mLoadedResources;
 		UnorderedMap<String, ResourceLoadData*> mInProgressResources; // Resources that are being asynchronously loaded
 		UnorderedMap<String, Vector<ResourceLoadData*>> mDependantLoads; // Allows dependency to be notified when a dependant is loaded
+
+		ResourceBatchLoadLimits mBatchLoadLimits;
+
+		UINT64 mResidencyBudget;
+		std::atomic<UINT64> mResidentBytes[(UINT32)ResourceMemoryType::Count];
+		Map<UINT64, String> mUsageOrder; // Loaded resources ordered from least to most recently used
+		UINT64 mNextUse;
 	};
 
 	/** Provides easier access to Resources manager. */
@@ -228,6 +228,12 @@ namespace BansheeEngine
 		/**	Retrieves a core implementation of a texture usable only from the core thread. */
 		SPtr<TextureCore> getCore() const;
 
+		/** @copydoc Resource::getMemorySize */
+		UINT64 getMemorySize() const override;
+
+		/** @copydoc Resource::getMemoryType */
+		ResourceMemoryType getMemoryType() const override { return ResourceMemoryType::Texture; }
+
 		/************************************************************************/
 		/* 								STATICS		                     		*/
 		/************************************************************************/
@@ -39,6 +39,9 @@ namespace BansheeEngine
 		 */
 		void setSRGB(bool sRGB) { mSRGB = sRGB; }
 
+		/** Sets the compression to apply to the pixel data when the imported texture is saved. */
+		void setDataCompression(CompressionType compression) { mDataCompression = compression; }
+
 		/** Gets the pixel format to import as. */
 		PixelFormat getFormat() const { return mFormat; }
 
@@ -60,6 +63,9 @@ namespace BansheeEngine
 		 */
 		bool getSRGB() const { return mSRGB; }
 
+		/** Returns the compression to apply to the pixel data when the imported texture is saved. */
+		CompressionType getDataCompression() const { return mDataCompression; }
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -74,6 +80,7 @@ namespace BansheeEngine
 		UINT32 mMaxMip;
 		bool mCPUReadable;
 		bool mSRGB;
+		CompressionType mDataCompression;
 	};
 
 	/** @} */
@@ -31,6 +31,9 @@ namespace BansheeEngine
 		bool& getSRGB(TextureImportOptions* obj) { return obj->mSRGB; }
 		void setSRGB(TextureImportOptions* obj, bool& value) { obj->mSRGB = value; }
 
+		CompressionType& getDataCompression(TextureImportOptions* obj) { return obj->mDataCompression; }
+		void setDataCompression(TextureImportOptions* obj, CompressionType& value) { obj->mDataCompression = value; }
+
 	public:
 		TextureImportOptionsRTTI()
 		{
@@ -39,6 +42,8 @@ namespace BansheeEngine
 			addPlainField("mMaxMip", 2, &TextureImportOptionsRTTI::getMaxMip, &TextureImportOptionsRTTI::setMaxMip);
 			addPlainField("mCPUReadable", 3, &TextureImportOptionsRTTI::getCPUReadable, &TextureImportOptionsRTTI::setCPUReadable);
 			addPlainField("mSRGB", 4, &TextureImportOptionsRTTI::getSRGB, &TextureImportOptionsRTTI::setSRGB);
+			addPlainField("mDataCompression", 5, &TextureImportOptionsRTTI::getDataCompression, 
+				&TextureImportOptionsRTTI::setDataCompression);
 		}
 
 		const String& getRTTIName() override
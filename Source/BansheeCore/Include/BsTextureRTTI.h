@@ -58,6 +58,7 @@ namespace BansheeEngine
 			obj->readSubresource(gCoreAccessor(), subresourceIdx, pixelData);
 			gCoreAccessor().submitToCoreThread(true);
 
+			pixelData->setCompression(obj->getDataCompression());
 			return pixelData;
 		}
 
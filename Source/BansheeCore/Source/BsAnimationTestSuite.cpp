@@ -0,0 +1,173 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsAnimationTestSuite.h"
+
+#include "BsAnimation.h"
+#include "BsAnimationClip.h"
+#include "BsAnimationManager.h"
+#include "BsSkeleton.h"
+#include "BsTaskScheduler.h"
+#include "BsTime.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** A set of characters sharing the same skeleton, all playing the same animation clip. */
+	struct AnimationTestCharacters
+	{
+		AnimationTestCharacters(UINT32 numCharacters, UINT32 numBones)
+		{
+			Vector<BONE_DESC> bones(numBones);
+			SPtr<AnimationCurves> curves = bs_shared_ptr_new<AnimationCurves>();
+
+			Quaternion endRotation(Vector3::UNIT_Y, Degree(90.0f));
+			for (UINT32 i = 0; i < numBones; i++)
+			{
+				bones[i].name = "Bone" + toString(i);
+				bones[i].parent = i == 0 ? (UINT32)-1 : (i - 1) / 2;
+				bones[i].invBindPose = Matrix4::IDENTITY;
+
+				Vector<TKeyframe<Quaternion>> rotationKeys =
+				{
+					{ Quaternion::IDENTITY, Quaternion::ZERO, Quaternion::ZERO, 0.0f },
+					{ endRotation, Quaternion::ZERO, Quaternion::ZERO, 1.0f }
+				};
+
+				Vector<TKeyframe<Vector3>> positionKeys =
+				{
+					{ Vector3::ZERO, Vector3::ZERO, Vector3::ZERO, 0.0f },
+					{ Vector3::UNIT_Y, Vector3::ZERO, Vector3::ZERO, 1.0f }
+				};
+
+				curves->addRotationCurve(bones[i].name, TAnimationCurve<Quaternion>(rotationKeys));
+				curves->addPositionCurve(bones[i].name, TAnimationCurve<Vector3>(positionKeys));
+			}
+
+			skeleton = Skeleton::create(bones.data(), numBones);
+			clip = AnimationClip::create(curves);
+
+			for (UINT32 i = 0; i < numCharacters; i++)
+			{
+				SPtr<Animation> animation = Animation::create();
+				animation->setSkeleton(skeleton);
+				animation->setCulling(false);
+				animation->play(clip);
+
+				animations.push_back(animation);
+			}
+		}
+
+		SPtr<Skeleton> skeleton;
+		HAnimationClip clip;
+		Vector<SPtr<Animation>> animations;
+	};
+
+	/**
+	 * Evaluates all animations for a single frame and waits until the results are available, in the same way the core
+	 * thread would.
+	 */
+	void evaluateAnimationFrame()
+	{
+		gTime()._update();
+
+		gAnimation().postUpdate();
+		gAnimation().waitUntilComplete();
+	}
+
+	/** Adds or removes workers from the global task scheduler until it has the specified number of workers. */
+	void setNumTaskWorkers(UINT32 numWorkers)
+	{
+		TaskScheduler& scheduler = TaskScheduler::instance();
+
+		while (scheduler.getNumWorkers() < numWorkers)
+			scheduler.addWorker();
+
+		while (scheduler.getNumWorkers() > numWorkers)
+			scheduler.removeWorker();
+	}
+
+	AnimationTestSuite::AnimationTestSuite()
+	{
+		BS_ADD_TEST(AnimationTestSuite::testEvaluate);
+		BS_ADD_TEST(AnimationTestSuite::testEvaluate_benchmark);
+	}
+
+	void AnimationTestSuite::testEvaluate()
+	{
+		const UINT32 NUM_CHARACTERS = 64;
+		const UINT32 NUM_BONES = 16;
+
+		AnimationTestCharacters characters(NUM_CHARACTERS, NUM_BONES);
+
+		// Evaluate every frame, so all characters are always in the same pose
+		gAnimation().setUpdateRate(1000000);
+		evaluateAnimationFrame();
+		evaluateAnimationFrame();
+
+		const RendererAnimationData& renderData = gAnimation().getRendererData();
+		BS_TEST_ASSERT(renderData.infos.size() == NUM_CHARACTERS);
+		BS_TEST_ASSERT(renderData.transforms.size() == NUM_CHARACTERS * NUM_BONES);
+
+		const Matrix4* firstPose = nullptr;
+		for (auto& animation : characters.animations)
+		{
+			auto iterFind = renderData.infos.find(animation->_getId());
+			BS_TEST_ASSERT(iterFind != renderData.infos.end());
+			if (iterFind == renderData.infos.end())
+				continue;
+
+			// Every character must have written its pose into its own range of the transform buffer
+			const RendererAnimationData::PoseInfo& poseInfo = iterFind->second.poseInfo;
+			BS_TEST_ASSERT(poseInfo.numBones == NUM_BONES);
+			BS_TEST_ASSERT(poseInfo.startIdx + poseInfo.numBones <= renderData.transforms.size());
+
+			const Matrix4* pose = renderData.transforms.data() + poseInfo.startIdx;
+			if (firstPose == nullptr)
+				firstPose = pose;
+			else
+				BS_TEST_ASSERT(firstPose != pose);
+
+			bool posesMatch = true;
+			for (UINT32 i = 0; i < NUM_BONES; i++)
+				posesMatch &= pose[i] == firstPose[i];
+
+			BS_TEST_ASSERT(posesMatch);
+		}
+
+		gAnimation().setUpdateRate(60);
+	}
+
+	void AnimationTestSuite::testEvaluate_benchmark()
+	{
+		const UINT32 NUM_CHARACTERS = 256;
+		const UINT32 NUM_BONES = 64;
+		const UINT32 NUM_FRAMES = 50;
+
+		AnimationTestCharacters characters(NUM_CHARACTERS, NUM_BONES);
+		gAnimation().setUpdateRate(1000000);
+
+		UINT32 originalNumWorkers = TaskScheduler::instance().getNumWorkers();
+		UINT32 maxNumWorkers = std::max(BS_THREAD_HARDWARE_CONCURRENCY, 4U);
+		for (UINT32 numWorkers = 1; numWorkers <= maxNumWorkers; numWorkers *= 2)
+		{
+			setNumTaskWorkers(numWorkers);
+			evaluateAnimationFrame();
+
+			Timer timer;
+			UINT64 startTime = timer.getMicroseconds();
+
+			for (UINT32 i = 0; i < NUM_FRAMES; i++)
+				evaluateAnimationFrame();
+
+			UINT64 time = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+			float charactersPerMs = (NUM_CHARACTERS * NUM_FRAMES * 1000.0f) / time;
+
+			LOGDBG("Evaluating " + toString(NUM_CHARACTERS) + " characters with " + toString(NUM_BONES) + " bones on " +
+				toString(numWorkers) + " workers: " + toString(charactersPerMs) + " characters/ms");
+		}
+
+		setNumTaskWorkers(originalNumWorkers);
+		gAnimation().setUpdateRate(60);
+	}
+}
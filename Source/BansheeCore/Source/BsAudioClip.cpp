@@ -24,6 +24,19 @@ namespace BansheeEngine
 		Resource::initialize();
 	}
 
+	UINT64 AudioClip::getMemorySize() const
+	{
+		switch(mDesc.readMode)
+		{
+		case AudioReadMode::LoadDecompressed:
+			return (UINT64)mNumSamples * (mDesc.bitDepth / 8);
+		case AudioReadMode::LoadCompressed:
+			return mStreamSize;
+		default: // Streamed clips only keep small buffers in memory
+			return 0;
+		}
+	}
+
 	HAudioClip AudioClip::create(const SPtr<DataStream>& samples, UINT32 streamSize, UINT32 numSamples, const AUDIO_CLIP_DESC& desc)
 	{
 		return static_resource_cast<AudioClip>(gResources()._createResourceHandle(_createPtr(samples, streamSize, numSamples, desc)));
@@ -38,6 +38,7 @@
 #include "BsQueryManager.h"
 #include "BsThreadPool.h"
 #include "BsTaskScheduler.h"
+#include "BsAsyncIO.h"
 #include "BsRenderStats.h"
 #include "BsMessageHandler.h"
 #include "BsResourceListenerManager.h"
@@ -104,6 +105,7 @@ namespace BansheeEngine
 
 		CoreThread::shutDown();
 		RenderStats::shutDown();
+		AsyncIO::shutDown();
 		TaskScheduler::shutDown();
 		ThreadPool::shutDown();
 		ProfilingManager::shutDown();
@@ -127,8 +129,9 @@ namespace BansheeEngine
 		ProfilerCPU::startUp();
 		ProfilingManager::startUp();
 		ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>((numWorkerThreads));
-		TaskScheduler::startUp();
+		TaskScheduler::startUp(TaskSchedulerMode::WorkStealing);
 		TaskScheduler::instance().removeWorker();
+		AsyncIO::startUp(mStartUpDesc.numIOThreads);
 		RenderStats::startUp();
 		CoreThread::startUp();
 		StringTableManager::startUp();
@@ -234,6 +237,7 @@ namespace BansheeEngine
 
 			// Send out resource events in case any were loaded/destroyed/modified
 			ResourceListenerManager::instance().update();
+			gResources()._update();
 
 			gCoreSceneManager()._updateCoreObjectTransforms();
 			PROFILE_CALL(RendererManager::instance().getActive()->renderAll(), "Render");
@@ -86,6 +86,14 @@ namespace BansheeEngine
 			mCoreSpecific->synchronize();
 	}
 
+	bool CoreObject::isCoreInitialized() const
+	{
+		if (mCoreSpecific == nullptr)
+			return true;
+
+		return mCoreSpecific->isInitialized() || !mCoreSpecific->isScheduledToBeInitialized();
+	}
+
 	void CoreObject::syncToCore(CoreAccessor& accessor)
 	{
 		CoreObjectManager::instance().syncToCore(this, accessor);
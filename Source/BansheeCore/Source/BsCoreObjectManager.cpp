@@ -11,7 +11,7 @@
 namespace BansheeEngine
 {
 	CoreObjectManager::CoreObjectManager()
-		:mNextAvailableID(1)
+		:mNextAvailableID(1), mNumObjects(0)
 	{
 
 	} 
@@ -21,7 +21,7 @@ namespace BansheeEngine
 #if BS_DEBUG_MODE
 		Lock lock(mObjectsMutex);
 
-		if(mObjects.size() > 0)
+		if(mNumObjects > 0)
 		{
 			// All objects MUST be destroyed at this point, otherwise there might be memory corruption.
 			// (Reason: This is called on application shutdown and at that point we also unload any dynamic libraries, 
@@ -39,10 +39,30 @@ namespace BansheeEngine
 
 		Lock lock(mObjectsMutex);
 
-		mObjects[mNextAvailableID] = object;
-		mDirtyObjects[mNextAvailableID] = { object, -1 };
+		UINT32 slotIdx;
+		if (!mFreeSlots.empty())
+		{
+			slotIdx = mFreeSlots.back();
+			mFreeSlots.pop_back();
+		}
+		else
+		{
+			slotIdx = (UINT32)mSlots.size();
+			mSlots.push_back(ObjectSlot());
+		}
+
+		UINT64 internalId = (mNextAvailableID++ << 32) | slotIdx;
+
+		ObjectSlot& slot = mSlots[slotIdx];
+		slot.object = object;
+		slot.internalId = internalId;
 
-		return mNextAvailableID++;
+		DirtyObjectData& dirtyObjData = getDirtyEntry(slot);
+		dirtyObjData.object = object;
+		dirtyObjData.syncDataId = -1;
+
+		mNumObjects++;
+		return internalId;
 	}
 
 	void CoreObjectManager::unregisterObject(CoreObject* object)
@@ -54,7 +74,9 @@ namespace BansheeEngine
 		// If dirty, we generate sync data before it is destroyed
 		{
 			Lock lock(mObjectsMutex);
-			bool isDirty = object->isCoreDirty() || (mDirtyObjects.find(internalId) != mDirtyObjects.end());
+
+			ObjectSlot& slot = getSlot(internalId);
+			bool isDirty = object->isCoreDirty() || slot.dirtyIdx != INVALID_INDEX;
 
 			if (isDirty)
 			{
@@ -65,49 +87,45 @@ namespace BansheeEngine
 				
 					mDestroyedSyncData.push_back(CoreStoredSyncObjData(coreObject, internalId, objSyncData));
 
-					DirtyObjectData& dirtyObjData = mDirtyObjects[internalId];
+					DirtyObjectData& dirtyObjData = getDirtyEntry(slot);
 					dirtyObjData.syncDataId = (INT32)mDestroyedSyncData.size() - 1;
 					dirtyObjData.object = nullptr;
 				}
 				else
 				{
-					DirtyObjectData& dirtyObjData = mDirtyObjects[internalId];
+					DirtyObjectData& dirtyObjData = getDirtyEntry(slot);
 					dirtyObjData.syncDataId = -1;
 					dirtyObjData.object = nullptr;
 				}
 			}
-
-			mObjects.erase(internalId);
 		}
 
 		updateDependencies(object, nullptr);
 
-		// Clear dependencies from dependants
+		// Clear dependencies from dependants and release the slot
 		{
 			Lock lock(mObjectsMutex);
 
-			auto iterFind = mDependants.find(internalId);
-			if (iterFind != mDependants.end())
+			ObjectSlot& slot = getSlot(internalId);
+			for (auto& entry : slot.dependants)
 			{
-				Vector<CoreObject*>& dependants = iterFind->second;
-				for (auto& entry : dependants)
-				{
-					auto iterFind2 = mDependencies.find(entry->getInternalID());
-					if (iterFind2 != mDependencies.end())
-					{
-						Vector<CoreObject*>& dependencies = iterFind2->second;
-						auto iterFind3 = std::find(dependencies.begin(), dependencies.end(), object);
+				Vector<CoreObject*>& dependencies = getSlot(entry->getInternalID()).dependencies;
+				auto iterFind = std::find(dependencies.begin(), dependencies.end(), object);
 
-						if (iterFind3 != dependencies.end())
-							dependencies.erase(iterFind3);
+				if (iterFind != dependencies.end())
+					dependencies.erase(iterFind);
+			}
 
-						if (dependencies.size() == 0)
-							mDependencies.erase(iterFind2);
-					}
-				}
+			// Dirty entry (if any) stays in the dirty list so its sync data still gets applied, but it no longer 
+			// belongs to this slot
+			slot.object = nullptr;
+			slot.internalId = 0;
+			slot.dirtyIdx = INVALID_INDEX;
+			slot.dependencies.clear();
+			slot.dependants.clear();
 
-				mDependants.erase(iterFind);
-			}
+			mFreeSlots.push_back(getSlotIdx(internalId));
+			mNumObjects--;
 		}
 	}
 
@@ -117,7 +135,9 @@ namespace BansheeEngine
 
 		Lock lock(mObjectsMutex);
 
-		mDirtyObjects[id] = { object, -1 };
+		DirtyObjectData& dirtyObjData = getDirtyEntry(getSlot(id));
+		dirtyObjData.object = object;
+		dirtyObjData.syncDataId = -1;
 	}
 
 	void CoreObjectManager::notifyDependenciesDirty(CoreObject* object)
@@ -144,18 +164,18 @@ namespace BansheeEngine
 				if (dependencies != nullptr)
 					std::sort(dependencies->begin(), dependencies->end());
 
-				auto iterFind = mDependencies.find(id);
-				if (iterFind != mDependencies.end())
+				ObjectSlot& slot = getSlot(id);
+				if (!slot.dependencies.empty())
 				{
-					const Vector<CoreObject*>& oldDependencies = iterFind->second;
+					const Vector<CoreObject*>& oldDependencies = slot.dependencies;
 
 					if (dependencies != nullptr)
 					{
-						std::set_difference(dependencies->begin(), dependencies->end(),
-							dependencies->begin(), dependencies->end(), toRemove.begin());
-
 						std::set_difference(oldDependencies.begin(), oldDependencies.end(),
-							oldDependencies.begin(), oldDependencies.end(), toAdd.begin());
+							dependencies->begin(), dependencies->end(), std::back_inserter(toRemove));
+
+						std::set_difference(dependencies->begin(), dependencies->end(),
+							oldDependencies.begin(), oldDependencies.end(), std::back_inserter(toAdd));
 					}
 					else
 					{
@@ -165,18 +185,11 @@ namespace BansheeEngine
 
 					for (auto& dependency : toRemove)
 					{
-						UINT64 dependencyId = dependency->getInternalID();
-						auto iterFind2 = mDependants.find(dependencyId);
-
-						if (iterFind2 != mDependants.end())
-						{
-							Vector<CoreObject*>& dependants = iterFind2->second;
-							auto findIter3 = std::find(dependants.begin(), dependants.end(), object);
-							dependants.erase(findIter3);
-
-							if (dependants.size() == 0)
-								mDependants.erase(iterFind2);
-						}
+						Vector<CoreObject*>& dependants = getSlot(dependency->getInternalID()).dependants;
+						auto findIter = std::find(dependants.begin(), dependants.end(), object);
+
+						if (findIter != dependants.end())
+							dependants.erase(findIter);
 					}
 				}
 				else
@@ -189,15 +202,14 @@ namespace BansheeEngine
 				}
 
 				if (dependencies != nullptr)
-					mDependencies[id] = *dependencies;
+					slot.dependencies = *dependencies;
 			}
 
 			// Register dependants
 			{
 				for (auto& dependency : toAdd)
 				{
-					UINT64 dependencyId = dependency->getInternalID();
-					Vector<CoreObject*>& dependants = mDependants[dependencyId];
+					Vector<CoreObject*>& dependants = getSlot(dependency->getInternalID()).dependants;
 					dependants.push_back(object);
 				}
 			}
@@ -234,21 +246,15 @@ namespace BansheeEngine
 			// Note: I don't check for recursion. Possible infinite loop if two objects
 			// are dependent on one another.
 
-			UINT64 id = curObj->getInternalID();
-			auto iterFind = mDependencies.find(id);
-
-			if (iterFind != mDependencies.end())
-			{
-				const Vector<CoreObject*>& dependencies = iterFind->second;
-				for (auto& dependency : dependencies)
-					syncObject(dependency);
-			}
+			ObjectSlot& slot = getSlot(curObj->getInternalID());
+			for (auto& dependency : slot.dependencies)
+				syncObject(dependency);
 
 			SPtr<CoreObjectCore> objectCore = curObj->getCore();
 			if (objectCore == nullptr)
 			{
 				curObj->markCoreClean();
-				mDirtyObjects.erase(id);
+				removeDirtyEntry(slot);
 				return;
 			}
 
@@ -259,7 +265,7 @@ namespace BansheeEngine
 			data.syncData = curObj->syncToCore(allocator);
 
 			curObj->markCoreClean();
-			mDirtyObjects.erase(id);
+			removeDirtyEntry(slot);
 		};
 
 		syncObject(object);
@@ -294,81 +300,70 @@ namespace BansheeEngine
 		syncData.alloc = allocator;
 		
 		// Add all objects dependant on the dirty objects
-		bs_frame_mark();
+		UINT32 numDirtyObjects = (UINT32)mDirtyObjects.size();
+		for (UINT32 i = 0; i < numDirtyObjects; i++)
 		{
-			FrameSet<CoreObject*> dirtyDependants;
-			for (auto& objectData : mDirtyObjects)
-			{
-				auto iterFind = mDependants.find(objectData.first);
-				if (iterFind != mDependants.end())
-				{
-					const Vector<CoreObject*>& dependants = iterFind->second;
-					for (auto& dependant : dependants)
-					{
-						if (!dependant->isCoreDirty())
-						{
-							dependant->mCoreDirtyFlags |= 0xFFFFFFFF; // To ensure the loop below doesn't skip it
-							dirtyDependants.insert(dependant);
-						}
-					}
-				}
-			}
+			if (mDirtyObjects[i].object == nullptr)
+				continue;
 
-			for (auto& dirtyDependant : dirtyDependants)
+			const Vector<CoreObject*>& dependants = getSlot(mDirtyObjects[i].internalId).dependants;
+			for (auto& dependant : dependants)
 			{
-				UINT64 id = dirtyDependant->getInternalID();
+				if (!dependant->isCoreDirty())
+				{
+					dependant->mCoreDirtyFlags |= 0xFFFFFFFF; // To ensure the loop below doesn't skip it
 
-				mDirtyObjects[id] = { dirtyDependant, -1 };
+					DirtyObjectData& dirtyObjData = getDirtyEntry(getSlot(dependant->getInternalID()));
+					dirtyObjData.object = dependant;
+					dirtyObjData.syncDataId = -1;
+				}
 			}
 		}
 
-		bs_frame_clear();
-		
 		// Order in which objects are recursed in matters, ones with lower ID will have been created before
 		// ones with higher ones and should be updated first.
-		for (auto& objectData : mDirtyObjects)
-		{
-			std::function<void(CoreObject*)> syncObject = [&](CoreObject* curObj)
-			{
-				if (!curObj->isCoreDirty())
-					return; // We already processed it as some other object's dependency
+		std::sort(mDirtyObjects.begin(), mDirtyObjects.end(), 
+			[](const DirtyObjectData& lhs, const DirtyObjectData& rhs) { return lhs.internalId < rhs.internalId; });
 
-				// Sync dependencies before dependants
-				// Note: I don't check for recursion. Possible infinite loop if two objects
-				// are dependent on one another.
-				
-				UINT64 id = curObj->getInternalID();
-				auto iterFind = mDependencies.find(id);
-
-				if (iterFind != mDependencies.end())
-				{
-					const Vector<CoreObject*>& dependencies = iterFind->second;
-					for (auto& dependency : dependencies)
-						syncObject(dependency);
-				}
+		std::function<void(CoreObject*)> syncObject = [&](CoreObject* curObj)
+		{
+			if (!curObj->isCoreDirty())
+				return; // We already processed it as some other object's dependency
 
-				SPtr<CoreObjectCore> objectCore = curObj->getCore();
-				if (objectCore == nullptr)
-				{
-					curObj->markCoreClean();
-					return;
-				}
+			// Sync dependencies before dependants
+			// Note: I don't check for recursion. Possible infinite loop if two objects
+			// are dependent on one another.
+			const Vector<CoreObject*>& dependencies = getSlot(curObj->getInternalID()).dependencies;
+			for (auto& dependency : dependencies)
+				syncObject(dependency);
 
-				CoreSyncData objSyncData = curObj->syncToCore(allocator);
+			SPtr<CoreObjectCore> objectCore = curObj->getCore();
+			if (objectCore == nullptr)
+			{
 				curObj->markCoreClean();
+				return;
+			}
+
+			CoreSyncData objSyncData = curObj->syncToCore(allocator);
+			curObj->markCoreClean();
 
-				syncData.entries.push_back(CoreStoredSyncObjData(objectCore,
-					curObj->getInternalID(), objSyncData));
-			};
+			syncData.entries.push_back(CoreStoredSyncObjData(objectCore,
+				curObj->getInternalID(), objSyncData));
+		};
 
-			CoreObject* object = objectData.second.object;
+		for (auto& objectData : mDirtyObjects)
+		{
+			CoreObject* object = objectData.object;
 			if (object != nullptr)
+			{
 				syncObject(object);
+				getSlot(objectData.internalId).dirtyIdx = INVALID_INDEX;
+			}
 			else
 			{
 				// Object was destroyed but we still need to sync its modifications before it was destroyed
-				if (objectData.second.syncDataId != -1)
-					syncData.entries.push_back(mDestroyedSyncData[objectData.second.syncDataId]);
+				if (objectData.syncDataId != -1)
+					syncData.entries.push_back(mDestroyedSyncData[objectData.syncDataId]);
 			}
 		}
 
@@ -400,4 +395,43 @@ namespace BansheeEngine
 		syncData.entries.clear();
 		mCoreSyncData.pop_front();
 	}
+
+	CoreObjectManager::ObjectSlot& CoreObjectManager::getSlot(UINT64 internalId)
+	{
+		ObjectSlot& slot = mSlots[getSlotIdx(internalId)];
+		assert(slot.internalId == internalId);
+
+		return slot;
+	}
+
+	CoreObjectManager::DirtyObjectData& CoreObjectManager::getDirtyEntry(ObjectSlot& slot)
+	{
+		if (slot.dirtyIdx == INVALID_INDEX)
+		{
+			slot.dirtyIdx = (UINT32)mDirtyObjects.size();
+			mDirtyObjects.push_back({ slot.object, slot.internalId, -1 });
+		}
+
+		return mDirtyObjects[slot.dirtyIdx];
+	}
+
+	void CoreObjectManager::removeDirtyEntry(ObjectSlot& slot)
+	{
+		if (slot.dirtyIdx == INVALID_INDEX)
+			return;
+
+		// Swap with the last entry, and update the slot of the moved entry (unless its object was already destroyed)
+		UINT32 lastIdx = (UINT32)mDirtyObjects.size() - 1;
+		if (slot.dirtyIdx != lastIdx)
+		{
+			DirtyObjectData& lastEntry = mDirtyObjects[lastIdx];
+			mDirtyObjects[slot.dirtyIdx] = lastEntry;
+
+			if (lastEntry.object != nullptr)
+				getSlot(lastEntry.internalId).dirtyIdx = slot.dirtyIdx;
+		}
+
+		mDirtyObjects.pop_back();
+		slot.dirtyIdx = INVALID_INDEX;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,301 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsCoreObjectTestSuite.h"
+
+#include "BsCoreObject.h"
+#include "BsCoreObjectCore.h"
+#include "BsCoreObjectManager.h"
+#include "BsCoreThread.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Core thread counterpart of TestCoreObject, counting how many times it received data from the sim thread. */
+	class TestCoreObjectCore : public CoreObjectCore
+	{
+	public:
+		UINT32 numSyncs = 0;
+
+	protected:
+		void syncToCore(const CoreSyncData& data) override { numSyncs++; }
+	};
+
+	/** Core object that counts how many times its data was sent to the core thread. */
+	class TestCoreObject : public CoreObject
+	{
+	public:
+		TestCoreObject()
+			:CoreObject(false)
+		{ }
+
+		/** Marks the object as dirty, requiring it to be synced with the core thread. */
+		void setDirty() { markCoreDirty(); }
+
+		/** Sets an object this object depends on, meaning it needs to be synced whenever the dependency is. */
+		void setDependency(CoreObject* dependency) 
+		{ 
+			mDependency = dependency; 
+			markDependenciesDirty();
+		}
+
+		/** Returns the core thread counterpart of the object. */
+		SPtr<TestCoreObjectCore> getTestCore() const { return std::static_pointer_cast<TestCoreObjectCore>(getCore()); }
+
+		/** Creates and initializes a new object. */
+		static SPtr<TestCoreObject> create()
+		{
+			SPtr<TestCoreObject> object = bs_core_ptr_new<TestCoreObject>();
+			object->_setThisPtr(object);
+			object->initialize();
+
+			return object;
+		}
+
+		UINT32 numSyncs = 0;
+
+	protected:
+		SPtr<CoreObjectCore> createCore() const override
+		{
+			SPtr<TestCoreObjectCore> core = bs_shared_ptr_new<TestCoreObjectCore>();
+			core->_setThisPtr(core);
+
+			return core;
+		}
+
+		CoreSyncData syncToCore(FrameAlloc* allocator) override
+		{
+			numSyncs++;
+			return CoreSyncData();
+		}
+
+		void getCoreDependencies(Vector<CoreObject*>& dependencies) override
+		{
+			if (mDependency != nullptr)
+				dependencies.push_back(mDependency);
+		}
+
+		CoreObject* mDependency = nullptr;
+	};
+
+	/** Syncs all dirty core objects, and waits until the core thread applies the synced data. */
+	void syncCoreObjects()
+	{
+		CoreObjectManager::instance().syncToCore(gCoreAccessor());
+		gCoreThread().submitAccessors(true);
+	}
+
+	/** Resets the sync counters of the provided objects, on both the sim and the core thread. */
+	void resetSyncCounters(const Vector<SPtr<TestCoreObject>>& objects)
+	{
+		for (auto& object : objects)
+		{
+			object->numSyncs = 0;
+			object->getTestCore()->numSyncs = 0;
+		}
+	}
+
+	CoreObjectTestSuite::CoreObjectTestSuite()
+	{
+		BS_ADD_TEST(CoreObjectTestSuite::testSyncDirty);
+		BS_ADD_TEST(CoreObjectTestSuite::testSyncDependants);
+		BS_ADD_TEST(CoreObjectTestSuite::testSyncDirty_benchmark);
+	}
+
+	void CoreObjectTestSuite::testSyncDirty()
+	{
+		const UINT32 NUM_OBJECTS = 1000;
+
+		Vector<SPtr<TestCoreObject>> objects(NUM_OBJECTS);
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+			objects[i] = TestCoreObject::create();
+
+		// Newly created objects start dirty
+		syncCoreObjects();
+
+		bool allSynced = true;
+		for (auto& object : objects)
+			allSynced &= object->numSyncs == 1 && object->getTestCore()->numSyncs == 1;
+
+		BS_TEST_ASSERT(allSynced);
+
+		// Only dirty objects must be synced, once each, even if marked dirty multiple times
+		resetSyncCounters(objects);
+		for (UINT32 i = 0; i < NUM_OBJECTS; i += 3)
+		{
+			objects[i]->setDirty();
+
+			if (i % 2 == 0)
+				objects[i]->setDirty();
+		}
+
+		syncCoreObjects();
+
+		bool syncedOnce = true;
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			UINT32 expected = i % 3 == 0 ? 1 : 0;
+			syncedOnce &= objects[i]->numSyncs == expected && objects[i]->getTestCore()->numSyncs == expected;
+		}
+
+		BS_TEST_ASSERT(syncedOnce);
+
+		// Nothing dirty, nothing synced
+		resetSyncCounters(objects);
+		syncCoreObjects();
+
+		bool noneSynced = true;
+		for (auto& object : objects)
+			noneSynced &= object->numSyncs == 0 && object->getTestCore()->numSyncs == 0;
+
+		BS_TEST_ASSERT(noneSynced);
+
+		// Objects destroyed while dirty must still have their last changes synced, once
+		resetSyncCounters(objects);
+		Vector<SPtr<TestCoreObjectCore>> destroyedCores;
+		for (UINT32 i = 0; i < NUM_OBJECTS; i += 2)
+		{
+			objects[i]->setDirty();
+
+			if (i % 4 == 0)
+			{
+				destroyedCores.push_back(objects[i]->getTestCore());
+				objects[i]->destroy();
+			}
+		}
+
+		syncCoreObjects();
+
+		bool destroyedSyncedOnce = true;
+		for (auto& core : destroyedCores)
+			destroyedSyncedOnce &= core->numSyncs == 1;
+
+		BS_TEST_ASSERT(destroyedSyncedOnce);
+
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			if (i % 4 == 0)
+				continue;
+
+			UINT32 expected = i % 2 == 0 ? 1 : 0;
+			syncedOnce &= objects[i]->numSyncs == expected && objects[i]->getTestCore()->numSyncs == expected;
+		}
+
+		BS_TEST_ASSERT(syncedOnce);
+	}
+
+	void CoreObjectTestSuite::testSyncDependants()
+	{
+		const UINT32 NUM_CHAINS = 100;
+
+		// Chains of three objects, each depending on the previous one
+		Vector<SPtr<TestCoreObject>> objects;
+		for (UINT32 i = 0; i < NUM_CHAINS; i++)
+		{
+			SPtr<TestCoreObject> first = TestCoreObject::create();
+			SPtr<TestCoreObject> second = TestCoreObject::create();
+			SPtr<TestCoreObject> third = TestCoreObject::create();
+
+			second->setDependency(first.get());
+			third->setDependency(second.get());
+
+			objects.push_back(first);
+			objects.push_back(second);
+			objects.push_back(third);
+		}
+
+		syncCoreObjects();
+
+		// Dirtying a dependency must also sync its direct dependants, and every object only once, even if it is marked 
+		// dirty itself, or multiple objects it depends on are dirty
+		resetSyncCounters(objects);
+		for (UINT32 i = 0; i < NUM_CHAINS; i++)
+		{
+			objects[i * 3 + 0]->setDirty();
+
+			if (i % 2 == 0)
+				objects[i * 3 + 1]->setDirty();
+		}
+
+		syncCoreObjects();
+
+		bool syncedOnce = true;
+		for (UINT32 i = 0; i < NUM_CHAINS; i++)
+		{
+			for (UINT32 j = 0; j < 2; j++)
+			{
+				const SPtr<TestCoreObject>& object = objects[i * 3 + j];
+				syncedOnce &= object->numSyncs == 1 && object->getTestCore()->numSyncs == 1;
+			}
+
+			// Only direct dependants of dirty objects are synced, so the last object is only synced if the second one was
+			// marked dirty itself
+			const SPtr<TestCoreObject>& last = objects[i * 3 + 2];
+			UINT32 expected = i % 2 == 0 ? 1 : 0;
+			syncedOnce &= last->numSyncs == expected && last->getTestCore()->numSyncs == expected;
+		}
+
+		BS_TEST_ASSERT(syncedOnce);
+
+		// Move the last object of each chain to depend on the first object instead, after which only changes to the
+		// first object should propagate to it
+		for (UINT32 i = 0; i < NUM_CHAINS; i++)
+			objects[i * 3 + 2]->setDependency(objects[i * 3 + 0].get());
+
+		syncCoreObjects();
+		resetSyncCounters(objects);
+
+		for (UINT32 i = 0; i < NUM_CHAINS; i++)
+		{
+			if (i % 2 == 0)
+				objects[i * 3 + 0]->setDirty();
+			else
+				objects[i * 3 + 1]->setDirty();
+		}
+
+		syncCoreObjects();
+
+		bool dependencyChanged = true;
+		for (UINT32 i = 0; i < NUM_CHAINS; i++)
+		{
+			const SPtr<TestCoreObject>& last = objects[i * 3 + 2];
+			UINT32 expected = i % 2 == 0 ? 1 : 0;
+			dependencyChanged &= last->numSyncs == expected && last->getTestCore()->numSyncs == expected;
+		}
+
+		BS_TEST_ASSERT(dependencyChanged);
+
+		// Release dependants before their dependencies
+		for (auto iter = objects.rbegin(); iter != objects.rend(); ++iter)
+			*iter = nullptr;
+	}
+
+	void CoreObjectTestSuite::testSyncDirty_benchmark()
+	{
+		const UINT32 NUM_OBJECTS = 100000;
+		const UINT32 NUM_FRAMES = 20;
+
+		Vector<SPtr<TestCoreObject>> objects(NUM_OBJECTS);
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+			objects[i] = TestCoreObject::create();
+
+		syncCoreObjects();
+
+		// A different tenth of the objects is dirty each frame
+		Timer timer;
+		UINT64 startTime = timer.getMicroseconds();
+
+		for (UINT32 i = 0; i < NUM_FRAMES; i++)
+		{
+			for (UINT32 j = i % 10; j < NUM_OBJECTS; j += 10)
+				objects[j]->setDirty();
+
+			syncCoreObjects();
+		}
+
+		UINT64 time = timer.getMicroseconds() - startTime;
+
+		LOGDBG("Syncing " + toString(NUM_OBJECTS / 10) + " dirty out of " + toString(NUM_OBJECTS) + " core objects: " +
+			toString(time / (float)NUM_FRAMES) + " us per frame");
+	}
+}
@@ -0,0 +1,59 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsCorePrerequisites.h"
+#include "BsAnimationTestSuite.h"
+#include "BsCoreThreadTestSuite.h"
+#include "BsCoreObjectTestSuite.h"
+#include "BsMaterialParamsTestSuite.h"
+#include "BsConsoleTestOutput.h"
+#include "BsThreadPool.h"
+#include "BsTaskScheduler.h"
+#include "BsCoreThread.h"
+#include "BsTime.h"
+#include "BsCoreObjectManager.h"
+#include "BsGameObjectManager.h"
+#include "BsResources.h"
+#include "BsResourceListenerManager.h"
+#include "BsCoreSceneManager.h"
+#include "BsAnimationManager.h"
+
+using namespace BansheeEngine;
+
+int main()
+{
+	// Tests run without a render API, renderer or any other plugins, so only the modules that don't depend on them
+	// are started
+	MemStack::beginThread();
+	ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>(BS_THREAD_HARDWARE_CONCURRENCY);
+	TaskScheduler::startUp(TaskSchedulerMode::WorkStealing);
+	CoreThread::startUp();
+	Time::startUp();
+	CoreObjectManager::startUp();
+	GameObjectManager::startUp();
+	Resources::startUp();
+	ResourceListenerManager::startUp();
+	CoreSceneManager::startUp();
+	AnimationManager::startUp();
+
+	SPtr<TestSuite> tests = AnimationTestSuite::create<AnimationTestSuite>();
+	tests->add(CoreThreadTestSuite::create<CoreThreadTestSuite>());
+	tests->add(CoreObjectTestSuite::create<CoreObjectTestSuite>());
+	tests->add(MaterialParamsTestSuite::create<MaterialParamsTestSuite>());
+	ConsoleTestOutput testOutput;
+	tests->run(testOutput);
+	tests = nullptr;
+
+	AnimationManager::shutDown();
+	CoreSceneManager::shutDown();
+	ResourceListenerManager::shutDown();
+	Resources::shutDown();
+	GameObjectManager::shutDown();
+	CoreObjectManager::shutDown();
+	Time::shutDown();
+	CoreThread::shutDown();
+	TaskScheduler::shutDown();
+	ThreadPool::shutDown();
+	MemStack::endThread();
+
+	return 0;
+}
@@ -5,6 +5,7 @@
 #include "BsTaskScheduler.h"
 #include "BsFrameAlloc.h"
 #include "BsCoreApplication.h"
+#include "BsDebug.h"
 
 using namespace std::placeholders;
 
@@ -17,7 +18,9 @@ namespace BansheeEngine
 		: mActiveFrameAlloc(0)
 		, mCoreThreadShutdown(false)
 		, mCoreThreadStarted(false)
-		, mCommandQueue(nullptr)
+		, mCoreThreadWaiting(false)
+		, mNumWaitingProducers(0)
+		, mCommandQueue(COMMAND_QUEUE_CAPACITY)
 		, mMaxCommandNotifyId(0)
 		, mSyncedCoreAccessor(nullptr)
 	{
@@ -29,7 +32,7 @@ namespace BansheeEngine
 
 		mSimThreadId = BS_THREAD_CURRENT_ID;
 		mCoreThreadId = mSimThreadId; // For now
-		mCommandQueue = bs_new<CommandQueue<CommandQueueSync>>(BS_THREAD_CURRENT_ID);
+		mAsyncOpSyncData = bs_shared_ptr_new<AsyncOpSyncData>();
 
 		initCoreThread();
 	}
@@ -50,12 +53,6 @@ namespace BansheeEngine
 			mAccessors.clear();
 		}
 
-		if(mCommandQueue != nullptr)
-		{
-			bs_delete(mCommandQueue);
-			mCommandQueue = nullptr;
-		}
-
 		for (UINT32 i = 0; i < NUM_SYNC_BUFFERS; i++)
 		{
 			mFrameAllocs[i]->setOwnerThread(BS_THREAD_CURRENT_ID); // Sim thread
@@ -97,40 +94,64 @@ namespace BansheeEngine
 
 		while(true)
 		{
+			// Play commands
+			executeCommands();
+
 			// Wait until we get some ready commands
-			Queue<QueuedCommand>* commands = nullptr;
-			{
-				Lock lock(mCommandQueueMutex);
+			Lock lock(mCommandReadyMutex);
+
+			// Let the producers know they need to wake us up. The fence ensures that either we see their command in the
+			// queue, or they see the flag (see submitCommand()).
+			mCoreThreadWaiting.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
 
-				while(mCommandQueue->isEmpty())
+			while(mCommandQueue.isEmpty())
+			{
+				if(mCoreThreadShutdown)
 				{
-					if(mCoreThreadShutdown)
-					{
-						bs_delete(mSyncedCoreAccessor);
-						TaskScheduler::instance().addWorker();
-						return;
-					}
-
-					TaskScheduler::instance().addWorker(); // Do something else while we wait, otherwise this core will be unused
-					mCommandReadyCondition.wait(lock);
-					TaskScheduler::instance().removeWorker();
+					bs_delete(mSyncedCoreAccessor);
+					TaskScheduler::instance().addWorker();
+					return;
 				}
 
-				commands = mCommandQueue->flush();
+				TaskScheduler::instance().addWorker(); // Do something else while we wait, otherwise this core will be unused
+				mCommandReadyCondition.wait(lock);
+				TaskScheduler::instance().removeWorker();
 			}
 
-			// Play commands
-			mCommandQueue->playbackWithNotify(commands, std::bind(&CoreThread::commandCompletedNotify, this, _1)); 
+			mCoreThreadWaiting.store(false, std::memory_order_relaxed);
 		}
 #endif
 	}
 
+	void CoreThread::executeCommands()
+	{
+		auto execute = [this](Command& command)
+		{
+			command.execute();
+
+			if (command.notifyId != Command::NO_NOTIFY)
+				commandCompletedNotify(command.notifyId);
+		};
+
+		while (mCommandQueue.tryConsume(execute))
+		{
+			// Wake up any producers waiting for room in the queue (see queueCommand())
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (mNumWaitingProducers.load(std::memory_order_relaxed) > 0)
+			{
+				Lock lock(mCommandSpaceMutex);
+				mCommandSpaceCondition.notify_all();
+			}
+		}
+	}
+
 	void CoreThread::shutdownCoreThread()
 	{
 #if !BS_FORCE_SINGLETHREADED_RENDERING
 
 		{
-			Lock lock(mCommandQueueMutex);
+			Lock lock(mCommandReadyMutex);
 			mCoreThreadShutdown = true;
 		}
 
@@ -194,51 +215,41 @@ namespace BansheeEngine
 
 	AsyncOp CoreThread::queueReturnCommand(std::function<void(AsyncOp&)> commandCallback, bool blockUntilComplete)
 	{
-		assert(BS_THREAD_CURRENT_ID != getCoreThreadId() && "Cannot queue commands on the core thread for the core thread");
+		AsyncOp op(mAsyncOpSyncData);
 
-		AsyncOp op;
-		UINT32 commandId = -1;
+		auto command = [commandCallback, op]() mutable
 		{
-			Lock lock(mCommandQueueMutex);
+			commandCallback(op);
 
-			if(blockUntilComplete)
+			if(!op.hasCompleted())
 			{
-				commandId = mMaxCommandNotifyId++;
-				op = mCommandQueue->queueReturn(commandCallback, true, commandId);
+				LOGDBG("Async operation return value wasn't resolved properly. Resolving automatically to nullptr. " \
+					"Make sure to complete the operation before returning from the command callback method.");
+				op._completeOperation(nullptr);
 			}
-			else
-				op = mCommandQueue->queueReturn(commandCallback);
-		}
-
-		mCommandReadyCondition.notify_all();
-
-		if(blockUntilComplete)
-			blockUntilCommandCompleted(commandId);
+		};
 
+		queueCommand(command, blockUntilComplete);
 		return op;
 	}
 
-	void CoreThread::queueCommand(std::function<void()> commandCallback, bool blockUntilComplete)
+	void CoreThread::submitCommand(UINT32 commandId)
 	{
-		assert(BS_THREAD_CURRENT_ID != getCoreThreadId() && "Cannot queue commands on the core thread for the core thread");
-
-		UINT32 commandId = -1;
+#if BS_FORCE_SINGLETHREADED_RENDERING
+		executeCommands();
+#else
+		// Wake up the core thread if it's waiting for commands (see runCoreThread())
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (mCoreThreadWaiting.load(std::memory_order_relaxed))
 		{
-			Lock lock(mCommandQueueMutex);
-
-			if(blockUntilComplete)
-			{
-				commandId = mMaxCommandNotifyId++;
-				mCommandQueue->queue(commandCallback, true, commandId);
-			}
-			else
-				mCommandQueue->queue(commandCallback);
+			// Lock ensures the core thread is either still checking the queue, or is already waiting on the condition
+			Lock lock(mCommandReadyMutex);
+			mCommandReadyCondition.notify_one();
 		}
 
-		mCommandReadyCondition.notify_all();
-
-		if(blockUntilComplete)
+		if(commandId != Command::NO_NOTIFY)
 			blockUntilCommandCompleted(commandId);
+#endif
 	}
 
 	void CoreThread::update()
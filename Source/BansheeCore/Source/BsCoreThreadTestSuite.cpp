@@ -0,0 +1,124 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsCoreThreadTestSuite.h"
+
+#include "BsCoreThread.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	CoreThreadTestSuite::CoreThreadTestSuite()
+	{
+		BS_ADD_TEST(CoreThreadTestSuite::testQueueCommand);
+		BS_ADD_TEST(CoreThreadTestSuite::testQueueCommandFull);
+		BS_ADD_TEST(CoreThreadTestSuite::testQueueCommand_benchmark);
+	}
+
+	void CoreThreadTestSuite::testQueueCommand()
+	{
+		const UINT32 NUM_COMMANDS = 1000;
+
+		// Commands from the same thread must execute in order, and blocking commands must wait for all before them
+		Vector<UINT32> executed;
+		for (UINT32 i = 0; i < NUM_COMMANDS; i++)
+			gCoreThread().queueCommand([&executed, i]() { executed.push_back(i); });
+
+		bool inOrder = true;
+		gCoreThread().queueCommand([&]() 
+		{
+			for (UINT32 i = 0; i < (UINT32)executed.size(); i++)
+				inOrder &= executed[i] == i;
+		}, true);
+
+		BS_TEST_ASSERT(executed.size() == NUM_COMMANDS);
+		BS_TEST_ASSERT(inOrder);
+
+		AsyncOp op = gCoreThread().queueReturnCommand([](AsyncOp& op) { op._completeOperation(5); }, true);
+		BS_TEST_ASSERT(op.hasCompleted());
+		BS_TEST_ASSERT(op.getReturnValue<int>() == 5);
+	}
+
+	void CoreThreadTestSuite::testQueueCommandFull()
+	{
+		// More commands than fit in the queue
+		const UINT32 NUM_COMMANDS = 10000;
+
+		// Keep the core thread busy so the queue fills up
+		Mutex releaseMutex;
+		Signal releaseCondition;
+		bool release = false;
+
+		gCoreThread().queueCommand([&]()
+		{
+			Lock lock(releaseMutex);
+
+			while (!release)
+				releaseCondition.wait(lock);
+		});
+
+		std::atomic<UINT32> numQueued(0);
+		std::atomic<UINT32> numExecuted(0);
+		Thread producer([&]()
+		{
+			for (UINT32 i = 0; i < NUM_COMMANDS; i++)
+			{
+				gCoreThread().queueCommand([&numExecuted]() { numExecuted++; });
+				numQueued++;
+			}
+		});
+
+		// Producer must be blocked by the full queue, until the core thread is released
+		BS_THREAD_SLEEP(50);
+		BS_TEST_ASSERT(numQueued.load() < NUM_COMMANDS);
+		BS_TEST_ASSERT(numExecuted.load() == 0);
+
+		{
+			Lock lock(releaseMutex);
+			release = true;
+		}
+
+		releaseCondition.notify_one();
+		producer.join();
+
+		gCoreThread().queueCommand([]() { }, true);
+		BS_TEST_ASSERT(numExecuted.load() == NUM_COMMANDS);
+	}
+
+	void CoreThreadTestSuite::testQueueCommand_benchmark()
+	{
+		const UINT32 NUM_COMMANDS = 200000;
+
+		for (UINT32 numProducers = 1; numProducers <= 16; numProducers *= 2)
+		{
+			UINT32 numCommandsPerProducer = NUM_COMMANDS / numProducers;
+			std::atomic<UINT32> numExecuted(0);
+
+			Timer timer;
+			UINT64 startTime = timer.getMicroseconds();
+
+			Vector<Thread> producers;
+			for (UINT32 i = 0; i < numProducers; i++)
+			{
+				producers.push_back(Thread([&numExecuted, numCommandsPerProducer]()
+				{
+					for (UINT32 j = 0; j < numCommandsPerProducer; j++)
+						gCoreThread().queueCommand([&numExecuted]() { numExecuted.fetch_add(1, std::memory_order_relaxed); });
+				}));
+			}
+
+			for (auto& producer : producers)
+				producer.join();
+
+			gCoreThread().queueCommand([]() { }, true);
+
+			UINT64 time = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+			UINT32 numCommands = numCommandsPerProducer * numProducers;
+
+			BS_TEST_ASSERT(numExecuted.load() == numCommands);
+
+			LOGDBG("Queuing " + toString(numCommands) + " core thread commands from " + toString(numProducers) + 
+				" producers: " + toString((numCommands * 1000.0f) / time) + " commands/ms");
+		}
+	}
+}
@@ -0,0 +1,44 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsGpuParamBlockRing.h"
+#include "BsGpuParamBlockBuffer.h"
+
+namespace BansheeEngine
+{
+	GpuParamBlockRing::GpuParamBlockRing(UINT32 blockSize, UINT32 numFramesInFlight)
+		:mBlockSize(blockSize), mCurrentRegion(0)
+	{
+		mRegions.resize(std::max(numFramesInFlight, 1U));
+	}
+
+	void GpuParamBlockRing::beginFrame()
+	{
+		mCurrentRegion = (mCurrentRegion + 1) % (UINT32)mRegions.size();
+		mRegions[mCurrentRegion].numUsed = 0;
+
+		mLastStats = mCurrentStats;
+		mCurrentStats = FrameStats();
+	}
+
+	SPtr<GpuParamBlockBufferCore> GpuParamBlockRing::allocate(const UINT8* data)
+	{
+		FrameRegion& region = mRegions[mCurrentRegion];
+		if (region.numUsed == (UINT32)region.buffers.size())
+			region.buffers.push_back(GpuParamBlockBufferCore::create(mBlockSize, GPBU_DYNAMIC));
+
+		const SPtr<GpuParamBlockBufferCore>& buffer = region.buffers[region.numUsed++];
+		mCurrentStats.numAllocations++;
+
+		// Buffer still holds whatever it was given the last time this region was used, which for static data will often
+		// be the exact same contents
+		if (memcmp(buffer->getCachedData(), data, mBlockSize) != 0)
+		{
+			buffer->write(0, data, mBlockSize);
+
+			mCurrentStats.numUploads++;
+			mCurrentStats.numBytesUploaded += mBlockSize;
+		}
+
+		return buffer;
+	}
+}
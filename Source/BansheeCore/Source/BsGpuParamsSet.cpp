@@ -610,6 +610,25 @@ namespace BansheeEngine
 			}
 		}
 
+		// Group data parameter infos by material parameter, so infos of a single dirty parameter can be found quickly
+		std::sort(mDataParamInfos.begin(), mDataParamInfos.end(), 
+			[](const DataParamInfo& a, const DataParamInfo& b)
+		{
+			return a.paramIdx < b.paramIdx;
+		});
+
+		UINT32 numMaterialParams = params->getNumParams();
+		mDataParamInfoOffsets.resize(numMaterialParams + 1);
+
+		UINT32 dataParamInfoIdx = 0;
+		for (UINT32 i = 0; i <= numMaterialParams; i++)
+		{
+			while (dataParamInfoIdx < (UINT32)mDataParamInfos.size() && mDataParamInfos[dataParamInfoIdx].paramIdx < i)
+				dataParamInfoIdx++;
+
+			mDataParamInfoOffsets[i] = dataParamInfoIdx;
+		}
+
 		// Add buffers defined in shader but not actually used by GPU programs (so we can check if user is providing a
 		// valid buffer name)
 		auto& allParamBlocks = shader->getParamBlocks();
@@ -801,11 +820,20 @@ namespace BansheeEngine
 			return;
 		}
 
-		if (!mBlocks[foundIdx].isUsed)
+		setParamBlockBuffer(foundIdx, paramBlock, ignoreInUpdate);
+	}
+
+	template<bool Core>
+	void TGpuParamsSet<Core>::setParamBlockBuffer(UINT32 index, const ParamBlockPtrType& paramBlock, bool ignoreInUpdate)
+	{
+		BlockInfo& block = mBlocks[index];
+		assert(block.shareable);
+
+		if (!block.isUsed)
 			return;
 
-		mBlocks[foundIdx].buffer = paramBlock;
-		mBlocks[foundIdx].allowUpdate = !ignoreInUpdate;
+		block.buffer = paramBlock;
+		block.allowUpdate = !ignoreInUpdate;
 
 		UINT32 numPasses = (UINT32)mPassParams.size();
 		for (UINT32 j = 0; j < numPasses; j++)
@@ -815,33 +843,40 @@ namespace BansheeEngine
 			{
 				GpuProgramType progType = (GpuProgramType)i;
 
-				if (paramPtr->hasParamBlock(progType, name))
-					paramPtr->setParamBlockBuffer(progType, name, paramBlock);
+				if (paramPtr->hasParamBlock(progType, block.name))
+					paramPtr->setParamBlockBuffer(progType, block.name, paramBlock);
 			}
 		}
 	}
 
 	template<bool Core>
-	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, UINT32 dirtyBitIdx, bool updateAll)
+	UINT32 TGpuParamsSet<Core>::getParamBlockBufferIndex(const String& name) const
 	{
-		// Note: Instead of iterating over every single parameter, it might be more efficient for @p params to keep
-		// a ring buffer and a version number. Then we could just iterate over the ring buffer and only access dirty
-		// parameters. If the version number is too high (larger than ring buffer can store), then we force update for all.
+		for (UINT32 i = 0; i < (UINT32)mBlocks.size(); i++)
+		{
+			const BlockInfo& block = mBlocks[i];
+			if (block.name == name && block.shareable)
+				return i;
+		}
 
+		return (UINT32)-1;
+	}
+
+	template<bool Core>
+	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, UINT32 dirtyBitIdx, bool updateAll)
+	{
 		// Maximum of 31 techniques are supported. Bit 32 is reserved.
 		assert(dirtyBitIdx < 31);
 		UINT32 dirtyFlagMask = 1 << dirtyBitIdx;
 
-		// Update data params
-		for(auto& paramInfo : mDataParamInfos)
+		bool transposeMatrices = RenderAPICore::instance().getAPIInfo().getGpuProgramHasColumnMajorMatrices();
+		auto updateDataParam = [&](const DataParamInfo& paramInfo)
 		{
 			ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
 			if (paramBlock == nullptr || !mBlocks[paramInfo.blockIdx].allowUpdate)
-				continue;
+				return;
 
 			const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-			if ((materialParamInfo->dirtyFlags & dirtyFlagMask) == 0 && !updateAll)
-				continue;
 
 			UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
 			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
@@ -849,7 +884,6 @@ namespace BansheeEngine
 
 			UINT8* data = params->getData(materialParamInfo->index);
 
-			bool transposeMatrices = RenderAPICore::instance().getAPIInfo().getGpuProgramHasColumnMajorMatrices();
 			if (transposeMatrices)
 			{
 				auto writeTransposed = [&](auto& temp)
@@ -929,7 +963,41 @@ namespace BansheeEngine
 			}
 			else
 				paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
+		};
+
+		// Update data params. If we haven't fallen behind the dirty ring, only visit parameters recorded in it since
+		// the last update, otherwise check the dirty flags of all of them.
+		UINT64 dirtyVersion = params->getDirtyVersion();
+		bool useDirtyRing = !updateAll && dirtyVersion >= mDirtyVersion && 
+			(dirtyVersion - mDirtyVersion) <= MaterialParams::DIRTY_RING_SIZE;
+
+		if (useDirtyRing)
+		{
+			for (UINT64 version = mDirtyVersion; version < dirtyVersion; version++)
+			{
+				UINT32 paramIdx = params->getDirtyParam(version);
+
+				const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramIdx);
+				if ((materialParamInfo->dirtyFlags & dirtyFlagMask) == 0)
+					continue;
+
+				for (UINT32 i = mDataParamInfoOffsets[paramIdx]; i < mDataParamInfoOffsets[paramIdx + 1]; i++)
+					updateDataParam(mDataParamInfos[i]);
+			}
 		}
+		else
+		{
+			for (auto& paramInfo : mDataParamInfos)
+			{
+				const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
+				if ((materialParamInfo->dirtyFlags & dirtyFlagMask) == 0 && !updateAll)
+					continue;
+
+				updateDataParam(paramInfo);
+			}
+		}
+
+		mDirtyVersion = dirtyVersion;
 
 		// Update object params
 		UINT32 numPasses = (UINT32)mPassParams.size();
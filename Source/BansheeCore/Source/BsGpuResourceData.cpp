@@ -4,11 +4,13 @@
 #include "BsGpuResourceDataRTTI.h"
 #include "BsCoreThread.h"
 #include "BsException.h"
+#include "BsCompression.h"
+#include "BsDataStream.h"
 
 namespace BansheeEngine
 {
 	GpuResourceData::GpuResourceData()
-		:mData(nullptr), mOwnsData(false), mLocked(false)
+		:mCompression(CompressionType::None), mData(nullptr), mOwnsData(false), mLocked(false)
 	{
 
 	}
@@ -16,8 +18,10 @@ namespace BansheeEngine
 	GpuResourceData::GpuResourceData(const GpuResourceData& copy)
 	{
 		mData = copy.mData;
+		mSourceStream = copy.mSourceStream;
 		mLocked = copy.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
+		mCompression = copy.mCompression;
 	}
 
 	GpuResourceData::~GpuResourceData()
@@ -28,8 +32,10 @@ namespace BansheeEngine
 	GpuResourceData& GpuResourceData::operator=(const GpuResourceData& rhs)
 	{
 		mData = rhs.mData;
+		mSourceStream = rhs.mSourceStream;
 		mLocked = rhs.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
+		mCompression = rhs.mCompression;
 
 		return *this;
 	}
@@ -65,6 +71,7 @@ namespace BansheeEngine
 		freeInternalBuffer();
 
 		mData = (UINT8*)bs_alloc(size);
+		mSourceStream = nullptr;
 		mOwnsData = true;
 	}
 
@@ -98,9 +105,17 @@ namespace BansheeEngine
 		freeInternalBuffer();
 
 		mData = data;
+		mSourceStream = nullptr;
 		mOwnsData = false;
 	}
 
+	void GpuResourceData::setExternalBuffer(UINT8* data, const SPtr<DataStream>& source)
+	{
+		setExternalBuffer(data);
+
+		mSourceStream = source;
+	}
+
 	void GpuResourceData::_lock() const
 	{
 		mLocked = true;
@@ -111,6 +126,41 @@ namespace BansheeEngine
 		mLocked = false;
 	}
 
+	SPtr<DataStream> GpuResourceData::_compressData(UINT32 size) const
+	{
+		return Compression::compressBlock(getData(), size, mCompression);
+	}
+
+	bool GpuResourceData::_decompressData(const SPtr<DataStream>& stream, UINT32 size)
+	{
+		// Data that isn't already in memory must be read before it can be decompressed
+		UINT8* block = nullptr;
+		UINT8* readBuffer = nullptr;
+		if (stream->isMemory())
+		{
+			size = (UINT32)std::min((size_t)size, stream->size() - stream->tell());
+			block = std::static_pointer_cast<MemoryDataStream>(stream)->getCurrentPtr();
+			stream->skip(size);
+		}
+		else
+		{
+			readBuffer = (UINT8*)bs_alloc(size);
+			size = (UINT32)stream->read(readBuffer, size);
+
+			block = readBuffer;
+		}
+
+		UINT32 uncompressedSize = Compression::getUncompressedSize(block, size);
+		allocateInternalBuffer(uncompressedSize);
+
+		bool success = Compression::decompressBlock(block, size, getData(), uncompressedSize);
+
+		if (readBuffer != nullptr)
+			bs_free(readBuffer);
+
+		return success;
+	}
+
 	/************************************************************************/
 	/* 								SERIALIZATION                      		*/
 	/************************************************************************/
@@ -305,6 +305,27 @@ namespace BansheeEngine
 		output = TMaterialDataParam<T, Core>(name, getMaterialPtr(this));
 	}
 
+	template<bool Core>
+	MaterialParamHandle TMaterial<Core>::getParamHandle(const StringID& name) const
+	{
+		throwIfNotInitialized();
+
+		MaterialParamHandle handle;
+		handle.name = name;
+
+		UINT32 paramIdx = name.empty() ? (UINT32)-1 : mParams->getParamIndex(name.cstr());
+		if (paramIdx == (UINT32)-1)
+		{
+			mParams->reportGetParamError(MaterialParamsBase::GetParamResult::NotFound, handle, 0);
+			return handle;
+		}
+
+		handle.shaderId = mParams->getShaderId();
+		handle.paramIdx = paramIdx;
+
+		return handle;
+	}
+
 	template<bool Core>
 	void TMaterial<Core>::throwIfNotInitialized() const
 	{
@@ -48,7 +48,7 @@ namespace BansheeEngine
 
 		SPtr<MaterialParamsType> params = mMaterial->_getInternalParams();
 		const MaterialParams::ParamData* data = params->getParamData(mParamIndex);
-		data->dirtyFlags = 0xFFFFFFFF;
+		params->setParamDirty(mParamIndex);
 
 		params->setDataParam(data->index, arrayIdx, value);
 		mMaterial->_markCoreDirty();
@@ -107,7 +107,7 @@ namespace BansheeEngine
 
 		SPtr<MaterialParamsType> params = mMaterial->_getInternalParams();
 		const MaterialParams::ParamData* data = params->getParamData(mParamIndex);
-		data->dirtyFlags = 0xFFFFFFFF;
+		params->setParamDirty(mParamIndex);
 
 		params->setStructData(data->index + arrayIdx, value, sizeBytes);
 		mMaterial->_markCoreDirty();
@@ -166,7 +166,7 @@ namespace BansheeEngine
 
 		SPtr<MaterialParamsType> params = mMaterial->_getInternalParams();
 		const MaterialParams::ParamData* data = params->getParamData(mParamIndex);
-		data->dirtyFlags = 0xFFFFFFFF;
+		params->setParamDirty(mParamIndex);
 
 		// If there is a default value, assign that instead of null
 		TextureType newValue = texture;
@@ -221,7 +221,7 @@ namespace BansheeEngine
 
 		SPtr<MaterialParamsType> params = mMaterial->_getInternalParams();
 		const MaterialParams::ParamData* data = params->getParamData(mParamIndex);
-		data->dirtyFlags = 0xFFFFFFFF;
+		params->setParamDirty(mParamIndex);
 
 		params->setLoadStoreTexture(data->index, texture, surface);
 		mMaterial->_markCoreDirty();
@@ -272,7 +272,7 @@ namespace BansheeEngine
 
 		SPtr<MaterialParamsType> params = mMaterial->_getInternalParams();
 		const MaterialParams::ParamData* data = params->getParamData(mParamIndex);
-		data->dirtyFlags = 0xFFFFFFFF;
+		params->setParamDirty(mParamIndex);
 
 		params->setBuffer(data->index, buffer);
 		mMaterial->_markCoreDirty();
@@ -321,7 +321,7 @@ namespace BansheeEngine
 
 		SPtr<MaterialParamsType> params = mMaterial->_getInternalParams();
 		const MaterialParams::ParamData* data = params->getParamData(mParamIndex);
-		data->dirtyFlags = 0xFFFFFFFF;
+		params->setParamDirty(mParamIndex);
 
 		// If there is a default value, assign that instead of null
 		SamplerStateType newValue = sampState;
@@ -167,6 +167,27 @@ namespace BansheeEngine
 		return GetParamResult::Success;
 	}
 
+	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamData(const MaterialParamHandle& handle, 
+		ParamType type, GpuParamDataType dataType, UINT32 arrayIdx, const ParamData** output) const
+	{
+		if (!handle.isValid())
+			return GetParamResult::NotFound;
+
+		if (handle.shaderId != mShaderId || handle.paramIdx >= (UINT32)mParams.size())
+			return GetParamResult::InvalidHandle;
+
+		const ParamData& param = mParams[handle.paramIdx];
+		*output = &param;
+
+		if (param.type != type || (type == ParamType::Data && param.dataType != dataType))
+			return GetParamResult::InvalidType;
+
+		if (arrayIdx >= param.arraySize)
+			return GetParamResult::IndexOutOfBounds;
+
+		return GetParamResult::Success;
+	}
+
 	void MaterialParamsBase::reportGetParamError(GetParamResult errorCode, const String& name, UINT32 arrayIdx) const
 	{
 		switch (errorCode)
@@ -180,11 +201,21 @@ namespace BansheeEngine
 		case GetParamResult::IndexOutOfBounds:
 			LOGWRN("Parameter \"" + name + "\" array index " + toString(arrayIdx) + " out of range.");
 			break;
+		case GetParamResult::InvalidHandle:
+			LOGWRN("Parameter handle \"" + name + "\" was created for a different shader.");
+			break;
 		default:
 			break;
 		}
 	}
 
+	void MaterialParamsBase::reportGetParamError(GetParamResult errorCode, const MaterialParamHandle& handle, 
+		UINT32 arrayIdx) const
+	{
+		String name = handle.name.empty() ? StringUtil::BLANK : String(handle.name.cstr());
+		reportGetParamError(errorCode, name, arrayIdx);
+	}
+
 	void MaterialParamsBase::clearDirtyFlags(UINT32 techniqueIdx)
 	{
 		UINT32 mask = ~(1 << techniqueIdx);
@@ -226,6 +257,8 @@ namespace BansheeEngine
 		auto& bufferParams = shader->getBufferParams();
 		auto& samplerParams = shader->getSamplerParams();
 
+		mShaderId = shader->getId();
+
 		mStructParams = mAlloc.construct<ParamStructDataType>(mNumStructParams);
 		mTextureParams = mAlloc.construct<ParamTextureDataType>(mNumTextureParams);
 		mBufferParams = mAlloc.construct<ParamBufferDataType>(mNumBufferParams);
@@ -618,8 +651,8 @@ namespace BansheeEngine
 			UINT32 paramIdx = 0;
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
+			setParamDirty(paramIdx);
 			ParamData& param = mParams[paramIdx];
-			param.dirtyFlags = 0xFFFFFFFF;
 
 			UINT32 arraySize = param.arraySize > 1 ? param.arraySize : 1;
 			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)param.type];
@@ -635,8 +668,8 @@ namespace BansheeEngine
 			UINT32 paramIdx = 0;
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
+			setParamDirty(paramIdx);
 			ParamData& param = mParams[paramIdx];
-			param.dirtyFlags = 0xFFFFFFFF;
 
 			MaterialParamTextureDataCore* sourceTexData = (MaterialParamTextureDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamTextureDataCore);
@@ -650,8 +683,8 @@ namespace BansheeEngine
 			UINT32 paramIdx = 0;
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
+			setParamDirty(paramIdx);
 			ParamData& param = mParams[paramIdx];
-			param.dirtyFlags = 0xFFFFFFFF;
 
 			MaterialParamBufferDataCore* sourceBufferData = (MaterialParamBufferDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamBufferDataCore);
@@ -665,8 +698,8 @@ namespace BansheeEngine
 			UINT32 paramIdx = 0;
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
+			setParamDirty(paramIdx);
 			ParamData& param = mParams[paramIdx];
-			param.dirtyFlags = 0xFFFFFFFF;
 
 			MaterialParamSamplerStateDataCore* sourceSamplerStateData = (MaterialParamSamplerStateDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamSamplerStateDataCore);
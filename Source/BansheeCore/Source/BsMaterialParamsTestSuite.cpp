@@ -0,0 +1,177 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMaterialParamsTestSuite.h"
+
+#include "BsMaterialParams.h"
+#include "BsMaterialParam.h"
+#include "BsShader.h"
+#include "BsVector4.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Creates material parameters with the specified number of float4 data parameters, named gParam0, gParam1, etc. */
+	SPtr<MaterialParamsBase> createTestMaterialParams(UINT32 numParams)
+	{
+		Map<String, SHADER_DATA_PARAM_DESC> dataParams;
+		for (UINT32 i = 0; i < numParams; i++)
+		{
+			SHADER_DATA_PARAM_DESC desc;
+			desc.name = "gParam" + toString(i);
+			desc.gpuVariableName = desc.name;
+			desc.type = GPDT_FLOAT4;
+			desc.arraySize = 1;
+			desc.elementSize = 0;
+			desc.defaultValueIdx = (UINT32)-1;
+
+			dataParams[desc.name] = desc;
+		}
+
+		Map<String, SHADER_OBJECT_PARAM_DESC> objectParams;
+		return bs_shared_ptr_new<MaterialParamsBase>(dataParams, objectParams, objectParams, objectParams);
+	}
+
+	/** Creates a handle for the parameter with the specified name, same as Material::getParamHandle(). */
+	MaterialParamHandle createTestParamHandle(const MaterialParamsBase& params, const String& name)
+	{
+		MaterialParamHandle handle;
+		handle.name = name;
+		handle.shaderId = params.getShaderId();
+		handle.paramIdx = params.getParamIndex(name);
+
+		return handle;
+	}
+
+	/** Sets a parameter through a name lookup, the same way Material::setVec4(const String&, ...) does. */
+	void setTestParamByName(MaterialParamsBase& params, const String& name, const Vector4& value)
+	{
+		UINT32 paramIdx;
+		auto result = params.getParamIndex(name, MaterialParamsBase::ParamType::Data, GPDT_FLOAT4, 0, paramIdx);
+		if (result != MaterialParamsBase::GetParamResult::Success)
+			return;
+
+		const MaterialParamsBase::ParamData* data = params.getParamData(paramIdx);
+		params.setParamDirty(paramIdx);
+		params.setDataParam(data->index, 0, value);
+	}
+
+	/** Sets a parameter through a precompiled handle, the same way Material::setVec4() with a handle does. */
+	void setTestParamByHandle(MaterialParamsBase& params, const MaterialParamHandle& handle, const Vector4& value)
+	{
+		const MaterialParamsBase::ParamData* data = nullptr;
+		auto result = params.getParamData(handle, MaterialParamsBase::ParamType::Data, GPDT_FLOAT4, 0, &data);
+		if (result != MaterialParamsBase::GetParamResult::Success)
+			return;
+
+		params.setDataParam(data->index, 0, value);
+		params.setParamDirty(handle.paramIdx);
+	}
+
+	MaterialParamsTestSuite::MaterialParamsTestSuite()
+	{
+		BS_ADD_TEST(MaterialParamsTestSuite::testHandles);
+		BS_ADD_TEST(MaterialParamsTestSuite::testDirtyRing);
+		BS_ADD_TEST(MaterialParamsTestSuite::testSetParams_benchmark);
+	}
+
+	void MaterialParamsTestSuite::testHandles()
+	{
+		SPtr<MaterialParamsBase> params = createTestMaterialParams(4);
+
+		MaterialParamHandle handle = createTestParamHandle(*params, "gParam2");
+		BS_TEST_ASSERT(handle.isValid());
+
+		// Handles and names must resolve to the same data
+		setTestParamByHandle(*params, handle, Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+
+		UINT32 paramIdx;
+		params->getParamIndex("gParam2", MaterialParamsBase::ParamType::Data, GPDT_FLOAT4, 0, paramIdx);
+
+		Vector4 value;
+		params->getDataParam(params->getParamData(paramIdx)->index, 0, value);
+		BS_TEST_ASSERT(value == Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+
+		// Handles with a mismatched shader, type or array index must be rejected
+		const MaterialParamsBase::ParamData* data = nullptr;
+		MaterialParamHandle otherShaderHandle = handle;
+		otherShaderHandle.shaderId++;
+
+		BS_TEST_ASSERT(params->getParamData(otherShaderHandle, MaterialParamsBase::ParamType::Data, GPDT_FLOAT4, 0,
+			&data) == MaterialParamsBase::GetParamResult::InvalidHandle);
+		BS_TEST_ASSERT(params->getParamData(handle, MaterialParamsBase::ParamType::Data, GPDT_FLOAT1, 0,
+			&data) == MaterialParamsBase::GetParamResult::InvalidType);
+		BS_TEST_ASSERT(params->getParamData(handle, MaterialParamsBase::ParamType::Data, GPDT_FLOAT4, 1,
+			&data) == MaterialParamsBase::GetParamResult::IndexOutOfBounds);
+		BS_TEST_ASSERT(params->getParamData(MaterialParamHandle(), MaterialParamsBase::ParamType::Data, GPDT_FLOAT4, 0,
+			&data) == MaterialParamsBase::GetParamResult::NotFound);
+	}
+
+	void MaterialParamsTestSuite::testDirtyRing()
+	{
+		SPtr<MaterialParamsBase> params = createTestMaterialParams(4);
+		UINT32 param1 = params->getParamIndex("gParam1");
+		UINT32 param3 = params->getParamIndex("gParam3");
+
+		// Parameters start dirty for all consumers, so setting them doesn't need to record them
+		UINT64 version = params->getDirtyVersion();
+		setTestParamByName(*params, "gParam1", Vector4::ZERO);
+		BS_TEST_ASSERT(params->getDirtyVersion() == version);
+
+		// Once a consumer cleared its flags, every changed parameter is recorded once, no matter how often it is set
+		params->clearDirtyFlags(0);
+		setTestParamByName(*params, "gParam3", Vector4::ZERO);
+		setTestParamByName(*params, "gParam1", Vector4::ZERO);
+		setTestParamByName(*params, "gParam3", Vector4::ZERO);
+
+		BS_TEST_ASSERT(params->getDirtyVersion() == version + 2);
+		BS_TEST_ASSERT(params->getDirtyParam(version) == param3);
+		BS_TEST_ASSERT(params->getDirtyParam(version + 1) == param1);
+		BS_TEST_ASSERT(params->getParamData(param1)->dirtyFlags == 0xFFFFFFFF);
+
+		// Parameters that weren't changed must stay clean for the consumer
+		UINT32 param0 = params->getParamIndex("gParam0");
+		BS_TEST_ASSERT((params->getParamData(param0)->dirtyFlags & 1) == 0);
+	}
+
+	void MaterialParamsTestSuite::testSetParams_benchmark()
+	{
+		const UINT32 NUM_PARAMS = 16;
+		const UINT32 NUM_SETS = 1000000;
+
+		SPtr<MaterialParamsBase> params = createTestMaterialParams(NUM_PARAMS);
+
+		Vector<String> names(NUM_PARAMS);
+		Vector<MaterialParamHandle> handles(NUM_PARAMS);
+		for (UINT32 i = 0; i < NUM_PARAMS; i++)
+		{
+			names[i] = "gParam" + toString(i);
+			handles[i] = createTestParamHandle(*params, names[i]);
+		}
+
+		// All parameters are set once per frame, after which a consumer clears its dirty flags
+		auto measure = [&](const std::function<void(UINT32, const Vector4&)>& setParam)
+		{
+			Timer timer;
+			UINT64 startTime = timer.getMicroseconds();
+
+			for (UINT32 i = 0; i < NUM_SETS; i += NUM_PARAMS)
+			{
+				for (UINT32 j = 0; j < NUM_PARAMS; j++)
+					setParam(j, Vector4((float)i, (float)j, 0.0f, 1.0f));
+
+				params->clearDirtyFlags(0);
+			}
+
+			return (timer.getMicroseconds() - startTime) / 1000.0f;
+		};
+
+		float nameTime = measure([&](UINT32 idx, const Vector4& value)
+			{ setTestParamByName(*params, names[idx], value); });
+		float handleTime = measure([&](UINT32 idx, const Vector4& value)
+			{ setTestParamByHandle(*params, handles[idx], value); });
+
+		LOGDBG("Setting " + toString(NUM_SETS) + " material parameters: by name " + toString(nameTime) + " ms, " +
+			"by handle " + toString(handleTime) + " ms");
+	}
+}
@@ -460,6 +460,14 @@ namespace BansheeEngine
 		return std::static_pointer_cast<MeshCore>(mCoreSpecific);
 	}
 
+	UINT64 Mesh::getMemorySize() const
+	{
+		UINT32 vertexStride = mVertexDesc != nullptr ? mVertexDesc->getVertexStride() : 0;
+		UINT32 indexSize = mIndexType == IT_32BIT ? sizeof(UINT32) : sizeof(UINT16);
+
+		return (UINT64)mProperties.getNumVertices() * vertexStride + (UINT64)mProperties.getNumIndices() * indexSize;
+	}
+
 	SPtr<CoreObjectCore> Mesh::createCore() const
 	{
 		MESH_DESC desc;
@@ -28,7 +28,7 @@ namespace BansheeEngine
 	MeshImportOptions::MeshImportOptions()
 		: mCPUReadable(false), mImportNormals(true), mImportTangents(true), mImportBlendShapes(false), mImportSkin(false)
 		, mImportAnimation(false), mReduceKeyFrames(true), mImportRootMotion(false), mImportScale(1.0f)
-		, mCollisionMeshType(CollisionMeshType::None)
+		, mCollisionMeshType(CollisionMeshType::None), mDataCompression(CompressionType::None)
 	{ }
 
 	RTTITypeBase* MeshImportOptions::getRTTIStatic()
@@ -6,6 +6,8 @@
 #include "BsMemorySerializer.h"
 #include "BsBinarySerializer.h"
 #include "BsBinaryDiff.h"
+#include "BsSerializedObject.h"
+#include "BsTaskScheduler.h"
 
 namespace BansheeEngine
 {
@@ -31,23 +33,57 @@ namespace BansheeEngine
 
 	SPtr<PrefabDiff> PrefabDiff::create(const HSceneObject& prefab, const HSceneObject& instance)
 	{
-		if (prefab->mPrefabLinkUUID != instance->mPrefabLinkUUID)
-			return nullptr;
+		Vector<SPtr<PrefabDiff>> output = create(Vector<HSceneObject>{ prefab }, Vector<HSceneObject>{ instance });
+		return output[0];
+	}
+
+	Vector<SPtr<PrefabDiff>> PrefabDiff::create(const Vector<HSceneObject>& prefabs, const Vector<HSceneObject>& instances)
+	{
+		assert(prefabs.size() == instances.size());
+
+		UINT32 numInstances = (UINT32)instances.size();
+		Vector<SPtr<PrefabDiff>> output(numInstances);
+		Vector<SPtr<PrefabObjectDiff>> roots(numInstances);
+
+		Vector<ComponentDiffJob> jobs;
+		ComponentDiffCache cache;
+
+		for (UINT32 i = 0; i < numInstances; i++)
+		{
+			const HSceneObject& prefab = prefabs[i];
+			const HSceneObject& instance = instances[i];
+
+			if (prefab->mPrefabLinkUUID != instance->mPrefabLinkUUID)
+				continue;
+
+			// Differences of components that haven't changed since the last diff was created can be reused
+			if (instance->mPrefabDiff != nullptr)
+				addToCache(instance->mPrefabDiff->mRoot, cache);
 
-		// Note: If this method is called multiple times in a row then renaming all objects every time is redundant, it
-		// would be more efficient to do it once outside of this method. I'm keeping it this way for simplicity for now.
+			// Note: If this method is called multiple times in a row then renaming all objects every time is redundant, it
+			// would be more efficient to do it once outside of this method. I'm keeping it this way for simplicity for now.
 
-		// Rename instance objects so they share the same IDs as the prefab objects (if they link IDs match). This allows
-		// game object handle diff to work properly, because otherwise handles that point to same objects would be 
-		// marked as different because the instance IDs of the two objects don't match (since one is in prefab and one
-		// in instance).
-		Vector<RenamedGameObject> renamedObjects;
-		renameInstanceIds(prefab, instance, renamedObjects);
+			// Rename instance objects so they share the same IDs as the prefab objects (if they link IDs match). This allows
+			// game object handle diff to work properly, because otherwise handles that point to same objects would be 
+			// marked as different because the instance IDs of the two objects don't match (since one is in prefab and one
+			// in instance).
+			Vector<RenamedGameObject> renamedObjects;
+			renameInstanceIds(prefab, instance, renamedObjects);
 
-		SPtr<PrefabDiff> output = bs_shared_ptr_new<PrefabDiff>();
-		output->mRoot = generateDiff(prefab, instance);
+			roots[i] = generateDiff(prefab, instance, jobs);
 
-		restoreInstanceIds(renamedObjects);
+			restoreInstanceIds(renamedObjects);
+
+			output[i] = bs_shared_ptr_new<PrefabDiff>();
+		}
+
+		generateComponentDiffs(jobs, cache);
+
+		for (UINT32 i = 0; i < numInstances; i++)
+		{
+			if (output[i] != nullptr)
+				output[i]->mRoot = removeEmptyDiffs(roots[i]);
+		}
 
 		return output;
 	}
@@ -152,51 +188,37 @@ namespace BansheeEngine
 		}
 	}
 
-	SPtr<PrefabObjectDiff> PrefabDiff::generateDiff(const HSceneObject& prefab, const HSceneObject& instance)
+	SPtr<PrefabObjectDiff> PrefabDiff::generateDiff(const HSceneObject& prefab, const HSceneObject& instance, 
+		Vector<ComponentDiffJob>& jobs)
 	{
-		SPtr<PrefabObjectDiff> output;
+		SPtr<PrefabObjectDiff> output = bs_shared_ptr_new<PrefabObjectDiff>();
 
 		if (prefab->getName() != instance->getName())
 		{
-			if (output == nullptr)
-				output = bs_shared_ptr_new<PrefabObjectDiff>();
-
 			output->name = instance->getName();
 			output->soFlags |= (UINT32)SceneObjectDiffFlags::Name;
 		}
 
 		if (prefab->getPosition() != instance->getPosition())
 		{
-			if (output == nullptr)
-				output = bs_shared_ptr_new<PrefabObjectDiff>();
-
 			output->position = instance->getPosition();
 			output->soFlags |= (UINT32)SceneObjectDiffFlags::Position;
 		}
 
 		if (prefab->getRotation() != instance->getRotation())
 		{
-			if (output == nullptr)
-				output = bs_shared_ptr_new<PrefabObjectDiff>();
-
 			output->rotation = instance->getRotation();
 			output->soFlags |= (UINT32)SceneObjectDiffFlags::Rotation;
 		}
 
 		if (prefab->getScale() != instance->getScale())
 		{
-			if (output == nullptr)
-				output = bs_shared_ptr_new<PrefabObjectDiff>();
-
 			output->scale = instance->getScale();
 			output->soFlags |= (UINT32)SceneObjectDiffFlags::Scale;
 		}
 
 		if (prefab->getActive() != instance->getActive())
 		{
-			if (output == nullptr)
-				output = bs_shared_ptr_new<PrefabObjectDiff>();
-
 			output->isActive = instance->getActive();
 			output->soFlags |= (UINT32)SceneObjectDiffFlags::Active;
 		}
@@ -218,7 +240,7 @@ namespace BansheeEngine
 				if (prefabChild->getLinkId() == instanceChild->getLinkId())
 				{
 					if (instanceChild->mPrefabLinkUUID.empty())
-						childDiff = generateDiff(prefabChild, instanceChild);
+						childDiff = generateDiff(prefabChild, instanceChild, jobs);
 
 					foundMatching = true;
 					break;
@@ -228,20 +250,10 @@ namespace BansheeEngine
 			if (foundMatching)
 			{
 				if (childDiff != nullptr)
-				{
-					if (output == nullptr)
-						output = bs_shared_ptr_new<PrefabObjectDiff>();
-
 					output->childDiffs.push_back(childDiff);
-				}
 			}
 			else
-			{
-				if (output == nullptr)
-					output = bs_shared_ptr_new<PrefabObjectDiff>();
-
 				output->removedChildren.push_back(prefabChild->getLinkId());
-			}	
 		}
 
 		// Find added children
@@ -272,9 +284,6 @@ namespace BansheeEngine
 				BinarySerializer bs;
 				SPtr<SerializedObject> obj = bs._encodeToIntermediate(instanceChild.get());
 
-				if (output == nullptr)
-					output = bs_shared_ptr_new<PrefabObjectDiff>();
-
 				output->addedChildren.push_back(obj);
 			}
 		}
@@ -290,7 +299,6 @@ namespace BansheeEngine
 		{
 			HComponent prefabComponent = prefabComponents[i];
 
-			SPtr<PrefabComponentDiff> childDiff;
 			bool foundMatching = false;
 			for (UINT32 j = 0; j < instanceComponentCount; j++)
 			{
@@ -298,42 +306,28 @@ namespace BansheeEngine
 
 				if (prefabComponent->getLinkId() == instanceComponent->getLinkId())
 				{
+					// Components must be encoded while the instance IDs are renamed, but their differences can be
+					// generated later
 					BinarySerializer bs;
-					SPtr<SerializedObject> encodedPrefab = bs._encodeToIntermediate(prefabComponent.get());
-					SPtr<SerializedObject> encodedInstance = bs._encodeToIntermediate(instanceComponent.get());
 
-					IDiff& diffHandler = prefabComponent->getRTTI()->getDiffHandler();
-					SPtr<SerializedObject> diff = diffHandler.generateDiff(encodedPrefab, encodedInstance);
+					ComponentDiffJob job;
+					job.objectDiff = output;
+					job.linkId = prefabComponent->getLinkId();
+					job.diffHandler = &prefabComponent->getRTTI()->getDiffHandler();
+					job.prefabData = bs._encodeToIntermediate(prefabComponent.get());
+					job.instanceData = bs._encodeToIntermediate(instanceComponent.get());
+					job.prefabHash = 0;
+					job.instanceHash = 0;
 
-					if (diff != nullptr)
-					{
-						childDiff = bs_shared_ptr_new<PrefabComponentDiff>();
-						childDiff->id = prefabComponent->getLinkId();
-						childDiff->data = diff;
-					}
+					jobs.push_back(job);
 
 					foundMatching = true;
 					break;
 				}
 			}
 
-			if (foundMatching)
-			{
-				if (childDiff != nullptr)
-				{
-					if (output == nullptr)
-						output = bs_shared_ptr_new<PrefabObjectDiff>();
-
-					output->componentDiffs.push_back(childDiff);
-				}
-			}
-			else
-			{
-				if (output == nullptr)
-					output = bs_shared_ptr_new<PrefabObjectDiff>();
-
+			if (!foundMatching)
 				output->removedComponents.push_back(prefabComponent->getLinkId());
-			}
 		}
 
 		// Find added components
@@ -361,19 +355,105 @@ namespace BansheeEngine
 				BinarySerializer bs;
 				SPtr<SerializedObject> obj = bs._encodeToIntermediate(instanceComponent.get());
 
-				if (output == nullptr)
-					output = bs_shared_ptr_new<PrefabObjectDiff>();
-
 				output->addedComponents.push_back(obj);
 			}
 		}
 
-		if (output != nullptr)
-			output->id = instance->getLinkId();
-
+		output->id = instance->getLinkId();
 		return output;
 	}
 
+	void PrefabDiff::generateComponentDiffs(Vector<ComponentDiffJob>& jobs, ComponentDiffCache& cache)
+	{
+		// Hashing only reads the intermediate data of the components, so it's safe to do in parallel
+		auto calculateHashes = [&jobs](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+			{
+				jobs[i].prefabHash = jobs[i].prefabData->getHash();
+				jobs[i].instanceHash = jobs[i].instanceData->getHash();
+			}
+		};
+
+		UINT32 numJobs = (UINT32)jobs.size();
+		if (numJobs > HASH_GRAIN_SIZE && TaskScheduler::isStarted())
+			TaskScheduler::instance().parallelFor(0, numJobs, HASH_GRAIN_SIZE, calculateHashes);
+		else
+			calculateHashes(0, numJobs);
+
+		// Diff handlers can call into systems that aren't thread safe (e.g. the scripting runtime), so the differences
+		// are generated on this thread
+		for (auto& job : jobs)
+		{
+			if (job.prefabHash == job.instanceHash)
+				continue;
+
+			SPtr<SerializedObject> diff;
+
+			auto key = std::make_pair(job.prefabHash, job.instanceHash);
+			auto iterFind = cache.find(key);
+			if (iterFind != cache.end())
+				diff = iterFind->second;
+			else
+			{
+				diff = job.diffHandler->generateDiff(job.prefabData, job.instanceData);
+				cache[key] = diff;
+			}
+
+			if (diff != nullptr)
+			{
+				SPtr<PrefabComponentDiff> componentDiff = bs_shared_ptr_new<PrefabComponentDiff>();
+				componentDiff->id = job.linkId;
+				componentDiff->data = diff;
+				componentDiff->prefabHash = job.prefabHash;
+				componentDiff->instanceHash = job.instanceHash;
+
+				job.objectDiff->componentDiffs.push_back(componentDiff);
+			}
+		}
+	}
+
+	void PrefabDiff::addToCache(const SPtr<PrefabObjectDiff>& diff, ComponentDiffCache& cache)
+	{
+		if (diff == nullptr)
+			return;
+
+		// Diffs loaded from disk have no hashes
+		for (auto& componentDiff : diff->componentDiffs)
+		{
+			if (componentDiff->prefabHash != 0 || componentDiff->instanceHash != 0)
+				cache[std::make_pair(componentDiff->prefabHash, componentDiff->instanceHash)] = componentDiff->data;
+		}
+
+		for (auto& childDiff : diff->childDiffs)
+			addToCache(childDiff, cache);
+	}
+
+	SPtr<PrefabObjectDiff> PrefabDiff::removeEmptyDiffs(const SPtr<PrefabObjectDiff>& diff)
+	{
+		if (diff == nullptr)
+			return nullptr;
+
+		Vector<SPtr<PrefabObjectDiff>> childDiffs;
+		for (auto& childDiff : diff->childDiffs)
+		{
+			SPtr<PrefabObjectDiff> nonEmptyDiff = removeEmptyDiffs(childDiff);
+			if (nonEmptyDiff != nullptr)
+				childDiffs.push_back(nonEmptyDiff);
+		}
+
+		diff->childDiffs = childDiffs;
+
+		bool isEmpty = diff->soFlags == 0 && diff->componentDiffs.empty() && diff->removedComponents.empty() &&
+			diff->addedComponents.empty() && diff->childDiffs.empty() && diff->removedChildren.empty() &&
+			diff->addedChildren.empty();
+
+		if (isEmpty)
+			return nullptr;
+
+		return diff;
+	}
+
 	void PrefabDiff::renameInstanceIds(const HSceneObject& prefab, const HSceneObject& instance, Vector<RenamedGameObject>& output)
 	{
 		UnorderedMap<String, UnorderedMap<UINT32, UINT64>> linkToInstanceId;
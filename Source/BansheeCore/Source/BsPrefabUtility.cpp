@@ -271,6 +271,10 @@ namespace BansheeEngine
 		Stack<HSceneObject> todo;
 		todo.push(topLevelObject);
 
+		// Diffs for all instances are created at once, so their components can be compared in parallel
+		Vector<HSceneObject> prefabs;
+		Vector<HSceneObject> instances;
+
 		while (!todo.empty())
 		{
 			HSceneObject current = todo.top();
@@ -278,11 +282,14 @@ namespace BansheeEngine
 
 			if (!current->mPrefabLinkUUID.empty())
 			{
-				current->mPrefabDiff = nullptr;
-
 				HPrefab prefabLink = static_resource_cast<Prefab>(gResources().loadFromUUID(current->mPrefabLinkUUID, false, ResourceLoadFlag::None));
 				if (prefabLink.isLoaded(false))
-					current->mPrefabDiff = PrefabDiff::create(prefabLink->_getRoot(), current->getHandle());
+				{
+					prefabs.push_back(prefabLink->_getRoot());
+					instances.push_back(current);
+				}
+				else
+					current->mPrefabDiff = nullptr;
 			}
 
 			UINT32 childCount = current->getNumChildren();
@@ -293,6 +300,10 @@ namespace BansheeEngine
 			}
 		}
 
+		Vector<SPtr<PrefabDiff>> diffs = PrefabDiff::create(prefabs, instances);
+		for (UINT32 i = 0; i < (UINT32)instances.size(); i++)
+			instances[i]->mPrefabDiff = diffs[i];
+
 		gResources().unloadAllUnused();
 	}
 
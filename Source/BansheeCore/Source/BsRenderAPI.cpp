@@ -167,6 +167,11 @@ namespace BansheeEngine
 		mCurrentCapabilities = nullptr;
     }
 
+	Vector<StringID> RenderAPICore::getTechniqueRenderAPIs() const
+	{
+		return { getName() };
+	}
+
 	SPtr<RenderWindow> RenderAPICore::initialize(const RENDER_WINDOW_DESC& primaryWindowDesc)
 	{
 		gCoreThread().queueCommand(std::bind((void(RenderAPICore::*)())&RenderAPICore::initialize, this), true);
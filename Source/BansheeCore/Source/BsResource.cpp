@@ -7,7 +7,7 @@
 namespace BansheeEngine
 {
 	Resource::Resource(bool initializeOnRenderThread)
-		:CoreObject(initializeOnRenderThread), mSize(0), mKeepSourceData(true)
+		:CoreObject(initializeOnRenderThread), mSize(0), mDataCompression(CompressionType::None), mKeepSourceData(true)
 	{ 
 		mMetaData = bs_shared_ptr_new<ResourceMetaData>();
 	}
@@ -62,6 +62,40 @@ namespace BansheeEngine
 			mFilePathToUUID.erase(iterFind->second);
 			mUUIDToFilePath.erase(uuid);
 		}
+
+		mDependencies.erase(uuid);
+	}
+
+	void ResourceManifest::registerDependencies(const String& uuid, const Vector<String>& dependencies)
+	{
+		mDependencies[uuid] = dependencies;
+	}
+
+	bool ResourceManifest::getDependencies(const String& uuid, Vector<String>& dependencies) const
+	{
+		auto iterFind = mDependencies.find(uuid);
+
+		if (iterFind != mDependencies.end())
+		{
+			dependencies = iterFind->second;
+			return true;
+		}
+		else
+		{
+			dependencies.clear();
+			return false;
+		}
+	}
+
+	Vector<String> ResourceManifest::getUUIDs() const
+	{
+		Vector<String> uuids;
+		uuids.reserve(mUUIDToFilePath.size());
+
+		for (auto& entry : mUUIDToFilePath)
+			uuids.push_back(entry.first);
+
+		return uuids;
 	}
 
 	bool ResourceManifest::uuidToFilePath(const String& uuid, Path& filePath) const
@@ -140,6 +174,8 @@ namespace BansheeEngine
 			copy->mUUIDToFilePath[elem.first] = elementRelativePath;
 		}
 
+		copy->mDependencies = manifest->mDependencies;
+
 		FileEncoder fs(path);
 		fs.encode(copy.get());
 	}
@@ -163,6 +199,8 @@ namespace BansheeEngine
 			copy->mUUIDToFilePath[elem.first] = absPath;
 		}
 
+		copy->mDependencies = manifest->mDependencies;
+
 		return copy;
 	}
 
@@ -6,17 +6,88 @@
 #include "BsException.h"
 #include "BsFileSerializer.h"
 #include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsResourcePackage.h"
 #include "BsTaskScheduler.h"
+#include "BsAsyncIO.h"
 #include "BsUUID.h"
 #include "BsDebug.h"
+#include "BsTimer.h"
+#include "BsCoreThread.h"
 #include "BsUtility.h"
 #include "BsSavedResourceData.h"
 #include "BsResourceListenerManager.h"
 
 namespace BansheeEngine
 {
+	/** Resource loaded as a part of a batch, along with its data in various stages of the load. */
+	struct Resources::BatchLoadEntry
+	{
+		BatchLoadEntry()
+			:packageEntry(nullptr), loadData(nullptr), isRoot(false), loadedElsewhere(false), allowAsync(true), size(0)
+			, compressedSize(0), readTime(0), decompressTime(0), deserializeTime(0), deserializeEndTime(0)
+		{ }
+
+		String uuid;
+		HResource resource;
+		Path filePath;
+		SPtr<ResourcePackage> package; /**< Package to read the resource from, if any. */
+		const ResourcePackageEntry* packageEntry; /**< Information about the resource in the package, if any. */
+		Vector<String> dependencies; /**< Dependencies the load is waiting on, or found to be already loaded. */
+
+		ResourceLoadData* loadData; /**< Non-null if the resource is loaded by the batch. */
+		bool isRoot; /**< True if the resource was requested by the user, rather than being a dependency. */
+		bool loadedElsewhere; /**< True if the resource was already being loaded outside of the batch. */
+		bool allowAsync;
+
+		SPtr<DataStream> data;
+		SPtr<MappedFileDataStream> compressedData; /**< Data read from the package, if it needs to be decompressed. */
+		Vector<String> fileDependencies;
+		SPtr<Resource> loadedData;
+		UINT64 size;
+		UINT64 compressedSize;
+
+		UINT64 readTime;
+		UINT64 decompressTime;
+		UINT64 deserializeTime;
+		UINT64 deserializeEndTime;
+	};
+
+	/** State of a batch being loaded by Resources::loadBatch(). */
+	struct Resources::BatchLoadState
+	{
+		BatchLoadState()
+			:keepSourceData(false), mapFile(false)
+		{ }
+
+		SPtr<ResourceManifest> manifest;
+		ResourceLoadFlags loadFlags;
+		bool keepSourceData;
+		bool mapFile;
+		Timer timer;
+
+		Vector<SPtr<BatchLoadEntry>> entries;
+		UnorderedMap<String, BatchLoadEntry*> entryLookup;
+		Vector<BatchLoadEntry*> readQueue;
+
+		/** 
+		 * Entries whose stage finished on a worker thread, or on the core thread for uploads. Accessed by other threads,
+		 * protected by the mutex.
+		 */
+		Vector<BatchLoadEntry*> readComplete;
+		Vector<BatchLoadEntry*> decompressComplete;
+		Vector<BatchLoadEntry*> deserializeComplete;
+		Vector<BatchLoadEntry*> uploadComplete;
+		Mutex mutex;
+		Signal signal;
+	};
+
 	Resources::Resources()
+		:mResidencyBudget(0), mNextUse(1)
 	{
+		for (auto& residentBytes : mResidentBytes)
+			residentBytes = 0;
+
 		mDefaultResourceManifest = ResourceManifest::create("Default");
 		mResourceManifests.push_back(mDefaultResourceManifest);
 	}
@@ -37,16 +108,17 @@ namespace BansheeEngine
 
 	HResource Resources::load(const Path& filePath, ResourceLoadFlags loadFlags)
 	{
-		if (!FileSystem::isFile(filePath))
+		String uuid;
+		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
+
+		// Packaged resources don't need their individual files
+		if ((!foundUUID || findResourcePackage(uuid) == nullptr) && !FileSystem::isFile(filePath))
 		{
 			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 
 			return HResource();
 		}
 
-		String uuid;
-		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
-
 		if (!foundUUID)
 			uuid = UUIDGenerator::generateRandom();
 
@@ -64,16 +136,17 @@ namespace BansheeEngine
 
 	HResource Resources::loadAsync(const Path& filePath, ResourceLoadFlags loadFlags)
 	{
-		if (!FileSystem::isFile(filePath))
+		String uuid;
+		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
+
+		// Packaged resources don't need their individual files
+		if ((!foundUUID || findResourcePackage(uuid) == nullptr) && !FileSystem::isFile(filePath))
 		{
 			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 
 			return HResource();
 		}
 
-		String uuid;
-		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
-
 		if (!foundUUID)
 			uuid = UUIDGenerator::generateRandom();
 
@@ -95,6 +168,18 @@ namespace BansheeEngine
 		return loadInternal(uuid, filePath, !async, loadFlags);
 	}
 
+	Vector<HResource> Resources::loadBatch(const Vector<String>& uuids, ResourceLoadFlags loadFlags,
+		ResourceBatchLoadStats* stats)
+	{
+		return loadBatchInternal(uuids, nullptr, loadFlags, stats);
+	}
+
+	Vector<HResource> Resources::loadBatch(const SPtr<ResourceManifest>& manifest, ResourceLoadFlags loadFlags,
+		ResourceBatchLoadStats* stats)
+	{
+		return loadBatchInternal(manifest->getUUIDs(), manifest, loadFlags, stats);
+	}
+
 	HResource Resources::loadInternal(const String& UUID, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags)
 	{
 		HResource outputResource;
@@ -139,6 +224,7 @@ namespace BansheeEngine
 						outputResource.addInternalRef();
 					}
 
+					markUsed(UUID, resData);
 					alreadyLoading = true;
 				}
 			}
@@ -160,9 +246,23 @@ namespace BansheeEngine
 			}			
 		}
 
+		bool keepSourceData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
+		bool mapFile = loadFlags.isSet(ResourceLoadFlag::MapFile) && !keepSourceData;
+
+		// Resources in registered packages are loaded from the package, regardless of the provided path
+		SPtr<DataStream> packageData;
+		SPtr<ResourcePackage> package = findResourcePackage(UUID);
+		if (package != nullptr)
+		{
+			packageData = ResourcePackage::decompressEntry(*package->getEntry(UUID), package->openEntry(UUID));
+
+			if (packageData == nullptr)
+				LOGERR("Unable to load resource with UUID \"" + UUID + "\". Its data in the resource package is corrupt.");
+		}
+
 		// We have nowhere to load from, warn and complete load if a file path was provided,
 		// otherwise pass through as we might just want to load from memory. 
-		if (filePath.isEmpty())
+		if (packageData == nullptr && filePath.isEmpty())
 		{
 			if (!alreadyLoading)
 			{
@@ -174,7 +274,7 @@ namespace BansheeEngine
 				return outputResource;
 			}
 		}
-		else if (!FileSystem::isFile(filePath))
+		else if (packageData == nullptr && !FileSystem::isFile(filePath))
 		{
 			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 
@@ -186,9 +286,15 @@ namespace BansheeEngine
 			return outputResource;
 		}
 
-		// Load dependency data if a file path is provided
+		// Load dependency data if a file path is provided. Package data is left positioned after it, ready for
+		// deserialization.
 		SPtr<SavedResourceData> savedResourceData;
-		if (!filePath.isEmpty())
+		if (packageData != nullptr)
+		{
+			FileDecoder fs(packageData);
+			savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
+		}
+		else if (!filePath.isEmpty())
 		{
 			FileDecoder fs(filePath);
 			savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
@@ -237,6 +343,9 @@ namespace BansheeEngine
 				if (loadFlags.isSet(ResourceLoadFlag::KeepSourceData))
 					depLoadFlags |= ResourceLoadFlag::KeepSourceData;
 
+				if (loadFlags.isSet(ResourceLoadFlag::MapFile))
+					depLoadFlags |= ResourceLoadFlag::MapFile;
+
 				for (UINT32 i = 0; i < numDependencies; i++)
 					dependencies[i] = loadFromUUID(dependencyUUIDs[i], !synchronous, depLoadFlags);
 
@@ -308,27 +417,30 @@ namespace BansheeEngine
 				if (loadFlags.isSet(ResourceLoadFlag::KeepSourceData))
 					depLoadFlags |= ResourceLoadFlag::KeepSourceData;
 
+				if (loadFlags.isSet(ResourceLoadFlag::MapFile))
+					depLoadFlags |= ResourceLoadFlag::MapFile;
+
 				for (auto& dependency : dependencies)
 					loadFromUUID(dependency, !synchronous, depLoadFlags);
 			}
 		}
 
 		// Actually start the file read operation if not already loaded or in progress
-		if (!alreadyLoading && !filePath.isEmpty())
+		if (!alreadyLoading && (packageData != nullptr || !filePath.isEmpty()))
 		{
 			// Synchronous or the resource doesn't support async, read the file immediately
 			if (synchronous || !savedResourceData->allowAsyncLoading())
 			{
-				loadCallback(filePath, outputResource, loadFlags.isSet(ResourceLoadFlag::KeepSourceData));
+				loadCallback(filePath, packageData, outputResource, keepSourceData, mapFile);
 			}
 			else // Asynchronous, read the file on a worker thread
 			{
 				String fileName = filePath.getFilename();
 				String taskName = "Resource load: " + fileName;
 
-				bool keepSourceData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
 				SPtr<Task> task = Task::create(taskName, 
-					std::bind(&Resources::loadCallback, this, filePath, outputResource, keepSourceData));
+					std::bind(&Resources::loadCallback, this, filePath, packageData, outputResource, keepSourceData, 
+					mapFile));
 				TaskScheduler::instance().addTask(task);
 			}
 		}
@@ -353,16 +465,578 @@ namespace BansheeEngine
 		return outputResource;
 	}
 
-	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData)
+	Vector<HResource> Resources::loadBatchInternal(const Vector<String>& uuids, const SPtr<ResourceManifest>& manifest,
+		ResourceLoadFlags loadFlags, ResourceBatchLoadStats* stats)
 	{
-		FileDecoder fs(filePath);
+		BatchLoadState state;
+		UINT64 startTime = state.timer.getMicroseconds();
+
+		state.manifest = manifest;
+		state.loadFlags = loadFlags;
+		state.keepSourceData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
+		state.mapFile = loadFlags.isSet(ResourceLoadFlag::MapFile) && !state.keepSourceData;
+
+		addBatchEntries(state, uuids, true);
+
+		ResourceBatchLoadStats batchStats;
+		batchStats.resolveTime = state.timer.getMicroseconds() - startTime;
+
+		UINT32 maxReads = std::max(mBatchLoadLimits.maxReads, 1U);
+		UINT32 maxDecompressions = std::max(mBatchLoadLimits.maxDecompressions, 1U);
+		UINT32 maxDeserializations = std::max(mBatchLoadLimits.maxDeserializations, 1U);
+		UINT32 maxPendingUploads = std::max(mBatchLoadLimits.maxPendingUploads, 1U);
+
+		Vector<BatchLoadEntry*> decompressQueue;
+		Vector<BatchLoadEntry*> deserializeQueue;
+		UINT32 readIdx = 0;
+		UINT32 decompressIdx = 0;
+		UINT32 deserializeIdx = 0;
+
+		UINT32 numReads = 0;
+		UINT32 numDecompressions = 0;
+		UINT32 numDeserializations = 0;
+		UINT32 numUploads = 0;
+		UINT64 numBufferedBytes = 0;
+
+		// Queues a read and decoded entry for deserialization, once any dependencies missing from the dependency tables
+		// are added to the batch
+		auto queueDeserialization = [&](BatchLoadEntry* entry)
+		{
+			if (loadFlags.isSet(ResourceLoadFlag::LoadDependencies))
+			{
+				Vector<String> missingDependencies;
+				Vector<String> newUUIDs;
+				for (auto& dependency : entry->fileDependencies)
+				{
+					if (dependency == entry->uuid)
+						continue;
+
+					auto iterFind = std::find(entry->dependencies.begin(), entry->dependencies.end(), dependency);
+					if (iterFind != entry->dependencies.end())
+						continue;
+
+					missingDependencies.push_back(dependency);
+
+					if (state.entryLookup.find(dependency) == state.entryLookup.end())
+						newUUIDs.push_back(dependency);
+				}
+
+				if (!missingDependencies.empty())
+				{
+					batchStats.numDiscoveredDependencies += (UINT32)missingDependencies.size();
+
+					if (!newUUIDs.empty())
+						addBatchEntries(state, newUUIDs, false);
+
+					Lock lock(mInProgressResourcesMutex);
+					waitForBatchDependencies(state, entry, missingDependencies);
+				}
+			}
+
+			deserializeQueue.push_back(entry);
+		};
+
+		Vector<BatchLoadEntry*> readComplete;
+		Vector<BatchLoadEntry*> decompressComplete;
+		Vector<BatchLoadEntry*> deserializeComplete;
+		Vector<BatchLoadEntry*> uploadComplete;
+		while (true)
+		{
+			// Start reading new files, unless too much read data is waiting to be deserialized
+			while (readIdx < (UINT32)state.readQueue.size() && numReads < maxReads && 
+				numBufferedBytes < mBatchLoadLimits.maxBufferedBytes)
+			{
+				BatchLoadEntry* entry = state.readQueue[readIdx++];
+				numReads++;
+
+				// Plain files are read on the I/O threads, so worker threads only run once the data is in memory
+				if (entry->package == nullptr && !state.mapFile && AsyncIO::isStarted())
+				{
+					UINT64 readStartTime = state.timer.getMicroseconds();
+					auto readCallback = [this, &state, entry, readStartTime](const SPtr<MemoryDataStream>& data)
+					{
+						auto decode = [this, &state, entry, readStartTime, data]()
+						{
+							decodeBatchEntry(entry, data);
+							completeBatchRead(state, entry, readStartTime);
+						};
+
+						SPtr<Task> task = Task::create("Resource decode: " + entry->filePath.getFilename(), decode);
+						TaskScheduler::instance().addTask(task);
+					};
+
+					AsyncIO::instance().readFile(entry->filePath, 0, AsyncIO::READ_TO_END, readCallback);
+				}
+				else
+				{
+					SPtr<Task> task = Task::create("Resource read: " + entry->filePath.getFilename(),
+						std::bind(&Resources::readBatchEntry, this, std::ref(state), entry));
+					TaskScheduler::instance().addTask(task);
+				}
+			}
+
+			// Start decompressing read data. Its size is already accounted for by the buffered bytes limit.
+			while (decompressIdx < (UINT32)decompressQueue.size() && numDecompressions < maxDecompressions)
+			{
+				BatchLoadEntry* entry = decompressQueue[decompressIdx++];
+				numDecompressions++;
+
+				SPtr<Task> task = Task::create("Resource decompress: " + entry->filePath.getFilename(),
+					std::bind(&Resources::decompressBatchEntry, this, std::ref(state), entry));
+				TaskScheduler::instance().addTask(task);
+			}
+
+			// Start deserializing read files, unless too many resources are waiting on the core thread
+			while (deserializeIdx < (UINT32)deserializeQueue.size() && numDeserializations < maxDeserializations &&
+				(numUploads + numDeserializations) < maxPendingUploads)
+			{
+				BatchLoadEntry* entry = deserializeQueue[deserializeIdx++];
+				numDeserializations++;
+
+				if (entry->allowAsync)
+				{
+					SPtr<Task> task = Task::create("Resource deserialize: " + entry->filePath.getFilename(),
+						std::bind(&Resources::deserializeBatchEntry, this, std::ref(state), entry));
+					TaskScheduler::instance().addTask(task);
+				}
+				else
+					deserializeBatchEntry(state, entry);
+			}
+
+			// Complete loads of resources whose core thread initialization is done
+			for (auto& entry : uploadComplete)
+			{
+				numUploads--;
+				batchStats.uploadTime += state.timer.getMicroseconds() - entry->deserializeEndTime;
+
+				setLoadedData(entry->resource, entry->loadedData);
+				entry->loadedData = nullptr;
+			}
+
+			uploadComplete.clear();
+
+			bool readsQueued = readIdx < (UINT32)state.readQueue.size();
+			bool decompressionsQueued = decompressIdx < (UINT32)decompressQueue.size();
+			bool deserializationsQueued = deserializeIdx < (UINT32)deserializeQueue.size();
+			if (numReads == 0 && numDecompressions == 0 && numDeserializations == 0 && numUploads == 0 && 
+				!readsQueued && !decompressionsQueued && !deserializationsQueued)
+			{
+				break;
+			}
+
+			// Wait for the worker threads, or the core thread, to finish any of the stages
+			{
+				Lock lock(state.mutex);
+				while (state.readComplete.empty() && state.decompressComplete.empty() && 
+					state.deserializeComplete.empty() && state.uploadComplete.empty())
+				{
+					state.signal.wait(lock);
+				}
+
+				std::swap(readComplete, state.readComplete);
+				std::swap(decompressComplete, state.decompressComplete);
+				std::swap(deserializeComplete, state.deserializeComplete);
+				std::swap(uploadComplete, state.uploadComplete);
+			}
+
+			for (auto& entry : readComplete)
+			{
+				numReads--;
+				batchStats.readTime += entry->readTime;
+
+				if (entry->compressedData != nullptr)
+				{
+					numBufferedBytes += entry->compressedSize;
+					batchStats.numBytesRead += entry->compressedSize;
+
+					decompressQueue.push_back(entry);
+					continue;
+				}
+
+				if (entry->data == nullptr)
+				{
+					setLoadedData(entry->resource, nullptr);
+					continue;
+				}
+
+				numBufferedBytes += entry->size;
+				batchStats.numBytesRead += entry->size;
+
+				queueDeserialization(entry);
+			}
+
+			for (auto& entry : decompressComplete)
+			{
+				numDecompressions--;
+				numBufferedBytes -= entry->compressedSize;
+				batchStats.decompressTime += entry->decompressTime;
+
+				if (entry->data == nullptr)
+				{
+					setLoadedData(entry->resource, nullptr);
+					continue;
+				}
+
+				numBufferedBytes += entry->size;
+				queueDeserialization(entry);
+			}
+
+			for (auto& entry : deserializeComplete)
+			{
+				numDeserializations--;
+				numBufferedBytes -= entry->size;
+
+				batchStats.deserializeTime += entry->deserializeTime;
+				batchStats.numResources++;
+
+				numUploads++;
+
+				// Core thread executes commands in the order they were queued, so this runs after the initialization 
+				// queued during deserialization
+				if (entry->loadedData != nullptr && !entry->loadedData->isCoreInitialized())
+				{
+					CoreThread::instance().queueCommand(
+						std::bind(&Resources::completeBatchUpload, this, std::ref(state), entry));
+				}
+				else
+					uploadComplete.push_back(entry);
+			}
+
+			readComplete.clear();
+			decompressComplete.clear();
+			deserializeComplete.clear();
+		}
+
+		Vector<HResource> output;
+		output.reserve(uuids.size());
+
+		for (auto& uuid : uuids)
+		{
+			BatchLoadEntry* entry = state.entryLookup[uuid];
+
+			// Same as with synchronous loads, wait on resources that were already being loaded asynchronously
+			if (entry->loadedElsewhere)
+				entry->resource.blockUntilLoaded();
+
+			output.push_back(entry->resource);
+		}
+
+		batchStats.totalTime = state.timer.getMicroseconds() - startTime;
+
+		if (stats != nullptr)
+			*stats = batchStats;
+
+		return output;
+	}
+
+	void Resources::addBatchEntries(BatchLoadState& state, const Vector<String>& uuids, bool isRoot)
+	{
+		// Find file paths and dependencies of the resources, and of all of their dependencies
+		bool loadDependencies = state.loadFlags.isSet(ResourceLoadFlag::LoadDependencies);
+
+		Vector<BatchLoadEntry*> newEntries;
+		Vector<String> todo(uuids.rbegin(), uuids.rend());
+		UINT32 numRoots = isRoot ? (UINT32)uuids.size() : 0;
+
+		while (!todo.empty())
+		{
+			String uuid = todo.back();
+			todo.pop_back();
+
+			bool isEntryRoot = numRoots > 0;
+			if (numRoots > 0)
+				numRoots--;
+
+			if (state.entryLookup.find(uuid) != state.entryLookup.end())
+				continue;
+
+			SPtr<BatchLoadEntry> entry = bs_shared_ptr_new<BatchLoadEntry>();
+			entry->uuid = uuid;
+			entry->isRoot = isEntryRoot;
+
+			// Packaged resources are read from the package, which also knows their dependencies
+			const ResourcePackageEntry* packageEntry = nullptr;
+			entry->package = findResourcePackage(uuid);
+			if (entry->package != nullptr)
+			{
+				packageEntry = entry->package->getEntry(uuid);
+				entry->packageEntry = packageEntry;
+				entry->filePath = entry->package->getPath();
+			}
+			else if (state.manifest == nullptr || !state.manifest->uuidToFilePath(uuid, entry->filePath))
+				getFilePathFromUUID(uuid, entry->filePath);
+
+			if (loadDependencies)
+			{
+				Vector<String> dependencies;
+				bool foundDependencies = false;
+				if (packageEntry != nullptr)
+				{
+					dependencies = packageEntry->dependencies;
+					foundDependencies = true;
+				}
+				else if (state.manifest != nullptr)
+					foundDependencies = state.manifest->getDependencies(uuid, dependencies);
+
+				// Default manifest is at 0th index but all other take priority since Default manifest could
+				// contain obsolete data. 
+				for (auto iter = mResourceManifests.rbegin(); !foundDependencies && iter != mResourceManifests.rend(); ++iter)
+					foundDependencies = (*iter)->getDependencies(uuid, dependencies);
+
+				for (auto& dependency : dependencies)
+				{
+					if (dependency == uuid)
+						continue;
+
+					entry->dependencies.push_back(dependency);
+					todo.push_back(dependency);
+				}
+			}
+
+			state.entryLookup[uuid] = entry.get();
+			state.entries.push_back(entry);
+			newEntries.push_back(entry.get());
+		}
+
+		// Register all new entries at once, rather than locking for every resource
+		bool keepInternalRef = state.loadFlags.isSet(ResourceLoadFlag::KeepInternalRef);
+		{
+			Lock inProgressLock(mInProgressResourcesMutex);
+
+			{
+				Lock loadedLock(mLoadedResourceMutex);
+				for (auto& entry : newEntries)
+				{
+					LoadedResourceData* resData = nullptr;
+
+					auto iterFind = mInProgressResources.find(entry->uuid);
+					if (iterFind != mInProgressResources.end())
+					{
+						resData = &iterFind->second->resData;
+						entry->loadedElsewhere = true;
+					}
+					else
+					{
+						auto iterFind2 = mLoadedResources.find(entry->uuid);
+						if (iterFind2 != mLoadedResources.end())
+						{
+							resData = &iterFind2->second;
+
+							if (entry->isRoot)
+								markUsed(entry->uuid, *resData);
+						}
+					}
+
+					// Already loaded or in progress
+					if (resData != nullptr)
+					{
+						entry->resource = resData->resource.lock();
+
+						if (entry->isRoot && keepInternalRef)
+						{
+							resData->numInternalRefs++;
+							entry->resource.addInternalRef();
+						}
+
+						continue;
+					}
+
+					auto iterFind3 = mHandles.find(entry->uuid);
+					if (iterFind3 != mHandles.end())
+						entry->resource = iterFind3->second.lock();
+					else
+					{
+						entry->resource = HResource(entry->uuid);
+						mHandles[entry->uuid] = entry->resource.getWeak();
+					}
+
+					if (entry->filePath.isEmpty())
+					{
+						LOGWRN_VERBOSE("Cannot load resource. Resource with UUID '" + entry->uuid + "' doesn't exist.");
+						continue;
+					}
+
+					ResourceLoadData* loadData = bs_new<ResourceLoadData>(entry->resource.getWeak(), 1);
+					loadData->notifyImmediately = true; // Loads are completed on the calling thread
+
+					if (entry->isRoot && keepInternalRef)
+					{
+						loadData->resData.numInternalRefs++;
+						entry->resource.addInternalRef();
+					}
+
+					mInProgressResources[entry->uuid] = loadData;
+					entry->loadData = loadData;
+
+					state.readQueue.push_back(entry);
+				}
+			}
+
+			// All dependencies are registered at this point, so loads can wait on them
+			for (auto& entry : newEntries)
+			{
+				if (entry->loadData == nullptr)
+					continue;
+
+				Vector<String> dependencies;
+				std::swap(dependencies, entry->dependencies);
+
+				waitForBatchDependencies(state, entry, dependencies);
+			}
+		}
+	}
+
+	void Resources::waitForBatchDependencies(BatchLoadState& state, BatchLoadEntry* entry, 
+		const Vector<String>& dependencies)
+	{
+		for (auto& dependency : dependencies)
+		{
+			entry->dependencies.push_back(dependency);
+
+			// Dependencies that are already loaded, or that couldn't be loaded, don't need to be waited on
+			if (mInProgressResources.find(dependency) == mInProgressResources.end())
+				continue;
+
+			mDependantLoads[dependency].push_back(entry->loadData);
+			entry->loadData->remainingDependencies++;
+			entry->loadData->dependencies.push_back(state.entryLookup[dependency]->resource);
+		}
+	}
+
+	void Resources::readBatchEntry(BatchLoadState& state, BatchLoadEntry* entry)
+	{
+		UINT64 startTime = state.timer.getMicroseconds();
+
+		SPtr<DataStream> stream;
+		if (entry->package != nullptr)
+		{
+			SPtr<MappedFileDataStream> packageData = entry->package->openEntry(entry->uuid);
+
+			// Compressed data is decoded by the decompression stage
+			if (entry->packageEntry->compression != ResourceCompression::None)
+			{
+				entry->compressedData = packageData;
+				entry->compressedSize = packageData->size();
+
+				completeBatchRead(state, entry, startTime);
+				return;
+			}
+
+			stream = packageData;
+
+			// Only reference the package mapping directly if requested, same as with individual files
+			if (!state.mapFile)
+				stream = stream->clone(true);
+		}
+		else if (state.mapFile)
+			stream = FileSystem::openFileMapped(entry->filePath);
+		else
+		{
+			// Read the entire file at once, so the deserializer never has to wait on the disk
+			SPtr<DataStream> fileStream = FileSystem::openFile(entry->filePath, true);
+			if (fileStream != nullptr && fileStream->size() > 0)
+				stream = bs_shared_ptr_new<MemoryDataStream>(fileStream);
+		}
+
+		decodeBatchEntry(entry, stream);
+		completeBatchRead(state, entry, startTime);
+	}
+
+	void Resources::decodeBatchEntry(BatchLoadEntry* entry, const SPtr<DataStream>& stream)
+	{
+		if (stream != nullptr && stream->size() > 0)
+		{
+			FileDecoder decoder(stream);
+			SPtr<SavedResourceData> savedResourceData = std::static_pointer_cast<SavedResourceData>(decoder.decode());
+
+			if (savedResourceData != nullptr)
+			{
+				entry->fileDependencies = savedResourceData->getDependencies();
+				entry->allowAsync = savedResourceData->allowAsyncLoading();
+				entry->size = stream->size();
+				entry->data = stream;
+			}
+		}
+
+		if (entry->data == nullptr)
+			LOGERR("Unable to load resource at path \"" + entry->filePath.toString() + "\"");
+	}
+
+	void Resources::completeBatchRead(BatchLoadState& state, BatchLoadEntry* entry, UINT64 startTime)
+	{
+		entry->readTime = state.timer.getMicroseconds() - startTime;
+
+		{
+			Lock lock(state.mutex);
+			state.readComplete.push_back(entry);
+		}
+
+		state.signal.notify_one();
+	}
+
+	void Resources::decompressBatchEntry(BatchLoadState& state, BatchLoadEntry* entry)
+	{
+		UINT64 startTime = state.timer.getMicroseconds();
+
+		SPtr<MemoryDataStream> data = ResourcePackage::decompressEntry(*entry->packageEntry, entry->compressedData);
+		entry->compressedData = nullptr;
+
+		decodeBatchEntry(entry, data);
+		entry->decompressTime = state.timer.getMicroseconds() - startTime;
+
+		{
+			Lock lock(state.mutex);
+			state.decompressComplete.push_back(entry);
+		}
+
+		state.signal.notify_one();
+	}
+
+	void Resources::deserializeBatchEntry(BatchLoadState& state, BatchLoadEntry* entry)
+	{
+		UINT64 startTime = state.timer.getMicroseconds();
+
+		FileDecoder decoder(entry->data);
+		entry->loadedData = deserialize(decoder, entry->filePath, state.keepSourceData);
+		entry->data = nullptr;
+
+		UINT64 endTime = state.timer.getMicroseconds();
+		entry->deserializeTime = endTime - startTime;
+		entry->deserializeEndTime = endTime;
+
+		{
+			Lock lock(state.mutex);
+			state.deserializeComplete.push_back(entry);
+		}
+
+		state.signal.notify_one();
+	}
+
+	void Resources::completeBatchUpload(BatchLoadState& state, BatchLoadEntry* entry)
+	{
+		{
+			Lock lock(state.mutex);
+			state.uploadComplete.push_back(entry);
+		}
+
+		state.signal.notify_one();
+	}
+
+	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData, bool mapFile)
+	{
+		FileDecoder fs(filePath, mapFile);
 		fs.skip(); // Skipped over saved resource data
 
+		return deserialize(fs, filePath, loadWithSaveData);
+	}
+
+	SPtr<Resource> Resources::deserialize(FileDecoder& decoder, const Path& filePath, bool loadWithSaveData)
+	{
 		UnorderedMap<String, UINT64> loadParams;
 		if(loadWithSaveData)
 			loadParams["keepSourceData"] = 1;
 
-		SPtr<IReflectable> loadedData = fs.decode(loadParams);
+		SPtr<IReflectable> loadedData = decoder.decode(loadParams);
 
 		if (loadedData == nullptr)
 		{
@@ -408,6 +1082,8 @@ namespace BansheeEngine
 					resData.numInternalRefs--;
 					resource.removeInternalRef();
 
+					markUsed(UUID, resData);
+
 					return;
 				}
 			}
@@ -438,6 +1114,103 @@ namespace BansheeEngine
 		}
 	}
 
+	void Resources::setResidencyBudget(UINT64 numBytes)
+	{
+		mResidencyBudget = numBytes;
+		enforceResidencyBudget();
+	}
+
+	UINT64 Resources::getResidentBytes() const
+	{
+		UINT64 total = 0;
+		for (auto& residentBytes : mResidentBytes)
+			total += residentBytes;
+
+		return total;
+	}
+
+	void Resources::_update()
+	{
+		enforceResidencyBudget();
+	}
+
+	void Resources::enforceResidencyBudget()
+	{
+		if (mResidencyBudget == 0)
+			return;
+
+		UINT64 residentBytes = getResidentBytes();
+		if (residentBytes <= mResidencyBudget)
+			return;
+
+		Vector<std::pair<HResource, UINT32>> resourcesToUnload;
+		{
+			Lock lock(mLoadedResourceMutex);
+			for (auto& entry : mUsageOrder)
+			{
+				if (residentBytes <= mResidencyBudget)
+					break;
+
+				auto iterFind = mLoadedResources.find(entry.second);
+				if (iterFind == mLoadedResources.end())
+					continue;
+
+				// Only unload resources that nothing outside of the resources system references, and that free up memory
+				const LoadedResourceData& resData = iterFind->second;
+				if (resData.numInternalRefs == 0 || resData.resource.mData->mRefCount != resData.numInternalRefs ||
+					resData.memorySize == 0)
+				{
+					continue;
+				}
+
+				resourcesToUnload.push_back(std::make_pair(resData.resource.lock(), resData.numInternalRefs));
+				residentBytes -= std::min(resData.memorySize, residentBytes);
+			}
+		}
+
+		// Resources get destroyed once the handles above go out of scope, same as with unloadAllUnused()
+		for (auto& entry : resourcesToUnload)
+		{
+			for (UINT32 i = 0; i < entry.second; i++)
+				release(entry.first);
+		}
+	}
+
+	void Resources::addResidency(const String& uuid, LoadedResourceData& resData, const SPtr<Resource>& resource)
+	{
+		removeResidency(resData);
+
+		if (resource != nullptr)
+		{
+			resData.memorySize = resource->getMemorySize();
+			resData.memoryType = resource->getMemoryType();
+			mResidentBytes[(UINT32)resData.memoryType] += resData.memorySize;
+		}
+
+		markUsed(uuid, resData);
+	}
+
+	void Resources::removeResidency(LoadedResourceData& resData)
+	{
+		mResidentBytes[(UINT32)resData.memoryType] -= resData.memorySize;
+		resData.memorySize = 0;
+
+		if (resData.lastUse != 0)
+		{
+			mUsageOrder.erase(resData.lastUse);
+			resData.lastUse = 0;
+		}
+	}
+
+	void Resources::markUsed(const String& uuid, LoadedResourceData& resData)
+	{
+		if (resData.lastUse != 0)
+			mUsageOrder.erase(resData.lastUse);
+
+		resData.lastUse = mNextUse++;
+		mUsageOrder[resData.lastUse] = uuid;
+	}
+
 	void Resources::destroy(ResourceHandleBase& resource)
 	{
 		if (resource.mData == nullptr)
@@ -477,6 +1250,7 @@ namespace BansheeEngine
 					resData.resource.removeInternalRef();
 				}
 
+				removeResidency(resData);
 				mLoadedResources.erase(iterFind);
 			}
 			else
@@ -533,6 +1307,13 @@ namespace BansheeEngine
 
 		SPtr<SavedResourceData> resourceData = bs_shared_ptr_new<SavedResourceData>(dependencyUUIDs, resource->allowAsyncLoading());
 
+		// Keep the dependency tables up to date, so batch loads don't need to open the file to find dependencies
+		for (auto& manifest : mResourceManifests)
+		{
+			if (manifest->uuidExists(resource.getUUID()))
+				manifest->registerDependencies(resource.getUUID(), dependencyUUIDs);
+		}
+
 		FileEncoder fs(filePath);
 		fs.encode(resourceData.get());
 		fs.encode(resource.get());
@@ -560,7 +1341,11 @@ namespace BansheeEngine
 			{
 				LoadedResourceData& resData = mLoadedResources[uuid];
 				resData.resource = handle.getWeak();
+
+				addResidency(uuid, resData, resource);
 			}
+			else
+				addResidency(uuid, iterFind->second, resource);
 		}
 
 		onResourceModified(handle);
@@ -601,6 +1386,22 @@ namespace BansheeEngine
 			mResourceManifests.erase(findIter);
 	}
 
+	void Resources::registerResourcePackage(const SPtr<ResourcePackage>& package)
+	{
+		auto findIter = std::find(mResourcePackages.begin(), mResourcePackages.end(), package);
+		if (findIter != mResourcePackages.end())
+			mResourcePackages.erase(findIter);
+
+		mResourcePackages.push_back(package);
+	}
+
+	void Resources::unregisterResourcePackage(const SPtr<ResourcePackage>& package)
+	{
+		auto findIter = std::find(mResourcePackages.begin(), mResourcePackages.end(), package);
+		if (findIter != mResourcePackages.end())
+			mResourcePackages.erase(findIter);
+	}
+
 	SPtr<ResourceManifest> Resources::getResourceManifest(const String& name) const
 	{
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
@@ -652,6 +1453,8 @@ namespace BansheeEngine
 			LoadedResourceData& resData = mLoadedResources[UUID];
 			resData.resource = newHandle.getWeak();
 			mHandles[UUID] = newHandle.getWeak();
+
+			addResidency(UUID, resData, obj);
 		}
 
 		return newHandle;
@@ -734,7 +1537,12 @@ namespace BansheeEngine
 				{
 					Lock loadedLock(mLoadedResourceMutex);
 
-					mLoadedResources[uuid] = myLoadData->resData;
+					LoadedResourceData& resData = mLoadedResources[uuid];
+					removeResidency(resData);
+
+					resData = myLoadData->resData;
+					addResidency(uuid, resData, myLoadData->loadedData);
+
 					resource.setHandleData(myLoadData->loadedData, uuid);
 				}
 
@@ -761,16 +1569,48 @@ namespace BansheeEngine
 		}
 	}
 
-	void Resources::loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData)
+	void Resources::loadCallback(const Path& filePath, const SPtr<DataStream>& packageData, HResource& resource, 
+		bool loadWithSaveData, bool mapFile)
 	{
-		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(filePath, loadWithSaveData);
+		SPtr<Resource> rawResource;
+		if (packageData != nullptr)
+		{
+			// Only reference the package mapping directly if requested, same as with individual files
+			SPtr<DataStream> data = packageData;
+			if (!mapFile)
+			{
+				data = packageData->clone(true);
+				data->seek(packageData->tell());
+			}
+
+			FileDecoder fs(data);
+			rawResource = deserialize(fs, filePath, loadWithSaveData);
+		}
+		else
+			rawResource = loadFromDiskAndDeserialize(filePath, loadWithSaveData, mapFile);
 
+		setLoadedData(resource, rawResource);
+	}
+
+	SPtr<ResourcePackage> Resources::findResourcePackage(const String& uuid) const
+	{
+		for (auto iter = mResourcePackages.rbegin(); iter != mResourcePackages.rend(); ++iter)
+		{
+			if ((*iter)->contains(uuid))
+				return *iter;
+		}
+
+		return nullptr;
+	}
+
+	void Resources::setLoadedData(HResource& resource, const SPtr<Resource>& loadedData)
+	{
 		{
 			Lock lock(mInProgressResourcesMutex);
 
 			// Check if all my dependencies are loaded
 			ResourceLoadData* myLoadData = mInProgressResources[resource.getUUID()];
-			myLoadData->loadedData = rawResource;
+			myLoadData->loadedData = loadedData;
 			myLoadData->remainingDependencies--;
 		}
 
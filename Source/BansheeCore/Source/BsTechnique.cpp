@@ -19,8 +19,14 @@ namespace BansheeEngine
 
 	bool TechniqueBase::isSupported() const
 	{
-		if ((RenderAPICore::instancePtr()->getName() == mRenderAPI ||
-			RenderAPIAny == mRenderAPI) &&
+		bool isAPISupported = RenderAPIAny == mRenderAPI;
+		if (!isAPISupported)
+		{
+			Vector<StringID> techniqueAPIs = RenderAPICore::instancePtr()->getTechniqueRenderAPIs();
+			isAPISupported = std::find(techniqueAPIs.begin(), techniqueAPIs.end(), mRenderAPI) != techniqueAPIs.end();
+		}
+
+		if (isAPISupported &&
 			(RendererManager::instance().getActive()->getName() == mRenderer ||
 			RendererAny == mRenderer))
 		{
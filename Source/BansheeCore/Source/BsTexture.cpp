@@ -400,6 +400,25 @@ namespace BansheeEngine
 			mProperties.getHeight(), mProperties.getDepth(), mProperties.getFormat());
 	}
 
+	UINT64 Texture::getMemorySize() const
+	{
+		UINT32 width = mProperties.getWidth();
+		UINT32 height = mProperties.getHeight();
+		UINT32 depth = mProperties.getDepth();
+
+		UINT64 size = 0;
+		for (UINT32 mip = 0; mip <= mProperties.getNumMipmaps(); mip++)
+		{
+			size += PixelUtil::getMemorySize(width, height, depth, mProperties.getFormat());
+
+			width = std::max(1U, width / 2);
+			height = std::max(1U, height / 2);
+			depth = std::max(1U, depth / 2);
+		}
+
+		return size * mProperties.getNumFaces();
+	}
+
 	void Texture::updateCPUBuffers(UINT32 subresourceIdx, const PixelData& pixelData)
 	{
 		if ((mProperties.getUsage() & TU_CPUCACHED) == 0)
@@ -7,7 +7,7 @@ namespace BansheeEngine
 {
 	TextureImportOptions::TextureImportOptions()
 		:mFormat(PF_R8G8B8A8), mGenerateMips(false), mMaxMip(0), 
-		mCPUReadable(false), mSRGB(false)
+		mCPUReadable(false), mSRGB(false), mDataCompression(CompressionType::None)
 	{ }
 
 	/************************************************************************/
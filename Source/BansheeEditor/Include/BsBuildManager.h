@@ -81,6 +81,16 @@ namespace BansheeEngine
 		/**	Returns a list of script defines for a specific platform. */
 		WString getDefines(PlatformType type) const;
 
+		/**
+		 * Packs saved resources into a single resource package, to be loaded by the built executable instead of the
+		 * individual resource files. Resource data is compressed, except for resources that don't benefit from it.
+		 *
+		 * @param[in]	resources	Map of resource UUIDs and paths to their saved resource files.
+		 * @param[in]	outputFile	Path to write the package to.
+		 * @return					True if the package was written, false otherwise.
+		 */
+		bool packageResources(const Map<String, Path>& resources, const Path& outputFile) const;
+
 		/**	Stores build settings for all platforms in the specified file. */
 		void save(const Path& outFile);
 
@@ -4,6 +4,8 @@
 #include "BsBuildDataRTTI.h"
 #include "BsFileSerializer.h"
 #include "BsFileSystem.h"
+#include "BsResourcePackage.h"
+#include "BsResources.h"
 #include "BsEditorApplication.h"
 
 namespace BansheeEngine
@@ -159,6 +161,16 @@ namespace BansheeEngine
 		return getPlatformInfo(type)->defines;
 	}
 
+	bool BuildManager::packageResources(const Map<String, Path>& resources, const Path& outputFile) const
+	{
+		ResourcePackageBuilder builder;
+		for (auto& entry : resources)
+			builder.addFile(entry.first, entry.second, gResources().getDependencies(entry.second),
+				ResourceCompression::LZ4);
+
+		return builder.build(outputFile);
+	}
+
 	void BuildManager::clear()
 	{
 		mBuildData = nullptr;
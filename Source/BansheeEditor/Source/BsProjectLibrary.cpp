@@ -11,6 +11,8 @@
 #include "BsImporter.h"
 #include "BsImportOptions.h"
 #include "BsFileSerializer.h"
+#include "BsAsyncIO.h"
+#include "BsDataStream.h"
 #include "BsDebug.h"
 #include "BsProjectLibraryEntries.h"
 #include "BsResource.h"
@@ -546,10 +548,12 @@ namespace BansheeEngine
 				for (auto& entry : importedResources)
 				{
 					internalResourcesPath.setFilename(toWString(entry.value.getUUID()) + L".asset");
-					gResources().save(entry.value, internalResourcesPath, true);
 
+					// Register before saving, so the manifest receives the resource's dependencies as well
 					String uuid = entry.value.getUUID();
 					mResourceManifest->registerResource(uuid, internalResourcesPath);
+
+					gResources().save(entry.value, internalResourcesPath, true);
 				}
 			}
 
@@ -1406,6 +1410,39 @@ namespace BansheeEngine
 
 		gResources().registerResourceManifest(mResourceManifest);
 
+		// Start reading all meta files up front, so many reads are in flight instead of waiting on each file in turn
+		UnorderedMap<FileEntry*, AsyncOp> metaReads;
+		if (AsyncIO::isStarted())
+		{
+			Stack<DirectoryEntry*> todo;
+			todo.push(mRootEntry);
+
+			while (!todo.empty())
+			{
+				DirectoryEntry* curDir = todo.top();
+				todo.pop();
+
+				for (auto& child : curDir->mChildren)
+				{
+					if (child->type == LibraryEntryType::Directory)
+					{
+						todo.push(static_cast<DirectoryEntry*>(child));
+						continue;
+					}
+
+					FileEntry* resEntry = static_cast<FileEntry*>(child);
+					if (resEntry->meta != nullptr)
+						continue;
+
+					Path metaPath = resEntry->path;
+					metaPath.setFilename(metaPath.getWFilename() + L".meta");
+
+					if (FileSystem::isFile(metaPath))
+						metaReads[resEntry] = AsyncIO::instance().readFile(metaPath);
+				}
+			}
+		}
+
 		// Load all meta files
 		Stack<DirectoryEntry*> todo;
 		todo.push(mRootEntry);
@@ -1427,20 +1464,38 @@ namespace BansheeEngine
 					{
 						if (resEntry->meta == nullptr)
 						{
-							Path metaPath = resEntry->path;
-							metaPath.setFilename(metaPath.getWFilename() + L".meta");
+							SPtr<IReflectable> loadedMeta;
 
-							if (FileSystem::isFile(metaPath))
+							auto iterFind = metaReads.find(resEntry);
+							if (iterFind != metaReads.end())
 							{
-								FileDecoder fs(metaPath);
-								SPtr<IReflectable> loadedMeta = fs.decode();
+								iterFind->second.blockUntilComplete();
 
-								if (loadedMeta != nullptr && loadedMeta->isDerivedFrom(ProjectFileMeta::getRTTIStatic()))
+								SPtr<MemoryDataStream> metaData = 
+									iterFind->second.getReturnValue<SPtr<MemoryDataStream>>();
+								if (metaData != nullptr && metaData->size() > 0)
 								{
-									SPtr<ProjectFileMeta> fileMeta = std::static_pointer_cast<ProjectFileMeta>(loadedMeta);
-									resEntry->meta = fileMeta;
+									FileDecoder fs(metaData);
+									loadedMeta = fs.decode();
 								}
 							}
+							else
+							{
+								Path metaPath = resEntry->path;
+								metaPath.setFilename(metaPath.getWFilename() + L".meta");
+
+								if (FileSystem::isFile(metaPath))
+								{
+									FileDecoder fs(metaPath);
+									loadedMeta = fs.decode();
+								}
+							}
+
+							if (loadedMeta != nullptr && loadedMeta->isDerivedFrom(ProjectFileMeta::getRTTIStatic()))
+							{
+								SPtr<ProjectFileMeta> fileMeta = std::static_pointer_cast<ProjectFileMeta>(loadedMeta);
+								resEntry->meta = fileMeta;
+							}
 						}
 
 						if (resEntry->meta != nullptr)
@@ -5,6 +5,7 @@
 #include "BsPrerequisites.h"
 #include "BsVector3.h"
 #include "BsSubMesh.h"
+#include "BsRadixSort.h"
 
 namespace BansheeEngine 
 {
@@ -44,10 +45,11 @@ namespace BansheeEngine
 		/**	Data used for renderable element sorting. Represents a single pass for a single mesh. */
 		struct SortableElement
 		{
-			UINT32 seqIdx;
+			UINT32 elementIdx;
 			INT32 priority;
 			float distFromCamera;
 			UINT32 shaderId;
+			UINT32 shaderIdx;
 			UINT32 passIdx;
 		};
 
@@ -76,21 +78,24 @@ namespace BansheeEngine
 		 * Controls if and how a render queue groups renderable objects by material in order to reduce number of state 
 		 * changes.
 		 */
-		void setStateReduction(StateReduction mode) { mStateReductionMode = mode; }
+		void setStateReduction(StateReduction mode);
 
 	protected:
-		/**	Callback used for sorting elements with no material grouping. */
-		static bool elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
-
-		/**	Callback used for sorting elements with preferred material grouping. */
-		static bool elementSorterPreferGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
-
-		/**	Callback used for sorting elements with material grouping after sorting. */
-		static bool elementSorterPreferSort(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
+		/**
+		 * Packs the sorting criteria of an element into a key that orders elements as requested by the state reduction
+		 * mode, when keys are sorted in ascending order. Elements with equal keys are rendered in the order they were
+		 * added in.
+		 *
+		 * Key always starts with the queue priority (20 bits, higher priorities first), followed by the shader index
+		 * (16 bits), pass index (4 bits) and quantized distance (24 bits), in the order required by the mode.
+		 */
+		static UINT64 encodeSortKey(const SortableElement& element, StateReduction mode);
 
 		Vector<SortableElement> mSortableElements;
-		Vector<UINT32> mSortableElementIdx;
+		Vector<RadixSortEntry> mSortKeys;
+		Vector<RadixSortEntry> mSortScratch;
 		Vector<RenderableElement*> mElements;
+		UnorderedMap<UINT32, UINT32> mShaderIndices;
 
 		Vector<RenderQueueElement> mSortedRenderElements;
 		StateReduction mStateReductionMode;
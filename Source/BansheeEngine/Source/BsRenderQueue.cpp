@@ -7,8 +7,6 @@
 #include "BsMaterial.h"
 #include "BsRenderableElement.h"
 
-using namespace std::placeholders;
-
 namespace BansheeEngine
 {
 	RenderQueue::RenderQueue(StateReduction mode)
@@ -20,8 +18,9 @@ namespace BansheeEngine
 	void RenderQueue::clear()
 	{
 		mSortableElements.clear();
-		mSortableElementIdx.clear();
+		mSortKeys.clear();
 		mElements.clear();
+		mShaderIndices.clear();
 
 		mSortedRenderElements.clear();
 	}
@@ -31,13 +30,17 @@ namespace BansheeEngine
 		SPtr<MaterialCore> material = element->material;
 		SPtr<ShaderCore> shader = material->getShader();
 
+		UINT32 elementIdx = (UINT32)mElements.size();
 		mElements.push_back(element);
 		
-		UINT32 queuePriority = shader->getQueuePriority();
+		INT32 queuePriority = shader->getQueuePriority();
 		QueueSortType sortType = shader->getQueueSortType();
 		UINT32 shaderId = shader->getId();
 		bool separablePasses = shader->getAllowSeparablePasses();
 
+		// Shader IDs are global and can be arbitrarily large, so map them to dense indices that fit in the sort key
+		UINT32 shaderIdx = mShaderIndices.insert(std::make_pair(shaderId, (UINT32)mShaderIndices.size())).first->second;
+
 		switch (sortType)
 		{
 		case QueueSortType::None:
@@ -56,59 +59,51 @@ namespace BansheeEngine
 
 		for (UINT32 i = 0; i < numPasses; i++)
 		{
-			UINT32 idx = (UINT32)mSortableElementIdx.size();
-			mSortableElementIdx.push_back(idx);
+			UINT32 idx = (UINT32)mSortableElements.size();
 
 			mSortableElements.push_back(SortableElement());
 			SortableElement& sortableElem = mSortableElements.back();
 
-			sortableElem.seqIdx = idx;
+			sortableElem.elementIdx = elementIdx;
 			sortableElem.priority = queuePriority;
 			sortableElem.shaderId = shaderId;
+			sortableElem.shaderIdx = shaderIdx;
 			sortableElem.passIdx = i;
 			sortableElem.distFromCamera = distFromCamera;
+
+			mSortKeys.push_back({ encodeSortKey(sortableElem, mStateReductionMode), idx });
 		}
 	}
 
-	void RenderQueue::sort()
+	void RenderQueue::setStateReduction(StateReduction mode)
 	{
-		std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
+		if (mStateReductionMode == mode)
+			return;
 
-		switch (mStateReductionMode)
-		{
-		case StateReduction::None:
-			sortMethod = &elementSorterNoGroup;
-			break;
-		case StateReduction::Material:
-			sortMethod = &elementSorterPreferGroup;
-			break;
-		case StateReduction::Distance:
-			sortMethod = &elementSorterPreferSort;
-			break;
-		}
+		mStateReductionMode = mode;
+
+		// Re-encode keys of elements added with the previous mode
+		for (auto& sortKey : mSortKeys)
+			sortKey.key = encodeSortKey(mSortableElements[sortKey.value], mode);
+	}
+
+	void RenderQueue::sort()
+	{
+		// Keys are added in sequence order and the sort is stable, so elements with equal keys keep their order
+		UINT32 numSortKeys = (UINT32)mSortKeys.size();
+		if (mSortScratch.size() < numSortKeys)
+			mSortScratch.resize(numSortKeys);
 
-		// Sort only indices since we generate an entirely new data set anyway, it doesn't make sense to move sortable elements
-		std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), std::bind(sortMethod, _1, _2, mSortableElements));
+		RadixSort::sort(mSortKeys.data(), mSortScratch.data(), numSortKeys);
 
 		UINT32 prevShaderId = (UINT32)-1;
 		UINT32 prevPassIdx = (UINT32)-1;
-		RenderableElement* renderElem = nullptr;
-		INT32 currentElementIdx = -1;
-		UINT32 numPassesInCurrentElement = 0;
-		bool separablePasses = true;
-		for (UINT32 i = 0; i < (UINT32)mSortableElementIdx.size(); i++)
+		for (auto& sortKey : mSortKeys)
 		{
-			UINT32 idx = mSortableElementIdx[i];
-
-			while (numPassesInCurrentElement == 0)
-			{
-				currentElementIdx++;
-				renderElem = mElements[currentElementIdx];
-				numPassesInCurrentElement = renderElem->material->getNumPasses();
-				separablePasses = renderElem->material->getShader()->getAllowSeparablePasses();
-			}
+			const SortableElement& elem = mSortableElements[sortKey.value];
+			RenderableElement* renderElem = mElements[elem.elementIdx];
 
-			const SortableElement& elem = mSortableElements[idx];
+			bool separablePasses = renderElem->material->getShader()->getAllowSeparablePasses();
 			if (separablePasses)
 			{
 				mSortedRenderElements.push_back(RenderQueueElement());
@@ -125,12 +120,11 @@ namespace BansheeEngine
 				}
 				else
 					sortedElem.applyPass = false;
-
-				numPassesInCurrentElement--;
 			}
 			else
 			{
-				for (UINT32 j = 0; j < numPassesInCurrentElement; j++)
+				UINT32 numPasses = renderElem->material->getNumPasses();
+				for (UINT32 j = 0; j < numPasses; j++)
 				{
 					mSortedRenderElements.push_back(RenderQueueElement());
 
@@ -142,66 +136,43 @@ namespace BansheeEngine
 					prevShaderId = elem.shaderId;
 					prevPassIdx = j;
 				}
-
-				numPassesInCurrentElement = 0;
 			}			
 		}
 	}
 
-	bool RenderQueue::elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
-	{
-		const SortableElement& a = lookup[aIdx];
-		const SortableElement& b = lookup[bIdx];
-
-		UINT8 isHigher = (a.priority > b.priority) << 2 |
-			(a.distFromCamera < b.distFromCamera) << 1 |
-			(a.seqIdx < b.seqIdx);
-
-		UINT8 isLower = (a.priority < b.priority) << 2 |
-			(a.distFromCamera > b.distFromCamera) << 1 |
-			(a.seqIdx > b.seqIdx);
-
-		return isHigher > isLower;
-	}
-
-	bool RenderQueue::elementSorterPreferGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
+	UINT64 RenderQueue::encodeSortKey(const SortableElement& element, StateReduction mode)
 	{
-		const SortableElement& a = lookup[aIdx];
-		const SortableElement& b = lookup[bIdx];
-		
-		UINT8 isHigher = (a.priority > b.priority) << 4 |
-			(a.shaderId < b.shaderId) << 3 |
-			(a.passIdx < b.passIdx) << 2 |
-			(a.distFromCamera < b.distFromCamera) << 1 |
-			(a.seqIdx < b.seqIdx);
-
-		UINT8 isLower = (a.priority < b.priority) << 4 |
-			(a.shaderId > b.shaderId) << 3 |
-			(a.passIdx > b.passIdx) << 2 |
-			(a.distFromCamera > b.distFromCamera) << 1 |
-			(a.seqIdx > b.seqIdx);
-
-		return isHigher > isLower;
-	}
+		// Bias the signed priority into the unsigned 20-bit range, saturating priorities outside of it. Higher priorities
+		// need to come first, so invert the result.
+		INT64 biasedPriority = Math::clamp((INT64)element.priority + 0x80000, (INT64)0, (INT64)0xFFFFF);
+		UINT64 priority = 0xFFFFF - (UINT64)biasedPriority;
+
+		// Flip the bits of negative floats, and the sign bit of positive ones, so their bit patterns order the same as
+		// their values. Then keep the top 24 bits, which covers the sign, exponent and 15 bits of the mantissa.
+		UINT32 distance;
+		memcpy(&distance, &element.distFromCamera, sizeof(distance));
+		distance = (distance & 0x80000000) != 0 ? ~distance : distance | 0x80000000;
+		distance >>= 8;
+
+		// Only grouping is affected if a queue has more shaders than fit, as applying passes compares full shader IDs
+		UINT64 shaderIdx = std::min(element.shaderIdx, 0xFFFFU);
+		UINT64 passIdx = std::min(element.passIdx, 0xFU);
+
+		UINT64 key = priority << 44;
+		switch (mode)
+		{
+		case StateReduction::None:
+			key |= (UINT64)distance << 20;
+			break;
+		case StateReduction::Material:
+			key |= shaderIdx << 28 | passIdx << 24 | distance;
+			break;
+		case StateReduction::Distance:
+			key |= (UINT64)distance << 20 | shaderIdx << 4 | passIdx;
+			break;
+		}
 
-	bool RenderQueue::elementSorterPreferSort(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
-	{
-		const SortableElement& a = lookup[aIdx];
-		const SortableElement& b = lookup[bIdx];
-
-		UINT8 isHigher = (a.priority > b.priority) << 4 | 
-			(a.distFromCamera < b.distFromCamera) << 3 | 
-			(a.shaderId < b.shaderId) << 2 | 
-			(a.passIdx < b.passIdx) << 1 | 
-			(a.seqIdx < b.seqIdx);
-
-		UINT8 isLower = (a.priority < b.priority) << 4 |
-			(a.distFromCamera > b.distFromCamera) << 3 |
-			(a.shaderId > b.shaderId) << 2 |
-			(a.passIdx > b.passIdx) << 1 |
-			(a.seqIdx > b.seqIdx);
-
-		return isHigher > isLower;
+		return key;
 	}
 
 	const Vector<RenderQueueElement>& RenderQueue::getSortedElements() const
@@ -131,6 +131,7 @@ namespace BansheeEngine
 			desc.usage |= MU_CPUCACHED;
 
 		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		mesh->setDataCompression(meshImportOptions->getDataCompression());
 
 		WString fileName = filePath.getWFilename(false);
 		mesh->setName(fileName);
@@ -153,6 +154,7 @@ namespace BansheeEngine
 			desc.usage |= MU_CPUCACHED;
 
 		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		mesh->setDataCompression(meshImportOptions->getDataCompression());
 
 		WString fileName = filePath.getWFilename(false);
 		mesh->setName(fileName);
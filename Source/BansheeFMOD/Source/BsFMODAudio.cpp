@@ -8,21 +8,21 @@
 
 namespace BansheeEngine
 {
+	// Note: Not using Banshee's allocators, as there is no easy way to implement realloc on top of them (and the general
+	// purpose allocator isn't guaranteed to use malloc/free internally).
 	void* F_CALLBACK FMODAlloc(unsigned int size, FMOD_MEMORY_TYPE type, const char *sourcestr)
 	{
-		return bs_alloc(size);
+		return malloc(size);
 	}
 
 	void* F_CALLBACK FMODRealloc(void *ptr, unsigned int size, FMOD_MEMORY_TYPE type, const char *sourcestr)
 	{
-		// Note: Not using Banshee's allocators, but have no easy alternative to implement realloc manually.
-		// This is okay to use in combination with general purpose bs_alloc/bs_free since they internally use malloc/free.
 		return realloc(ptr, size);
 	}
 
 	void F_CALLBACK FMODFree(void *ptr, FMOD_MEMORY_TYPE type, const char *sourcestr)
 	{
-		bs_free(ptr);
+		free(ptr);
 	}
 
 	float F_CALLBACK FMOD3DRolloff(FMOD_CHANNELCONTROL* channelControl, float distance)
@@ -166,6 +166,7 @@ namespace BansheeEngine
 		texDesc.hwGamma = sRGB;
 
 		SPtr<Texture> newTexture = Texture::_createPtr(texDesc);
+		newTexture->setDataCompression(textureImportOptions->getDataCompression());
 
 		Vector<SPtr<PixelData>> mipLevels;
 		if (numMips > 0)
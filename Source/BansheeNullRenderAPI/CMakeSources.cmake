@@ -0,0 +1,67 @@
+set(BS_BANSHEENULLRENDERAPI_INC_NOFILTER
+	"Include/BsNullCommandBuffer.h"
+	"Include/BsNullEventQuery.h"
+	"Include/BsNullGpuBuffer.h"
+	"Include/BsNullGpuParamBlockBuffer.h"
+	"Include/BsNullGpuProgram.h"
+	"Include/BsNullHLSLParamParser.h"
+	"Include/BsNullHardwareBuffer.h"
+	"Include/BsNullIndexBuffer.h"
+	"Include/BsNullOcclusionQuery.h"
+	"Include/BsNullPrerequisites.h"
+	"Include/BsNullRenderAPI.h"
+	"Include/BsNullRenderTexture.h"
+	"Include/BsNullRenderWindow.h"
+	"Include/BsNullTexture.h"
+	"Include/BsNullTimerQuery.h"
+	"Include/BsNullVertexBuffer.h"
+)
+
+set(BS_BANSHEENULLRENDERAPI_INC_MANAGERS
+	"Include/BsNullCommandBufferManager.h"
+	"Include/BsNullHardwareBufferManager.h"
+	"Include/BsNullQueryManager.h"
+	"Include/BsNullRenderAPIFactory.h"
+	"Include/BsNullRenderWindowManager.h"
+	"Include/BsNullTextureManager.h"
+)
+
+set(BS_BANSHEENULLRENDERAPI_SRC_NOFILTER
+	"Source/BsNullCommandBuffer.cpp"
+	"Source/BsNullEventQuery.cpp"
+	"Source/BsNullGpuBuffer.cpp"
+	"Source/BsNullGpuParamBlockBuffer.cpp"
+	"Source/BsNullGpuProgram.cpp"
+	"Source/BsNullHLSLParamParser.cpp"
+	"Source/BsNullHardwareBuffer.cpp"
+	"Source/BsNullIndexBuffer.cpp"
+	"Source/BsNullOcclusionQuery.cpp"
+	"Source/BsNullPlugin.cpp"
+	"Source/BsNullRenderAPI.cpp"
+	"Source/BsNullRenderTexture.cpp"
+	"Source/BsNullRenderWindow.cpp"
+	"Source/BsNullTexture.cpp"
+	"Source/BsNullTimerQuery.cpp"
+	"Source/BsNullVertexBuffer.cpp"
+)
+
+set(BS_BANSHEENULLRENDERAPI_SRC_MANAGERS
+	"Source/BsNullCommandBufferManager.cpp"
+	"Source/BsNullHardwareBufferManager.cpp"
+	"Source/BsNullQueryManager.cpp"
+	"Source/BsNullRenderAPIFactory.cpp"
+	"Source/BsNullRenderWindowManager.cpp"
+	"Source/BsNullTextureManager.cpp"
+)
+
+source_group("Header Files" FILES ${BS_BANSHEENULLRENDERAPI_INC_NOFILTER})
+source_group("Header Files\\Managers" FILES ${BS_BANSHEENULLRENDERAPI_INC_MANAGERS})
+source_group("Source Files" FILES ${BS_BANSHEENULLRENDERAPI_SRC_NOFILTER})
+source_group("Source Files\\Managers" FILES ${BS_BANSHEENULLRENDERAPI_SRC_MANAGERS})
+
+set(BS_BANSHEENULLRENDERAPI_SRC
+	${BS_BANSHEENULLRENDERAPI_INC_NOFILTER}
+	${BS_BANSHEENULLRENDERAPI_SRC_NOFILTER}
+	${BS_BANSHEENULLRENDERAPI_INC_MANAGERS}
+	${BS_BANSHEENULLRENDERAPI_SRC_MANAGERS}
+)
\ No newline at end of file
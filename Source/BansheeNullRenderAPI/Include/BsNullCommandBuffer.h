@@ -0,0 +1,64 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsCommandBuffer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** Counters for the commands recorded by the null render API. */
+	struct NullCommandStats
+	{
+		UINT64 numDrawCalls = 0;
+		UINT64 numInstances = 0;
+		UINT64 numVertices = 0;
+		UINT64 numPrimitives = 0;
+		UINT64 numComputeCalls = 0;
+		UINT64 numPipelineStateChanges = 0;
+		UINT64 numGpuParamBinds = 0;
+		UINT64 numVertexBufferBinds = 0;
+		UINT64 numIndexBufferBinds = 0;
+		UINT64 numRenderTargetChanges = 0;
+		UINT64 numViewportChanges = 0;
+		UINT64 numClears = 0;
+		UINT64 numPresents = 0;
+		UINT64 numParamBlockUploads = 0;
+		UINT64 numParamBlockBytesUploaded = 0;
+
+		/** Adds the counters from another set of statistics to this one. */
+		NullCommandStats& operator+=(const NullCommandStats& other);
+	};
+
+	/**
+	 * Command buffer implementation for the null render API. Commands are not stored, instead the buffer only counts
+	 * the commands issued to it. Counters are merged into the main command buffer when the buffer is executed.
+	 */
+	class NullCommandBuffer : public CommandBuffer
+	{
+	public:
+		/** Appends statistics from the secondary buffer into this command buffer. */
+		void appendSecondary(const SPtr<NullCommandBuffer>& secondaryBuffer);
+
+		/** Resets all counters recorded by the command buffer. */
+		void clear();
+
+		/** Returns counters for all commands recorded in the command buffer since it was last cleared. */
+		const NullCommandStats& getStats() const { return mStats; }
+
+	private:
+		friend class NullCommandBufferManager;
+		friend class NullRenderAPI;
+
+		NullCommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary);
+
+		NullCommandStats mStats;
+		DrawOperationType mDrawOperation;
+	};
+
+	/** @} */
+}
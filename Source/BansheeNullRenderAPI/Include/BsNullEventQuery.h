@@ -0,0 +1,29 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsEventQuery.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** Event query that is ready as soon as it is issued, since the null render API has no GPU work to wait on. */
+	class NullEventQuery : public EventQuery
+	{
+	public:
+		NullEventQuery(UINT32 deviceIdx);
+		~NullEventQuery();
+
+		/** @copydoc EventQuery::begin */
+		void begin() override;
+
+		/** @copydoc EventQuery::isReady */
+		bool isReady() const override;
+	};
+
+	/** @} */
+}
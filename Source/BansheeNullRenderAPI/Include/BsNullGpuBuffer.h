@@ -0,0 +1,50 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsGpuBuffer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**	Null render API implementation of a generic GPU buffer. Contents are kept in system memory. */
+	class NullGpuBufferCore : public GpuBufferCore
+    {
+    public:
+		~NullGpuBufferCore();
+
+		/** @copydoc GpuBufferCore::lock */
+		void* lock(UINT32 offset, UINT32 length, GpuLockOptions options) override;
+
+		/** @copydoc GpuBufferCore::unlock */
+		void unlock() override;
+
+		/** @copydoc GpuBufferCore::readData */
+		void readData(UINT32 offset, UINT32 length, void* pDest) override;
+
+		/** @copydoc GpuBufferCore::writeData */
+        void writeData(UINT32 offset, UINT32 length, const void* pSource,
+			BufferWriteType writeFlags = BWT_NORMAL) override;
+
+		/** @copydoc GpuBufferCore::copyData */
+		void copyData(GpuBufferCore& srcBuffer, UINT32 srcOffset,
+			UINT32 dstOffset, UINT32 length, bool discardWholeBuffer = false) override;
+
+	protected:
+		friend class NullHardwareBufferCoreManager;
+
+		NullGpuBufferCore(const GPU_BUFFER_DESC& desc, GpuDeviceFlags deviceMask);
+
+		/** @copydoc GpuBufferCore::initialize */
+		void initialize() override;
+
+	private:
+		NullHardwareBuffer* mBuffer;
+    };
+
+	/** @} */
+}
@@ -0,0 +1,36 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsGpuParamBlockBuffer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** 
+	 * Null render API implementation of a GPU parameter block buffer. Contents are kept in system memory, and every upload
+	 * is reported to the render API statistics.
+	 */
+	class NullGpuParamBlockBufferCore : public GenericGpuParamBlockBufferCore
+	{
+	public:
+		NullGpuParamBlockBufferCore(UINT32 size, GpuParamBlockUsage usage, GpuDeviceFlags deviceMask);
+		~NullGpuParamBlockBufferCore();
+
+		/** @copydoc GpuParamBlockBufferCore::writeToGPU */
+		void writeToGPU(const UINT8* data) override;
+
+		/** @copydoc GpuParamBlockBufferCore::readFromGPU */
+		void readFromGPU(UINT8* data) const override;
+
+	protected:
+		/** @copydoc CoreObjectCore::initialize */
+		void initialize() override;
+	};
+
+	/** @} */
+}
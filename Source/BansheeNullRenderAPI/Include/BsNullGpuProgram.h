@@ -0,0 +1,57 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsGpuProgram.h"
+#include "BsGpuProgramManager.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**
+	 * GPU program that is never compiled or executed. Its parameters are determined by scanning the declarations in the
+	 * HLSL source, so materials and renderer parameter blocks can be bound the same as with a real render API.
+	 */
+	class NullGpuProgramCore : public GpuProgramCore
+	{
+	public:
+		virtual ~NullGpuProgramCore();
+
+		/** @copydoc GpuProgramCore::isSupported */
+		bool isSupported() const override { return true; }
+
+	protected:
+		friend class NullGpuProgramFactory;
+
+		NullGpuProgramCore(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask);
+
+		/** @copydoc GpuProgramCore::initialize */
+		void initialize() override;
+	};
+
+	/**	Handles creation of null GPU programs from HLSL source. */
+	class NullGpuProgramFactory : public GpuProgramFactory
+	{
+	public:
+		NullGpuProgramFactory() {}
+		~NullGpuProgramFactory() {}
+
+		/** @copydoc GpuProgramFactory::getLanguage */
+		const String& getLanguage() const override;
+
+		/** @copydoc GpuProgramFactory::create(const GPU_PROGRAM_DESC&, GpuDeviceFlags) */
+		SPtr<GpuProgramCore> create(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask = GDF_DEFAULT) override;
+
+		/** @copydoc GpuProgramFactory::create(GpuProgramType, GpuDeviceFlags) */
+		SPtr<GpuProgramCore> create(GpuProgramType type, GpuDeviceFlags deviceMask = GDF_DEFAULT) override;
+
+	protected:
+		static const String LANGUAGE_NAME;
+	};
+
+	/** @} */
+}
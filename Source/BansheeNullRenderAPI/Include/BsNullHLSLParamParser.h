@@ -0,0 +1,122 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**
+	 * Builds GPU program parameter descriptions by scanning the declarations in HLSL source code. Used in place of
+	 * compiler reflection, since the null render API never compiles its programs.
+	 *
+	 * Recognizes constant buffers, structs, resource and sampler declarations, and global uniform variables. Constant
+	 * buffer members are laid out using the HLSL packing rules. Preprocessor directives are ignored, except for simple
+	 * numeric defines used as array sizes.
+	 */
+	class NullHLSLParamParser
+	{
+	public:
+		/**
+		 * Parses the provided HLSL source and outputs the found parameters.
+		 *
+		 * @param[in]	source	HLSL source code of the program.
+		 * @param[in]	type	Type of the program the source belongs to.
+		 * @param[out]	desc	Output structure that will receive the parameter descriptions.
+		 */
+		void parse(const String& source, GpuProgramType type, GpuParamDesc& desc);
+
+	private:
+		/** Information about a data type that can be placed in a constant buffer. */
+		struct DataTypeInfo
+		{
+			GpuParamDataType type;
+			UINT32 size; /**< In multiples of 4 bytes. */
+			bool alignToRegister;
+		};
+
+		/** Splits the source into identifier, number and punctuation tokens, skipping comments and directives. */
+		void tokenize(const String& source);
+
+		/** Returns the current token, or an empty string if all tokens were consumed. */
+		const String& peek(UINT32 offset = 0) const;
+
+		/** 
+		 * Advances past a balanced group of tokens starting at the current token (e.g. a block in braces), including 
+		 * nested groups.
+		 */
+		void skipGroup(const String& open, const String& close);
+
+		/** Advances to the next ',' or ';', or the closing brace of the current block, skipping nested groups. */
+		void skipToDeclaratorEnd();
+
+		/**
+		 * Parses a register binding (e.g. ": register(t2)") at the current token, if one exists. Returns the register
+		 * index, or -1 if there is no binding.
+		 */
+		INT32 parseRegister();
+
+		/** Parses an optional array size (e.g. "[4]") at the current token. Returns 1 if the variable is not an array. */
+		UINT32 parseArraySize();
+
+		/** Parses a struct declaration starting at the current token, and records its size. */
+		void parseStruct();
+
+		/** Parses a cbuffer declaration starting at the current token. */
+		void parseConstantBuffer(GpuProgramType type, GpuParamDesc& desc);
+
+		/** 
+		 * Parses a single top-level declaration (variable, resource or function) starting at the current token. Data 
+		 * variables are placed in the global parameter block and appended to @p globalParams.
+		 */
+		void parseDeclaration(GpuProgramType type, GpuParamDesc& desc, UINT32& globalsSize, 
+			Vector<GpuParamDataDesc>& globalParams);
+
+		/** 
+		 * Parses variable declarations until the closing brace of the block starting at the current token, and places
+		 * the variables one after another. Variables are appended to @p params if it is provided. Returns the total 
+		 * size of the placed variables, in multiples of 4 bytes.
+		 */
+		UINT32 parseMembers(Vector<GpuParamDataDesc>* params);
+
+		/** 
+		 * Places a variable after @p offset according to the HLSL packing rules. Returns the description of the placed
+		 * variable, and advances @p offset past it.
+		 */
+		static GpuParamDataDesc placeVariable(const String& name, const DataTypeInfo& info, UINT32 arraySize, 
+			UINT32& offset);
+
+		/** Finds information about a data type with the provided name. Returns false if the type is not known. */
+		bool getDataType(const String& name, bool rowMajor, DataTypeInfo& info) const;
+
+		/** 
+		 * Finds the object type and register class (0 - b, 1 - t, 2 - s, 3 - u) for a resource type with the provided
+		 * name. Returns false if the name isn't a resource type. Resources that cannot be described are reported as
+		 * GPOT_UNKNOWN.
+		 */
+		static bool getObjectType(const String& name, GpuParamObjectType& type, UINT32& registerClass);
+
+		/** 
+		 * Returns the register to bind a parameter to. Uses the explicit register if one was provided, or the next free
+		 * register of the provided class otherwise.
+		 */
+		UINT32 assignRegister(UINT32 registerClass, INT32 explicitRegister, UINT32 count);
+
+		/** Returns true if the token is a modifier that can precede a variable or function declaration. */
+		static bool isModifier(const String& token);
+
+		Vector<String> mTokens;
+		UINT32 mTokenIdx;
+
+		UnorderedMap<String, UINT32> mDefines;
+		UnorderedMap<String, UINT32> mStructSizes;
+
+		UINT32 mNextRegister[4];
+	};
+
+	/** @} */
+}
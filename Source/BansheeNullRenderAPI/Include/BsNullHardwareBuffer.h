@@ -0,0 +1,42 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsHardwareBuffer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** Hardware buffer that stores its contents in system memory. Used as storage by all null render API buffers. */
+	class NullHardwareBuffer : public HardwareBuffer
+	{
+	public:
+		NullHardwareBuffer(GpuBufferUsage usage, UINT32 size);
+		~NullHardwareBuffer();
+
+		/** @copydoc HardwareBuffer::readData */
+		void readData(UINT32 offset, UINT32 length, void* dest, UINT32 syncMask = 0x00000001) override;
+
+		/** @copydoc HardwareBuffer::writeData */
+		void writeData(UINT32 offset, UINT32 length, const void* source,
+			BufferWriteType writeFlags = BWT_NORMAL, UINT32 syncMask = 0x00000001) override;
+
+		/** Returns the memory holding the buffer contents. */
+		UINT8* getData() const { return mData; }
+
+	protected:
+		/** @copydoc HardwareBuffer::map */
+		void* map(UINT32 offset, UINT32 length, GpuLockOptions options, UINT32 syncMask) override;
+
+		/** @copydoc HardwareBuffer::unmap */
+		void unmap() override { }
+
+		UINT8* mData;
+	};
+
+	/** @} */
+}
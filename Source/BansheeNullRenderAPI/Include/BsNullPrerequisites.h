@@ -0,0 +1,32 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+/** @addtogroup Plugins
+ *  @{
+ */
+
+/** @defgroup NullRenderAPI BansheeNullRenderAPI
+ *	Render API that doesn't render anything. All GPU resources are kept in system memory and issued commands are only
+ *	counted, allowing the rest of the engine to run without a GPU.
+ */
+
+/** @} */
+
+namespace BansheeEngine
+{
+	class NullRenderAPI;
+	class NullHardwareBuffer;
+	class NullVertexBufferCore;
+	class NullIndexBufferCore;
+	class NullGpuBufferCore;
+	class NullGpuParamBlockBufferCore;
+	class NullTextureCore;
+	class NullRenderTextureCore;
+	class NullRenderWindowCore;
+	class NullCommandBuffer;
+	class NullGpuProgramCore;
+	class NullGpuProgramFactory;
+}
@@ -0,0 +1,125 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsRenderWindow.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**	Contains various properties that describe a render window. */
+	class NullRenderWindowProperties : public RenderWindowProperties
+	{
+	public:
+		NullRenderWindowProperties(const RENDER_WINDOW_DESC& desc);
+		virtual ~NullRenderWindowProperties() { }
+
+	private:
+		friend class NullRenderWindowCore;
+		friend class NullRenderWindow;
+	};
+
+	/**
+	 * Render window that has no OS window or frame buffer behind it. Window operations only update its properties.
+	 *
+	 * @note	Core thread only.
+	 */
+	class NullRenderWindowCore : public RenderWindowCore
+	{
+	public:
+		NullRenderWindowCore(const RENDER_WINDOW_DESC& desc, UINT32 windowId);
+		~NullRenderWindowCore();
+
+		/** @copydoc RenderWindowCore::move */
+		void move(INT32 left, INT32 top) override;
+
+		/** @copydoc RenderWindowCore::resize */
+		void resize(UINT32 width, UINT32 height) override;
+
+		/** @copydoc RenderWindowCore::setFullscreen(UINT32, UINT32, float, UINT32) */
+		void setFullscreen(UINT32 width, UINT32 height, float refreshRate = 60.0f, UINT32 monitorIdx = 0) override;
+
+		/** @copydoc RenderWindowCore::setFullscreen(const VideoMode&) */
+		void setFullscreen(const VideoMode& videoMode) override;
+
+		/** @copydoc RenderWindowCore::setWindowed */
+		void setWindowed(UINT32 width, UINT32 height) override;
+
+		/**
+		 * @copydoc RenderTargetCore::getCustomAttribute
+		 *
+		 * @note	"WINDOW" attribute reports a null (zero) OS window handle.
+		 */
+		void getCustomAttribute(const String& name, void* pData) const override;
+
+	protected:
+		friend class NullRenderWindow;
+
+		/** @copydoc CoreObjectCore::initialize */
+		void initialize() override;
+
+		/** @copydoc RenderWindowCore::getProperties */
+		const RenderTargetProperties& getPropertiesInternal() const override { return mProperties; }
+
+		/** @copydoc RenderWindowCore::getSyncedProperties */
+		RenderWindowProperties& getSyncedProperties() override { return mSyncedProperties; }
+
+		/** @copydoc RenderWindowCore::syncProperties */
+		void syncProperties() override;
+
+		/** Changes the window size and fullscreen state, and notifies the sim thread of the change. */
+		void setSize(UINT32 width, UINT32 height, bool fullscreen);
+
+	protected:
+		NullRenderWindowProperties mProperties;
+		NullRenderWindowProperties mSyncedProperties;
+	};
+
+	/**
+	 * Render window that has no OS window or frame buffer behind it.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class NullRenderWindow : public RenderWindow
+	{
+	public:
+		~NullRenderWindow() { }
+
+		/** @copydoc RenderWindow::screenToWindowPos */
+		Vector2I screenToWindowPos(const Vector2I& screenPos) const override;
+
+		/** @copydoc RenderWindow::windowToScreenPos */
+		Vector2I windowToScreenPos(const Vector2I& windowPos) const override;
+
+		/**
+		 * @copydoc RenderTarget::getCustomAttribute
+		 *
+		 * @note	"WINDOW" attribute reports a null (zero) OS window handle.
+		 */
+		void getCustomAttribute(const String& name, void* pData) const override;
+
+		/** @copydoc RenderWindow::getCore */
+		SPtr<NullRenderWindowCore> getCore() const;
+
+	protected:
+		friend class NullRenderWindowManager;
+		friend class NullRenderWindowCore;
+
+		NullRenderWindow(const RENDER_WINDOW_DESC& desc, UINT32 windowId);
+
+		/** @copydoc RenderWindowCore::getProperties */
+		const RenderTargetProperties& getPropertiesInternal() const override { return mProperties; }
+
+		/** @copydoc RenderWindow::syncProperties */
+		void syncProperties() override;
+
+	private:
+		NullRenderWindowProperties mProperties;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,52 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsTexture.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**	Null render API implementation of a texture. Each face and mip level is kept in system memory. */
+	class NullTextureCore : public TextureCore
+	{
+	public:
+		~NullTextureCore();
+
+	protected:
+		friend class NullTextureCoreManager;
+
+		NullTextureCore(const TEXTURE_DESC& desc, const SPtr<PixelData>& initialData, GpuDeviceFlags deviceMask);
+
+		/** @copydoc CoreObjectCore::initialize() */
+		void initialize() override;
+
+		/** @copydoc TextureCore::lockImpl */
+		PixelData lockImpl(GpuLockOptions options, UINT32 mipLevel = 0, UINT32 face = 0) override;
+
+		/** @copydoc TextureCore::unlockImpl */
+		void unlockImpl() override { }
+
+		/** @copydoc TextureCore::copyImpl */
+		void copyImpl(UINT32 srcFace, UINT32 srcMipLevel, UINT32 destFace, UINT32 destMipLevel,
+			const SPtr<TextureCore>& target) override;
+
+		/** @copydoc TextureCore::readData */
+		void readData(PixelData& dest, UINT32 mipLevel = 0, UINT32 face = 0) override;
+
+		/** @copydoc TextureCore::writeData */
+		void writeData(const PixelData& src, UINT32 mipLevel = 0, UINT32 face = 0, bool discardWholeBuffer = false) override;
+
+		/** Returns the memory holding the contents of the specified face and mip level. */
+		const SPtr<PixelData>& getSurface(UINT32 mipLevel, UINT32 face) const;
+
+	private:
+		Vector<SPtr<PixelData>> mSurfaces;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,46 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsVertexBuffer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**	Null render API implementation of a vertex buffer. Contents are kept in system memory. */
+	class NullVertexBufferCore : public VertexBufferCore
+	{
+	public:
+		NullVertexBufferCore(const VERTEX_BUFFER_DESC& desc, GpuDeviceFlags deviceMask);
+		~NullVertexBufferCore();
+
+		/** @copydoc VertexBufferCore::readData */
+		void readData(UINT32 offset, UINT32 length, void* dest, UINT32 syncMask = 0x00000001) override;
+
+		/** @copydoc VertexBufferCore::writeData */
+		void writeData(UINT32 offset, UINT32 length, const void* source,
+			BufferWriteType writeFlags = BWT_NORMAL, UINT32 syncMask = 0x00000001) override;
+
+		/** @copydoc VertexBufferCore::copyData */
+		void copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset, UINT32 dstOffset, UINT32 length,
+			bool discardWholeBuffer = false, UINT32 syncMask = 0x00000001) override;
+
+	protected:
+		/** @copydoc VertexBufferCore::map */
+		void* map(UINT32 offset, UINT32 length, GpuLockOptions options, UINT32 syncMask) override;
+
+		/** @copydoc VertexBufferCore::unmap */
+		void unmap() override;
+
+		/** @copydoc VertexBufferCore::initialize */
+		void initialize() override;
+
+		NullHardwareBuffer* mBuffer;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,59 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullCommandBuffer.h"
+#include "BsException.h"
+
+namespace BansheeEngine
+{
+	NullCommandStats& NullCommandStats::operator+=(const NullCommandStats& other)
+	{
+		numDrawCalls += other.numDrawCalls;
+		numInstances += other.numInstances;
+		numVertices += other.numVertices;
+		numPrimitives += other.numPrimitives;
+		numComputeCalls += other.numComputeCalls;
+		numPipelineStateChanges += other.numPipelineStateChanges;
+		numGpuParamBinds += other.numGpuParamBinds;
+		numVertexBufferBinds += other.numVertexBufferBinds;
+		numIndexBufferBinds += other.numIndexBufferBinds;
+		numRenderTargetChanges += other.numRenderTargetChanges;
+		numViewportChanges += other.numViewportChanges;
+		numClears += other.numClears;
+		numPresents += other.numPresents;
+		numParamBlockUploads += other.numParamBlockUploads;
+		numParamBlockBytesUploaded += other.numParamBlockBytesUploaded;
+
+		return *this;
+	}
+
+	NullCommandBuffer::NullCommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary)
+		: CommandBuffer(type, deviceIdx, queueIdx, secondary), mDrawOperation(DOT_TRIANGLE_LIST)
+	{
+		if (deviceIdx != 0)
+			BS_EXCEPT(InvalidParametersException, "Only a single device supported on the null render API.");
+	}
+
+	void NullCommandBuffer::appendSecondary(const SPtr<NullCommandBuffer>& secondaryBuffer)
+	{
+#if BS_DEBUG_MODE
+		if(!secondaryBuffer->mIsSecondary)
+		{
+			LOGERR("Cannot append a command buffer that is not secondary.");
+			return;
+		}
+
+		if(mIsSecondary)
+		{
+			LOGERR("Cannot append a buffer to a secondary command buffer.");
+			return;
+		}
+#endif
+
+		mStats += secondaryBuffer->mStats;
+	}
+
+	void NullCommandBuffer::clear()
+	{
+		mStats = NullCommandStats();
+	}
+}
@@ -0,0 +1,14 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullCommandBufferManager.h"
+#include "BsNullCommandBuffer.h"
+
+namespace BansheeEngine
+{
+	SPtr<CommandBuffer> NullCommandBufferManager::createInternal(GpuQueueType type, UINT32 deviceIdx,
+		UINT32 queueIdx, bool secondary)
+	{
+		CommandBuffer* buffer = new (bs_alloc<NullCommandBuffer>()) NullCommandBuffer(type, deviceIdx, queueIdx, secondary);
+		return bs_shared_ptr(buffer);
+	}
+}
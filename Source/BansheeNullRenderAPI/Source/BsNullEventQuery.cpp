@@ -0,0 +1,27 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullEventQuery.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullEventQuery::NullEventQuery(UINT32 deviceIdx)
+	{
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Query);
+	}
+
+	NullEventQuery::~NullEventQuery()
+	{
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Query);
+	}
+
+	void NullEventQuery::begin()
+	{
+		setActive(true);
+	}
+
+	bool NullEventQuery::isReady() const
+	{
+		return true;
+	}
+}
@@ -0,0 +1,42 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullGpuParamBlockBuffer.h"
+#include "BsNullRenderAPI.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullGpuParamBlockBufferCore::NullGpuParamBlockBufferCore(UINT32 size, GpuParamBlockUsage usage, 
+		GpuDeviceFlags deviceMask)
+		:GenericGpuParamBlockBufferCore(size, usage, deviceMask)
+	{ }
+
+	NullGpuParamBlockBufferCore::~NullGpuParamBlockBufferCore()
+	{
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_GpuParamBuffer);
+	}
+
+	void NullGpuParamBlockBufferCore::initialize()
+	{
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_GpuParamBuffer);
+
+		GenericGpuParamBlockBufferCore::initialize();
+	}
+
+	void NullGpuParamBlockBufferCore::writeToGPU(const UINT8* data)
+	{
+		GenericGpuParamBlockBufferCore::writeToGPU(data);
+
+		NullRenderAPI* rapi = static_cast<NullRenderAPI*>(RenderAPICore::instancePtr());
+		rapi->_notifyParamBlockUpload(mSize);
+
+		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
+	}
+
+	void NullGpuParamBlockBufferCore::readFromGPU(UINT8* data) const
+	{
+		GenericGpuParamBlockBufferCore::readFromGPU(data);
+
+		BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_GpuParamBuffer);
+	}
+}
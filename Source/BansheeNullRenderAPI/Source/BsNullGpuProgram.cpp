@@ -0,0 +1,61 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullGpuProgram.h"
+#include "BsNullHLSLParamParser.h"
+#include "BsHardwareBufferManager.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullGpuProgramCore::NullGpuProgramCore(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask)
+		: GpuProgramCore(desc, deviceMask)
+	{ }
+
+	NullGpuProgramCore::~NullGpuProgramCore()
+	{
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_GpuProgram);
+	}
+
+	void NullGpuProgramCore::initialize()
+	{
+		NullHLSLParamParser parser;
+		parser.parse(mProperties.getSource(), mProperties.getType(), *mParametersDesc);
+
+		// Vertex inputs are not reflected. An empty declaration is compatible with any mesh.
+		if (mProperties.getType() == GPT_VERTEX_PROGRAM)
+			mInputDeclaration = HardwareBufferCoreManager::instance().createVertexDeclaration(List<VertexElement>());
+
+		mIsCompiled = true;
+
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_GpuProgram);
+		GpuProgramCore::initialize();
+	}
+
+	const String NullGpuProgramFactory::LANGUAGE_NAME = "hlsl";
+
+	const String& NullGpuProgramFactory::getLanguage() const
+	{
+		return LANGUAGE_NAME;
+	}
+
+	SPtr<GpuProgramCore> NullGpuProgramFactory::create(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask)
+	{
+		SPtr<GpuProgramCore> gpuProg = bs_shared_ptr<NullGpuProgramCore>(new (bs_alloc<NullGpuProgramCore>())
+			NullGpuProgramCore(desc, deviceMask));
+		gpuProg->_setThisPtr(gpuProg);
+
+		return gpuProg;
+	}
+
+	SPtr<GpuProgramCore> NullGpuProgramFactory::create(GpuProgramType type, GpuDeviceFlags deviceMask)
+	{
+		GPU_PROGRAM_DESC desc;
+		desc.type = type;
+
+		SPtr<GpuProgramCore> gpuProg = bs_shared_ptr<NullGpuProgramCore>(new (bs_alloc<NullGpuProgramCore>())
+			NullGpuProgramCore(desc, deviceMask));
+		gpuProg->_setThisPtr(gpuProg);
+
+		return gpuProg;
+	}
+}
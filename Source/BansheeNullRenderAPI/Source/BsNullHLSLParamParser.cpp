@@ -0,0 +1,647 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullHLSLParamParser.h"
+#include "BsGpuParamDesc.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	void NullHLSLParamParser::parse(const String& source, GpuProgramType type, GpuParamDesc& desc)
+	{
+		mTokens.clear();
+		mTokenIdx = 0;
+		mDefines.clear();
+		mStructSizes.clear();
+
+		for (UINT32 i = 0; i < 4; i++)
+			mNextRegister[i] = 0;
+
+		tokenize(source);
+
+		UINT32 globalsSize = 0;
+		Vector<GpuParamDataDesc> globalParams;
+		while (mTokenIdx < (UINT32)mTokens.size())
+		{
+			const String& token = peek();
+
+			if (token == "cbuffer" || token == "tbuffer")
+				parseConstantBuffer(type, desc);
+			else if (token == "struct")
+				parseStruct();
+			else if (token == "{")
+				skipGroup("{", "}");
+			else if (token == "[") // Attributes
+				skipGroup("[", "]");
+			else if (token == ";" || token == "}")
+				mTokenIdx++;
+			else
+				parseDeclaration(type, desc, globalsSize, globalParams);
+		}
+
+		// Variables declared outside of a cbuffer end up in an implicit block, same as with the HLSL compiler
+		if (!globalParams.empty())
+		{
+			GpuParamBlockDesc blockDesc;
+			blockDesc.name = "$Globals";
+			blockDesc.slot = assignRegister(0, -1, 1);
+			blockDesc.set = (UINT32)type;
+			blockDesc.blockSize = ((globalsSize + 3) / 4) * 4;
+			blockDesc.isShareable = false;
+
+			for (auto& param : globalParams)
+			{
+				param.paramBlockSlot = blockDesc.slot;
+				param.paramBlockSet = blockDesc.set;
+
+				desc.params.insert(std::make_pair(param.name, param));
+			}
+
+			desc.paramBlocks.insert(std::make_pair(blockDesc.name, blockDesc));
+		}
+	}
+
+	void NullHLSLParamParser::tokenize(const String& source)
+	{
+		UINT32 length = (UINT32)source.size();
+		bool lineStart = true;
+
+		UINT32 i = 0;
+		while (i < length)
+		{
+			char ch = source[i];
+			if (ch == '\n')
+			{
+				lineStart = true;
+				i++;
+				continue;
+			}
+
+			if (isspace((unsigned char)ch))
+			{
+				i++;
+				continue;
+			}
+
+			if (ch == '/' && (i + 1) < length && source[i + 1] == '/')
+			{
+				while (i < length && source[i] != '\n')
+					i++;
+
+				continue;
+			}
+
+			if (ch == '/' && (i + 1) < length && source[i + 1] == '*')
+			{
+				size_t end = source.find("*/", i + 2);
+				i = end == String::npos ? length : (UINT32)end + 2;
+				continue;
+			}
+
+			if (ch == '#' && lineStart)
+			{
+				UINT32 start = i + 1;
+				while (i < length && source[i] != '\n')
+				{
+					if (source[i] == '\\' && (i + 1) < length && source[i + 1] == '\n')
+						i++;
+
+					i++;
+				}
+
+				// Only simple numeric defines are recorded, so they can be used as array sizes
+				Vector<String> words = StringUtil::split(source.substr(start, i - start), "\t\r ");
+				if (words.size() >= 3 && words[0] == "define" && isdigit((unsigned char)words[2][0]))
+					mDefines[words[1]] = parseUINT32(words[2]);
+
+				continue;
+			}
+
+			lineStart = false;
+
+			UINT32 start = i;
+			if (isalpha((unsigned char)ch) || ch == '_')
+			{
+				while (i < length && (isalnum((unsigned char)source[i]) || source[i] == '_'))
+					i++;
+			}
+			else if (isdigit((unsigned char)ch))
+			{
+				while (i < length && (isalnum((unsigned char)source[i]) || source[i] == '.'))
+					i++;
+			}
+			else if (ch == '"')
+			{
+				i++;
+				while (i < length && source[i] != '"' && source[i] != '\n')
+					i++;
+
+				i++;
+				continue;
+			}
+			else
+				i++;
+
+			mTokens.push_back(source.substr(start, i - start));
+		}
+	}
+
+	const String& NullHLSLParamParser::peek(UINT32 offset) const
+	{
+		static const String EMPTY;
+
+		if ((mTokenIdx + offset) >= (UINT32)mTokens.size())
+			return EMPTY;
+
+		return mTokens[mTokenIdx + offset];
+	}
+
+	void NullHLSLParamParser::skipGroup(const String& open, const String& close)
+	{
+		UINT32 depth = 0;
+		while (mTokenIdx < (UINT32)mTokens.size())
+		{
+			const String& token = mTokens[mTokenIdx++];
+			if (token == open)
+				depth++;
+			else if (token == close)
+			{
+				if (depth <= 1)
+					return;
+
+				depth--;
+			}
+		}
+	}
+
+	void NullHLSLParamParser::skipToDeclaratorEnd()
+	{
+		while (mTokenIdx < (UINT32)mTokens.size())
+		{
+			const String& token = peek();
+			if (token == "," || token == ";" || token == "}")
+				return;
+
+			if (token == "(")
+				skipGroup("(", ")");
+			else if (token == "{")
+				skipGroup("{", "}");
+			else
+				mTokenIdx++;
+		}
+	}
+
+	INT32 NullHLSLParamParser::parseRegister()
+	{
+		if (peek() != ":" || peek(1) != "register" || peek(2) != "(")
+			return -1;
+
+		const String& slot = peek(3);
+
+		INT32 output = -1;
+		if (slot.size() > 1)
+			output = (INT32)parseUINT32(slot.substr(1));
+
+		mTokenIdx += 2;
+		skipGroup("(", ")");
+
+		return output;
+	}
+
+	UINT32 NullHLSLParamParser::parseArraySize()
+	{
+		UINT32 output = 1;
+		while (peek() == "[")
+		{
+			const String& size = peek(1);
+
+			auto iterFind = mDefines.find(size);
+			if (iterFind != mDefines.end())
+				output *= iterFind->second;
+			else if (!size.empty() && isdigit((unsigned char)size[0]))
+				output *= parseUINT32(size);
+
+			skipGroup("[", "]");
+		}
+
+		return output;
+	}
+
+	void NullHLSLParamParser::parseStruct()
+	{
+		mTokenIdx++;
+
+		String name = peek();
+		mTokenIdx++;
+
+		if (peek() == "{")
+			mStructSizes[name] = parseMembers(nullptr);
+
+		// Skip over any variables declared together with the struct
+		while (mTokenIdx < (UINT32)mTokens.size() && peek() != ";")
+		{
+			skipToDeclaratorEnd();
+
+			if (peek() != ";")
+				mTokenIdx++;
+		}
+
+		mTokenIdx++;
+	}
+
+	void NullHLSLParamParser::parseConstantBuffer(GpuProgramType type, GpuParamDesc& desc)
+	{
+		mTokenIdx++;
+
+		GpuParamBlockDesc blockDesc;
+		blockDesc.name = peek();
+		mTokenIdx++;
+
+		INT32 explicitRegister = parseRegister();
+		if (peek() != "{")
+		{
+			skipToDeclaratorEnd();
+			return;
+		}
+
+		Vector<GpuParamDataDesc> params;
+		UINT32 size = parseMembers(&params);
+
+		blockDesc.slot = assignRegister(0, explicitRegister, 1);
+		blockDesc.set = (UINT32)type;
+		blockDesc.blockSize = ((size + 3) / 4) * 4;
+		blockDesc.isShareable = true;
+
+		for (auto& param : params)
+		{
+			param.paramBlockSlot = blockDesc.slot;
+			param.paramBlockSet = blockDesc.set;
+
+			desc.params.insert(std::make_pair(param.name, param));
+		}
+
+		desc.paramBlocks.insert(std::make_pair(blockDesc.name, blockDesc));
+	}
+
+	void NullHLSLParamParser::parseDeclaration(GpuProgramType type, GpuParamDesc& desc, UINT32& globalsSize,
+		Vector<GpuParamDataDesc>& globalParams)
+	{
+		bool isUniform = true;
+		bool rowMajor = false;
+		while (isModifier(peek()))
+		{
+			const String& modifier = peek();
+			if (modifier == "static" || modifier == "groupshared" || modifier == "typedef")
+				isUniform = false;
+			else if (modifier == "row_major")
+				rowMajor = true;
+
+			mTokenIdx++;
+		}
+
+		String typeName = peek();
+		mTokenIdx++;
+
+		if (peek() == "<")
+			skipGroup("<", ">");
+
+		// Function declaration or definition
+		if (peek(1) == "(")
+		{
+			while (mTokenIdx < (UINT32)mTokens.size() && peek() != ";" && peek() != "{")
+			{
+				if (peek() == "(")
+					skipGroup("(", ")");
+				else
+					mTokenIdx++;
+			}
+
+			if (peek() == "{")
+				skipGroup("{", "}");
+
+			return;
+		}
+
+		GpuParamObjectType objectType = GPOT_UNKNOWN;
+		UINT32 registerClass = 0;
+		bool isObject = getObjectType(typeName, objectType, registerClass);
+
+		DataTypeInfo dataType;
+		bool isData = !isObject && getDataType(typeName, rowMajor, dataType);
+
+		while (mTokenIdx < (UINT32)mTokens.size())
+		{
+			String name = peek();
+			mTokenIdx++;
+
+			UINT32 arraySize = parseArraySize();
+			INT32 explicitRegister = parseRegister();
+			skipToDeclaratorEnd();
+
+			if (isUniform && isObject)
+			{
+				if (objectType != GPOT_UNKNOWN)
+				{
+					GpuParamObjectDesc memberDesc;
+					memberDesc.name = name;
+					memberDesc.type = objectType;
+					memberDesc.slot = assignRegister(registerClass, explicitRegister, arraySize);
+					memberDesc.set = (UINT32)type;
+
+					switch (objectType)
+					{
+					case GPOT_SAMPLER2D:
+						desc.samplers.insert(std::make_pair(memberDesc.name, memberDesc));
+						break;
+					case GPOT_TEXTURE1D:
+					case GPOT_TEXTURE2D:
+					case GPOT_TEXTURE3D:
+					case GPOT_TEXTURECUBE:
+					case GPOT_TEXTURE2DMS:
+						desc.textures.insert(std::make_pair(memberDesc.name, memberDesc));
+						break;
+					case GPOT_RWTEXTURE1D:
+					case GPOT_RWTEXTURE2D:
+					case GPOT_RWTEXTURE3D:
+						desc.loadStoreTextures.insert(std::make_pair(memberDesc.name, memberDesc));
+						break;
+					default:
+						desc.buffers.insert(std::make_pair(memberDesc.name, memberDesc));
+						break;
+					}
+				}
+				else
+					LOGWRN("Skipping resource because it has unsupported type: " + typeName);
+			}
+			else if (isUniform && isData)
+				globalParams.push_back(placeVariable(name, dataType, arraySize, globalsSize));
+
+			if (peek() != ",")
+				break;
+
+			mTokenIdx++;
+		}
+
+		if (peek() == ";")
+			mTokenIdx++;
+	}
+
+	UINT32 NullHLSLParamParser::parseMembers(Vector<GpuParamDataDesc>* params)
+	{
+		mTokenIdx++;
+
+		UINT32 size = 0;
+		while (mTokenIdx < (UINT32)mTokens.size() && peek() != "}")
+		{
+			if (peek() == ";")
+			{
+				mTokenIdx++;
+				continue;
+			}
+
+			bool rowMajor = false;
+			while (isModifier(peek()))
+			{
+				if (peek() == "row_major")
+					rowMajor = true;
+
+				mTokenIdx++;
+			}
+
+			String typeName = peek();
+			mTokenIdx++;
+
+			if (peek() == "<")
+				skipGroup("<", ">");
+
+			DataTypeInfo dataType;
+			bool isKnown = getDataType(typeName, rowMajor, dataType);
+
+			if (!isKnown && params != nullptr)
+				LOGWRN("Skipping variable because it has unsupported type: " + typeName);
+
+			while (mTokenIdx < (UINT32)mTokens.size())
+			{
+				String name = peek();
+				mTokenIdx++;
+
+				UINT32 arraySize = parseArraySize();
+				skipToDeclaratorEnd();
+
+				if (isKnown)
+				{
+					GpuParamDataDesc memberDesc = placeVariable(name, dataType, arraySize, size);
+					if (params != nullptr)
+						params->push_back(memberDesc);
+				}
+
+				if (peek() != ",")
+					break;
+
+				mTokenIdx++;
+			}
+		}
+
+		mTokenIdx++;
+		return size;
+	}
+
+	GpuParamDataDesc NullHLSLParamParser::placeVariable(const String& name, const DataTypeInfo& info, UINT32 arraySize,
+		UINT32& offset)
+	{
+		// Variables cannot straddle a 16 byte register, and arrays, matrices and structs always start a new register
+		UINT32 registerOffset = offset % 4;
+		if (info.alignToRegister || arraySize > 1 || (registerOffset != 0 && (registerOffset + info.size) > 4))
+			offset = ((offset + 3) / 4) * 4;
+
+		GpuParamDataDesc output;
+		output.name = name;
+		output.type = info.type;
+		output.elementSize = info.size;
+		output.arraySize = arraySize;
+		output.arrayElementStride = arraySize > 1 ? ((info.size + 3) / 4) * 4 : info.size;
+		output.paramBlockSlot = 0;
+		output.paramBlockSet = 0;
+		output.gpuMemOffset = offset;
+		output.cpuMemOffset = offset;
+
+		offset += output.arrayElementStride * (arraySize - 1) + info.size;
+		return output;
+	}
+
+	bool NullHLSLParamParser::getDataType(const String& name, bool rowMajor, DataTypeInfo& info) const
+	{
+		info.alignToRegister = false;
+
+		if (name == "matrix")
+		{
+			info.type = GPDT_MATRIX_4X4;
+			info.size = 16;
+			info.alignToRegister = true;
+			return true;
+		}
+
+		auto iterFind = mStructSizes.find(name);
+		if (iterFind != mStructSizes.end())
+		{
+			info.type = GPDT_STRUCT;
+			info.size = iterFind->second;
+			info.alignToRegister = true;
+			return true;
+		}
+
+		static const char* BASE_TYPES[] = { "float", "half", "int", "uint", "dword", "bool" };
+
+		String baseType;
+		for (auto& entry : BASE_TYPES)
+		{
+			if (name.compare(0, strlen(entry), entry) == 0)
+			{
+				baseType = entry;
+				break;
+			}
+		}
+
+		if (baseType.empty())
+			return false;
+
+		bool isFloat = baseType == "float" || baseType == "half";
+		String suffix = name.substr(baseType.size());
+
+		// Scalar
+		if (suffix.empty())
+		{
+			if (isFloat)
+				info.type = GPDT_FLOAT1;
+			else if (baseType == "bool")
+				info.type = GPDT_BOOL;
+			else
+				info.type = GPDT_INT1;
+
+			info.size = 1;
+			return true;
+		}
+
+		auto isDimension = [](char ch) { return ch >= '1' && ch <= '4'; };
+
+		// Vector
+		if (suffix.size() == 1 && isDimension(suffix[0]))
+		{
+			UINT32 numComponents = suffix[0] - '0';
+
+			info.type = (GpuParamDataType)((isFloat ? GPDT_FLOAT1 : GPDT_INT1) + numComponents - 1);
+			info.size = numComponents;
+			return true;
+		}
+
+		// Matrix
+		if (isFloat && suffix.size() == 3 && suffix[1] == 'x' && suffix[0] >= '2' && suffix[0] <= '4' &&
+			suffix[2] >= '2' && suffix[2] <= '4')
+		{
+			UINT32 numRows = suffix[0] - '0';
+			UINT32 numColumns = suffix[2] - '0';
+
+			static const GpuParamDataType MATRIX_TYPES[3][3] =
+			{
+				{ GPDT_MATRIX_2X2, GPDT_MATRIX_2X3, GPDT_MATRIX_2X4 },
+				{ GPDT_MATRIX_3X2, GPDT_MATRIX_3X3, GPDT_MATRIX_3X4 },
+				{ GPDT_MATRIX_4X2, GPDT_MATRIX_4X3, GPDT_MATRIX_4X4 }
+			};
+
+			info.type = MATRIX_TYPES[numRows - 2][numColumns - 2];
+			info.alignToRegister = true;
+
+			// Column major matrices use one register per column, row major ones one register per row
+			if (rowMajor)
+				info.size = (numRows - 1) * 4 + numColumns;
+			else
+				info.size = (numColumns - 1) * 4 + numRows;
+
+			return true;
+		}
+
+		return false;
+	}
+
+	bool NullHLSLParamParser::getObjectType(const String& name, GpuParamObjectType& type, UINT32& registerClass)
+	{
+		struct ObjectTypeInfo
+		{
+			const char* name;
+			GpuParamObjectType type;
+			UINT32 registerClass;
+		};
+
+		static const ObjectTypeInfo OBJECT_TYPES[] =
+		{
+			{ "SamplerState", GPOT_SAMPLER2D, 2 },
+			{ "SamplerComparisonState", GPOT_SAMPLER2D, 2 },
+			{ "sampler", GPOT_SAMPLER2D, 2 },
+			{ "Texture1D", GPOT_TEXTURE1D, 1 },
+			{ "Texture2D", GPOT_TEXTURE2D, 1 },
+			{ "Texture3D", GPOT_TEXTURE3D, 1 },
+			{ "TextureCube", GPOT_TEXTURECUBE, 1 },
+			{ "Texture2DMS", GPOT_TEXTURE2DMS, 1 },
+			{ "Texture1DArray", GPOT_UNKNOWN, 1 },
+			{ "Texture2DArray", GPOT_UNKNOWN, 1 },
+			{ "Texture2DMSArray", GPOT_UNKNOWN, 1 },
+			{ "TextureCubeArray", GPOT_UNKNOWN, 1 },
+			{ "Buffer", GPOT_UNKNOWN, 1 },
+			{ "StructuredBuffer", GPOT_STRUCTURED_BUFFER, 1 },
+			{ "ByteAddressBuffer", GPOT_BYTE_BUFFER, 1 },
+			{ "RWBuffer", GPOT_RWTYPED_BUFFER, 3 },
+			{ "RWByteAddressBuffer", GPOT_RWBYTE_BUFFER, 3 },
+			{ "RWStructuredBuffer", GPOT_RWSTRUCTURED_BUFFER, 3 },
+			{ "AppendStructuredBuffer", GPOT_RWAPPEND_BUFFER, 3 },
+			{ "ConsumeStructuredBuffer", GPOT_RWCONSUME_BUFFER, 3 },
+			{ "RWTexture1D", GPOT_RWTEXTURE1D, 3 },
+			{ "RWTexture2D", GPOT_RWTEXTURE2D, 3 },
+			{ "RWTexture3D", GPOT_RWTEXTURE3D, 3 },
+			{ "RWTexture1DArray", GPOT_UNKNOWN, 3 },
+			{ "RWTexture2DArray", GPOT_UNKNOWN, 3 },
+		};
+
+		for (auto& entry : OBJECT_TYPES)
+		{
+			if (name == entry.name)
+			{
+				type = entry.type;
+				registerClass = entry.registerClass;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	UINT32 NullHLSLParamParser::assignRegister(UINT32 registerClass, INT32 explicitRegister, UINT32 count)
+	{
+		if (explicitRegister >= 0)
+		{
+			mNextRegister[registerClass] = std::max(mNextRegister[registerClass], (UINT32)explicitRegister + count);
+			return (UINT32)explicitRegister;
+		}
+
+		UINT32 output = mNextRegister[registerClass];
+		mNextRegister[registerClass] += count;
+
+		return output;
+	}
+
+	bool NullHLSLParamParser::isModifier(const String& token)
+	{
+		static const char* MODIFIERS[] =
+		{
+			"static", "const", "uniform", "extern", "volatile", "precise", "shared", "groupshared", "row_major",
+			"column_major", "inline", "typedef", "nointerpolation", "linear", "centroid", "noperspective", "sample",
+			"snorm", "unorm", "in", "out", "inout", "globallycoherent"
+		};
+
+		for (auto& entry : MODIFIERS)
+		{
+			if (token == entry)
+				return true;
+		}
+
+		return false;
+	}
+}
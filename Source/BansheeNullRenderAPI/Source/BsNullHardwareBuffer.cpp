@@ -0,0 +1,60 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullHardwareBuffer.h"
+
+namespace BansheeEngine
+{
+	NullHardwareBuffer::NullHardwareBuffer(GpuBufferUsage usage, UINT32 size)
+		:HardwareBuffer(usage), mData(nullptr)
+	{
+		mSizeInBytes = size;
+
+		if (size > 0)
+		{
+			mData = (UINT8*)bs_alloc(size);
+			memset(mData, 0, size);
+		}
+	}
+
+	NullHardwareBuffer::~NullHardwareBuffer()
+	{
+		if (mData != nullptr)
+			bs_free(mData);
+	}
+
+	void* NullHardwareBuffer::map(UINT32 offset, UINT32 length, GpuLockOptions options, UINT32 syncMask)
+	{
+		if ((offset + length) > mSizeInBytes)
+		{
+			LOGERR("Provided offset(" + toString(offset) + ") + length(" + toString(length) + ") "
+				"is larger than the buffer " + toString(mSizeInBytes) + ".");
+
+			return nullptr;
+		}
+
+		return mData + offset;
+	}
+
+	void NullHardwareBuffer::readData(UINT32 offset, UINT32 length, void* dest, UINT32 syncMask)
+	{
+		if ((offset + length) > mSizeInBytes)
+		{
+			LOGERR("Attempting to read past the end of the buffer.");
+			return;
+		}
+
+		memcpy(dest, mData + offset, length);
+	}
+
+	void NullHardwareBuffer::writeData(UINT32 offset, UINT32 length, const void* source, BufferWriteType writeFlags,
+		UINT32 syncMask)
+	{
+		if ((offset + length) > mSizeInBytes)
+		{
+			LOGERR("Attempting to write past the end of the buffer.");
+			return;
+		}
+
+		memcpy(mData + offset, source, length);
+	}
+}
@@ -0,0 +1,51 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullHardwareBufferManager.h"
+#include "BsNullVertexBuffer.h"
+#include "BsNullIndexBuffer.h"
+#include "BsNullGpuBuffer.h"
+#include "BsNullGpuParamBlockBuffer.h"
+
+namespace BansheeEngine
+{
+	SPtr<VertexBufferCore> NullHardwareBufferCoreManager::createVertexBufferInternal(const VERTEX_BUFFER_DESC& desc,
+		GpuDeviceFlags deviceMask)
+	{
+		SPtr<NullVertexBufferCore> ret = bs_shared_ptr_new<NullVertexBufferCore>(desc, deviceMask);
+		ret->_setThisPtr(ret);
+
+		return ret;
+	}
+
+	SPtr<IndexBufferCore> NullHardwareBufferCoreManager::createIndexBufferInternal(const INDEX_BUFFER_DESC& desc,
+		GpuDeviceFlags deviceMask)
+	{
+		SPtr<NullIndexBufferCore> ret = bs_shared_ptr_new<NullIndexBufferCore>(desc, deviceMask);
+		ret->_setThisPtr(ret);
+
+		return ret;
+	}
+
+	SPtr<GpuParamBlockBufferCore> NullHardwareBufferCoreManager::createGpuParamBlockBufferInternal(UINT32 size,
+		GpuParamBlockUsage usage, GpuDeviceFlags deviceMask)
+	{
+		NullGpuParamBlockBufferCore* paramBlockBuffer =
+			new (bs_alloc<NullGpuParamBlockBufferCore>()) NullGpuParamBlockBufferCore(size, usage, deviceMask);
+
+		SPtr<GpuParamBlockBufferCore> paramBlockBufferPtr = bs_shared_ptr<NullGpuParamBlockBufferCore>(paramBlockBuffer);
+		paramBlockBufferPtr->_setThisPtr(paramBlockBufferPtr);
+
+		return paramBlockBufferPtr;
+	}
+
+	SPtr<GpuBufferCore> NullHardwareBufferCoreManager::createGpuBufferInternal(const GPU_BUFFER_DESC& desc,
+		GpuDeviceFlags deviceMask)
+	{
+		NullGpuBufferCore* buffer = new (bs_alloc<NullGpuBufferCore>()) NullGpuBufferCore(desc, deviceMask);
+
+		SPtr<NullGpuBufferCore> bufferPtr = bs_shared_ptr<NullGpuBufferCore>(buffer);
+		bufferPtr->_setThisPtr(bufferPtr);
+
+		return bufferPtr;
+	}
+}
@@ -0,0 +1,37 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullOcclusionQuery.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullOcclusionQuery::NullOcclusionQuery(bool binary, UINT32 deviceIdx)
+		:OcclusionQuery(binary)
+	{
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Query);
+	}
+
+	NullOcclusionQuery::~NullOcclusionQuery()
+	{
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Query);
+	}
+
+	void NullOcclusionQuery::begin()
+	{
+		setActive(true);
+	}
+
+	void NullOcclusionQuery::end()
+	{
+	}
+
+	bool NullOcclusionQuery::isReady() const
+	{
+		return true;
+	}
+
+	UINT32 NullOcclusionQuery::getNumSamples()
+	{
+		return 0;
+	}
+}
@@ -0,0 +1,452 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderAPI.h"
+#include "BsNullCommandBufferManager.h"
+#include "BsNullTextureManager.h"
+#include "BsNullHardwareBufferManager.h"
+#include "BsNullRenderWindowManager.h"
+#include "BsNullQueryManager.h"
+#include "BsNullGpuProgram.h"
+#include "BsRenderStateManager.h"
+#include "BsGpuProgramManager.h"
+#include "BsGpuParams.h"
+#include "BsGpuParamDesc.h"
+#include "BsVideoModeInfo.h"
+#include "BsCoreThread.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullRenderAPI::NullRenderAPI()
+		:mHLSLFactory(nullptr)
+	{ }
+
+	NullRenderAPI::~NullRenderAPI()
+	{
+
+	}
+
+	const StringID& NullRenderAPI::getName() const
+	{
+		return RenderAPINull;
+	}
+
+	const String& NullRenderAPI::getShadingLanguageName() const
+	{
+		static String strName("hlsl");
+		return strName;
+	}
+
+	Vector<StringID> NullRenderAPI::getTechniqueRenderAPIs() const
+	{
+		// Programs are never executed, but their parameters are determined from HLSL source, so techniques written for
+		// DirectX 11 can be used
+		return { RenderAPINull, "D3D11RenderAPI" };
+	}
+
+	void NullRenderAPI::initialize()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		// No outputs to report
+		mVideoModeInfo = bs_shared_ptr_new<VideoModeInfo>();
+
+		// Create command buffer manager
+		CommandBufferManager::startUp<NullCommandBufferManager>();
+
+		// Create main command buffer
+		mMainCommandBuffer = std::static_pointer_cast<NullCommandBuffer>(CommandBuffer::create(GQT_GRAPHICS));
+
+		// Create the texture manager for use by others		
+		TextureManager::startUp<NullTextureManager>();
+		TextureCoreManager::startUp<NullTextureCoreManager>();
+
+		// Create hardware buffer manager		
+		HardwareBufferManager::startUp();
+		HardwareBufferCoreManager::startUp<NullHardwareBufferCoreManager>();
+
+		// Create render window manager
+		RenderWindowManager::startUp<NullRenderWindowManager>();
+		RenderWindowCoreManager::startUp<NullRenderWindowCoreManager>();
+
+		// Create query manager 
+		QueryManager::startUp<NullQueryManager>();
+
+		// Create render state manager
+		RenderStateCoreManager::startUp();
+
+		// Create & register HLSL factory
+		mHLSLFactory = bs_new<NullGpuProgramFactory>();
+		GpuProgramCoreManager::instance().addFactory(mHLSLFactory);
+
+		initCapabilites();
+		
+		RenderAPICore::initialize();
+	}
+
+	void NullRenderAPI::destroyCore()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (mHLSLFactory != nullptr)
+		{
+			GpuProgramCoreManager::instance().removeFactory(mHLSLFactory);
+
+			bs_delete(mHLSLFactory);
+			mHLSLFactory = nullptr;
+		}
+
+		QueryManager::shutDown();
+		RenderStateCoreManager::shutDown();
+		RenderWindowCoreManager::shutDown();
+		RenderWindowManager::shutDown();
+		HardwareBufferCoreManager::shutDown();
+		HardwareBufferManager::shutDown();
+		TextureCoreManager::shutDown();
+		TextureManager::shutDown();
+
+		mMainCommandBuffer = nullptr;
+		CommandBufferManager::shutDown();
+
+		RenderAPICore::destroyCore();
+	}
+
+	void NullRenderAPI::setGraphicsPipeline(const SPtr<GpuPipelineStateCore>& pipelineState,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->mStats.numPipelineStateChanges++;
+
+		BS_INC_RENDER_STAT(NumPipelineStateChanges);
+	}
+
+	void NullRenderAPI::setComputePipeline(const SPtr<GpuProgramCore>& computeProgram,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->mStats.numPipelineStateChanges++;
+
+		BS_INC_RENDER_STAT(NumPipelineStateChanges);
+	}
+
+	void NullRenderAPI::setGpuParams(const SPtr<GpuParamsCore>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->mStats.numGpuParamBinds++;
+
+		BS_INC_RENDER_STAT(NumGpuParamBinds);
+	}
+
+	void NullRenderAPI::beginFrame(const SPtr<CommandBuffer>& commandBuffer)
+	{
+
+	}
+
+	void NullRenderAPI::endFrame(const SPtr<CommandBuffer>& commandBuffer)
+	{
+
+	}
+
+	void NullRenderAPI::setViewport(const Rect2& vp, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->mStats.numViewportChanges++;
+	}
+
+	void NullRenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->mStats.numVertexBufferBinds++;
+
+		BS_INC_RENDER_STAT(NumVertexBufferBinds);
+	}
+
+	void NullRenderAPI::setIndexBuffer(const SPtr<IndexBufferCore>& buffer, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->mStats.numIndexBufferBinds++;
+
+		BS_INC_RENDER_STAT(NumIndexBufferBinds);
+	}
+
+	void NullRenderAPI::setVertexDeclaration(const SPtr<VertexDeclarationCore>& vertexDeclaration,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		
+	}
+
+	void NullRenderAPI::setDrawOperation(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->mDrawOperation = op;
+	}
+
+	void NullRenderAPI::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		NullCommandBuffer* cb = getCB(commandBuffer);
+		UINT32 primCount = vertexCountToPrimCount(cb->mDrawOperation, vertexCount);
+
+		cb->mStats.numDrawCalls++;
+		cb->mStats.numInstances += std::max(instanceCount, 1U);
+		cb->mStats.numVertices += vertexCount;
+		cb->mStats.numPrimitives += primCount;
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
+	}
+
+	void NullRenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+		UINT32 instanceCount, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		NullCommandBuffer* cb = getCB(commandBuffer);
+		UINT32 primCount = vertexCountToPrimCount(cb->mDrawOperation, indexCount);
+
+		cb->mStats.numDrawCalls++;
+		cb->mStats.numInstances += std::max(instanceCount, 1U);
+		cb->mStats.numVertices += vertexCount;
+		cb->mStats.numPrimitives += primCount;
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
+	}
+
+	void NullRenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->mStats.numComputeCalls++;
+
+		BS_INC_RENDER_STAT(NumComputeCalls);
+	}
+
+	void NullRenderAPI::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		
+	}
+
+	void NullRenderAPI::setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		
+	}
+
+	void NullRenderAPI::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->mStats.numClears++;
+
+		BS_INC_RENDER_STAT(NumClears);
+	}
+
+	void NullRenderAPI::clearRenderTarget(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+		UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->mStats.numClears++;
+
+		BS_INC_RENDER_STAT(NumClears);
+	}
+
+	void NullRenderAPI::setRenderTarget(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->mStats.numRenderTargetChanges++;
+
+		BS_INC_RENDER_STAT(NumRenderTargetChanges);
+	}
+
+	void NullRenderAPI::swapBuffers(const SPtr<RenderTargetCore>& target, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		getCB(commandBuffer)->mStats.numPresents++;
+
+		BS_INC_RENDER_STAT(NumPresents);
+	}
+
+	void NullRenderAPI::addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
+	{
+		SPtr<NullCommandBuffer> cb = std::static_pointer_cast<NullCommandBuffer>(commandBuffer);
+		SPtr<NullCommandBuffer> secondaryCb = std::static_pointer_cast<NullCommandBuffer>(secondary);
+
+		cb->appendSecondary(secondaryCb);
+	}
+
+	void NullRenderAPI::executeCommands(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (commandBuffer == nullptr || commandBuffer == mMainCommandBuffer)
+			return;
+
+		NullCommandBuffer* cb = static_cast<NullCommandBuffer*>(commandBuffer.get());
+		mMainCommandBuffer->mStats += cb->mStats;
+		cb->clear();
+	}
+	
+	void NullRenderAPI::convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest)
+	{
+		dest = matrix;
+	}
+
+	const RenderAPIInfo& NullRenderAPI::getAPIInfo() const
+	{
+		static RenderAPIInfo info(0.0f, 0.0f, 0.0f, 1.0f, VET_COLOR_ABGR, false, true, false, true);
+
+		return info;
+	}
+
+	GpuParamBlockDesc NullRenderAPI::generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params)
+	{
+		GpuParamBlockDesc block;
+		block.blockSize = 0;
+		block.isShareable = true;
+		block.name = name;
+		block.slot = 0;
+		block.set = 0;
+
+		// Uses the same layout as the HLSL constant buffers the program parameters are parsed from
+		for (auto& param : params)
+		{
+			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[param.type];
+			UINT32 size = typeInfo.size / 4;
+
+			if (param.arraySize > 1)
+			{
+				// Arrays perform no packing and their elements are always padded and aligned to four component vectors
+				UINT32 alignOffset = size % typeInfo.baseTypeSize;
+				if (alignOffset != 0)
+				{
+					UINT32 padding = (typeInfo.baseTypeSize - alignOffset);
+					size += padding;
+				}
+
+				alignOffset = block.blockSize % typeInfo.baseTypeSize;
+				if (alignOffset != 0)
+				{
+					UINT32 padding = (typeInfo.baseTypeSize - alignOffset);
+					block.blockSize += padding;
+				}
+
+				param.elementSize = size;
+				param.arrayElementStride = size;
+				param.cpuMemOffset = block.blockSize;
+				param.gpuMemOffset = 0;
+
+				block.blockSize += size * param.arraySize;
+			}
+			else
+			{
+				// Pack everything as tightly as possible as long as the data doesn't cross 16 byte boundary
+				UINT32 alignOffset = block.blockSize % 4;
+				if (alignOffset != 0 && size > (4 - alignOffset))
+				{
+					UINT32 padding = (4 - alignOffset);
+					block.blockSize += padding;
+				}
+
+				param.elementSize = size;
+				param.arrayElementStride = size;
+				param.cpuMemOffset = block.blockSize;
+				param.gpuMemOffset = 0;
+
+				block.blockSize += size;
+			}
+
+			param.paramBlockSlot = 0;
+			param.paramBlockSet = 0;
+		}
+
+		// Constant buffer size must always be a multiple of 16
+		if (block.blockSize % 4 != 0)
+			block.blockSize += (4 - (block.blockSize % 4));
+
+		return block;
+	}
+
+	const NullCommandStats& NullRenderAPI::getStats() const
+	{
+		return mMainCommandBuffer->getStats();
+	}
+
+	void NullRenderAPI::resetStats()
+	{
+		mMainCommandBuffer->clear();
+	}
+
+	void NullRenderAPI::_notifyParamBlockUpload(UINT32 numBytes)
+	{
+		mMainCommandBuffer->mStats.numParamBlockUploads++;
+		mMainCommandBuffer->mStats.numParamBlockBytesUploaded += numBytes;
+	}
+
+	void NullRenderAPI::initCapabilites()
+	{
+		mNumDevices = 1;
+		mCurrentCapabilities = bs_newN<RenderAPICapabilities>(mNumDevices);
+
+		RenderAPICapabilities& caps = mCurrentCapabilities[0];
+
+		DriverVersion driverVersion;
+		driverVersion.major = 1;
+		driverVersion.minor = 0;
+		driverVersion.release = 0;
+		driverVersion.build = 0;
+
+		caps.setDriverVersion(driverVersion);
+		caps.setDeviceName("Null device");
+		caps.setVendor(GPU_UNKNOWN);
+		caps.setRenderAPIName(getName());
+
+		// Texture data is stored as provided, so any format can be used
+		caps.setCapability(RSC_TEXTURE_COMPRESSION_BC);
+		caps.setCapability(RSC_TEXTURE_COMPRESSION_ETC2);
+		caps.setCapability(RSC_TEXTURE_COMPRESSION_ASTC);
+
+		caps.setCapability(RSC_GEOMETRY_PROGRAM);
+		caps.setCapability(RSC_TESSELLATION_PROGRAM);
+		caps.setCapability(RSC_COMPUTE_PROGRAM);
+
+		caps.setMaxBoundVertexBuffers(32);
+		caps.setNumMultiRenderTargets(8);
+		caps.setGeometryProgramNumOutputVertices(1024);
+
+		static const GpuProgramType PROGRAM_TYPES[] = 
+		{ 
+			GPT_VERTEX_PROGRAM, GPT_FRAGMENT_PROGRAM, GPT_GEOMETRY_PROGRAM, GPT_HULL_PROGRAM, GPT_DOMAIN_PROGRAM,
+			GPT_COMPUTE_PROGRAM 
+		};
+
+		for(auto& type : PROGRAM_TYPES)
+		{
+			caps.setNumTextureUnits(type, 128);
+			caps.setNumGpuParamBlockBuffers(type, 14);
+		}
+
+		caps.setNumLoadStoreTextureUnits(GPT_FRAGMENT_PROGRAM, 8);
+		caps.setNumLoadStoreTextureUnits(GPT_COMPUTE_PROGRAM, 8);
+
+		caps.setNumCombinedTextureUnits(128 * 6);
+		caps.setNumCombinedGpuParamBlockBuffers(14 * 6);
+		caps.setNumCombinedLoadStoreTextureUnits(8 * 2);
+
+		caps.addShaderProfile("ps_5_0");
+		caps.addShaderProfile("vs_5_0");
+		caps.addShaderProfile("gs_5_0");
+		caps.addShaderProfile("hs_5_0");
+		caps.addShaderProfile("ds_5_0");
+		caps.addShaderProfile("cs_5_0");
+
+		caps.addGpuProgramProfile(GPP_FS_5_0, "ps_5_0");
+		caps.addGpuProgramProfile(GPP_VS_5_0, "vs_5_0");
+		caps.addGpuProgramProfile(GPP_GS_5_0, "gs_5_0");
+		caps.addGpuProgramProfile(GPP_HS_5_0, "hs_5_0");
+		caps.addGpuProgramProfile(GPP_DS_5_0, "ds_5_0");
+		caps.addGpuProgramProfile(GPP_CS_5_0, "cs_5_0");
+
+		caps.addShaderProfile("hlsl");
+	}
+
+	NullCommandBuffer* NullRenderAPI::getCB(const SPtr<CommandBuffer>& buffer)
+	{
+		if (buffer != nullptr)
+			return static_cast<NullCommandBuffer*>(buffer.get());
+
+		return mMainCommandBuffer.get();
+	}
+}
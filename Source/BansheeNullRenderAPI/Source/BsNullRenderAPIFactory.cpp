@@ -0,0 +1,16 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderAPIFactory.h"
+#include "BsRenderAPI.h"
+
+namespace BansheeEngine
+{
+	const char* SystemName = "BansheeNullRenderAPI";
+
+	void NullRenderAPIFactory::create()
+	{
+		RenderAPICore::startUp<NullRenderAPI>();
+	}
+
+	NullRenderAPIFactory::InitOnStart NullRenderAPIFactory::initOnStart;
+}
\ No newline at end of file
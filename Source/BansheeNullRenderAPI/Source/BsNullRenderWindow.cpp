@@ -0,0 +1,162 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderWindow.h"
+#include "BsRenderWindowManager.h"
+#include "BsCoreThread.h"
+
+namespace BansheeEngine
+{
+	NullRenderWindowProperties::NullRenderWindowProperties(const RENDER_WINDOW_DESC& desc)
+		:RenderWindowProperties(desc)
+	{ }
+
+	NullRenderWindowCore::NullRenderWindowCore(const RENDER_WINDOW_DESC& desc, UINT32 windowId)
+		: RenderWindowCore(desc, windowId), mProperties(desc), mSyncedProperties(desc)
+	{ }
+
+	NullRenderWindowCore::~NullRenderWindowCore()
+	{
+		NullRenderWindowProperties& props = mProperties;
+		props.mActive = false;
+	}
+
+	void NullRenderWindowCore::initialize()
+	{
+		NullRenderWindowProperties& props = mProperties;
+		props.mHasFocus = !mDesc.hidden;
+
+		{
+			ScopedSpinLock lock(mLock);
+			mSyncedProperties = props;
+		}
+
+		RenderWindowManager::instance().notifySyncDataDirty(this);
+		RenderWindowCore::initialize();
+	}
+
+	void NullRenderWindowCore::move(INT32 left, INT32 top)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		NullRenderWindowProperties& props = mProperties;
+
+		if (!props.mIsFullScreen)
+		{
+			props.mTop = top;
+			props.mLeft = left;
+
+			{
+				ScopedSpinLock lock(mLock);
+				mSyncedProperties.mTop = props.mTop;
+				mSyncedProperties.mLeft = props.mLeft;
+			}
+
+			RenderWindowManager::instance().notifySyncDataDirty(this);
+			RenderWindowManager::instance().notifyMovedOrResized(this);
+		}
+	}
+
+	void NullRenderWindowCore::resize(UINT32 width, UINT32 height)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (!mProperties.mIsFullScreen)
+			setSize(width, height, false);
+	}
+
+	void NullRenderWindowCore::setFullscreen(UINT32 width, UINT32 height, float refreshRate, UINT32 monitorIdx)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		setSize(width, height, true);
+	}
+
+	void NullRenderWindowCore::setFullscreen(const VideoMode& mode)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		setSize(mode.getWidth(), mode.getHeight(), true);
+	}
+
+	void NullRenderWindowCore::setWindowed(UINT32 width, UINT32 height)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		setSize(width, height, false);
+	}
+
+	void NullRenderWindowCore::getCustomAttribute(const String& name, void* pData) const
+	{
+		if (name == "WINDOW")
+		{
+			UINT64* pHwnd = (UINT64*)pData;
+			*pHwnd = 0;
+			return;
+		}
+
+		RenderWindowCore::getCustomAttribute(name, pData);
+	}
+
+	void NullRenderWindowCore::setSize(UINT32 width, UINT32 height, bool fullscreen)
+	{
+		NullRenderWindowProperties& props = mProperties;
+
+		props.mIsFullScreen = fullscreen;
+		props.mWidth = width;
+		props.mHeight = height;
+
+		{
+			ScopedSpinLock lock(mLock);
+			mSyncedProperties.mIsFullScreen = props.mIsFullScreen;
+			mSyncedProperties.mWidth = props.mWidth;
+			mSyncedProperties.mHeight = props.mHeight;
+		}
+
+		// There is no OS window to report the change, so report it directly
+		RenderWindowManager::instance().notifySyncDataDirty(this);
+		RenderWindowManager::instance().notifyMovedOrResized(this);
+	}
+
+	void NullRenderWindowCore::syncProperties()
+	{
+		ScopedSpinLock lock(mLock);
+		mProperties = mSyncedProperties;
+	}
+
+	NullRenderWindow::NullRenderWindow(const RENDER_WINDOW_DESC& desc, UINT32 windowId)
+		:RenderWindow(desc, windowId), mProperties(desc)
+	{ }
+
+	Vector2I NullRenderWindow::screenToWindowPos(const Vector2I& screenPos) const
+	{
+		return Vector2I(screenPos.x - mProperties.getLeft(), screenPos.y - mProperties.getTop());
+	}
+
+	Vector2I NullRenderWindow::windowToScreenPos(const Vector2I& windowPos) const
+	{
+		return Vector2I(windowPos.x + mProperties.getLeft(), windowPos.y + mProperties.getTop());
+	}
+
+	void NullRenderWindow::getCustomAttribute(const String& name, void* pData) const
+	{
+		if (name == "WINDOW")
+		{
+			UINT64* pHwnd = (UINT64*)pData;
+			*pHwnd = 0;
+			return;
+		}
+
+		RenderWindow::getCustomAttribute(name, pData);
+	}
+
+	SPtr<NullRenderWindowCore> NullRenderWindow::getCore() const
+	{
+		return std::static_pointer_cast<NullRenderWindowCore>(mCoreSpecific);
+	}
+
+	void NullRenderWindow::syncProperties()
+	{
+		ScopedSpinLock lock(getCore()->mLock);
+		mProperties = getCore()->mSyncedProperties;
+	}
+}
@@ -0,0 +1,27 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderWindowManager.h"
+#include "BsNullRenderWindow.h"
+
+namespace BansheeEngine
+{
+	SPtr<RenderWindow> NullRenderWindowManager::createImpl(RENDER_WINDOW_DESC& desc, UINT32 windowId,
+		const SPtr<RenderWindow>& parentWindow)
+	{
+		NullRenderWindow* renderWindow = new (bs_alloc<NullRenderWindow>()) NullRenderWindow(desc, windowId);
+		return bs_core_ptr<NullRenderWindow>(renderWindow);
+	}
+
+	SPtr<RenderWindowCore> NullRenderWindowCoreManager::createInternal(RENDER_WINDOW_DESC& desc, UINT32 windowId)
+	{
+		NullRenderWindowCore* renderWindow =
+			new (bs_alloc<NullRenderWindowCore>()) NullRenderWindowCore(desc, windowId);
+
+		SPtr<NullRenderWindowCore> renderWindowPtr = bs_shared_ptr<NullRenderWindowCore>(renderWindow);
+		renderWindowPtr->_setThisPtr(renderWindowPtr);
+
+		windowCreated(renderWindow);
+
+		return renderWindowPtr;
+	}
+}
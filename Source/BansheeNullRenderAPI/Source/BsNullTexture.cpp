@@ -0,0 +1,76 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullTexture.h"
+#include "BsPixelData.h"
+#include "BsPixelUtil.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullTextureCore::NullTextureCore(const TEXTURE_DESC& desc, const SPtr<PixelData>& initialData,
+		GpuDeviceFlags deviceMask)
+		: TextureCore(desc, initialData, deviceMask)
+	{ }
+
+	NullTextureCore::~NullTextureCore()
+	{
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Texture);
+	}
+
+	void NullTextureCore::initialize()
+	{
+		UINT32 numSubresources = mProperties.getNumFaces() * (mProperties.getNumMipmaps() + 1);
+
+		mSurfaces.resize(numSubresources);
+		for (UINT32 i = 0; i < numSubresources; i++)
+			mSurfaces[i] = mProperties.allocateSubresourceBuffer(i);
+
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Texture);
+		TextureCore::initialize();
+	}
+
+	PixelData NullTextureCore::lockImpl(GpuLockOptions options, UINT32 mipLevel, UINT32 face)
+	{
+#if BS_PROFILING_ENABLED
+		if (options == GBL_READ_ONLY || options == GBL_READ_WRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_Texture);
+		}
+
+		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture);
+		}
+#endif
+
+		// Returned copy references the surface memory directly
+		return *getSurface(mipLevel, face);
+	}
+
+	void NullTextureCore::copyImpl(UINT32 srcFace, UINT32 srcMipLevel, UINT32 destFace, UINT32 destMipLevel,
+		const SPtr<TextureCore>& target)
+	{
+		NullTextureCore* other = static_cast<NullTextureCore*>(target.get());
+
+		PixelUtil::bulkPixelConversion(*getSurface(srcMipLevel, srcFace), *other->getSurface(destMipLevel, destFace));
+	}
+
+	void NullTextureCore::readData(PixelData& dest, UINT32 mipLevel, UINT32 face)
+	{
+		PixelUtil::bulkPixelConversion(*getSurface(mipLevel, face), dest);
+
+		BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_Texture);
+	}
+
+	void NullTextureCore::writeData(const PixelData& src, UINT32 mipLevel, UINT32 face, bool discardWholeBuffer)
+	{
+		PixelUtil::bulkPixelConversion(src, *getSurface(mipLevel, face));
+
+		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture);
+	}
+
+	const SPtr<PixelData>& NullTextureCore::getSurface(UINT32 mipLevel, UINT32 face) const
+	{
+		return mSurfaces[mProperties.mapToSubresourceIdx(face, mipLevel)];
+	}
+}
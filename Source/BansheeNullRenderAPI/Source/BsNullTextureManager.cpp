@@ -0,0 +1,41 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullTextureManager.h"
+#include "BsNullTexture.h"
+#include "BsNullRenderTexture.h"
+
+namespace BansheeEngine
+{
+	SPtr<RenderTexture> NullTextureManager::createRenderTextureImpl(const RENDER_TEXTURE_DESC& desc)
+	{
+		NullRenderTexture* tex = new (bs_alloc<NullRenderTexture>()) NullRenderTexture(desc);
+
+		return bs_core_ptr<NullRenderTexture>(tex);
+	}
+
+	PixelFormat NullTextureManager::getNativeFormat(TextureType ttype, PixelFormat format, int usage, bool hwGamma)
+	{
+		// Textures live in system memory, so any format can be stored as is
+		return format;
+	}
+
+	SPtr<TextureCore> NullTextureCoreManager::createTextureInternal(const TEXTURE_DESC& desc,
+		const SPtr<PixelData>& initialData, GpuDeviceFlags deviceMask)
+	{
+		NullTextureCore* tex = new (bs_alloc<NullTextureCore>()) NullTextureCore(desc, initialData, deviceMask);
+
+		SPtr<NullTextureCore> texPtr = bs_shared_ptr<NullTextureCore>(tex);
+		texPtr->_setThisPtr(texPtr);
+
+		return texPtr;
+	}
+
+	SPtr<RenderTextureCore> NullTextureCoreManager::createRenderTextureInternal(const RENDER_TEXTURE_DESC_CORE& desc,
+		GpuDeviceFlags deviceMask)
+	{
+		SPtr<NullRenderTextureCore> texPtr = bs_shared_ptr_new<NullRenderTextureCore>(desc, deviceMask);
+		texPtr->_setThisPtr(texPtr);
+
+		return texPtr;
+	}
+}
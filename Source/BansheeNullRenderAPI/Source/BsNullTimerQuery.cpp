@@ -0,0 +1,36 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullTimerQuery.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullTimerQuery::NullTimerQuery(UINT32 deviceIdx)
+	{
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Query);
+	}
+
+	NullTimerQuery::~NullTimerQuery()
+	{
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Query);
+	}
+
+	void NullTimerQuery::begin()
+	{
+		setActive(true);
+	}
+
+	void NullTimerQuery::end()
+	{
+	}
+
+	bool NullTimerQuery::isReady() const
+	{
+		return true;
+	}
+
+	float NullTimerQuery::getTimeMs()
+	{
+		return 0.0f;
+	}
+}
@@ -0,0 +1,69 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullVertexBuffer.h"
+#include "BsNullHardwareBuffer.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullVertexBufferCore::NullVertexBufferCore(const VERTEX_BUFFER_DESC& desc, GpuDeviceFlags deviceMask)
+		:VertexBufferCore(desc, deviceMask), mBuffer(nullptr)
+	{ }
+
+	NullVertexBufferCore::~NullVertexBufferCore()
+	{
+		if (mBuffer != nullptr)
+			bs_delete(mBuffer);
+
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_VertexBuffer);
+	}
+
+	void* NullVertexBufferCore::map(UINT32 offset, UINT32 length, GpuLockOptions options, UINT32 syncMask)
+	{
+#if BS_PROFILING_ENABLED
+		if (options == GBL_READ_ONLY || options == GBL_READ_WRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_VertexBuffer);
+		}
+
+		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer);
+		}
+#endif
+
+		return mBuffer->lock(offset, length, options, syncMask);
+	}
+
+	void NullVertexBufferCore::unmap()
+	{
+		mBuffer->unlock();
+	}
+
+	void NullVertexBufferCore::readData(UINT32 offset, UINT32 length, void* dest, UINT32 syncMask)
+	{
+		mBuffer->readData(offset, length, dest, syncMask);
+		BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_VertexBuffer);
+	}
+
+	void NullVertexBufferCore::writeData(UINT32 offset, UINT32 length, const void* source, BufferWriteType writeFlags,
+		UINT32 syncMask)
+	{
+		mBuffer->writeData(offset, length, source, writeFlags, syncMask);
+		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer);
+	}
+
+	void NullVertexBufferCore::copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset,
+		UINT32 dstOffset, UINT32 length, bool discardWholeBuffer, UINT32 syncMask)
+	{
+		mBuffer->copyData(srcBuffer, srcOffset, dstOffset, length, discardWholeBuffer, syncMask);
+	}
+
+	void NullVertexBufferCore::initialize()
+	{
+		mBuffer = bs_new<NullHardwareBuffer>(mUsage, mSizeInBytes);
+
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_VertexBuffer);
+		VertexBufferCore::initialize();
+	}
+}
@@ -25,6 +25,13 @@ namespace BansheeEngine
 		UINT64 windowId = 0;
 		primaryWindow->getCustomAttribute("WINDOW", &windowId);
 
+		// Headless windows (e.g. null render API) have no OS window to capture input from
+		if (windowId == 0)
+		{
+			LOGWRN("Primary window has no OS window handle. Raw input will not be available.");
+			return nullptr;
+		}
+
 		// TODO - Window handles in Windows are 64 bits when compiled as x64, but OIS only accepts a 32bit value. Is this okay?
 		SPtr<RawInputHandler> inputHandler = bs_shared_ptr_new<InputHandlerOIS>((UINT32)windowId);
 
@@ -4,6 +4,7 @@ set(BS_BANSHEEUTILITY_INC_THREADING
 	"Include/BsSpinLock.h"
 	"Include/BsThreadPool.h"
 	"Include/BsTaskScheduler.h"
+	"Include/BsMPSCQueue.h"
 )
 
 set(BS_BANSHEEUTILITY_SRC_THIRDPARTY
@@ -54,6 +55,8 @@ set(BS_BANSHEEUTILITY_SRC_GENERAL
 	"Source/BsMessageHandler.cpp"
 	"Source/BsTimer.cpp"
 	"Source/BsTime.cpp"
+	"Source/BsCompression.cpp"
+	"Source/BsRadixSort.cpp"
 	"Source/BsUtil.cpp"
 )
 
@@ -67,12 +70,16 @@ set(BS_BANSHEEUTILITY_INC_FILESYSTEM
 	"Include/BsFileSystem.h"
 	"Include/BsDataStream.h"
 	"Include/BsPath.h"
+	"Include/BsResourcePackage.h"
+	"Include/BsAsyncIO.h"
 )
 
 set(BS_BANSHEEUTILITY_SRC_FILESYSTEM
 	"Source/BsDataStream.cpp"
 	"Source/BsFileSystem.cpp"
 	"Source/BsPath.cpp"
+	"Source/BsResourcePackage.cpp"
+	"Source/BsAsyncIO.cpp"
 )
 
 set(BS_BANSHEEUTILITY_SRC_THREADING
@@ -96,6 +103,8 @@ set(BS_BANSHEEUTILITY_INC_GENERAL
 	"Include/BsTimer.h"
 	"Include/BsUtil.h"
 	"Include/BsFlags.h"
+	"Include/BsCompression.h"
+	"Include/BsRadixSort.h"
 )
 
 set(BS_BANSHEEUTILITY_SRC_ALLOCATORS
@@ -165,10 +174,20 @@ set(BS_BANSHEEUTILITY_SRC_MATH
 	"Source/BsLineSegment3.cpp"
 	"Source/BsCapsule.cpp"
 	"Source/BsLine2.cpp"
+	"Source/BsAABBTree.cpp"
 )
 
 set(BS_BANSHEEUTILITY_INC_TESTING
 	"Include/BsFileSystemTestSuite.h"
+	"Include/BsTaskSchedulerTestSuite.h"
+	"Include/BsMathTestSuite.h"
+	"Include/BsMPSCQueueTestSuite.h"
+	"Include/BsPoolAllocTestSuite.h"
+	"Include/BsFrameAllocTestSuite.h"
+	"Include/BsCompressionTestSuite.h"
+	"Include/BsSerializationTestSuite.h"
+	"Include/BsStringIDTestSuite.h"
+	"Include/BsRadixSortTestSuite.h"
 	"Include/BsTestSuite.h"
 	"Include/BsTestOutput.h"
 	"Include/BsConsoleTestOutput.h"
@@ -176,6 +195,15 @@ set(BS_BANSHEEUTILITY_INC_TESTING
 
 set(BS_BANSHEEUTILITY_SRC_TESTING
 	"Source/BsFileSystemTestSuite.cpp"
+	"Source/BsTaskSchedulerTestSuite.cpp"
+	"Source/BsMathTestSuite.cpp"
+	"Source/BsMPSCQueueTestSuite.cpp"
+	"Source/BsPoolAllocTestSuite.cpp"
+	"Source/BsFrameAllocTestSuite.cpp"
+	"Source/BsCompressionTestSuite.cpp"
+	"Source/BsSerializationTestSuite.cpp"
+	"Source/BsStringIDTestSuite.cpp"
+	"Source/BsRadixSortTestSuite.cpp"
 	"Source/BsTestSuite.cpp"
 	"Source/BsTestOutput.cpp"
 	"Source/BsConsoleTestOutput.cpp"
@@ -216,6 +244,8 @@ set(BS_BANSHEEUTILITY_INC_MATH
 	"Include/BsMatrixNxM.h"
 	"Include/BsVectorNI.h"
 	"Include/BsLine2.h"
+	"Include/BsSIMD.h"
+	"Include/BsAABBTree.h"
 )
 
 set(BS_BANSHEEUTILITY_SRC_ERROR
@@ -0,0 +1,241 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsAABox.h"
+#include "BsConvexVolume.h"
+#include "BsSphere.h"
+#include "BsRay.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Math
+	 *  @{
+	 */
+
+	/**
+	 * Dynamic bounding volume hierarchy of axis aligned boxes, allowing quick lookup of objects overlapping a certain
+	 * volume.
+	 *
+	 * Objects are stored using bounds enlarged by a margin, so moving objects only need to be re-inserted once they move
+	 * outside of their enlarged bounds. The tree is kept balanced using tree rotations, making it suitable for objects
+	 * that are added, removed and moved often.
+	 *
+	 * @note	Not thread safe, except for queries which may run concurrently as long as the tree isn't being modified.
+	 */
+	class BS_UTILITY_EXPORT AABBTree
+	{
+		/** Single node in the tree. Leaf nodes represent objects in the tree. */
+		struct Node
+		{
+			bool isLeaf() const { return children[0] == INVALID_ID; }
+
+			AABox bounds;
+			UINT32 parent; /**< Parent node for used nodes, or the next free node for unused nodes. */
+			UINT32 children[2];
+			INT32 height; /**< Zero for leaves, -1 for unused nodes. */
+			UINT32 userData;
+		};
+
+		/** Possible results when testing a node against a query volume. */
+		enum class Overlap
+		{
+			Outside, Intersects, Inside
+		};
+
+	public:
+		/**
+		 * Creates a new empty tree.
+		 *
+		 * @param[in]	margin	Distance to enlarge object bounds by, in each direction. Larger values mean objects need to
+		 *						be re-inserted less often as they move, at the cost of less precise queries.
+		 */
+		AABBTree(float margin = 0.1f);
+
+		/**
+		 * Inserts a new object into the tree.
+		 *
+		 * @param[in]	bounds		Bounds of the object.
+		 * @param[in]	userData	Data that will be reported by queries that find the object. Usually an index or an
+		 *							identifier of the object in some external structure.
+		 * @return					Identifier that can be used for updating or removing the object.
+		 */
+		UINT32 insert(const AABox& bounds, UINT32 userData);
+
+		/** Removes an object previously added with insert(). */
+		void remove(UINT32 id);
+
+		/**
+		 * Updates bounds of an object previously added with insert().
+		 *
+		 * @return	True if the object was re-inserted into the tree. False if the new bounds are still within the
+		 *			enlarged bounds the object is stored with, in which case the tree wasn't modified.
+		 */
+		bool update(UINT32 id, const AABox& bounds);
+
+		/** Returns the user data provided when the object was inserted. */
+		UINT32 getUserData(UINT32 id) const { return mNodes[id].userData; }
+
+		/** Changes the user data of an existing object. */
+		void setUserData(UINT32 id, UINT32 userData) { mNodes[id].userData = userData; }
+
+		/** Returns the enlarged bounds the object is stored with. */
+		const AABox& getFatBounds(UINT32 id) const { return mNodes[id].bounds; }
+
+		/** Returns the number of objects in the tree. */
+		UINT32 getNumObjects() const { return mNumObjects; }
+
+		/** Returns the height of the tree. Tree with a single object has a height of zero. */
+		UINT32 getHeight() const { return mRoot != INVALID_ID ? (UINT32)mNodes[mRoot].height : 0; }
+
+		/** Removes all objects from the tree. */
+		void clear();
+
+		/**
+		 * Finds all objects whose enlarged bounds overlap the provided box.
+		 *
+		 * @param[in]	box			Box to test against.
+		 * @param[in]	callback	Callable with a void(UINT32 userData) signature, called for every overlapping object.
+		 */
+		template<class T>
+		void query(const AABox& box, T callback) const
+		{
+			traverse(
+				[&box](const AABox& bounds) { return bounds.intersects(box) ? Overlap::Intersects : Overlap::Outside; },
+				[&callback](UINT32 userData, bool inside) { callback(userData); });
+		}
+
+		/**
+		 * Finds all objects whose enlarged bounds overlap the provided sphere.
+		 *
+		 * @param[in]	sphere		Sphere to test against.
+		 * @param[in]	callback	Callable with a void(UINT32 userData) signature, called for every overlapping object.
+		 */
+		template<class T>
+		void query(const Sphere& sphere, T callback) const
+		{
+			traverse(
+				[&sphere](const AABox& bounds) { return bounds.intersects(sphere) ? Overlap::Intersects : Overlap::Outside; },
+				[&callback](UINT32 userData, bool inside) { callback(userData); });
+		}
+
+		/**
+		 * Finds all objects whose enlarged bounds are hit by the provided ray.
+		 *
+		 * @param[in]	ray			Ray to test against.
+		 * @param[in]	callback	Callable with a void(UINT32 userData) signature, called for every intersecting object.
+		 */
+		template<class T>
+		void query(const Ray& ray, T callback) const
+		{
+			traverse(
+				[&ray](const AABox& bounds) { return bounds.intersects(ray).first ? Overlap::Intersects : Overlap::Outside; },
+				[&callback](UINT32 userData, bool inside) { callback(userData); });
+		}
+
+		/**
+		 * Finds all objects whose enlarged bounds overlap the provided convex volume (e.g. a camera frustum).
+		 *
+		 * @param[in]	volume		Volume to test against.
+		 * @param[in]	callback	Callable with a void(UINT32 userData, bool inside) signature, called for every overlapping
+		 *							object. @p inside will be true if the enlarged bounds of the object are fully within the
+		 *							volume, meaning the object doesn't need to be tested against the volume more precisely.
+		 */
+		template<class T>
+		void query(const ConvexVolume& volume, T callback) const
+		{
+			const Vector<Plane>& planes = volume.getPlanes();
+			const Plane* planesPtr = planes.data();
+			UINT32 numPlanes = (UINT32)planes.size();
+
+			traverse(
+				[planesPtr, numPlanes](const AABox& bounds) { return classify(planesPtr, numPlanes, bounds); },
+				callback);
+		}
+
+		static const UINT32 INVALID_ID = (UINT32)-1;
+
+	private:
+		/** Maximum depth the tree can be traversed to. Balanced trees stay well below it for any realistic object count. */
+		static const UINT32 MAX_STACK_SIZE = 256;
+
+		/**
+		 * Walks the tree and reports all leaves overlapping a volume.
+		 *
+		 * @param[in]	test		Callable with an Overlap(const AABox&) signature that tests node bounds against the
+		 *							volume. Not called for children of nodes reported as fully inside.
+		 * @param[in]	callback	Callable with a void(UINT32 userData, bool inside) signature called for each leaf
+		 *							overlapping the volume.
+		 */
+		template<class Test, class Callback>
+		void traverse(Test test, Callback callback) const
+		{
+			if (mRoot == INVALID_ID)
+				return;
+
+			struct StackEntry
+			{
+				UINT32 node;
+				bool inside;
+			};
+
+			StackEntry stack[MAX_STACK_SIZE];
+			UINT32 stackSize = 0;
+
+			stack[stackSize++] = { mRoot, false };
+			while (stackSize > 0)
+			{
+				StackEntry entry = stack[--stackSize];
+				const Node& node = mNodes[entry.node];
+
+				Overlap overlap = entry.inside ? Overlap::Inside : test(node.bounds);
+				if (overlap == Overlap::Outside)
+					continue;
+
+				bool inside = overlap == Overlap::Inside;
+				if (node.isLeaf())
+					callback(node.userData, inside);
+				else
+				{
+					assert(stackSize + 2 <= MAX_STACK_SIZE);
+
+					stack[stackSize++] = { node.children[0], inside };
+					stack[stackSize++] = { node.children[1], inside };
+				}
+			}
+		}
+
+		/** Tests the provided bounds against a set of planes, where the volume is on the positive side of each plane. */
+		static Overlap classify(const Plane* planes, UINT32 numPlanes, const AABox& bounds);
+
+		/** Returns a new node from the node pool. */
+		UINT32 allocateNode();
+
+		/** Returns a node to the node pool. */
+		void freeNode(UINT32 idx);
+
+		/** Inserts a previously allocated leaf into the hierarchy. */
+		void insertLeaf(UINT32 leaf);
+
+		/** Removes a leaf from the hierarchy, without freeing it. */
+		void removeLeaf(UINT32 leaf);
+
+		/**
+		 * Recalculates bounds and heights of all nodes from the provided node to the root, rebalancing the tree if
+		 * needed.
+		 */
+		void refit(UINT32 idx);
+
+		/** Performs a tree rotation if the subtree at the provided node is imbalanced. Returns the new subtree root. */
+		UINT32 balance(UINT32 idx);
+
+		Vector<Node> mNodes;
+		UINT32 mRoot;
+		UINT32 mFreeList;
+		UINT32 mNumObjects;
+		float mMargin;
+	};
+
+	/** @} */
+}
@@ -36,7 +36,7 @@ namespace BansheeEngine
 
 			virtual DataBase* clone() const override
 			{
-				return new Data(value);
+				return bs_new<Data>(value);
 			}
 
 			ValueType value;
@@ -0,0 +1,94 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsModule.h"
+#include "BsAsyncOp.h"
+#include "BsPath.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Filesystem
+	 *  @{
+	 */
+
+	/** Callback triggered when an asynchronous read completes. Receives null if the read failed. */
+	typedef std::function<void(const SPtr<MemoryDataStream>&)> AsyncReadCallback;
+
+	/**
+	 * Reads files on a set of dedicated I/O threads, allowing the caller to keep many reads in flight without blocking
+	 * on any of them. Number of I/O threads determines the maximum number of reads the disk is processing at once.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT AsyncIO : public Module<AsyncIO>
+	{
+	public:
+		/** 
+		 * @param[in]	numThreads	Number of I/O threads to start. If zero, the number is determined from the number of
+		 *							hardware threads, see getDefaultNumThreads().
+		 */
+		AsyncIO(UINT32 numThreads = 0);
+		~AsyncIO();
+
+		/**
+		 * Queues a read of a file, or a range of a file, on the I/O threads.
+		 *
+		 * @param[in]	path		Full path to the file to read.
+		 * @param[in]	offset		Offset at which to start reading, in bytes.
+		 * @param[in]	size		Number of bytes to read. Range is clamped to the end of the file, so READ_TO_END reads
+		 *							the rest of the file. Reads larger than MAX_READ_SIZE fail.
+		 * @param[in]	callback	Optional callback triggered when the read completes. Triggered on one of the I/O
+		 *							threads, before the returned operation is marked as completed, so it should be quick.
+		 * @return					Operation that completes once the read is done. Its return value is a
+		 *							SPtr<MemoryDataStream> containing the read data, or null if the file couldn't be read.
+		 *							You may use AsyncOp::blockUntilComplete() to wait on it.
+		 */
+		AsyncOp readFile(const Path& path, UINT64 offset = 0, UINT64 size = READ_TO_END,
+			const AsyncReadCallback& callback = nullptr);
+
+		/** Returns the number of I/O threads. */
+		UINT32 getNumThreads() const { return (UINT32)mThreads.size(); }
+
+		/** Size to provide to readFile() in order to read until the end of the file. */
+		static const UINT64 READ_TO_END = (UINT64)-1;
+
+		/** Maximum number of bytes a single read can return. */
+		static const UINT64 MAX_READ_SIZE = std::numeric_limits<UINT32>::max();
+
+		/** 
+		 * Returns the number of I/O threads to start if not specified otherwise. Matches the number of hardware threads,
+		 * clamped to [2, 8]. Reads from the OS file cache are memory copies that gain nothing from more threads than
+		 * there are cores, while at least two threads allow a read to be issued while another one is being copied.
+		 */
+		static UINT32 getDefaultNumThreads();
+
+	private:
+		/** Information about a queued read. */
+		struct ReadRequest
+		{
+			Path path;
+			UINT64 offset;
+			UINT64 size;
+			AsyncReadCallback callback;
+			AsyncOp op;
+		};
+
+		/** Main method of the I/O threads. Executes queued reads until the module is destroyed. */
+		void runWorker();
+
+		/** Reads a range of a file into memory. Returns null if the file cannot be read. */
+		static SPtr<MemoryDataStream> read(const Path& path, UINT64 offset, UINT64 size);
+
+		Vector<Thread> mThreads;
+		Queue<ReadRequest*> mRequests;
+		bool mShutdown;
+
+		Mutex mMutex;
+		Signal mRequestSignal;
+		SPtr<AsyncOpSyncData> mSyncData;
+	};
+
+	/** @} */
+}
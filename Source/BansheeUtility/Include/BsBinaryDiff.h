@@ -27,7 +27,8 @@ namespace BansheeEngine
 		 * different in the new object compared to the original will be output in the resulting object, with a full 
 		 * hierarchy of that field.
 		 *
-		 * Will return null if there is no difference.
+		 * Will return null if there is no difference. Objects (and child objects) with identical contents are detected 
+		 * through their hashes (see SerializedInstance::getHash()) and skipped without being compared.
 		 */
 		SPtr<SerializedObject> generateDiff(const SPtr<SerializedObject>& orgObj, const SPtr<SerializedObject>& newObj);
 
@@ -36,6 +36,9 @@ namespace BansheeEngine
 	 * 			
 	 * @note	
 	 * Child elements are guaranteed to be fully deserialized before their parents, except for fields marked with WeakRef flag.
+	 * @note
+	 * Objects whose types contain only plain and data block fields (see RTTITypeBase::_hasOnlyPlainFields) are decoded
+	 * directly from the source data by decode(), without building their intermediate representation.
 	 */
 	class BS_UTILITY_EXPORT BinarySerializer
 	{
@@ -99,7 +102,8 @@ namespace BansheeEngine
 		 * @param[in]	copyData	Determines should the data be copied or just referenced. If referenced then the returned
 		 *							serialized object will be invalid as soon as the original data buffer is destroyed.
 		 *							Referencing is faster than copying. If the source data stream is a file stream the data
-		 *							will always be copied.
+		 *							will always be copied. Mapped file streams are referenced the same as memory streams,
+		 *							including data blocks, whose RTTI setters may then alias the mapped data.
 		 *
 		 * @note
 		 * References to field data will point to the original buffer and will become invalid when it is destroyed.
@@ -140,6 +144,23 @@ namespace BansheeEngine
 			bool decodeInProgress; // Used for error reporting circular references
 		};
 
+		/** Location of the data of a single field, belonging to an object that is being decoded directly. */
+		struct DirectField
+		{
+			RTTIField* field;
+			UINT32 fieldIdx; /**< Index of the field in its RTTI type. Fields are applied in this order. */
+			UINT32 offset; /**< Offset of the data in the stream, or in mDirectData if the stream is a file. */
+			UINT32 size; /**< Size of the data in bytes. */
+			UINT32 numElements; /**< Number of array elements, or zero if the field isn't an array. */
+		};
+
+		/** Part of an object that is being decoded directly, belonging to a single class in its class hierarchy. */
+		struct DirectSubObject
+		{
+			RTTITypeBase* rtti;
+			UINT32 firstField; /**< Index of the first field of the sub-object in mDirectFields. */
+		};
+
 		/** Encodes a single IReflectable object. */
 		UINT8* encodeEntry(IReflectable* object, UINT32 objectId, UINT8* buffer, UINT32& bufferLength, UINT32* bytesWritten,
 			std::function<UINT8*(UINT8* buffer, UINT32 bytesWritten, UINT32& newBufferSize)> flushBufferCallback, bool shallow);
@@ -151,6 +172,19 @@ namespace BansheeEngine
 		bool decodeEntry(const SPtr<DataStream>& data, UINT32 dataLength, UINT32& bytesRead, SPtr<SerializedObject>& output, 
 			bool copyData, bool streamDataBlock);
 
+		/**
+		 * Decodes an object whose type contains only plain and data block fields directly into a new object instance, 
+		 * without decoding its fields into an intermediate representation. Called by decodeEntry() after it reads the
+		 * object meta data, and has the same return value. The new object is registered in mDirectObjects with 
+		 * @p output as its key.
+		 */
+		bool decodeDirect(const SPtr<DataStream>& data, UINT32 dataLength, UINT32& bytesRead, RTTITypeBase* rtti,
+			const SPtr<SerializedObject>& output);
+
+		/** Assigns field data read by decodeDirect() to the object. */
+		void applyDirectFields(IReflectable* object, UINT8* fieldData, const SPtr<DataStream>& data, UINT32 firstField,
+			UINT32 lastField);
+
 		/**	Helper method for encoding a complex object and copying its data to a buffer. */
 		UINT8* complexTypeToBuffer(IReflectable* object, UINT8* buffer, UINT32& bufferLength, UINT32* bytesWritten,
 			std::function<UINT8*(UINT8* buffer, UINT32 bytesWritten, UINT32& newBufferSize)> flushBufferCallback, bool shallow);
@@ -159,6 +193,13 @@ namespace BansheeEngine
 		UINT8* dataBlockToBuffer(UINT8* data, UINT32 size, UINT8* buffer, UINT32& bufferLength, UINT32* bytesWritten,
 			std::function<UINT8*(UINT8* buffer, UINT32 bytesWritten, UINT32& newBufferSize)> flushBufferCallback);
 
+		/** 
+		 * Helper method for encoding a data block to a buffer. Data is read from the stream directly into the buffer, one 
+		 * buffer at a time, so the block never needs to be fully loaded in memory.
+		 */
+		UINT8* dataBlockToBuffer(const SPtr<DataStream>& data, UINT32 size, UINT8* buffer, UINT32& bufferLength, 
+			UINT32* bytesWritten, std::function<UINT8*(UINT8* buffer, UINT32 bytesWritten, UINT32& newBufferSize)> flushBufferCallback);
+
 		/**	Finds an existing, or creates a unique unique identifier for the specified object. */
 		UINT32 findOrCreatePersistentId(IReflectable* object);
 
@@ -201,6 +242,12 @@ namespace BansheeEngine
 		UnorderedMap<SPtr<SerializedObject>, ObjectToDecode> mObjectMap;
 		UnorderedMap<UINT32, SPtr<SerializedObject>> mInterimObjectMap;
 
+		bool mDecodeDirect;
+		UnorderedMap<SPtr<SerializedObject>, SPtr<IReflectable>> mDirectObjects;
+		Vector<DirectField> mDirectFields;
+		Vector<DirectSubObject> mDirectSubObjects;
+		Vector<UINT8> mDirectData;
+
 		UnorderedMap<String, UINT64> mParams;
 
 		static const int META_SIZE = 4; // Meta field size
@@ -0,0 +1,88 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup General
+	 *  @{
+	 */
+
+	/** Algorithms that can be used for compressing data. */
+	enum class CompressionType
+	{
+		None = 0, /**< Data is stored uncompressed. */
+		/**
+		 * Fast LZ77 compression using the LZ4 block format. Compresses less than general purpose algorithms, but
+		 * decompresses at several gigabytes per second, well above disk bandwidth.
+		 */
+		LZ4 = 1
+	};
+
+	/** Provides methods for compressing and decompressing blocks of data. */
+	class BS_UTILITY_EXPORT Compression
+	{
+	public:
+		/** Returns the maximum size of @p size bytes of data after being compressed by compressLZ4(). */
+		static UINT32 getLZ4Bound(UINT32 size) { return size + size / 255 + 16; }
+
+		/**
+		 * Compresses data into the LZ4 block format.
+		 *
+		 * @param[in]	input			Data to compress.
+		 * @param[in]	inputSize		Size of @p input, in bytes.
+		 * @param[out]	output			Buffer to write the compressed data to.
+		 * @param[in]	outputCapacity	Size of @p output, in bytes. Compression never fails if this is at least
+		 *								getLZ4Bound(@p inputSize).
+		 * @return						Size of the compressed data, or zero if it doesn't fit in the output buffer.
+		 */
+		static UINT32 compressLZ4(const UINT8* input, UINT32 inputSize, UINT8* output, UINT32 outputCapacity);
+
+		/**
+		 * Decompresses data in the LZ4 block format. Input is validated, so it is safe to call on corrupt data.
+		 *
+		 * @param[in]	input			Compressed data.
+		 * @param[in]	inputSize		Size of @p input, in bytes.
+		 * @param[out]	output			Buffer to write the decompressed data to.
+		 * @param[in]	outputSize		Size of the data before compression, in bytes.
+		 * @return						True if the data was decompressed, false if it is corrupt or if its decompressed
+		 *								size doesn't match @p outputSize.
+		 */
+		static bool decompressLZ4(const UINT8* input, UINT32 inputSize, UINT8* output, UINT32 outputSize);
+
+		/**
+		 * Compresses a block of data. Data is split into chunks that are compressed independently, so they can be
+		 * decompressed in parallel. Chunks that don't benefit from compression are stored as is.
+		 *
+		 * @param[in]	data		Data to compress.
+		 * @param[in]	size		Size of @p data, in bytes.
+		 * @param[in]	type		Algorithm to compress the chunks with.
+		 * @param[in]	chunkSize	Size of the independently compressed chunks, in bytes.
+		 * @return					Compressed block, along with the information required for decompressing it.
+		 */
+		static SPtr<MemoryDataStream> compressBlock(const UINT8* data, UINT32 size, CompressionType type,
+			UINT32 chunkSize = DEFAULT_CHUNK_SIZE);
+
+		/** Returns the size of the data in a block created by compressBlock(), or zero if the block is invalid. */
+		static UINT32 getUncompressedSize(const UINT8* block, UINT32 blockSize);
+
+		/**
+		 * Decompresses a block created by compressBlock(). Chunks are decompressed directly into the output buffer, on
+		 * all task scheduler worker threads if the scheduler is running.
+		 *
+		 * @param[in]	block		Compressed block.
+		 * @param[in]	blockSize	Size of @p block, in bytes.
+		 * @param[out]	output		Buffer to write the decompressed data to.
+		 * @param[in]	outputSize	Size of @p output, in bytes. Must match the value returned by getUncompressedSize().
+		 * @return					True if the block was decompressed, false if it is corrupt.
+		 */
+		static bool decompressBlock(const UINT8* block, UINT32 blockSize, UINT8* output, UINT32 outputSize);
+
+		/** Default size of the independently compressed chunks of a block, in bytes. */
+		static const UINT32 DEFAULT_CHUNK_SIZE = 256 * 1024;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,21 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsTestSuite.h"
+
+namespace BansheeEngine
+{
+	class CompressionTestSuite : public TestSuite
+	{
+	public:
+		CompressionTestSuite();
+
+	private:
+		void testLZ4();
+		void testLZ4_corrupt();
+		void testBlock();
+		void testBlock_corrupt();
+		void testBlock_benchmark();
+	};
+}
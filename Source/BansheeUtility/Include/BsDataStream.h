@@ -50,6 +50,15 @@ namespace BansheeEngine
 		virtual bool isWriteable() const { return (mAccess & WRITE) != 0; }
 		virtual bool isFile() const = 0;
 
+		/**
+		 * Checks if the stream is a MappedFileDataStream, whose data stays at a fixed location in memory for as long as the
+		 * mapping is referenced.
+		 */
+		virtual bool isMapped() const { return false; }
+
+		/** Checks if the stream is a MemoryDataStream, whose data can be accessed directly in memory. */
+		virtual bool isMemory() const { return false; }
+
         /** Reads data from the buffer and copies it to the specified value. */
         template<typename T> DataStream& operator>>(T& val);
 
@@ -183,6 +192,9 @@ namespace BansheeEngine
 
 		bool isFile() const override { return false; }
 
+		/** @copydoc DataStream::isMemory */
+		bool isMemory() const override { return true; }
+
 		/** Get a pointer to the start of the memory block this stream holds. */
 		UINT8* getPtr() const { return mData; }
 		
@@ -274,6 +286,61 @@ namespace BansheeEngine
 		bool mFreeOnClose;	
 	};
 
+	/**
+	 * Data stream for reading a file mapped into memory. File contents are accessed directly through the mapped region,
+	 * which the OS populates on demand, avoiding the intermediate copies made by FileDataStream. Pointers returned by
+	 * getPtr() and getCurrentPtr() remain valid for as long as this stream, or any stream cloned from it without copying
+	 * its data, keeps the mapping referenced.
+	 *
+	 * @note	
+	 * File is mapped copy-on-write. Writing to the stream is allowed, but the changes are never written to the file.
+	 * @note
+	 * Contents of the mapped region are undefined if the file is modified while it is mapped, and truncating the file can
+	 * crash the process when the region is accessed.
+	 */
+	class BS_UTILITY_EXPORT MappedFileDataStream : public MemoryDataStream
+	{
+	public:
+		/**
+		 * Wraps a region of a file mapped into memory. Normally you want to use FileSystem::openFileMapped() instead of
+		 * creating the stream directly.
+		 *
+		 * @param[in]	filePath	Path of the mapped file.
+		 * @param[in]	mapping		Start of the mapped region. The pointer's deleter is expected to unmap the region, which
+		 *							happens once all streams referencing it are closed. Can be null if @p size is zero.
+		 * @param[in]	size		Size of the mapped region, in bytes.
+		 */
+		MappedFileDataStream(const Path& filePath, const SPtr<UINT8>& mapping, size_t size);
+
+		~MappedFileDataStream();
+
+		/** @copydoc DataStream::isMapped */
+		bool isMapped() const override { return true; }
+
+		/**
+		 * @copydoc DataStream::clone
+		 *
+		 * @note	If @p copyData is false the returned stream shares the mapping, keeping it alive.
+		 */
+		SPtr<DataStream> clone(bool copyData = true) const override;
+
+		/** @copydoc DataStream::close */
+		void close() override;
+
+		/** Returns the path of the mapped file. */
+		const Path& getPath() const { return mPath; }
+
+		/** 
+		 * Returns the mapped region. Can be used for creating streams over parts of the region (using the aliasing
+		 * constructor of the shared pointer), which keep the mapping alive.
+		 */
+		const SPtr<UINT8>& getMapping() const { return mMapping; }
+
+	protected:
+		Path mPath;
+		SPtr<UINT8> mMapping;
+	};
+
 	/** @} */
 }
 
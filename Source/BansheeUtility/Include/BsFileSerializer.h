@@ -13,11 +13,22 @@ namespace BansheeEngine
 	// TODO - Low priority. Eventually I'll want to generalize BinarySerializer to Serializer class, then I can make this class accept
 	// a generic Serializer interface so it may write both binary, plain-text or some other form of data.
 
-	/** Encodes the provided object to the specified file using the RTTI system. */
+	/** 
+	 * Encodes the provided object to the specified file or stream using the RTTI system. Data is written in small chunks
+	 * as it is being encoded (including the contents of data blocks), so memory use doesn't depend on the size of the
+	 * encoded object.
+	 */
 	class BS_UTILITY_EXPORT FileEncoder
 	{
 	public:
+		/** Creates (or overwrites) the file at the provided location and prepares it for encoding. */
 		FileEncoder(const Path& fileLocation);
+
+		/**
+		 * Encodes objects into the provided stream, starting at its current position. The stream must be writeable and
+		 * seekable, as the size of each object is written in front of its data once it is known.
+		 */
+		FileEncoder(const SPtr<DataStream>& stream);
 		~FileEncoder();
 
 		/**
@@ -34,7 +45,7 @@ namespace BansheeEngine
 		/** Called by the binary serializer whenever the buffer gets full. */
 		UINT8* flushBuffer(UINT8* bufferStart, UINT32 bytesWritten, UINT32& newBufferSize);
 
-		std::ofstream mOutputStream;
+		SPtr<DataStream> mOutputStream;
 		UINT8* mWriteBuffer;
 
 		static const UINT32 WRITE_BUFFER_SIZE = 2048;
@@ -44,7 +55,23 @@ namespace BansheeEngine
 	class BS_UTILITY_EXPORT FileDecoder
 	{
 	public:
-		FileDecoder(const Path& fileLocation);
+		/**
+		 * Opens the file at the provided location for decoding.
+		 *
+		 * @param[in]	fileLocation	Path to the file to decode.
+		 * @param[in]	mapFile			If true the file will be mapped into memory instead of being read through a
+		 *								buffered stream. Decoded objects may then reference the mapped data directly, instead
+		 *								of copying it (e.g. large data blocks whose RTTI setters check
+		 *								DataStream::isMapped()). Such objects keep the mapping alive, and the file must not
+		 *								be modified while they are referencing it.
+		 */
+		FileDecoder(const Path& fileLocation, bool mapFile = false);
+
+		/**	
+		 * Decodes objects from a stream containing data in the same format as written by FileEncoder. Decoding starts at
+		 * the current position in the stream.
+		 */
+		FileDecoder(const SPtr<DataStream>& stream);
 
 		/**	
 		 * Deserializes an IReflectable object by reading the binary data at the provided file location. 
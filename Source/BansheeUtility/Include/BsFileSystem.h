@@ -22,6 +22,14 @@ namespace BansheeEngine
 		 */
 		static SPtr<DataStream> openFile(const Path& fullPath, bool readOnly = true);
 
+		/**
+		 * Maps a file into memory and returns a data stream referencing the mapped region. Changes made through the stream
+		 * are never written to the file. Returns null if the file cannot be opened or mapped.
+		 *
+		 * @param[in]	fullPath	Full path to a file.
+		 */
+		static SPtr<MappedFileDataStream> openFileMapped(const Path& fullPath);
+
 		/**
 		 * Opens a file and returns a data stream capable of reading and writing to that file. If file doesn't exist new
 		 * one will be created.
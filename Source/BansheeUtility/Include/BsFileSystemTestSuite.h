@@ -35,6 +35,14 @@ namespace BansheeEngine
 		void testGetChildren();
 		void testGetLastModifiedTime();
 		void testGetTempDirectoryPath();
+		void testOpenFileMapped();
+		void testOpenFileMapped_empty();
+		void testResourcePackage();
+		void testResourcePackage_invalid();
+		void testResourcePackage_compressed();
+		void testResourcePackage_benchmark();
+		void testAsyncIO();
+		void testAsyncIO_queueDepth();
 
 		Path mTestDirectory;
 	};
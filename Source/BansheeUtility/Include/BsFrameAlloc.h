@@ -148,8 +148,142 @@ namespace BansheeEngine
 		void deallocBlock(MemBlock* block);
 	};
 
-	/** Allocator for the standard library that internally uses a frame allocator. */
-	template <class T>
+	/**
+	 * Frame allocator that can be used by multiple threads at once. Allocations are made by atomically bumping a pointer
+	 * within the current memory block, and only take a lock when a new block needs to be allocated. Like FrameAlloc, it
+	 * can only free all of its memory at once.
+	 *
+	 * @note
+	 * alloc() and dealloc() are thread safe. clear() is not, and must only be called once all threads have stopped 
+	 * allocating and no longer use the allocated memory (e.g. at a frame boundary).
+	 */
+	class BS_UTILITY_EXPORT ConcurrentFrameAlloc
+	{
+	private:
+		/** A single block of memory within a concurrent frame allocator. */
+		struct MemBlock
+		{
+			UINT8* mData;
+			UINT32 mSize;
+			std::atomic<UINT32> mFreePtr;
+		};
+
+	public:
+		ConcurrentFrameAlloc(UINT32 blockSize = 1024 * 1024);
+		~ConcurrentFrameAlloc();
+
+		/**
+		 * Allocates a new block of memory of the specified size. Returned memory is aligned to a 16 byte boundary.
+		 *
+		 * @param[in]	amount	Amount of memory to allocate, in bytes.
+		 *
+		 * @note	Thread safe.
+		 */
+		UINT8* alloc(UINT32 amount);
+
+		/**
+		 * Allocates a new block of memory of the specified size aligned to the specified boundary. 
+		 *
+		 * @param[in]	amount		Amount of memory to allocate, in bytes.
+		 * @param[in]	alignment	Alignment of the allocated memory. Must be power of two.
+		 *
+		 * @note	Thread safe.
+		 */
+		UINT8* allocAligned(UINT32 amount, UINT32 alignment);
+
+		/**
+		 * Allocates and constructs a new object.
+		 *	
+		 * @note	Thread safe.
+		 */
+		template<class T, class... Args>
+		T* alloc(Args &&...args)
+		{
+			return new ((T*)alloc(sizeof(T))) T(std::forward<Args>(args)...);
+		}
+
+		/**
+		 * Deallocates a previously allocated block of memory. No deallocation is actually done here, memory is only
+		 * released by clear(). 
+		 * 
+		 * @note	Thread safe.
+		 */
+		void dealloc(UINT8* data) { }
+
+		/** 
+		 * Destructs a previously allocated object. Memory is only released by clear(). 
+		 * 
+		 * @note	Thread safe.
+		 */
+		template<class T>
+		void dealloc(T* obj)
+		{
+			if (obj != nullptr)
+				obj->~T();
+		}
+
+		/**
+		 * Deallocates all allocated memory. 
+		 * 
+		 * @note	Not thread safe. No other thread may be allocating while this is called.
+		 */
+		void clear();
+
+	private:
+		/** Allocates a new block with at least @p wantedSize bytes and makes it the current block. */
+		void allocBlock(UINT32 wantedSize);
+
+		/** Frees a memory block. */
+		void deallocBlock(MemBlock* block);
+
+		UINT32 mBlockSize;
+		std::atomic<MemBlock*> mCurrentBlock;
+		Vector<MemBlock*> mBlocks;
+		Mutex mMutex;
+	};
+
+	/**
+	 * Set of frame allocators, one for each thread that uses it. Allows multiple threads (e.g. task scheduler workers) to
+	 * allocate scratch memory without synchronization, while allowing all of the allocators to be reset together at the
+	 * end of the frame. Memory allocated on one thread may be read and released on any other thread, as long as that
+	 * happens before the allocators are cleared.
+	 */
+	class BS_UTILITY_EXPORT WorkerFrameAlloc
+	{
+	public:
+		WorkerFrameAlloc(UINT32 blockSize = 1024 * 1024);
+		~WorkerFrameAlloc();
+
+		/**
+		 * Returns the frame allocator belonging to the calling thread, creating it if this is the first time the thread
+		 * requested it. 
+		 *
+		 * @note	Thread safe. Returned allocator must only be used for allocation on the calling thread.
+		 */
+		FrameAlloc& get();
+
+		/**
+		 * Deallocates all memory allocated by all of the threads.
+		 *
+		 * @note	Not thread safe. No other thread may be allocating while this is called.
+		 */
+		void clear();
+
+		/** Returns the number of threads that have requested an allocator. */
+		UINT32 getNumAllocators() const;
+
+	private:
+		UINT64 mId;
+		UINT32 mBlockSize;
+		UnorderedMap<ThreadId, FrameAlloc*> mAllocators;
+		mutable Mutex mMutex;
+	};
+
+	/** 
+	 * Allocator for the standard library that internally uses a frame allocator. @p Alloc can be FrameAlloc or
+	 * ConcurrentFrameAlloc.
+	 */
+	template <class T, class Alloc = FrameAlloc>
 	class StdFrameAlloc
 	{
 	public:
@@ -165,17 +299,17 @@ namespace BansheeEngine
 			:mFrameAlloc(nullptr)
 		{ }
 
-		StdFrameAlloc(FrameAlloc* alloc) noexcept
+		StdFrameAlloc(Alloc* alloc) noexcept
 			:mFrameAlloc(alloc)
 		{ }
 
-		template<class U> StdFrameAlloc(const StdFrameAlloc<U>& alloc) noexcept
+		template<class U> StdFrameAlloc(const StdFrameAlloc<U, Alloc>& alloc) noexcept
 			:mFrameAlloc(alloc.mFrameAlloc)
 		{ }
 
-		template<class U> bool operator==(const StdFrameAlloc<U>&) const noexcept { return true; }
-		template<class U> bool operator!=(const StdFrameAlloc<U>&) const noexcept { return false; }
-		template<class U> class rebind { public: typedef StdFrameAlloc<U> other; };
+		template<class U> bool operator==(const StdFrameAlloc<U, Alloc>&) const noexcept { return true; }
+		template<class U> bool operator!=(const StdFrameAlloc<U, Alloc>&) const noexcept { return false; }
+		template<class U> class rebind { public: typedef StdFrameAlloc<U, Alloc> other; };
 
 		/** Allocate but don't initialize number elements of type T.*/
 		T* allocate(const size_t num) const
@@ -199,7 +333,7 @@ namespace BansheeEngine
 			mFrameAlloc->dealloc((UINT8*)p);
 		}
 
-		FrameAlloc* mFrameAlloc;
+		Alloc* mFrameAlloc;
 
 		size_t max_size() const { return std::numeric_limits<size_type>::max() / sizeof(T); }
 		void construct(pointer p, const_reference t) { new (p) T(t); }
@@ -210,19 +344,30 @@ namespace BansheeEngine
 	};
 
 	/** Return that all specializations of this allocator are interchangeable. */
-	template <class T1, class T2>
-	bool operator== (const StdFrameAlloc<T1>&,
-		const StdFrameAlloc<T2>&) throw() {
+	template <class T1, class T2, class Alloc>
+	bool operator== (const StdFrameAlloc<T1, Alloc>&,
+		const StdFrameAlloc<T2, Alloc>&) throw() {
 		return true;
 	}
 
 	/** Return that all specializations of this allocator are interchangeable. */
-	template <class T1, class T2>
-	bool operator!= (const StdFrameAlloc<T1>&,
-		const StdFrameAlloc<T2>&) throw() {
+	template <class T1, class T2, class Alloc>
+	bool operator!= (const StdFrameAlloc<T1, Alloc>&,
+		const StdFrameAlloc<T2, Alloc>&) throw() {
 		return false;
 	}
 
+	/** 
+	 * Vector that allocates its elements using the provided frame allocator. Can be filled on a worker thread using its
+	 * own allocator, and then read and destroyed on another thread before the allocator is cleared.
+	 */
+	template <typename T, typename Alloc = FrameAlloc>
+	using StdFrameVector = std::vector<T, StdFrameAlloc<T, Alloc>>;
+
+	/** UnorderedMap that allocates its elements using the provided frame allocator. See StdFrameVector. */
+	template <typename K, typename V, typename Alloc = FrameAlloc, typename H = std::hash<K>, typename C = std::equal_to<K>>
+	using StdFrameUnorderedMap = std::unordered_map<K, V, H, C, StdFrameAlloc<std::pair<const K, V>, Alloc>>;
+
 	/** @} */
 	/** @} */
 }
@@ -0,0 +1,18 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsTestSuite.h"
+
+namespace BansheeEngine
+{
+	class FrameAllocTestSuite : public TestSuite
+	{
+	public:
+		FrameAllocTestSuite();
+
+	private:
+		void testConcurrentFrameAlloc();
+		void testWorkerFrameAlloc();
+	};
+}
@@ -68,6 +68,10 @@ namespace BansheeEngine
 	class DataStream;
 	class MemoryDataStream;
 	class FileDataStream;
+	class MappedFileDataStream;
+	class FileDecoder;
+	class ResourcePackage;
+	class ResourcePackageBuilder;
 	class MeshData;
 	class FileSystem;
 	class Timer;
@@ -86,6 +90,7 @@ namespace BansheeEngine
 	struct RTTIReflectablePtrFieldBase;
 	struct SerializedObject;
 	struct SerializedInstance;
+	class IDiff;
 	class FrameAlloc;
 	class LogEntry;
 	// Reflection
@@ -119,6 +124,10 @@ namespace BansheeEngine
 		TID_UnorderedSet = 66,
 		TID_SerializedDataBlock = 67,
 		TID_Flags = 68,
-		TID_IReflectable = 69
+		TID_IReflectable = 69,
+		TID_SerializationTestBase = 70,
+		TID_SerializationTestPlain = 71,
+		TID_SerializationTestComplex = 72,
+		TID_SerializationTestBlob = 73
 	};
 }
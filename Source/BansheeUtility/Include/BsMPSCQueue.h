@@ -0,0 +1,153 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include <atomic>
+
+namespace BansheeEngine
+{
+	/** @addtogroup Threading
+	 *  @{
+	 */
+
+	/**
+	 * Bounded lock-free queue that allows multiple threads to add elements, while a single thread removes them. Elements
+	 * are constructed directly in the queue storage, so adding or removing elements never allocates memory.
+	 *
+	 * @note
+	 * Thread safe for any number of producer threads calling tryEmplace() and a single consumer thread calling
+	 * tryConsume(). Elements added from a single thread are always consumed in the order they were added.
+	 */
+	template<class T>
+	class MPSCQueue
+	{
+		/** Single element slot in the ring buffer. */
+		struct Cell
+		{
+			/**
+			 * Position of the element in the queue. Tells the producers when the cell is free to be written to, and the
+			 * consumer when the cell contains a fully constructed element.
+			 */
+			std::atomic<UINT64> sequence;
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+		};
+
+	public:
+		/**
+		 * Creates a new queue.
+		 *
+		 * @param[in]	capacity	Maximum number of elements in the queue. Rounded up to a power of two.
+		 */
+		MPSCQueue(UINT32 capacity)
+			:mEnqueuePos(0), mDequeuePos(0)
+		{
+			mCapacity = 1;
+			while (mCapacity < capacity)
+				mCapacity <<= 1;
+
+			mCells = bs_newN<Cell>(mCapacity);
+			for (UINT32 i = 0; i < mCapacity; i++)
+				mCells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		~MPSCQueue()
+		{
+			while (tryConsume([](T& value) { }))
+			{ }
+
+			bs_deleteN(mCells, mCapacity);
+		}
+
+		MPSCQueue(const MPSCQueue&) = delete;
+		MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+		/**
+		 * Attempts to add a new element to the end of the queue, constructing it from the provided arguments.
+		 *
+		 * @return	True if the element was added, or false if the queue is full. Arguments are left untouched if the
+		 *			element wasn't added, so it is safe to retry.
+		 */
+		template<class ...Args>
+		bool tryEmplace(Args&&... args)
+		{
+			Cell* cell;
+			UINT64 pos = mEnqueuePos.load(std::memory_order_relaxed);
+			while(true)
+			{
+				cell = &mCells[pos & (mCapacity - 1)];
+				UINT64 sequence = cell->sequence.load(std::memory_order_acquire);
+
+				INT64 diff = (INT64)sequence - (INT64)pos;
+				if (diff == 0)
+				{
+					// Cell is free, try to claim it (on failure pos is updated with the latest value)
+					if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (diff < 0) // Cell still holds an element from the previous lap, meaning the queue is full
+					return false;
+				else // Another producer claimed the cell
+					pos = mEnqueuePos.load(std::memory_order_relaxed);
+			}
+
+			new (&cell->storage) T(std::forward<Args>(args)...);
+			cell->sequence.store(pos + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		/**
+		 * Removes the element at the front of the queue, if any. Must only be called from a single thread at a time.
+		 *
+		 * @param[in]	consumer	Callable with a void(T&) signature that receives the element before it is removed
+		 *							from the queue. The element is destroyed once the callable returns.
+		 * @return					True if an element was removed, false if the queue is empty.
+		 */
+		template<class Consumer>
+		bool tryConsume(Consumer consumer)
+		{
+			Cell* cell = &mCells[mDequeuePos & (mCapacity - 1)];
+			UINT64 sequence = cell->sequence.load(std::memory_order_acquire);
+
+			// Cell not yet written to (or the write is still in progress)
+			if (sequence != mDequeuePos + 1)
+				return false;
+
+			T* value = reinterpret_cast<T*>(&cell->storage);
+			consumer(*value);
+			value->~T();
+
+			// Release the cell for use by the producers in the next lap
+			cell->sequence.store(mDequeuePos + mCapacity, std::memory_order_release);
+			mDequeuePos++;
+
+			return true;
+		}
+
+		/**
+		 * Checks if the queue contains no elements. Only reliable when called from the consumer thread, and even then
+		 * elements may get added immediately after the call returns.
+		 */
+		bool isEmpty() const
+		{
+			const Cell& cell = mCells[mDequeuePos & (mCapacity - 1)];
+			return cell.sequence.load(std::memory_order_acquire) != mDequeuePos + 1;
+		}
+
+		/** Returns the maximum number of elements the queue can hold. */
+		UINT32 getCapacity() const { return mCapacity; }
+
+	private:
+		Cell* mCells;
+		UINT32 mCapacity;
+
+		// Producer and consumer positions on separate cache lines, to avoid false sharing
+		char mPad0[64];
+		std::atomic<UINT64> mEnqueuePos;
+		char mPad1[64];
+		UINT64 mDequeuePos;
+	};
+
+	/** @} */
+}
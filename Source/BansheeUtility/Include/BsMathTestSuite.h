@@ -0,0 +1,24 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsTestSuite.h"
+
+namespace BansheeEngine
+{
+	class MathTestSuite : public TestSuite
+	{
+	public:
+		MathTestSuite();
+
+	private:
+		void testMatrixMultiply();
+		void testMatrixInverse();
+		void testMatrixBatchTransform();
+		void testQuaternionMultiply();
+		void testQuaternionSlerp();
+		void testMath_benchmark();
+		void testAABBTree();
+		void testAABBTree_benchmark();
+	};
+}
@@ -8,6 +8,7 @@
 #include "BsMatrix3.h"
 #include "BsVector4.h"
 #include "BsPlane.h"
+#include "BsSIMD.h"
 
 namespace BansheeEngine
 {
@@ -115,6 +116,18 @@ namespace BansheeEngine
         {
 			Matrix4 r;
 
+#if BS_SIMD != BS_SIMD_NONE
+			__m128 r0 = _mm_loadu_ps(rhs.m[0]);
+			__m128 r1 = _mm_loadu_ps(rhs.m[1]);
+			__m128 r2 = _mm_loadu_ps(rhs.m[2]);
+			__m128 r3 = _mm_loadu_ps(rhs.m[3]);
+
+			_mm_storeu_ps(r.m[0], simdMulRow(_mm_loadu_ps(m[0]), r0, r1, r2, r3));
+			_mm_storeu_ps(r.m[1], simdMulRow(_mm_loadu_ps(m[1]), r0, r1, r2, r3));
+			_mm_storeu_ps(r.m[2], simdMulRow(_mm_loadu_ps(m[2]), r0, r1, r2, r3));
+			_mm_storeu_ps(r.m[3], simdMulRow(_mm_loadu_ps(m[3]), r0, r1, r2, r3));
+#else
+
 			r.m[0][0] = m[0][0] * rhs.m[0][0] + m[0][1] * rhs.m[1][0] + m[0][2] * rhs.m[2][0] + m[0][3] * rhs.m[3][0];
 			r.m[0][1] = m[0][0] * rhs.m[0][1] + m[0][1] * rhs.m[1][1] + m[0][2] * rhs.m[2][1] + m[0][3] * rhs.m[3][1];
 			r.m[0][2] = m[0][0] * rhs.m[0][2] + m[0][1] * rhs.m[1][2] + m[0][2] * rhs.m[2][2] + m[0][3] * rhs.m[3][2];
@@ -134,6 +147,7 @@ namespace BansheeEngine
 			r.m[3][1] = m[3][0] * rhs.m[0][1] + m[3][1] * rhs.m[1][1] + m[3][2] * rhs.m[2][1] + m[3][3] * rhs.m[3][1];
 			r.m[3][2] = m[3][0] * rhs.m[0][2] + m[3][1] * rhs.m[1][2] + m[3][2] * rhs.m[2][2] + m[3][3] * rhs.m[3][2];
 			r.m[3][3] = m[3][0] * rhs.m[0][3] + m[3][1] * rhs.m[1][3] + m[3][2] * rhs.m[2][3] + m[3][3] * rhs.m[3][3];
+#endif
 
 			return r;
         }
@@ -323,6 +337,21 @@ namespace BansheeEngine
         {
             BS_ASSERT(isAffine() && other.isAffine());
 
+#if BS_SIMD != BS_SIMD_NONE
+			// Last row of the right-hand matrix is (0, 0, 0, 1), so a full row multiply also adds in the translation
+			__m128 r0 = _mm_loadu_ps(other.m[0]);
+			__m128 r1 = _mm_loadu_ps(other.m[1]);
+			__m128 r2 = _mm_loadu_ps(other.m[2]);
+			__m128 r3 = _mm_loadu_ps(other.m[3]);
+
+			Matrix4 r;
+			_mm_storeu_ps(r.m[0], simdMulRow(_mm_loadu_ps(m[0]), r0, r1, r2, r3));
+			_mm_storeu_ps(r.m[1], simdMulRow(_mm_loadu_ps(m[1]), r0, r1, r2, r3));
+			_mm_storeu_ps(r.m[2], simdMulRow(_mm_loadu_ps(m[2]), r0, r1, r2, r3));
+			_mm_storeu_ps(r.m[3], r3);
+
+			return r;
+#else
             return Matrix4(
                 m[0][0] * other.m[0][0] + m[0][1] * other.m[1][0] + m[0][2] * other.m[2][0],
                 m[0][0] * other.m[0][1] + m[0][1] * other.m[1][1] + m[0][2] * other.m[2][1],
@@ -340,6 +369,7 @@ namespace BansheeEngine
                 m[2][0] * other.m[0][3] + m[2][1] * other.m[1][3] + m[2][2] * other.m[2][3] + m[2][3],
 
                 0, 0, 0, 1);
+#endif
         }
 
         /**
@@ -398,6 +428,30 @@ namespace BansheeEngine
                     m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z);
         }
 
+		/**
+		 * Transforms an array of 3D points by this matrix. Equivalent to calling multiplyAffine(const Vector3&) for each
+		 * point, but faster for larger arrays.
+		 *
+		 * @param[in]	input	Array of points to transform.
+		 * @param[out]	output	Array the transformed points will be written to. Must be able to hold @p count elements.
+		 *						Can be the same as @p input.
+		 * @param[in]	count	Number of points to transform.
+		 *
+		 * @note	Matrix must be affine.
+		 */
+		void multiplyAffine(const Vector3* input, Vector3* output, UINT32 count) const;
+
+		/**
+		 * Transforms an array of 3D directions by this matrix. Equivalent to calling multiplyDirection(const Vector3&) for
+		 * each direction, but faster for larger arrays.
+		 *
+		 * @param[in]	input	Array of directions to transform.
+		 * @param[out]	output	Array the transformed directions will be written to. Must be able to hold @p count
+		 *						elements. Can be the same as @p input.
+		 * @param[in]	count	Number of directions to transform.
+		 */
+		void multiplyDirection(const Vector3* input, Vector3* output, UINT32 count) const;
+
         /**
          * Transform a 3D point by this matrix.  
          *
@@ -37,6 +37,30 @@ namespace BansheeEngine
 		}
 	};
 
+	/** Usage statistics for a single size class of the pool allocator, accumulated over all threads. */
+	struct PoolAllocStats
+	{
+		UINT32 blockSize; /**< Maximum allocation size served by the size class, in bytes. */
+		UINT64 numAllocs; /**< Total number of allocations made. */
+		UINT64 numFrees; /**< Total number of frees, including remote frees. */
+		UINT64 numRemoteFrees; /**< Number of frees performed by a thread other than the one that made the allocation. */
+		UINT64 numBlocks; /**< Number of blocks reserved from the OS. Blocks are reused and never returned to the OS. */
+	};
+
+	/** Provides statistics about memory allocators. */
+	class BS_UTILITY_EXPORT MemAllocProfiler
+	{
+	public:
+		/** Returns the number of size classes used by the pool allocator (see MemoryAllocator<PoolAlloc>). */
+		static UINT32 getNumPoolSizeClasses();
+
+		/** 
+		 * Returns usage statistics for the pool allocator size class with the provided index, in range 
+		 * [0, getNumPoolSizeClasses()). Size classes are sorted by block size, smallest first.
+		 */
+		static PoolAllocStats getPoolStats(UINT32 sizeClass);
+	};
+
 	/** @} */
 	/** @} */
 }
\ No newline at end of file
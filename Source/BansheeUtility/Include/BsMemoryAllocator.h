@@ -214,6 +214,82 @@ namespace BansheeEngine
 	class GenAlloc
 	{ };
 
+	/**
+	 * Allocator optimized for small allocations that happen often (e.g. shared pointers, functors, container nodes).
+	 * Allocations up to MemoryAllocator<PoolAlloc>::MAX_POOLED_SIZE bytes are rounded up to one of a fixed number of size
+	 * classes and served from free lists local to the allocating thread, larger allocations are passed on to the OS.
+	 * Memory may be freed from any thread.
+	 */
+	class PoolAlloc
+	{ };
+
+	/**
+	 * Allocator that keeps a separate set of size class free lists for each thread. Blocks are carved out of large chunks
+	 * requested from the OS and are never returned to the OS, only reused for allocations of the same size class.
+	 *
+	 * @note
+	 * Blocks freed by the thread that allocated them are returned straight to its free lists. Blocks freed by other
+	 * threads are returned to the owner thread's lock-free list of remote frees, which it reclaims once its own free
+	 * list for that size class runs empty. Free lists of threads that exited are reused by newly started threads.
+	 * @note
+	 * Use MemAllocProfiler to retrieve per size class statistics.
+	 */
+	template<>
+	class BS_UTILITY_EXPORT MemoryAllocator<PoolAlloc> : public MemoryAllocatorBase
+	{
+	public:
+		/** Allocates @p bytes bytes. Returned memory is aligned to a 16 byte boundary. */
+		static void* allocate(size_t bytes);
+
+		/** 
+		 * Allocates @p bytes and aligns them to the specified boundary (in bytes). Not pooled, see 
+		 * MemoryAllocator::allocateAligned().
+		 */
+		static void* allocateAligned(size_t bytes, size_t alignment)
+		{
+#if BS_PROFILING_ENABLED
+			incAllocCount();
+#endif
+
+			return platformAlignedAlloc(bytes, alignment);
+		}
+
+		/** Allocates @p bytes and aligns them to a 16 byte boundary. */
+		static void* allocateAligned16(size_t bytes)
+		{
+			return allocate(bytes);
+		}
+
+		/** Frees memory previously allocated with allocate(). Can be called from any thread. */
+		static void free(void* ptr);
+
+		/** Frees memory allocated with allocateAligned() */
+		static void freeAligned(void* ptr)
+		{
+#if BS_PROFILING_ENABLED
+			incFreeCount();
+#endif
+
+			platformAlignedFree(ptr);
+		}
+
+		/** Frees memory allocated with allocateAligned16() */
+		static void freeAligned16(void* ptr)
+		{
+			free(ptr);
+		}
+
+		/** Largest allocation size, in bytes, that will be served from the pools. */
+		static const UINT32 MAX_POOLED_SIZE = 2048;
+	};
+
+#if BS_POOL_ALLOCATOR
+	/** Routes all general purpose allocations through the pool allocator. */
+	template<>
+	class MemoryAllocator<GenAlloc> : public MemoryAllocator<PoolAlloc>
+	{ };
+#endif
+
 	/** @} */
 	/** @} */
 
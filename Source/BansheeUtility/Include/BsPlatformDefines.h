@@ -17,6 +17,11 @@
 #define BS_ARCHITECTURE_x86_32 1
 #define BS_ARCHITECTURE_x86_64 2
 
+#define BS_SIMD_NONE 0
+#define BS_SIMD_SSE2 1
+#define BS_SIMD_SSE41 2
+#define BS_SIMD_AVX2 3
+
 #define BS_ENDIAN_LITTLE 1
 #define BS_ENDIAN_BIG 2
 #define BS_ENDIAN BS_ENDIAN_LITTLE
@@ -65,6 +70,12 @@
 #   define BS_ARCH_TYPE BS_ARCHITECTURE_x86_32
 #endif
 
+// Instruction set used by the vectorized math operations. Normally provided by the build system. When not provided, 
+// scalar implementations are used.
+#ifndef BS_SIMD
+#	define BS_SIMD BS_SIMD_NONE
+#endif
+
 // Windows Settings
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 
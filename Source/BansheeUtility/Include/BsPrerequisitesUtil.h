@@ -97,6 +97,10 @@
  *  Utility functionality that doesn't fit in any other category.
  */
 
+/** @defgroup Math-Internal Math
+ *  Vectorized implementations of math operations.
+ */
+
 /** @defgroup Memory-Internal Memory
  *  Allocators, deallocators and memory manipulation.
  */
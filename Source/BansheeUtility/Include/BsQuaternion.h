@@ -5,6 +5,7 @@
 #include "BsPrerequisitesUtil.h"
 #include "BsMath.h"
 #include "BsVector3.h"
+#include "BsSIMD.h"
 
 namespace BansheeEngine 
 {
@@ -207,6 +208,12 @@ namespace BansheeEngine
 
 		Quaternion operator* (const Quaternion& rhs) const
 		{
+#if BS_SIMD != BS_SIMD_NONE
+			Quaternion output;
+			_mm_storeu_ps(&output.x, simdQuaternionMultiply(_mm_loadu_ps(&x), _mm_loadu_ps(&rhs.x)));
+
+			return output;
+#else
 			return Quaternion
 			(
 				w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z,
@@ -214,6 +221,7 @@ namespace BansheeEngine
 				w * rhs.y + y * rhs.w + z * rhs.x - x * rhs.z,
 				w * rhs.z + z * rhs.w + x * rhs.y - y * rhs.x
 			);
+#endif
 		}
 
 		Quaternion operator* (float rhs) const
@@ -258,6 +266,9 @@ namespace BansheeEngine
 
 		Quaternion& operator*= (const Quaternion& rhs)
 		{
+#if BS_SIMD != BS_SIMD_NONE
+			_mm_storeu_ps(&x, simdQuaternionMultiply(_mm_loadu_ps(&x), _mm_loadu_ps(&rhs.x)));
+#else
 			float newW = w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z;
 			float newX = w * rhs.x + x * rhs.w + y * rhs.z - z * rhs.y;
 			float newY = w * rhs.y + y * rhs.w + z * rhs.x - x * rhs.z;
@@ -267,6 +278,7 @@ namespace BansheeEngine
 			x = newX;
 			y = newY;
 			z = newZ;
+#endif
 
 			return *this;
 		}
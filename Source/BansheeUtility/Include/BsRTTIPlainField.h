@@ -94,6 +94,20 @@ namespace BansheeEngine
 		 * location and contains the proper type.
 		 */
 		virtual void arrayElemFromBuffer(void* object, int index, void* buffer) = 0;
+
+		/**
+		 * Retrieves a range of values from the array on the provided field of the provided object, and copies them into
+		 * the buffer one after another. Only valid for fields whose type doesn't have a dynamic size. It does not check
+		 * if buffer is large enough.
+		 */
+		virtual void arrayToBuffer(void* object, UINT32 start, UINT32 count, void* buffer) = 0;
+
+		/**
+		 * Sets a range of values in the array on the provided field of the provided object. Values are copied from the
+		 * buffer where they are stored one after another. Only valid for fields whose type doesn't have a dynamic size. 
+		 * Array must already be large enough to hold the range.
+		 */
+		virtual void arrayFromBuffer(void* object, UINT32 start, UINT32 count, void* buffer) = 0;
 	};
 
 	/** Represents a plain class field containing a specific type. */
@@ -173,10 +187,8 @@ namespace BansheeEngine
 
 			ObjectType* castObject = static_cast<ObjectType*>(object);
 
-			std::function<DataType&(ObjectType*)> f = any_cast<std::function<DataType&(ObjectType*)>>(valueGetter);
-			DataType value = f(castObject);
-
-			return RTTIPlainType<DataType>::getDynamicSize(value);
+			auto& f = any_cast_ref<std::function<DataType&(ObjectType*)>>(valueGetter);
+			return RTTIPlainType<DataType>::getDynamicSize(f(castObject));
 		}
 
 		/** @copydoc RTTIPlainFieldBase::getArrayElemDynamicSize */
@@ -187,10 +199,8 @@ namespace BansheeEngine
 
 			ObjectType* castObject = static_cast<ObjectType*>(object);
 
-			std::function<DataType&(ObjectType*, UINT32)> f = any_cast<std::function<DataType&(ObjectType*, UINT32)>>(valueGetter);
-			DataType value = f(castObject, index);
-
-			return RTTIPlainType<DataType>::getDynamicSize(value);
+			auto& f = any_cast_ref<std::function<DataType&(ObjectType*, UINT32)>>(valueGetter);
+			return RTTIPlainType<DataType>::getDynamicSize(f(castObject, index));
 		}
 
 		/** Returns the size of the array managed by the field. */
@@ -198,7 +208,7 @@ namespace BansheeEngine
 		{
 			checkIsArray(true);
 
-			std::function<UINT32(ObjectType*)> f = any_cast<std::function<UINT32(ObjectType*)>>(arraySizeGetter);
+			auto& f = any_cast_ref<std::function<UINT32(ObjectType*)>>(arraySizeGetter);
 			ObjectType* castObject = static_cast<ObjectType*>(object);
 			return f(castObject);
 		}
@@ -213,7 +223,7 @@ namespace BansheeEngine
 				BS_EXCEPT(InternalErrorException, "Specified field (" + mName + ") has no array size setter.");
 			}
 
-			std::function<void(ObjectType*, UINT32)> f = any_cast<std::function<void(ObjectType*, UINT32)>>(arraySizeSetter);
+			auto& f = any_cast_ref<std::function<void(ObjectType*, UINT32)>>(arraySizeSetter);
 			ObjectType* castObject = static_cast<ObjectType*>(object);
 			f(castObject, size);
 		}
@@ -226,10 +236,8 @@ namespace BansheeEngine
 
 			ObjectType* castObject = static_cast<ObjectType*>(object);
 
-			std::function<DataType&(ObjectType*)> f = any_cast<std::function<DataType&(ObjectType*)>>(valueGetter);
-			DataType value = f(castObject);
-
-			RTTIPlainType<DataType>::toMemory(value, (char*)buffer);
+			auto& f = any_cast_ref<std::function<DataType&(ObjectType*)>>(valueGetter);
+			RTTIPlainType<DataType>::toMemory(f(castObject), (char*)buffer);
 		}
 
 		/** @copydoc RTTIPlainFieldBase::arrayElemToBuffer */
@@ -240,10 +248,8 @@ namespace BansheeEngine
 
 			ObjectType* castObject = static_cast<ObjectType*>(object);
 
-			std::function<DataType&(ObjectType*, UINT32)> f = any_cast<std::function<DataType&(ObjectType*, UINT32)>>(valueGetter);
-			DataType value = f(castObject, index);
-
-			RTTIPlainType<DataType>::toMemory(value, (char*)buffer);
+			auto& f = any_cast_ref<std::function<DataType&(ObjectType*, UINT32)>>(valueGetter);
+			RTTIPlainType<DataType>::toMemory(f(castObject, index), (char*)buffer);
 		}
 
 		/** @copydoc RTTIPlainFieldBase::fromBuffer */
@@ -263,7 +269,7 @@ namespace BansheeEngine
 					"Specified field (" + mName + ") has no setter.");
 			}
 
-			std::function<void(ObjectType*, DataType&)> f = any_cast<std::function<void(ObjectType*, DataType&)>>(valueSetter);
+			auto& f = any_cast_ref<std::function<void(ObjectType*, DataType&)>>(valueSetter);
 			f(castObject, value);
 		}
 
@@ -284,9 +290,64 @@ namespace BansheeEngine
 					"Specified field (" + mName + ") has no setter.");
 			}
 
-			std::function<void(ObjectType*, UINT32, DataType&)> f = any_cast<std::function<void(ObjectType*, UINT32, DataType&)>>(valueSetter);
+			auto& f = any_cast_ref<std::function<void(ObjectType*, UINT32, DataType&)>>(valueSetter);
 			f(castObject, index, value);
 		}
+
+		/** @copydoc RTTIPlainFieldBase::arrayToBuffer */
+		void arrayToBuffer(void* object, UINT32 start, UINT32 count, void* buffer) override
+		{
+			checkIsArray(true);
+			checkType<DataType>();
+
+			if (RTTIPlainType<DataType>::hasDynamicSize != 0)
+			{
+				BS_EXCEPT(InternalErrorException,
+					"Specified field (" + mName + ") has dynamic size and cannot be copied in bulk.");
+			}
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+			auto& f = any_cast_ref<std::function<DataType&(ObjectType*, UINT32)>>(valueGetter);
+
+			char* dest = (char*)buffer;
+			for (UINT32 i = 0; i < count; i++)
+			{
+				RTTIPlainType<DataType>::toMemory(f(castObject, start + i), dest);
+				dest += sizeof(DataType);
+			}
+		}
+
+		/** @copydoc RTTIPlainFieldBase::arrayFromBuffer */
+		void arrayFromBuffer(void* object, UINT32 start, UINT32 count, void* buffer) override
+		{
+			checkIsArray(true);
+			checkType<DataType>();
+
+			if (RTTIPlainType<DataType>::hasDynamicSize != 0)
+			{
+				BS_EXCEPT(InternalErrorException,
+					"Specified field (" + mName + ") has dynamic size and cannot be copied in bulk.");
+			}
+
+			if(valueSetter.empty())
+			{
+				BS_EXCEPT(InternalErrorException, 
+					"Specified field (" + mName + ") has no setter.");
+			}
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+			auto& f = any_cast_ref<std::function<void(ObjectType*, UINT32, DataType&)>>(valueSetter);
+
+			char* src = (char*)buffer;
+			DataType value;
+			for (UINT32 i = 0; i < count; i++)
+			{
+				RTTIPlainType<DataType>::fromMemory(value, src);
+				f(castObject, start + i, value);
+
+				src += sizeof(DataType);
+			}
+		}
 	};
 
 	/** @} */
@@ -5,6 +5,7 @@
 #include <string>
 #include <algorithm>
 #include <unordered_map>
+#include <atomic>
 
 #include "BsPrerequisitesUtil.h"
 #include "BsRTTIField.h"
@@ -689,6 +690,12 @@ namespace BansheeEngine
 		/** Called by the RTTI system when a class is first found in order to form child/parent class hierarchy. */
 		virtual void _registerDerivedClass(RTTITypeBase* derivedClass) = 0;
 
+		/**
+		 * Checks does the type, and all of its base types, contain only plain and data block fields. Serializers can
+		 * decode such types directly, without first building an intermediate representation of their data.
+		 */
+		bool _hasOnlyPlainFields();
+
 		/** @} */
 
 	protected:
@@ -702,6 +709,7 @@ namespace BansheeEngine
 
 	private:
 		Vector<RTTIField*> mFields;
+		std::atomic<UINT32> mPlainFieldsState; /**< 0 - Not yet determined, 1 - Has non-plain fields, 2 - Only plain fields */
 	};
 
 	/** Used for initializing a certain type as soon as the program is loaded. */
@@ -0,0 +1,41 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup General
+	 *  @{
+	 */
+
+	/** Entry sorted by RadixSort. */
+	struct RadixSortEntry
+	{
+		UINT64 key; /**< Key to sort by. */
+		UINT32 value; /**< User data associated with the key, usually an index of the sorted object. */
+	};
+
+	/** 
+	 * Sorts entries by 64-bit keys using a least significant digit radix sort. Runs in linear time, and doesn't need to
+	 * call a comparison function, which makes it considerably faster than comparison based sorts for large number of 
+	 * entries with keys built up front.
+	 */
+	class BS_UTILITY_EXPORT RadixSort
+	{
+	public:
+		/**
+		 * Sorts the entries in ascending order of their keys. Sort is stable, so entries with equal keys keep their
+		 * relative order.
+		 *
+		 * @param[in, out]	entries		Entries to sort.
+		 * @param[in]		scratch		Buffer with room for @p count entries, used during sorting. Contents are 
+		 *								undefined after the sort.
+		 * @param[in]		count		Number of entries in @p entries.
+		 */
+		static void sort(RadixSortEntry* entries, RadixSortEntry* scratch, UINT32 count);
+	};
+
+	/** @} */
+}
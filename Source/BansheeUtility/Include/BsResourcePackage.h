@@ -0,0 +1,155 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Filesystem
+	 *  @{
+	 */
+
+	/** Compression applied to the data of a resource stored in a resource package. */
+	enum class ResourceCompression
+	{
+		None = 0, /**< Data is stored as is. */
+		LZ4 = 1 /**< Data is stored as a block created by Compression::compressBlock() using CompressionType::LZ4. */
+	};
+
+	/** Information about a single resource stored in a resource package. */
+	struct ResourcePackageEntry
+	{
+		String uuid;
+		UINT64 offset; /**< Offset of the resource data from the start of the package file, in bytes. */
+		UINT64 size; /**< Size of the resource data as stored in the package (after compression), in bytes. */
+		ResourceCompression compression;
+		Vector<String> dependencies; /**< UUIDs of resources the resource depends on. */
+	};
+
+	/**
+	 * Archive containing data of multiple resources in a single file, so they can be loaded without opening a file for
+	 * each resource.
+	 *
+	 * The file starts with an index that maps resource UUIDs to their data, followed by data of all the resources. The
+	 * entire file is mapped into memory when opened, and the data of each resource starts at an aligned offset, so it can
+	 * be referenced directly from the mapping.
+	 *
+	 * Packages are created using ResourcePackageBuilder.
+	 */
+	class BS_UTILITY_EXPORT ResourcePackage
+	{
+	public:
+		/**
+		 * Opens a resource package at the specified path and reads its index.
+		 *
+		 * @return	Opened package, or null if the file cannot be opened or isn't a valid package.
+		 */
+		static SPtr<ResourcePackage> open(const Path& path);
+
+		/** Returns the path of the package file. */
+		const Path& getPath() const { return mPath; }
+
+		/** Returns information about all the resources in the package. */
+		const Vector<ResourcePackageEntry>& getEntries() const { return mEntries; }
+
+		/** Returns information about the resource with the specified UUID, or null if the package doesn't contain it. */
+		const ResourcePackageEntry* getEntry(const String& uuid) const;
+
+		/** Checks does the package contain a resource with the specified UUID. */
+		bool contains(const String& uuid) const { return mLookup.find(uuid) != mLookup.end(); }
+
+		/**
+		 * Returns a stream over the data of the resource with the specified UUID. The stream references the mapped package
+		 * directly and keeps the mapping alive for as long as it exists.
+		 *
+		 * @return	Stream over the resource data, or null if the package doesn't contain the resource.
+		 */
+		SPtr<MappedFileDataStream> openEntry(const String& uuid) const;
+
+		/**
+		 * Decompresses the data of a resource, as returned by openEntry().
+		 *
+		 * @param[in]	entry	Information about the resource the data belongs to.
+		 * @param[in]	data	Data of the resource as stored in the package.
+		 * @return				Decompressed data, @p data itself if the resource isn't compressed, or null if the data is
+		 *						corrupt.
+		 */
+		static SPtr<MemoryDataStream> decompressEntry(const ResourcePackageEntry& entry, 
+			const SPtr<MemoryDataStream>& data);
+
+		/** Default alignment of resource data within the package, in bytes. */
+		static const UINT32 DEFAULT_ALIGNMENT = 16;
+
+		/** Alignment of the start of resource data within the package, in bytes. */
+		static const UINT32 DATA_ALIGNMENT = 4096;
+
+	private:
+		friend class ResourcePackageBuilder;
+
+		ResourcePackage(const SPtr<MappedFileDataStream>& file);
+
+		/** Reads the package index. Returns false if the index is invalid. */
+		bool readIndex();
+
+		static const UINT32 MAGIC = 0x4B505342; // "BSPK"
+		static const UINT32 VERSION = 1;
+
+		Path mPath;
+		SPtr<MappedFileDataStream> mFile;
+		Vector<ResourcePackageEntry> mEntries;
+		UnorderedMap<String, UINT32> mLookup;
+	};
+
+	/** Creates resource packages out of resource files. */
+	class BS_UTILITY_EXPORT ResourcePackageBuilder
+	{
+	public:
+		/**
+		 * Constructs a new empty builder.
+		 *
+		 * @param[in]	alignment	Alignment of the data of each resource within the package, in bytes. Must be a power of
+		 *							two. Use the page size if data of individual resources needs to be mapped separately.
+		 */
+		ResourcePackageBuilder(UINT32 alignment = ResourcePackage::DEFAULT_ALIGNMENT);
+
+		/**
+		 * Adds a resource to the package. The file isn't read until build() is called.
+		 *
+		 * @param[in]	uuid			UUID of the resource.
+		 * @param[in]	filePath		Path to the file containing the resource data.
+		 * @param[in]	dependencies	UUIDs of resources the resource depends on.
+		 * @param[in]	compression		Compression to apply to the resource data. Data is stored uncompressed if it doesn't
+		 *								benefit from compression. Compressed data is kept in memory until the package is
+		 *								written, as the index containing the data sizes precedes the data.
+		 */
+		void addFile(const String& uuid, const Path& filePath, const Vector<String>& dependencies,
+			ResourceCompression compression = ResourceCompression::None);
+
+		/** Returns the number of resources added to the builder. */
+		UINT32 getNumEntries() const { return (UINT32)mEntries.size(); }
+
+		/**
+		 * Writes a package containing all the added resources.
+		 *
+		 * @param[in]	outputPath	Path to write the package to. Any existing file is overwritten.
+		 * @return					True if the package was written, false if any of the resource files couldn't be read
+		 *							or if the output file couldn't be created.
+		 */
+		bool build(const Path& outputPath);
+
+	private:
+		/** Resource to be written to a package. */
+		struct Entry
+		{
+			ResourcePackageEntry info;
+			Path filePath;
+			SPtr<MemoryDataStream> compressedData;
+		};
+
+		UINT32 mAlignment;
+		Vector<Entry> mEntries;
+	};
+
+	/** @} */
+}
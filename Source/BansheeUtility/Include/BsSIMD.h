@@ -0,0 +1,130 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPlatformDefines.h"
+
+#if BS_SIMD != BS_SIMD_NONE
+
+#if BS_SIMD >= BS_SIMD_AVX2
+#	include <immintrin.h>
+#elif BS_SIMD >= BS_SIMD_SSE41
+#	include <smmintrin.h>
+#else
+#	include <emmintrin.h>
+#endif
+
+/** Returns a vector with all four components set to component @p idx of vector @p v. */
+#define BS_SIMD_SPLAT(v, idx) _mm_shuffle_ps((v), (v), _MM_SHUFFLE(idx, idx, idx, idx))
+
+namespace BansheeEngine
+{
+	/** @addtogroup Math-Internal
+	 *  @{
+	 */
+
+	/** Returns a * b + c. Uses a fused multiply-add when available. */
+	inline __m128 simdMulAdd(__m128 a, __m128 b, __m128 c)
+	{
+#if BS_SIMD >= BS_SIMD_AVX2
+		return _mm_fmadd_ps(a, b, c);
+#else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+	}
+
+	/** Calculates a 4D dot product between two vectors, and returns it in all four components of the result. */
+	inline __m128 simdDot4(__m128 a, __m128 b)
+	{
+#if BS_SIMD >= BS_SIMD_SSE41
+		return _mm_dp_ps(a, b, 0xFF);
+#else
+		__m128 mul = _mm_mul_ps(a, b);
+		__m128 sum = _mm_add_ps(mul, _mm_shuffle_ps(mul, mul, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+#endif
+	}
+
+	/**
+	 * Multiplies a row vector with a 4x4 matrix. Used for calculating a single row of a matrix product.
+	 *
+	 * @param[in]	row		Row vector to multiply (row of the left-hand matrix).
+	 * @param[in]	r0		First row of the right-hand matrix.
+	 * @param[in]	r1		Second row of the right-hand matrix.
+	 * @param[in]	r2		Third row of the right-hand matrix.
+	 * @param[in]	r3		Fourth row of the right-hand matrix.
+	 */
+	inline __m128 simdMulRow(__m128 row, __m128 r0, __m128 r1, __m128 r2, __m128 r3)
+	{
+		__m128 output = _mm_mul_ps(BS_SIMD_SPLAT(row, 0), r0);
+		output = simdMulAdd(BS_SIMD_SPLAT(row, 1), r1, output);
+		output = simdMulAdd(BS_SIMD_SPLAT(row, 2), r2, output);
+		output = simdMulAdd(BS_SIMD_SPLAT(row, 3), r3, output);
+
+		return output;
+	}
+
+	/**
+	 * Converts four tightly packed 3D vectors (loaded as three 4D vectors) into three vectors containing the x, y and z
+	 * components of all four input vectors, respectively.
+	 */
+	inline void simdAoSToSoA(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z)
+	{
+		// a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+		__m128 x2y2z2x3 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2));
+		__m128 y0z0y1z1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+		__m128 y2y2y3z3 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(3, 2, 3, 3));
+		__m128 z2z2z3z3 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));
+
+		x = _mm_shuffle_ps(a, x2y2z2x3, _MM_SHUFFLE(3, 0, 3, 0));
+		y = _mm_shuffle_ps(y0z0y1z1, y2y2y3z3, _MM_SHUFFLE(2, 0, 2, 0));
+		z = _mm_shuffle_ps(y0z0y1z1, z2z2z3z3, _MM_SHUFFLE(2, 0, 3, 1));
+	}
+
+	/** Performs the inverse of simdAoSToSoA(). */
+	inline void simdSoAToAoS(__m128 x, __m128 y, __m128 z, __m128& a, __m128& b, __m128& c)
+	{
+		__m128 x0y0x1y1 = _mm_unpacklo_ps(x, y);
+		__m128 x2y2x3y3 = _mm_unpackhi_ps(x, y);
+		__m128 z0z0x1x1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+		__m128 y1y1z1z1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+		__m128 z2z2x3x3 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+		__m128 y3y3z3z3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+
+		a = _mm_shuffle_ps(x0y0x1y1, z0z0x1x1, _MM_SHUFFLE(2, 0, 1, 0));
+		b = _mm_shuffle_ps(y1y1z1z1, x2y2x3y3, _MM_SHUFFLE(1, 0, 2, 0));
+		c = _mm_shuffle_ps(z2z2x3x3, y3y3z3z3, _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	/** Multiplies two quaternions stored in (x, y, z, w) order. */
+	inline __m128 simdQuaternionMultiply(__m128 lhs, __m128 rhs)
+	{
+		const __m128 negateW = _mm_set_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+
+		// x = lw * rx + lx * rw + ly * rz - lz * ry
+		// y = lw * ry + ly * rw + lz * rx - lx * rz
+		// z = lw * rz + lz * rw + lx * ry - ly * rx
+		// w = lw * rw - lx * rx - ly * ry - lz * rz
+		__m128 output = _mm_mul_ps(BS_SIMD_SPLAT(lhs, 3), rhs);
+
+		__m128 a = _mm_mul_ps(
+			_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(0, 2, 1, 0)),
+			_mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(0, 3, 3, 3)));
+		output = _mm_add_ps(output, _mm_xor_ps(a, negateW));
+
+		__m128 b = _mm_mul_ps(
+			_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(1, 0, 2, 1)),
+			_mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 1, 0, 2)));
+		output = _mm_add_ps(output, _mm_xor_ps(b, negateW));
+
+		__m128 c = _mm_mul_ps(
+			_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(2, 1, 0, 2)),
+			_mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(2, 0, 2, 1)));
+
+		return _mm_sub_ps(output, c);
+	}
+
+	/** @} */
+}
+
+#endif
@@ -0,0 +1,25 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsTestSuite.h"
+
+namespace BansheeEngine
+{
+	class SerializationTestSuite : public TestSuite
+	{
+	public:
+		SerializationTestSuite();
+		void startUp() override;
+		void shutDown() override;
+
+	private:
+		void testPlainFields();
+		void testNestedObjects();
+		void testIntermediate();
+		void testFileStream();
+		void testStreamingEncode();
+		void testDiff();
+		void testSerialization_benchmark();
+	};
+}
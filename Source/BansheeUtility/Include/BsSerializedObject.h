@@ -26,6 +26,29 @@ namespace BansheeEngine
 		 */
 		virtual SPtr<SerializedInstance> clone(bool cloneData = true) = 0;
 
+		/**
+		 * Returns a hash of the data contained in this instance and all of its child instances. Instances containing the
+		 * same data have the same hash, so unchanged objects can be detected without comparing them field by field.
+		 *
+		 * @note	Hashes of objects are calculated on first request and cached, so the instance must not be modified once
+		 *			its hash has been requested.
+		 */
+		UINT64 getHash() { UINT32 numCycles = 0; return _calculateHash(numCycles); }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Calculates the hash returned by getHash(). 
+		 *
+		 * @param[in, out]	numCycles	Incremented whenever an object that is already being hashed is encountered further
+		 *								down its own hierarchy. Hashes of such hierarchies are not cached.
+		 */
+		virtual UINT64 _calculateHash(UINT32& numCycles) = 0;
+
+		/** @} */
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
@@ -98,14 +121,33 @@ namespace BansheeEngine
 	/** A serialized object consisting of multiple sub-objects, one for each inherited class. */
 	struct BS_UTILITY_EXPORT SerializedObject : SerializedInstance
 	{
+		SerializedObject()
+			:mHash(0), mHashState(HashState::None)
+		{ }
+
 		/** Returns the RTTI type ID for the most-derived class of this object. */
 		UINT32 getRootTypeId() const;
 
 		/** @copydoc SerializedInstance::clone */
 		SPtr<SerializedInstance> clone(bool cloneData = true) override;
 
+		/** @copydoc SerializedInstance::_calculateHash */
+		UINT64 _calculateHash(UINT32& numCycles) override;
+
 		Vector<SerializedSubObject> subObjects;
 
+	private:
+		/** Determines the state of the cached hash. */
+		enum class HashState
+		{
+			None,
+			InProgress,
+			Cached
+		};
+
+		UINT64 mHash;
+		HashState mHashState;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
@@ -133,6 +175,9 @@ namespace BansheeEngine
 		/** @copydoc SerializedInstance::clone */
 		SPtr<SerializedInstance> clone(bool cloneData = true) override;
 
+		/** @copydoc SerializedInstance::_calculateHash */
+		UINT64 _calculateHash(UINT32& numCycles) override;
+
 		UINT8* value;
 		UINT32 size;
 		bool ownsMemory;
@@ -158,6 +203,9 @@ namespace BansheeEngine
 		/** @copydoc SerializedInstance::clone */
 		SPtr<SerializedInstance> clone(bool cloneData = true) override;
 
+		/** @copydoc SerializedInstance::_calculateHash */
+		UINT64 _calculateHash(UINT32& numCycles) override;
+
 		SPtr<DataStream> stream;
 		UINT32 offset;
 		UINT32 size;
@@ -181,6 +229,9 @@ namespace BansheeEngine
 		/** @copydoc SerializedInstance::clone */
 		SPtr<SerializedInstance> clone(bool cloneData = true) override;
 
+		/** @copydoc SerializedInstance::_calculateHash */
+		UINT64 _calculateHash(UINT32& numCycles) override;
+
 		UnorderedMap<UINT32, SerializedArrayEntry> entries;
 		UINT32 numElements;
 
@@ -19,37 +19,49 @@ namespace BansheeEngine
 	 * Essentially a unique ID is generated for each string and then the ID is used for comparisons as if you were using 
 	 * an integer or an enum.
 	 * @note
-	 * Thread safe.
+	 * Thread safe. Strings are stored in a number of independently locked shards, and looking up a string that was 
+	 * already created doesn't require any locking.
 	 */
 	class BS_UTILITY_EXPORT StringID
 	{
-		static const int HASH_TABLE_SIZE = 4096;
-		static const int MAX_CHUNK_COUNT = 50;
-		static const int ELEMENTS_PER_CHUNK = 256;
-		static const int STRING_SIZE = 256;
-
-		/** Helper class that performs string actions on both null terminated character arrays and standard strings. */
-		template<class T>
-		class StringIDUtil
-		{
-		public:
-			static UINT32 size(T const& input) { return 0; }
-			static void copy(T const& input, char* dest) { }
-			static bool compare(T const& a, char* b) { return 0; }
-		};
+		static const UINT32 NUM_SHARDS = 64;
+		static const UINT32 SHARD_BITS = 6;
+		static const UINT32 INITIAL_TABLE_SIZE = 64;
+		static const UINT32 CHUNK_SIZE = 16384;
 
 		/**	Internal data that is shared by all instances for a specific string. */
 		struct InternalData
 		{
 			UINT32 id;
-			InternalData* next;
-			char chars[STRING_SIZE];
+			UINT32 hash;
+			UINT32 length;
+			char chars[1]; /**< Null-terminated string, allocated along with the entry to fit the string. */
+		};
+
+		/** 
+		 * Open addressing hash table containing the strings of a single shard. Once it gets half full it is replaced by a
+		 * table twice the size. Replaced tables are never freed, as other threads might still be reading from them.
+		 */
+		struct HashTable
+		{
+			UINT32 size;
+			UINT32 numEntries;
+			std::atomic<InternalData*>* entries;
 		};
 
-		/**	Performs initialization of static members as soon as the library is loaded. */
-		struct InitStatics
+		/** 
+		 * Portion of all the strings with a specific range of hash values. 
+		 *
+		 * @note	Relies on zero initialization, as string IDs may be created during static initialization of other
+		 *			translation units, before the shards are constructed.
+		 */
+		struct Shard
 		{
-			InitStatics();
+			std::atomic<HashTable*> table;
+			SpinLock lock;
+
+			UINT8* chunk;
+			UINT32 chunkOffset;
 		};
 
 	public:
@@ -58,20 +70,20 @@ namespace BansheeEngine
 		StringID(const char* name)
 			:mData(nullptr)
 		{
-			construct(name);
+			construct(name, (UINT32)strlen(name));
 		}
 
 		StringID(const String& name)
 			:mData(nullptr)
 		{
-			construct(name);
+			construct(name.data(), (UINT32)name.size());
 		}
 
 		template<int N>
 		StringID(const char name[N])
 			:mData(nullptr)
 		{
-			construct((const char*)name);
+			construct((const char*)name, (UINT32)strlen(name));
 		}
 
 		/**	Compare to string ids for equality. Uses fast integer comparison. */
@@ -101,32 +113,43 @@ namespace BansheeEngine
 			return mData->chars;
 		}
 
+		/** 
+		 * Creates string ids for all of the provided strings. Faster than creating them one by one when many of the 
+		 * strings are new, as each shard is only locked once.
+		 */
+		static Vector<StringID> create(const Vector<String>& names);
+
 		static const StringID NONE;
 
 	private:
-		/**Constructs a StringID object in a way that works for pointers to character arrays and standard strings. */
-		template<class T>
-		void construct(T const& name);
+		/** Finds an existing entry for the provided string, or creates a new one if none exists. */
+		void construct(const char* name, UINT32 length);
+
+		/**	Calculates a hash value for the provided string. */
+		static UINT32 calcHash(const char* name, UINT32 length);
 
-		/**	Calculates a hash value for the provided null-terminated string. */
-		template<class T>
-		UINT32 calcHash(T const& input);
+		/** Returns the shard that stores strings with the provided hash. */
+		static Shard& getShard(UINT32 hash) { return mShards[hash >> (32 - SHARD_BITS)]; }
+
+		/** Searches the shard for an existing entry of the provided string, without locking. */
+		static InternalData* find(Shard& shard, UINT32 hash, const char* name, UINT32 length);
 
 		/**
-		 * Allocates a new string entry and assigns it a unique ID. Optionally expands the chunks buffer if the new entry 
-		 * doesn't fit.
+		 * Searches the shard for an existing entry of the provided string, and creates a new entry if none is found. Shard
+		 * must be locked by the caller.
 		 */
-		InternalData* allocEntry();
+		static InternalData* findOrInsert(Shard& shard, UINT32 hash, const char* name, UINT32 length);
 
-		InternalData* mData;
+		/** Allocates a new string entry in the shard and assigns it a unique ID. Shard must be locked by the caller. */
+		static InternalData* allocEntry(Shard& shard, UINT32 hash, const char* name, UINT32 length);
 
-		static volatile InitStatics mInitStatics;
-		static InternalData* mStringHashTable[HASH_TABLE_SIZE];
-		static InternalData* mChunks[MAX_CHUNK_COUNT];
+		/** Replaces the shard's hash table with one twice the size. Shard must be locked by the caller. */
+		static HashTable* growTable(Shard& shard);
+
+		InternalData* mData;
 
-		static UINT32 mNextId;
-		static UINT32 mNumChunks;
-		static SpinLock mSync;
+		static Shard mShards[NUM_SHARDS];
+		static std::atomic<UINT32> mNextId;
 	};
 
 	/** @cond SPECIALIZATIONS */
@@ -23,6 +23,25 @@ namespace BansheeEngine
 		VeryHigh = 102
 	};
 
+	/** Determines how does the TaskScheduler distribute queued tasks among its worker threads. */
+	enum class TaskSchedulerMode
+	{
+		/**
+		 * All tasks are placed in a single priority sorted queue from which a dedicated scheduler thread dispatches them.
+		 * Strictly respects task priorities, but is only suitable for a relatively low number of coarse tasks.
+		 */
+		GlobalQueue,
+		/**
+		 * Each worker thread owns a lock-free queue of tasks, and idle workers steal tasks from other workers. Suitable
+		 * for a large number of small tasks. Priorities are only respected coarsely: tasks with priority above normal are
+		 * executed before any other queued tasks, while tasks with priority below normal are never placed in worker
+		 * queues, so workers execute their own tasks first. Low and very low priority tasks share a single first-in
+		 * first-out queue and are not ordered relative to each other. Steals always take the oldest task of the victim,
+		 * which is fine as worker queues only ever contain normal priority tasks.
+		 */
+		WorkStealing
+	};
+
 	/**
 	 * Represents a single task that may be queued in the TaskScheduler.
 	 * 			
@@ -34,7 +53,7 @@ namespace BansheeEngine
 
 	public:
 		Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker, 
-			TaskPriority priority, SPtr<Task> dependency);
+			TaskPriority priority, const Vector<SPtr<Task>>& dependencies);
 
 		/**
 		 * Creates a new task. Task should be provided to TaskScheduler in order for it to start.
@@ -48,6 +67,18 @@ namespace BansheeEngine
 		static SPtr<Task> create(const String& name, std::function<void()> taskWorker, TaskPriority priority = TaskPriority::Normal, 
 			SPtr<Task> dependency = nullptr);
 
+		/**
+		 * Creates a new task that depends on multiple other tasks. Task should be provided to TaskScheduler in order for it
+		 * to start.
+		 *
+		 * @param[in]	name			Name you can use to more easily identify the task.
+		 * @param[in]	taskWorker		Worker method that does all of the work in the task.
+		 * @param[in]	priority  		Higher priority means the tasks will be executed sooner.
+		 * @param[in]	dependencies	A set of tasks that must complete (or be canceled) before this task is executed.
+		 */
+		static SPtr<Task> create(const String& name, std::function<void()> taskWorker, TaskPriority priority,
+			const Vector<SPtr<Task>>& dependencies);
+
 		/** Returns true if the task has completed. */
 		bool isComplete() const;
 
@@ -57,7 +88,10 @@ namespace BansheeEngine
 		/**
 		 * Blocks the current thread until the task has completed. 
 		 * 
-		 * @note	While waiting adds a new worker thread, so that the blocking threads core can be utilized.
+		 * @note
+		 * In TaskSchedulerMode::GlobalQueue mode a new worker thread is added while waiting, so that the blocking threads
+		 * core can be utilized. In TaskSchedulerMode::WorkStealing mode the calling thread executes other queued tasks
+		 * while waiting.
 		 */
 		void wait();
 
@@ -67,16 +101,56 @@ namespace BansheeEngine
 	private:
 		friend class TaskScheduler;
 
+		/** Checks have all the tasks dependencies been completed or canceled. */
+		bool areDependenciesComplete() const;
+
 		String mName;
 		TaskPriority mPriority;
 		UINT32 mTaskId;
 		std::function<void()> mTaskWorker;
-		SPtr<Task> mTaskDependency;
+		Vector<SPtr<Task>> mTaskDependencies;
 		std::atomic<UINT32> mState; /**< 0 - Inactive, 1 - In progress, 2 - Completed, 3 - Canceled */
 
+		// Work stealing only
+		SPtr<Task> mSelfRef; /**< Keeps the task alive while it's only referenced from the lock-free task queues. */
+		Vector<SPtr<Task>> mDependants;
+		std::atomic<UINT32> mNumPendingDependencies;
+		SpinLock mDependantsSync;
+
 		TaskScheduler* mParent;
 	};
 
+	/**
+	 * A set of tasks that can be queued and waited upon as a single unit.
+	 *
+	 * @note	Not thread safe. Tasks should be added to and waited upon from the same thread.
+	 */
+	class BS_UTILITY_EXPORT TaskGroup
+	{
+	public:
+		/** Creates a new group whose tasks will be queued in the global TaskScheduler. */
+		TaskGroup();
+
+		/** Creates a new group whose tasks will be queued in the provided scheduler. */
+		TaskGroup(TaskScheduler& scheduler);
+
+		/** Queues the task in the TaskScheduler and makes it a part of the group. */
+		void add(const SPtr<Task>& task);
+
+		/** Returns true if all tasks in the group have completed (or were canceled). */
+		bool isComplete() const;
+
+		/** Blocks the current thread until all tasks in the group complete. See Task::wait(). */
+		void wait();
+
+		/** Returns all tasks in the group. Can be used for providing the group as a dependency to other tasks. */
+		const Vector<SPtr<Task>>& getTasks() const { return mTasks; }
+
+	private:
+		TaskScheduler& mScheduler;
+		Vector<SPtr<Task>> mTasks;
+	};
+
 	/**
 	 * Represents a task scheduler running on multiple threads. You may queue tasks on it from any thread and they will be
 	 * executed in user specified order on any available thread.
@@ -84,17 +158,19 @@ namespace BansheeEngine
 	 * @note	
 	 * Thread safe.
 	 * @note
-	 * This type of task scheduler uses a global queue and is best used for coarse granularity of tasks. (Number of tasks 
-	 * in the order of hundreds. Higher number of tasks might require different queuing and locking mechanism, potentially 
-	 * at the cost of flexibility.)
+	 * In TaskSchedulerMode::GlobalQueue mode the scheduler uses a global queue and is best used for coarse granularity of
+	 * tasks. (Number of tasks in the order of hundreds.) For higher number of tasks use TaskSchedulerMode::WorkStealing
+	 * mode, at the cost of only coarsely respecting task priorities.
 	 * @note
 	 * By default the task scheduler will create as many threads as there are physical CPU cores. You may add or remove
 	 * threads using addWorker()/removeWorker() methods.
 	 */
 	class BS_UTILITY_EXPORT TaskScheduler : public Module<TaskScheduler>
 	{
+		struct WorkerData;
+
 	public:
-		TaskScheduler();
+		TaskScheduler(TaskSchedulerMode mode = TaskSchedulerMode::GlobalQueue);
 		~TaskScheduler();
 
 		/** Queues a new task. */
@@ -106,8 +182,25 @@ namespace BansheeEngine
 		/**	Removes a worker thread (as soon as its current task is finished). */
 		void removeWorker();
 
+		/**
+		 * Splits the provided range into chunks of @p grainSize elements and executes the provided worker over them on all
+		 * available worker threads. The calling thread participates in the work and the method returns only once the
+		 * entire range has been processed.
+		 *
+		 * @param[in]	start		Index of the first element in the range.
+		 * @param[in]	end			Index one past the last element in the range.
+		 * @param[in]	grainSize	Maximum number of elements to process in a single call to @p worker.
+		 * @param[in]	worker		Method that processes elements in range [first, last).
+		 * @param[in]	priority	Priority of the tasks used for processing the range.
+		 */
+		void parallelFor(UINT32 start, UINT32 end, UINT32 grainSize, const std::function<void(UINT32, UINT32)>& worker,
+			TaskPriority priority = TaskPriority::Normal);
+
 		/** Returns the maximum available worker threads (maximum number of tasks that can be executed simultaneously). */
 		UINT32 getNumWorkers() const { return mMaxActiveTasks; }
+
+		/** Returns the mode the scheduler is distributing its tasks in. */
+		TaskSchedulerMode getMode() const { return mMode; }
 	protected:
 		friend class Task;
 
@@ -123,17 +216,70 @@ namespace BansheeEngine
 		/**	Method used for sorting tasks. */
 		static bool taskCompare(const SPtr<Task>& lhs, const SPtr<Task>& rhs);
 
+		/** Work stealing worker thread method that executes tasks from its own queue, or steals them from other workers. */
+		void runWorker(UINT32 workerIdx);
+
+		/** Starts a new work stealing worker thread if current number of threads is lower than the number of workers. */
+		void spawnWorkers();
+
+		/** Places a task whose dependencies are complete into a work stealing queue. */
+		void pushTask(Task* task);
+
+		/**
+		 * Retrieves a high priority task if one is queued, otherwise a task from the queue of the provided worker, or if
+		 * empty, the global queue or one of the other workers. Worker can be null in which case tasks are only retrieved
+		 * from the global queues or stolen.
+		 */
+		Task* findTask(WorkerData* worker);
+
+		/** Executes a task retrieved from a work stealing queue and releases any tasks that depend on it. */
+		void executeTask(Task* task);
+
+		/** Queues any of the provided tasks that no longer have pending dependencies. */
+		static void releaseDependants(const Vector<SPtr<Task>>& dependants);
+
+		/** Wakes up threads blocked in helpUntilComplete(), or in the destructor waiting for remaining tasks. */
+		void notifyWaiters();
+
+		/** Blocks the calling thread until the specified task has completed, executing other tasks in the meantime. */
+		void helpUntilComplete(const Task* task);
+
+		/**
+		 * Returns the work stealing worker running on the calling thread, or null if the calling thread isn't a worker of
+		 * this scheduler.
+		 */
+		WorkerData* getActiveWorker() const;
+
+		TaskSchedulerMode mMode;
 		HThread mTaskSchedulerThread;
 		Set<SPtr<Task>, std::function<bool(const SPtr<Task>&, const SPtr<Task>&)>> mTaskQueue;
 		Vector<SPtr<Task>> mActiveTasks;
-		UINT32 mMaxActiveTasks;
+		std::atomic<UINT32> mMaxActiveTasks;
 		UINT32 mNextTaskId;
+		bool mCheckTasks;
 		bool mShutdown;
 
 		Mutex mReadyMutex;
 		Mutex mCompleteMutex;
 		Signal mTaskReadyCond;
 		Signal mTaskCompleteCond;
+
+		// Work stealing only
+		WorkerData* mWorkers;
+		UINT32 mNumWorkerSlots;
+		std::atomic<UINT32> mNumSpawnedWorkers;
+		std::atomic<UINT32> mNumQueuedTasks;
+		std::atomic<UINT32> mNumRunningTasks;
+		std::atomic<UINT32> mNumIdleWorkers;
+		std::atomic<UINT32> mNumWaiters;
+
+		Queue<Task*> mGlobalTasks;
+		Queue<Task*> mHighPriorityTasks[2]; // Very high, high
+		std::atomic<UINT32> mNumHighPriorityTasks;
+		Mutex mGlobalTasksMutex;
+		Signal mWorkerAddedCond;
+
+		static BS_THREADLOCAL WorkerData* ActiveWorker;
 	};
 
 	/** @} */
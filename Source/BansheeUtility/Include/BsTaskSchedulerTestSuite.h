@@ -0,0 +1,29 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsTestSuite.h"
+
+namespace BansheeEngine
+{
+	class TaskSchedulerTestSuite : public TestSuite
+	{
+	public:
+		TaskSchedulerTestSuite();
+		void startUp() override;
+		void shutDown() override;
+
+	private:
+		void testRunTasks_global_queue();
+		void testRunTasks_work_stealing();
+		void testMultipleDependencies_global_queue();
+		void testMultipleDependencies_work_stealing();
+		void testNestedTasks_work_stealing();
+		void testParallelFor_global_queue();
+		void testParallelFor_work_stealing();
+		void testCanceledDependency_work_stealing();
+		void testMultipleSchedulers_work_stealing();
+		void testPriority_work_stealing();
+		void testThroughput_benchmark();
+	};
+}
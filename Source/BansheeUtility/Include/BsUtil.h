@@ -26,5 +26,15 @@ namespace BansheeEngine
 	/**	Generates an MD5 hash string for the provided source string. */
 	String BS_UTILITY_EXPORT md5(const String& source);
 
+	/** 
+	 * Generates a 64-bit hash of the provided data. Much faster than md5() but not suitable for cryptographic purposes.
+	 * 
+	 * @param[in]	data	Data to hash.
+	 * @param[in]	size	Size of @p data in bytes.
+	 * @param[in]	seed	Value to initialize the hash with. Can be used for hashing data split into multiple pieces, by
+	 *						providing the hash of the previous piece.
+	 */
+	UINT64 BS_UTILITY_EXPORT hash64(const void* data, size_t size, UINT64 seed = 0);
+
 	/** @} */
 }
@@ -0,0 +1,377 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsAABBTree.h"
+#include "BsPlane.h"
+#include "BsMath.h"
+
+namespace BansheeEngine
+{
+	/** Returns a box encompassing both provided boxes. */
+	static AABox mergeBounds(const AABox& a, const AABox& b)
+	{
+		Vector3 min = a.getMin();
+		Vector3 max = a.getMax();
+		min.floor(b.getMin());
+		max.ceil(b.getMax());
+
+		return AABox(min, max);
+	}
+
+	/** Returns the surface area of the box, used as a cost metric when deciding where to insert new nodes. */
+	static float surfaceArea(const AABox& box)
+	{
+		Vector3 size = box.getMax() - box.getMin();
+		return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
+	AABBTree::AABBTree(float margin)
+		:mRoot(INVALID_ID), mFreeList(INVALID_ID), mNumObjects(0), mMargin(margin)
+	{ }
+
+	UINT32 AABBTree::insert(const AABox& bounds, UINT32 userData)
+	{
+		UINT32 leaf = allocateNode();
+
+		Vector3 margin(mMargin, mMargin, mMargin);
+		mNodes[leaf].bounds = AABox(bounds.getMin() - margin, bounds.getMax() + margin);
+		mNodes[leaf].userData = userData;
+
+		insertLeaf(leaf);
+		mNumObjects++;
+
+		return leaf;
+	}
+
+	void AABBTree::remove(UINT32 id)
+	{
+		assert(id < (UINT32)mNodes.size() && mNodes[id].isLeaf());
+
+		removeLeaf(id);
+		freeNode(id);
+		mNumObjects--;
+	}
+
+	bool AABBTree::update(UINT32 id, const AABox& bounds)
+	{
+		assert(id < (UINT32)mNodes.size() && mNodes[id].isLeaf());
+
+		if (mNodes[id].bounds.contains(bounds))
+			return false;
+
+		removeLeaf(id);
+
+		Vector3 margin(mMargin, mMargin, mMargin);
+		mNodes[id].bounds = AABox(bounds.getMin() - margin, bounds.getMax() + margin);
+
+		insertLeaf(id);
+		return true;
+	}
+
+	void AABBTree::clear()
+	{
+		mNodes.clear();
+		mRoot = INVALID_ID;
+		mFreeList = INVALID_ID;
+		mNumObjects = 0;
+	}
+
+	AABBTree::Overlap AABBTree::classify(const Plane* planes, UINT32 numPlanes, const AABox& bounds)
+	{
+		// Note: Same test as ConvexVolume::intersects(const AABox&), except it also detects when the box is fully inside
+		Vector3 center = bounds.getCenter();
+		Vector3 extents = bounds.getHalfSize();
+
+		Overlap output = Overlap::Inside;
+		for (UINT32 i = 0; i < numPlanes; i++)
+		{
+			const Plane& plane = planes[i];
+			float dist = center.dot(plane.normal) - plane.d;
+
+			float effectiveRadius = extents.x * Math::abs(plane.normal.x);
+			effectiveRadius += extents.y * Math::abs(plane.normal.y);
+			effectiveRadius += extents.z * Math::abs(plane.normal.z);
+
+			if (dist < -effectiveRadius)
+				return Overlap::Outside;
+
+			if (dist < effectiveRadius)
+				output = Overlap::Intersects;
+		}
+
+		return output;
+	}
+
+	UINT32 AABBTree::allocateNode()
+	{
+		UINT32 idx;
+		if (mFreeList != INVALID_ID)
+		{
+			idx = mFreeList;
+			mFreeList = mNodes[idx].parent;
+		}
+		else
+		{
+			idx = (UINT32)mNodes.size();
+			mNodes.push_back(Node());
+		}
+
+		Node& node = mNodes[idx];
+		node.parent = INVALID_ID;
+		node.children[0] = INVALID_ID;
+		node.children[1] = INVALID_ID;
+		node.height = 0;
+		node.userData = 0;
+
+		return idx;
+	}
+
+	void AABBTree::freeNode(UINT32 idx)
+	{
+		mNodes[idx].parent = mFreeList;
+		mNodes[idx].height = -1;
+		mFreeList = idx;
+	}
+
+	void AABBTree::insertLeaf(UINT32 leaf)
+	{
+		if (mRoot == INVALID_ID)
+		{
+			mRoot = leaf;
+			mNodes[leaf].parent = INVALID_ID;
+			return;
+		}
+
+		// Find the best sibling for the new leaf, by descending into the child that would increase the total surface
+		// area of the hierarchy the least
+		AABox leafBounds = mNodes[leaf].bounds;
+
+		UINT32 idx = mRoot;
+		while (!mNodes[idx].isLeaf())
+		{
+			const Node& node = mNodes[idx];
+
+			float area = surfaceArea(node.bounds);
+			float combinedArea = surfaceArea(mergeBounds(node.bounds, leafBounds));
+
+			// Cost of creating a new parent for this node and the new leaf
+			float cost = 2.0f * combinedArea;
+
+			// Minimum cost of pushing the leaf further down the tree
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			float childCosts[2];
+			for (UINT32 i = 0; i < 2; i++)
+			{
+				const Node& child = mNodes[node.children[i]];
+				float childArea = surfaceArea(mergeBounds(leafBounds, child.bounds));
+
+				if (child.isLeaf())
+					childCosts[i] = childArea + inheritanceCost;
+				else
+					childCosts[i] = (childArea - surfaceArea(child.bounds)) + inheritanceCost;
+			}
+
+			if (cost < childCosts[0] && cost < childCosts[1])
+				break;
+
+			idx = childCosts[0] < childCosts[1] ? node.children[0] : node.children[1];
+		}
+
+		UINT32 sibling = idx;
+
+		// Create a new parent for the sibling and the leaf
+		UINT32 oldParent = mNodes[sibling].parent;
+		UINT32 newParent = allocateNode();
+
+		mNodes[newParent].parent = oldParent;
+		mNodes[newParent].bounds = mergeBounds(leafBounds, mNodes[sibling].bounds);
+		mNodes[newParent].height = mNodes[sibling].height + 1;
+		mNodes[newParent].children[0] = sibling;
+		mNodes[newParent].children[1] = leaf;
+
+		mNodes[sibling].parent = newParent;
+		mNodes[leaf].parent = newParent;
+
+		if (oldParent != INVALID_ID)
+		{
+			if (mNodes[oldParent].children[0] == sibling)
+				mNodes[oldParent].children[0] = newParent;
+			else
+				mNodes[oldParent].children[1] = newParent;
+		}
+		else
+			mRoot = newParent;
+
+		refit(oldParent);
+	}
+
+	void AABBTree::removeLeaf(UINT32 leaf)
+	{
+		if (leaf == mRoot)
+		{
+			mRoot = INVALID_ID;
+			return;
+		}
+
+		UINT32 parent = mNodes[leaf].parent;
+		UINT32 grandParent = mNodes[parent].parent;
+		UINT32 sibling = mNodes[parent].children[0] == leaf ? mNodes[parent].children[1] : mNodes[parent].children[0];
+
+		// Replace the parent with the sibling
+		if (grandParent != INVALID_ID)
+		{
+			if (mNodes[grandParent].children[0] == parent)
+				mNodes[grandParent].children[0] = sibling;
+			else
+				mNodes[grandParent].children[1] = sibling;
+
+			mNodes[sibling].parent = grandParent;
+			freeNode(parent);
+
+			refit(grandParent);
+		}
+		else
+		{
+			mRoot = sibling;
+			mNodes[sibling].parent = INVALID_ID;
+			freeNode(parent);
+		}
+	}
+
+	void AABBTree::refit(UINT32 idx)
+	{
+		while (idx != INVALID_ID)
+		{
+			idx = balance(idx);
+
+			Node& node = mNodes[idx];
+			const Node& child0 = mNodes[node.children[0]];
+			const Node& child1 = mNodes[node.children[1]];
+
+			node.height = 1 + std::max(child0.height, child1.height);
+			node.bounds = mergeBounds(child0.bounds, child1.bounds);
+
+			idx = node.parent;
+		}
+	}
+
+	UINT32 AABBTree::balance(UINT32 idxA)
+	{
+		Node& a = mNodes[idxA];
+		if (a.isLeaf() || a.height < 2)
+			return idxA;
+
+		UINT32 idxB = a.children[0];
+		UINT32 idxC = a.children[1];
+		Node& b = mNodes[idxB];
+		Node& c = mNodes[idxC];
+
+		INT32 balance = c.height - b.height;
+
+		// Rotate C up
+		if (balance > 1)
+		{
+			UINT32 idxF = c.children[0];
+			UINT32 idxG = c.children[1];
+			Node& f = mNodes[idxF];
+			Node& g = mNodes[idxG];
+
+			// Swap A and C
+			c.children[0] = idxA;
+			c.parent = a.parent;
+			a.parent = idxC;
+
+			if (c.parent != INVALID_ID)
+			{
+				if (mNodes[c.parent].children[0] == idxA)
+					mNodes[c.parent].children[0] = idxC;
+				else
+					mNodes[c.parent].children[1] = idxC;
+			}
+			else
+				mRoot = idxC;
+
+			// Keep the taller of C's children under C, and move the other one under A
+			if (f.height > g.height)
+			{
+				c.children[1] = idxF;
+				a.children[1] = idxG;
+				g.parent = idxA;
+
+				a.bounds = mergeBounds(b.bounds, g.bounds);
+				c.bounds = mergeBounds(a.bounds, f.bounds);
+
+				a.height = 1 + std::max(b.height, g.height);
+				c.height = 1 + std::max(a.height, f.height);
+			}
+			else
+			{
+				c.children[1] = idxG;
+				a.children[1] = idxF;
+				f.parent = idxA;
+
+				a.bounds = mergeBounds(b.bounds, f.bounds);
+				c.bounds = mergeBounds(a.bounds, g.bounds);
+
+				a.height = 1 + std::max(b.height, f.height);
+				c.height = 1 + std::max(a.height, g.height);
+			}
+
+			return idxC;
+		}
+
+		// Rotate B up
+		if (balance < -1)
+		{
+			UINT32 idxD = b.children[0];
+			UINT32 idxE = b.children[1];
+			Node& d = mNodes[idxD];
+			Node& e = mNodes[idxE];
+
+			// Swap A and B
+			b.children[0] = idxA;
+			b.parent = a.parent;
+			a.parent = idxB;
+
+			if (b.parent != INVALID_ID)
+			{
+				if (mNodes[b.parent].children[0] == idxA)
+					mNodes[b.parent].children[0] = idxB;
+				else
+					mNodes[b.parent].children[1] = idxB;
+			}
+			else
+				mRoot = idxB;
+
+			// Keep the taller of B's children under B, and move the other one under A
+			if (d.height > e.height)
+			{
+				b.children[1] = idxD;
+				a.children[0] = idxE;
+				e.parent = idxA;
+
+				a.bounds = mergeBounds(c.bounds, e.bounds);
+				b.bounds = mergeBounds(a.bounds, d.bounds);
+
+				a.height = 1 + std::max(c.height, e.height);
+				b.height = 1 + std::max(a.height, d.height);
+			}
+			else
+			{
+				b.children[1] = idxE;
+				a.children[0] = idxD;
+				d.parent = idxA;
+
+				a.bounds = mergeBounds(c.bounds, d.bounds);
+				b.bounds = mergeBounds(a.bounds, e.bounds);
+
+				a.height = 1 + std::max(c.height, d.height);
+				b.height = 1 + std::max(a.height, e.height);
+			}
+
+			return idxB;
+		}
+
+		return idxA;
+	}
+}
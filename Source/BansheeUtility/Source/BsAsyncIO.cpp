@@ -0,0 +1,132 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsAsyncIO.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsDebug.h"
+#include "BsMath.h"
+
+namespace BansheeEngine
+{
+	AsyncIO::AsyncIO(UINT32 numThreads)
+		:mShutdown(false), mSyncData(bs_shared_ptr_new<AsyncOpSyncData>())
+	{
+		if (numThreads == 0)
+			numThreads = getDefaultNumThreads();
+
+		for (UINT32 i = 0; i < numThreads; i++)
+			mThreads.push_back(Thread(std::bind(&AsyncIO::runWorker, this)));
+	}
+
+	AsyncIO::~AsyncIO()
+	{
+		{
+			Lock lock(mMutex);
+			mShutdown = true;
+		}
+
+		mRequestSignal.notify_all();
+
+		// Workers finish any queued reads before exiting, so nobody is left waiting on an operation
+		for (auto& thread : mThreads)
+			thread.join();
+	}
+
+	AsyncOp AsyncIO::readFile(const Path& path, UINT64 offset, UINT64 size, const AsyncReadCallback& callback)
+	{
+		ReadRequest* request = bs_new<ReadRequest>();
+		request->path = path;
+		request->offset = offset;
+		request->size = size;
+		request->callback = callback;
+		request->op = AsyncOp(mSyncData);
+
+		AsyncOp op = request->op;
+		{
+			Lock lock(mMutex);
+			mRequests.push(request);
+		}
+
+		mRequestSignal.notify_one();
+		return op;
+	}
+
+	void AsyncIO::runWorker()
+	{
+		while (true)
+		{
+			ReadRequest* request;
+			{
+				Lock lock(mMutex);
+				while (mRequests.empty() && !mShutdown)
+					mRequestSignal.wait(lock);
+
+				if (mRequests.empty())
+					return;
+
+				request = mRequests.front();
+				mRequests.pop();
+			}
+
+			SPtr<MemoryDataStream> data = read(request->path, request->offset, request->size);
+
+			if (request->callback != nullptr)
+				request->callback(data);
+
+			// Complete under the lock, so a thread that just checked the operation cannot miss the notification
+			{
+				Lock lock(mSyncData->mMutex);
+				request->op._completeOperation(data);
+			}
+
+			bs_delete(request);
+		}
+	}
+
+	UINT32 AsyncIO::getDefaultNumThreads()
+	{
+		return Math::clamp((UINT32)BS_THREAD_HARDWARE_CONCURRENCY, 2U, 8U);
+	}
+
+	SPtr<MemoryDataStream> AsyncIO::read(const Path& path, UINT64 offset, UINT64 size)
+	{
+		if (!FileSystem::isFile(path))
+		{
+			LOGWRN("Cannot read file: " + path.toString());
+			return nullptr;
+		}
+
+		SPtr<DataStream> stream = FileSystem::openFile(path, true);
+		if (stream == nullptr)
+			return nullptr;
+
+		UINT64 fileSize = stream->size();
+		offset = std::min(offset, fileSize);
+		size = std::min(size, fileSize - offset);
+
+		if (size > MAX_READ_SIZE)
+		{
+			LOGWRN("Cannot read " + toString(size) + " bytes at once, read size is limited to " +
+				toString(MAX_READ_SIZE) + " bytes. File: " + path.toString());
+			return nullptr;
+		}
+
+		UINT8* buffer = nullptr;
+		if (size > 0)
+		{
+			buffer = (UINT8*)bs_alloc((UINT32)size);
+
+			stream->seek((size_t)offset);
+			size_t numRead = stream->read(buffer, (size_t)size);
+			if (numRead != (size_t)size)
+			{
+				LOGWRN("Unable to read " + toString(size) + " bytes from file: " + path.toString());
+
+				bs_free(buffer);
+				return nullptr;
+			}
+		}
+
+		return bs_shared_ptr_new<MemoryDataStream>(buffer, (size_t)size);
+	}
+}
@@ -12,6 +12,11 @@ namespace BansheeEngine
 	SPtr<SerializedObject> IDiff::generateDiff(const SPtr<SerializedObject>& orgObj,
 		const SPtr<SerializedObject>& newObj)
 	{
+		// Hashing both objects also caches the hashes of all of their child objects, so unchanged child objects are
+		// skipped as well, without being compared field by field
+		if (orgObj != nullptr && newObj != nullptr && orgObj->getHash() == newObj->getHash())
+			return nullptr;
+
 		ObjectMap objectMap;
 		return generateDiff(orgObj, newObj, objectMap);
 	}
@@ -33,8 +38,9 @@ namespace BansheeEngine
 				modification = iterFind->second;
 			else
 			{
+				// Objects with identical contents have no differences
 				RTTITypeBase* childRtti = nullptr;
-				if (orgObjData->getRootTypeId() == newObjData->getRootTypeId())
+				if (orgObjData->getRootTypeId() == newObjData->getRootTypeId() && orgObjData->getHash() != newObjData->getHash())
 					childRtti = IReflectable::_getRTTIfromTypeId(newObjData->getRootTypeId());
 
 				SPtr<SerializedObject> objectDiff;
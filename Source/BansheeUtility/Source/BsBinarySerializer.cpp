@@ -41,7 +41,7 @@ buffer += size;															\
 namespace BansheeEngine
 {
 	BinarySerializer::BinarySerializer()
-		:mLastUsedObjectId(1)
+		:mLastUsedObjectId(1), mDecodeDirect(false)
 	{
 	}
 
@@ -56,7 +56,6 @@ namespace BansheeEngine
 		mTotalBytesWritten = 0;
 		mParams = params;
 
-		Vector<SPtr<IReflectable>> encodedObjects;
 		UINT32 objectId = findOrCreatePersistentId(object);
 		
 		// Encode primary object and its value types
@@ -67,44 +66,27 @@ namespace BansheeEngine
 				"Destination buffer is null or not large enough.");
 		}
 
-		// Encode pointed to objects and their value types
+		// Encode pointed to objects and their value types. Objects are processed in the order they were found in, and
+		// encoding an object may append new ones to the list. Encoded objects are kept in the list until the end so we
+		// keep a reference to them and they aren't released. The system assigns unique IDs to IReflectable objects based 
+		// on pointer addresses but if objects get released then same address could be assigned twice.
 		UnorderedSet<UINT32> serializedObjects;
-		while(true)
+		for(UINT32 i = 0; i < (UINT32)mObjectsToEncode.size(); i++)
 		{
-			auto iter = mObjectsToEncode.begin();
-			bool foundObjectToProcess = false;
-			for(; iter != mObjectsToEncode.end(); ++iter)
-			{
-				auto foundExisting = serializedObjects.find(iter->objectId);
-				if(foundExisting != serializedObjects.end())
-					continue; // Already processed
-
-				SPtr<IReflectable> curObject = iter->object;
-				UINT32 curObjectid = iter->objectId;
-				serializedObjects.insert(curObjectid);
-				mObjectsToEncode.erase(iter);
-
-				buffer = encodeEntry(curObject.get(), curObjectid, buffer, 
-					bufferLength, bytesWritten, flushBufferCallback, shallow);
-				if(buffer == nullptr)
-				{
-					BS_EXCEPT(InternalErrorException, 
-						"Destination buffer is null or not large enough.");
-				}
+			UINT32 curObjectid = mObjectsToEncode[i].objectId;
+			if(!serializedObjects.insert(curObjectid).second)
+				continue; // Already processed
 
-				foundObjectToProcess = true;
+			// Copy the reference, as the list might grow while encoding
+			SPtr<IReflectable> curObject = mObjectsToEncode[i].object;
 
-				// Ensure we keep a reference to the object so it isn't released.
-				// The system assigns unique IDs to IReflectable objects based on pointer 
-				// addresses but if objects get released then same address could be assigned twice.
-				// Note: To get around this I could assign unique IDs to IReflectable objects
-				encodedObjects.push_back(curObject);
-
-				break; // Need to start over as mObjectsToSerialize was possibly modified
+			buffer = encodeEntry(curObject.get(), curObjectid, buffer, 
+				bufferLength, bytesWritten, flushBufferCallback, shallow);
+			if(buffer == nullptr)
+			{
+				BS_EXCEPT(InternalErrorException, 
+					"Destination buffer is null or not large enough.");
 			}
-
-			if(!foundObjectToProcess) // We're done
-				break;
 		}
 
 		// Final flush
@@ -116,7 +98,6 @@ namespace BansheeEngine
 
 		*bytesWritten = mTotalBytesWritten;
 
-		encodedObjects.clear();
 		mObjectsToEncode.clear();
 		mObjectAddrToId.clear();
 	}
@@ -129,9 +110,17 @@ namespace BansheeEngine
 		if (dataLength == 0)
 			return nullptr;
 
+		// Objects that only contain plain fields are fully decoded at this point, and the rest are decoded from their
+		// intermediate representation below
+		mDecodeDirect = true;
 		SPtr<SerializedObject> intermediateObject = _decodeToIntermediate(data, dataLength);
+		mDecodeDirect = false;
+
 		if (intermediateObject == nullptr)
+		{
+			mDirectObjects.clear();
 			return nullptr;
+		}
 
 		return _decodeFromIntermediate(intermediateObject);
 	}
@@ -140,9 +129,21 @@ namespace BansheeEngine
 	{
 		mObjectMap.clear();
 
+		for (auto& entry : mDirectObjects)
+		{
+			auto iterNewObj = mObjectMap.insert(std::make_pair(entry.first, ObjectToDecode(entry.second, entry.first)));
+			iterNewObj.first->second.isDecoded = true;
+		}
+
+		mDirectObjects.clear();
+
 		SPtr<IReflectable> output;
 		RTTITypeBase* type = IReflectable::_getRTTIfromTypeId(serializedObject->getRootTypeId());
-		if (type != nullptr)
+
+		auto iterFind = mObjectMap.find(serializedObject);
+		if (iterFind != mObjectMap.end())
+			output = iterFind->second.object;
+		else if (type != nullptr)
 		{
 			output = type->newRTTIObject();
 			auto iterNewObj = mObjectMap.insert(std::make_pair(serializedObject, ObjectToDecode(output, serializedObject)));
@@ -289,6 +290,45 @@ namespace BansheeEngine
 						{
 							RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
 
+							// Elements of static size are copied in runs, as many as fit in the buffer at once
+							if(!curField->hasDynamicSize())
+							{
+								UINT32 typeSize = curField->getTypeSize();
+
+								UINT32 arrIdx = 0;
+								while(arrIdx < arrayNumElems)
+								{
+									UINT32 numFit = (bufferLength - *bytesWritten) / typeSize;
+									if(numFit > 0)
+									{
+										UINT32 count = std::min(numFit, arrayNumElems - arrIdx);
+										curField->arrayToBuffer(object, arrIdx, count, buffer);
+
+										buffer += count * typeSize;
+										*bytesWritten += count * typeSize;
+										arrIdx += count;
+									}
+									else
+									{
+										UINT8* tempBuffer = (UINT8*)bs_stack_alloc(typeSize);
+										curField->arrayElemToBuffer(object, arrIdx, tempBuffer);
+
+										buffer = dataBlockToBuffer(tempBuffer, typeSize, buffer, bufferLength, bytesWritten, flushBufferCallback);
+										bs_stack_free(tempBuffer);
+
+										if (buffer == nullptr || bufferLength == 0)
+										{
+											si->onSerializationEnded(object, mParams);
+											return nullptr;
+										}
+
+										arrIdx++;
+									}
+								}
+
+								break;
+							}
+
 							for(UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
 							{
 								UINT32 typeSize = 0;
@@ -403,11 +443,7 @@ namespace BansheeEngine
 							COPY_TO_BUFFER(&dataBlockSize, sizeof(UINT32))
 
 							// Data block data
-							UINT8* dataToStore = (UINT8*)bs_stack_alloc(dataBlockSize);
-							blockStream->read(dataToStore, dataBlockSize);
-
-							buffer = dataBlockToBuffer(dataToStore, dataBlockSize, buffer, bufferLength, bytesWritten, flushBufferCallback);
-							bs_stack_free(dataToStore);
+							buffer = dataBlockToBuffer(blockStream, dataBlockSize, buffer, bufferLength, bytesWritten, flushBufferCallback);
 
 							if (buffer == nullptr || bufferLength == 0)
 							{
@@ -483,6 +519,9 @@ namespace BansheeEngine
 			serializedSubObject = &output->subObjects.back();
 
 			serializedSubObject->typeId = objectTypeId;
+
+			if (mDecodeDirect && rtti->_hasOnlyPlainFields())
+				return decodeDirect(data, dataLength, bytesRead, rtti, output);
 		}
 
 		while (bytesRead < dataLength)
@@ -984,8 +1023,17 @@ namespace BansheeEngine
 
 							if (childRtti != nullptr)
 							{
-								SPtr<IReflectable> newObject = childRtti->newRTTIObject();
-								decodeEntry(newObject, arrayElemData);
+								SPtr<IReflectable> newObject;
+
+								auto findObj = mObjectMap.find(arrayElemData);
+								if (findObj != mObjectMap.end())
+									newObject = findObj->second.object;
+								else
+								{
+									newObject = childRtti->newRTTIObject();
+									decodeEntry(newObject, arrayElemData);
+								}
+
 								curField->setArrayValue(object.get(), arrayElem.first, *newObject);
 							}
 						}
@@ -1074,8 +1122,17 @@ namespace BansheeEngine
 
 						if (childRtti != nullptr)
 						{
-							SPtr<IReflectable> newObject = childRtti->newRTTIObject();
-							decodeEntry(newObject, fieldObjectData);
+							SPtr<IReflectable> newObject;
+
+							auto findObj = mObjectMap.find(fieldObjectData);
+							if (findObj != mObjectMap.end())
+								newObject = findObj->second.object;
+							else
+							{
+								newObject = childRtti->newRTTIObject();
+								decodeEntry(newObject, fieldObjectData);
+							}
+
 							curField->setValue(object.get(), *newObject);
 						}
 						break;
@@ -1115,6 +1172,330 @@ namespace BansheeEngine
 		}
 	}
 
+	bool BinarySerializer::decodeDirect(const SPtr<DataStream>& data, UINT32 dataLength, UINT32& bytesRead, 
+		RTTITypeBase* rtti, const SPtr<SerializedObject>& output)
+	{
+		// Data of memory streams is referenced directly, while data of file streams is read into a temporary buffer
+		bool isFile = data->isFile();
+
+		// Skipping over embedded objects of removed fields may recursively decode another object, so the buffers are only
+		// ever appended to, and each call cleans up its own part
+		UINT32 firstSubObject = (UINT32)mDirectSubObjects.size();
+		UINT32 firstField = (UINT32)mDirectFields.size();
+		UINT32 firstData = (UINT32)mDirectData.size();
+
+		RTTITypeBase* objectRtti = rtti;
+		mDirectSubObjects.push_back({ rtti, firstField });
+
+		bool hasMore = false;
+		while (bytesRead < dataLength)
+		{
+			int metaData = -1;
+			if(data->read(&metaData, META_SIZE) != META_SIZE)
+			{
+				BS_EXCEPT(InternalErrorException, "Error decoding data.");
+			}
+
+			if (isObjectMetaData(metaData)) // We've reached a new object or a base class of the current one
+			{
+				ObjectMetaData objMetaData;
+				objMetaData.objectMeta = 0;
+				objMetaData.typeId = 0;
+
+				data->seek(data->tell() - META_SIZE);
+				if (data->read(&objMetaData, sizeof(ObjectMetaData)) != sizeof(ObjectMetaData))
+				{
+					BS_EXCEPT(InternalErrorException, "Error decoding data.");
+				}
+
+				UINT32 objId = 0;
+				UINT32 objTypeId = 0;
+				bool objIsBaseClass = false;
+				decodeObjectMetaData(objMetaData, objId, objTypeId, objIsBaseClass);
+
+				// Found new object, we're done
+				if (!objIsBaseClass)
+				{
+					data->seek(data->tell() - sizeof(ObjectMetaData));
+					hasMore = true;
+					break;
+				}
+
+				if (rtti != nullptr)
+					rtti = rtti->getBaseClass();
+
+				// Saved and current base classes don't match, so just skip over all that data
+				if (rtti == nullptr || rtti->getRTTIId() != objTypeId)
+					rtti = nullptr;
+
+				if (rtti != nullptr)
+					mDirectSubObjects.push_back({ rtti, (UINT32)mDirectFields.size() });
+
+				bytesRead += sizeof(ObjectMetaData);
+				continue;
+			}
+
+			bytesRead += META_SIZE;
+
+			bool isArray;
+			SerializableFieldType fieldType;
+			UINT16 fieldId;
+			UINT8 fieldSize;
+			bool hasDynamicSize;
+			bool terminator;
+			decodeFieldMetaData(metaData, fieldId, fieldSize, isArray, fieldType, hasDynamicSize, terminator);
+
+			if (terminator)
+				break;
+
+			RTTIField* curGenericField = nullptr;
+			UINT32 fieldIdx = 0;
+
+			if (rtti != nullptr)
+			{
+				UINT32 numFields = rtti->getNumFields();
+				for (; fieldIdx < numFields; fieldIdx++)
+				{
+					RTTIField* field = rtti->getField(fieldIdx);
+					if (field->mUniqueId == fieldId)
+					{
+						curGenericField = field;
+						break;
+					}
+				}
+			}
+
+			if (curGenericField != nullptr)
+			{
+				if (!hasDynamicSize && curGenericField->getTypeSize() != fieldSize)
+				{
+					BS_EXCEPT(InternalErrorException,
+						"Data type mismatch. Type size stored in file and actual type size don't match. ("
+						+ toString(curGenericField->getTypeSize()) + " vs. " + toString(fieldSize) + ")");
+				}
+
+				if (curGenericField->mIsVectorType != isArray)
+				{
+					BS_EXCEPT(InternalErrorException,
+						"Data type mismatch. One is array, other is a single type.");
+				}
+
+				if (curGenericField->mType != fieldType)
+				{
+					BS_EXCEPT(InternalErrorException,
+						"Data type mismatch. Field types don't match. " + toString(UINT32(curGenericField->mType)) + " vs. " + toString(UINT32(fieldType)));
+				}
+			}
+
+			UINT32 arrayNumElems = 1;
+			if (isArray)
+			{
+				if(data->read(&arrayNumElems, NUM_ELEM_FIELD_SIZE) != NUM_ELEM_FIELD_SIZE)
+				{
+					BS_EXCEPT(InternalErrorException, "Error decoding data.");
+				}
+
+				bytesRead += NUM_ELEM_FIELD_SIZE;
+			}
+
+			switch (fieldType)
+			{
+			case SerializableFT_Plain:
+			{
+				bool readData = isFile && curGenericField != nullptr;
+				UINT32 offset = isFile ? (UINT32)mDirectData.size() : (UINT32)data->tell();
+
+				UINT32 dataSize = 0;
+				if (!hasDynamicSize)
+				{
+					UINT64 totalSize = (UINT64)fieldSize * arrayNumElems;
+					if (totalSize > dataLength - bytesRead)
+					{
+						BS_EXCEPT(InternalErrorException, "Error decoding data.");
+					}
+
+					dataSize = (UINT32)totalSize;
+					if (readData && dataSize > 0)
+					{
+						mDirectData.resize(offset + dataSize);
+						if (data->read(&mDirectData[offset], dataSize) != dataSize)
+						{
+							BS_EXCEPT(InternalErrorException, "Error decoding data.");
+						}
+					}
+					else
+						data->skip(dataSize);
+				}
+				else
+				{
+					for (UINT32 i = 0; i < arrayNumElems; i++)
+					{
+						UINT32 typeSize = 0;
+						data->read(&typeSize, sizeof(UINT32));
+						data->seek(data->tell() - sizeof(UINT32));
+
+						if (typeSize < sizeof(UINT32) || typeSize > dataLength - bytesRead - dataSize)
+						{
+							BS_EXCEPT(InternalErrorException, "Error decoding data.");
+						}
+
+						if (readData)
+						{
+							mDirectData.resize(offset + dataSize + typeSize);
+							if (data->read(&mDirectData[offset + dataSize], typeSize) != typeSize)
+							{
+								BS_EXCEPT(InternalErrorException, "Error decoding data.");
+							}
+						}
+						else
+							data->skip(typeSize);
+
+						dataSize += typeSize;
+					}
+				}
+
+				bytesRead += dataSize;
+
+				if (curGenericField != nullptr)
+					mDirectFields.push_back({ curGenericField, fieldIdx, offset, dataSize, arrayNumElems });
+
+				break;
+			}
+			case SerializableFT_DataBlock:
+			{
+				// Data block size
+				UINT32 dataBlockSize = 0;
+				if(data->read(&dataBlockSize, DATA_BLOCK_TYPE_FIELD_SIZE) != DATA_BLOCK_TYPE_FIELD_SIZE)
+				{
+					BS_EXCEPT(InternalErrorException, "Error decoding data.");
+				}
+
+				bytesRead += DATA_BLOCK_TYPE_FIELD_SIZE;
+
+				// Data block data, passed to the field setter as a part of the source stream
+				if (curGenericField != nullptr)
+					mDirectFields.push_back({ curGenericField, fieldIdx, (UINT32)data->tell(), dataBlockSize, 1 });
+
+				data->skip(dataBlockSize);
+				bytesRead += dataBlockSize;
+
+				break;
+			}
+			case SerializableFT_ReflectablePtr:
+			{
+				// Only stored by fields that were since removed, so just skip the object IDs
+				data->skip(COMPLEX_TYPE_FIELD_SIZE * arrayNumElems);
+				bytesRead += COMPLEX_TYPE_FIELD_SIZE * arrayNumElems;
+
+				break;
+			}
+			case SerializableFT_Reflectable:
+			{
+				// Only stored by fields that were since removed, but the objects must be parsed in order to skip them
+				for (UINT32 i = 0; i < arrayNumElems; i++)
+				{
+					SPtr<SerializedObject> skippedObject;
+					decodeEntry(data, dataLength, bytesRead, skippedObject, isFile, isFile);
+				}
+
+				break;
+			}
+			default:
+				BS_EXCEPT(InternalErrorException,
+					"Error decoding data. Encountered a type I don't know how to decode. Type: " + toString(UINT32(fieldType)) +
+					", Is array: " + toString(isArray));
+			}
+		}
+
+		// Apply the fields in the same order as decodeEntry() does, starting with the base-most class
+		SPtr<IReflectable> object = objectRtti->newRTTIObject();
+
+		UINT8* fieldData;
+		if (isFile)
+			fieldData = mDirectData.data();
+		else
+			fieldData = static_cast<MemoryDataStream*>(data.get())->getPtr();
+
+		UINT32 lastSubObject = (UINT32)mDirectSubObjects.size();
+		for (UINT32 i = lastSubObject; i > firstSubObject; i--)
+		{
+			const DirectSubObject& subObject = mDirectSubObjects[i - 1];
+
+			UINT32 lastField;
+			if (i < lastSubObject)
+				lastField = mDirectSubObjects[i].firstField;
+			else
+				lastField = (UINT32)mDirectFields.size();
+
+			subObject.rtti->onDeserializationStarted(object.get(), mParams);
+			applyDirectFields(object.get(), fieldData, data, subObject.firstField, lastField);
+		}
+
+		for (UINT32 i = lastSubObject; i > firstSubObject; i--)
+			mDirectSubObjects[i - 1].rtti->onDeserializationEnded(object.get(), mParams);
+
+		mDirectSubObjects.resize(firstSubObject);
+		mDirectFields.resize(firstField);
+		mDirectData.resize(firstData);
+
+		mDirectObjects[output] = object;
+		return hasMore;
+	}
+
+	void BinarySerializer::applyDirectFields(IReflectable* object, UINT8* fieldData, const SPtr<DataStream>& data,
+		UINT32 firstField, UINT32 lastField)
+	{
+		// Fields are set in the order they were registered in, rather than the order they were stored in
+		std::stable_sort(mDirectFields.begin() + firstField, mDirectFields.begin() + lastField,
+			[](const DirectField& a, const DirectField& b) { return a.fieldIdx < b.fieldIdx; });
+
+		for (UINT32 i = firstField; i < lastField; i++)
+		{
+			const DirectField& entry = mDirectFields[i];
+
+			// If the same field was stored more than once, only the first value is used
+			if (i > firstField && mDirectFields[i - 1].fieldIdx == entry.fieldIdx)
+				continue;
+
+			if (entry.field->mType == SerializableFT_DataBlock)
+			{
+				RTTIManagedDataBlockFieldBase* curField = static_cast<RTTIManagedDataBlockFieldBase*>(entry.field);
+
+				// Setter may read from the stream, so restore its position for the objects that follow
+				size_t position = data->tell();
+				data->seek(entry.offset);
+				curField->setValue(object, data, entry.size);
+				data->seek(position);
+
+				continue;
+			}
+
+			RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(entry.field);
+			UINT8* value = fieldData + entry.offset;
+
+			if (curField->mIsVectorType)
+			{
+				curField->setArraySize(object, entry.numElements);
+
+				if (!curField->hasDynamicSize())
+					curField->arrayFromBuffer(object, 0, entry.numElements, value);
+				else
+				{
+					for (UINT32 arrIdx = 0; arrIdx < entry.numElements; arrIdx++)
+					{
+						curField->arrayElemFromBuffer(object, arrIdx, value);
+
+						UINT32 elemSize = 0;
+						memcpy(&elemSize, value, sizeof(UINT32));
+						value += elemSize;
+					}
+				}
+			}
+			else
+				curField->fromBuffer(object, value);
+		}
+	}
+
 	UINT32 BinarySerializer::encodeFieldMetaData(UINT16 id, UINT8 size, bool array, 
 		SerializableFieldType type, bool hasDynamicSize, bool terminator)
 	{
@@ -1252,6 +1633,48 @@ namespace BansheeEngine
 		return buffer;
 	}
 
+	UINT8* BinarySerializer::dataBlockToBuffer(const SPtr<DataStream>& data, UINT32 size, UINT8* buffer, UINT32& bufferLength, 
+		UINT32* bytesWritten, std::function<UINT8*(UINT8* buffer, UINT32 bytesWritten, UINT32& newBufferSize)> flushBufferCallback)
+	{
+		UINT32 remainingSize = size;
+		bool streamEnded = false;
+		while (remainingSize > 0)
+		{
+			UINT32 remainingSpaceInBuffer = bufferLength - *bytesWritten;
+			if (remainingSpaceInBuffer == 0)
+			{
+				mTotalBytesWritten += *bytesWritten;
+				buffer = flushBufferCallback(buffer - *bytesWritten, *bytesWritten, bufferLength);
+				if (buffer == nullptr || bufferLength == 0)
+					return nullptr;
+
+				*bytesWritten = 0;
+				continue;
+			}
+
+			UINT32 readSize = std::min(remainingSize, remainingSpaceInBuffer);
+			UINT32 numRead = streamEnded ? 0 : (UINT32)data->read(buffer, readSize);
+
+			// Keep the output layout intact even if the stream ends early
+			if (numRead < readSize)
+			{
+				if (!streamEnded)
+				{
+					LOGWRN("Data block stream ended before the reported block size was read.");
+					streamEnded = true;
+				}
+
+				memset(buffer + numRead, 0, readSize - numRead);
+			}
+
+			buffer += readSize;
+			*bytesWritten += readSize;
+			remainingSize -= readSize;
+		}
+
+		return buffer;
+	}
+
 	UINT32 BinarySerializer::findOrCreatePersistentId(IReflectable* object)
 	{
 		void* ptrAddress = (void*)object;
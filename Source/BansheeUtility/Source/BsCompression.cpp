@@ -0,0 +1,434 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsCompression.h"
+#include "BsDataStream.h"
+#include "BsTaskScheduler.h"
+
+namespace BansheeEngine
+{
+	/** Minimum length of a match, in bytes. Stored match lengths are relative to it. */
+	static const UINT32 LZ4_MIN_MATCH = 4;
+
+	/** Number of bytes at the end of the input that are always stored as literals. */
+	static const UINT32 LZ4_LAST_LITERALS = 5;
+
+	/** Minimum distance of the start of the last match from the end of the input, in bytes. */
+	static const UINT32 LZ4_MF_LIMIT = 12;
+
+	/** Largest offset of a match that can be encoded. */
+	static const UINT32 LZ4_MAX_OFFSET = 65535;
+
+	/** Number of bits used for indexing the match finder hash table. */
+	static const UINT32 LZ4_HASH_BITS = 12;
+
+	/** Determines how fast the match finder skips over data that doesn't contain any matches. */
+	static const UINT32 LZ4_SKIP_STRENGTH = 6;
+
+	/** Flag in the stored size of a block chunk, signifying the chunk is stored uncompressed. */
+	static const UINT32 CHUNK_RAW_FLAG = 0x80000000;
+
+	/** Header at the start of every block created by Compression::compressBlock(). */
+	struct CompressedBlockHeader
+	{
+		UINT32 type;
+		UINT32 size; /**< Size of the data before compression, in bytes. */
+		UINT32 chunkSize;
+		UINT32 numChunks;
+	};
+
+	/** Reads four bytes from a potentially unaligned address. */
+	static UINT32 readLZ4Sequence(const UINT8* ptr)
+	{
+		UINT32 value;
+		memcpy(&value, ptr, sizeof(value));
+
+		return value;
+	}
+
+	/** Maps a four byte sequence to an entry in the match finder hash table. */
+	static UINT32 hashLZ4Sequence(UINT32 sequence)
+	{
+		return (sequence * 2654435761U) >> (32 - LZ4_HASH_BITS);
+	}
+
+	/** Writes the remainder of a literal or match length that doesn't fit in the sequence token. */
+	static UINT8* writeLZ4Length(UINT8* op, size_t length)
+	{
+		for (; length >= 255; length -= 255)
+			*op++ = 255;
+
+		*op++ = (UINT8)length;
+		return op;
+	}
+
+	/**
+	 * Reads the remainder of a literal or match length that doesn't fit in the sequence token. Returns false if the input
+	 * ends before the length does.
+	 */
+	static bool readLZ4Length(const UINT8*& ip, const UINT8* iend, size_t& length)
+	{
+		UINT8 value;
+		do
+		{
+			if (ip >= iend)
+				return false;
+
+			value = *ip++;
+			length += value;
+		} while (value == 255);
+
+		return true;
+	}
+
+	/** Returns the number of bytes required for encoding a sequence, in the worst case. */
+	static size_t getLZ4SequenceBound(size_t numLiterals, size_t matchLength)
+	{
+		return 1 + (numLiterals / 255 + 1) + numLiterals + 2 + (matchLength / 255 + 1);
+	}
+
+	UINT32 Compression::compressLZ4(const UINT8* input, UINT32 inputSize, UINT8* output, UINT32 outputCapacity)
+	{
+		const UINT8* ip = input;
+		const UINT8* anchor = input;
+		const UINT8* iend = input + inputSize;
+
+		UINT8* op = output;
+		UINT8* oend = output + outputCapacity;
+
+		if (inputSize > LZ4_MF_LIMIT)
+		{
+			const UINT8* mflimit = iend - LZ4_MF_LIMIT;
+			const UINT8* matchlimit = iend - LZ4_LAST_LITERALS;
+
+			// Positions relative to the input. Unused entries point to the start of the input, which is fine as every
+			// candidate is verified before being used.
+			UINT32 hashTable[1 << LZ4_HASH_BITS];
+			memset(hashTable, 0, sizeof(hashTable));
+
+			ip++;
+			while (ip < mflimit)
+			{
+				UINT32 sequence = readLZ4Sequence(ip);
+				UINT32 hash = hashLZ4Sequence(sequence);
+
+				const UINT8* match = input + hashTable[hash];
+				hashTable[hash] = (UINT32)(ip - input);
+
+				if (match >= ip || (UINT32)(ip - match) > LZ4_MAX_OFFSET || readLZ4Sequence(match) != sequence)
+				{
+					// Move faster the longer we go without finding a match, as the data is likely incompressible
+					ip += 1 + ((ip - anchor) >> LZ4_SKIP_STRENGTH);
+					continue;
+				}
+
+				while (ip > anchor && match > input && ip[-1] == match[-1])
+				{
+					ip--;
+					match--;
+				}
+
+				const UINT8* matchEnd = ip + LZ4_MIN_MATCH;
+				const UINT8* matchSrc = match + LZ4_MIN_MATCH;
+				while (matchEnd < matchlimit && *matchEnd == *matchSrc)
+				{
+					matchEnd++;
+					matchSrc++;
+				}
+
+				size_t numLiterals = ip - anchor;
+				size_t matchLength = matchEnd - ip - LZ4_MIN_MATCH;
+				if (getLZ4SequenceBound(numLiterals, matchLength) > (size_t)(oend - op))
+					return 0;
+
+				UINT8* token = op++;
+				if (numLiterals >= 15)
+				{
+					*token = 15 << 4;
+					op = writeLZ4Length(op, numLiterals - 15);
+				}
+				else
+					*token = (UINT8)(numLiterals << 4);
+
+				memcpy(op, anchor, numLiterals);
+				op += numLiterals;
+
+				UINT32 offset = (UINT32)(ip - match);
+				*op++ = (UINT8)offset;
+				*op++ = (UINT8)(offset >> 8);
+
+				if (matchLength >= 15)
+				{
+					*token |= 15;
+					op = writeLZ4Length(op, matchLength - 15);
+				}
+				else
+					*token |= (UINT8)matchLength;
+
+				// Register a position near the end of the match, as the next match is likely to continue from it
+				const UINT8* last = matchEnd - 2;
+				hashTable[hashLZ4Sequence(readLZ4Sequence(last))] = (UINT32)(last - input);
+
+				ip = matchEnd;
+				anchor = matchEnd;
+			}
+		}
+
+		// Remaining data is stored in a sequence containing only literals
+		size_t numLiterals = iend - anchor;
+		if (1 + (numLiterals / 255 + 1) + numLiterals > (size_t)(oend - op))
+			return 0;
+
+		if (numLiterals >= 15)
+		{
+			*op++ = 15 << 4;
+			op = writeLZ4Length(op, numLiterals - 15);
+		}
+		else
+			*op++ = (UINT8)(numLiterals << 4);
+
+		memcpy(op, anchor, numLiterals);
+		op += numLiterals;
+
+		return (UINT32)(op - output);
+	}
+
+	bool Compression::decompressLZ4(const UINT8* input, UINT32 inputSize, UINT8* output, UINT32 outputSize)
+	{
+		const UINT8* ip = input;
+		const UINT8* iend = input + inputSize;
+
+		UINT8* op = output;
+		UINT8* oend = output + outputSize;
+
+		while (true)
+		{
+			if (ip >= iend)
+				return false;
+
+			UINT32 token = *ip++;
+
+			size_t numLiterals = token >> 4;
+			if (numLiterals == 15)
+			{
+				if (!readLZ4Length(ip, iend, numLiterals))
+					return false;
+			}
+
+			if (numLiterals > (size_t)(iend - ip) || numLiterals > (size_t)(oend - op))
+				return false;
+
+			// Short literal runs are copied with a single fixed size copy when there is enough room past their end, as
+			// that is much faster than a variable sized copy
+			if (numLiterals <= 16 && (oend - op) >= 16 && (iend - ip) >= 16)
+				memcpy(op, ip, 16);
+			else
+				memcpy(op, ip, numLiterals);
+
+			op += numLiterals;
+			ip += numLiterals;
+
+			// Last sequence has no match
+			if (ip == iend)
+				break;
+
+			if (iend - ip < 2)
+				return false;
+
+			size_t offset = ip[0] | (ip[1] << 8);
+			ip += 2;
+
+			if (offset == 0 || offset > (size_t)(op - output))
+				return false;
+
+			size_t matchLength = token & 15;
+			if (matchLength == 15)
+			{
+				if (!readLZ4Length(ip, iend, matchLength))
+					return false;
+			}
+
+			matchLength += LZ4_MIN_MATCH;
+			if (matchLength > (size_t)(oend - op))
+				return false;
+
+			// Matches may overlap the data they're written to, in which case they repeat the last 'offset' bytes
+			const UINT8* match = op - offset;
+			if (offset >= 8 && (size_t)(oend - op) >= matchLength + 8)
+			{
+				// Copy in eight byte steps, possibly past the end of the match. Each step only reads bytes that were
+				// already written.
+				for (size_t i = 0; i < matchLength; i += 8)
+					memcpy(op + i, match + i, 8);
+			}
+			else if (offset >= matchLength)
+				memcpy(op, match, matchLength);
+			else
+			{
+				for (size_t i = 0; i < matchLength; i++)
+					op[i] = match[i];
+			}
+
+			op += matchLength;
+		}
+
+		return op == oend;
+	}
+
+	SPtr<MemoryDataStream> Compression::compressBlock(const UINT8* data, UINT32 size, CompressionType type,
+		UINT32 chunkSize)
+	{
+		assert(chunkSize > 0 && chunkSize < CHUNK_RAW_FLAG);
+
+		UINT32 numChunks = (UINT32)(((UINT64)size + chunkSize - 1) / chunkSize);
+		UINT32 tableSize = numChunks * sizeof(UINT32);
+
+		// Chunks are first compressed into their own slots, so they can be compressed in parallel, then packed together.
+		// Chunks that don't compress to less than their original size are stored as is, so no slot needs to be any larger.
+		UINT8* scratch = (UINT8*)bs_alloc(std::max(size, 1U));
+		Vector<UINT32> storedSizes(numChunks);
+
+		auto compressChunks = [&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+			{
+				UINT32 offset = i * chunkSize;
+				UINT32 chunkLength = std::min(chunkSize, size - offset);
+
+				UINT32 compressedSize = 0;
+				if (type == CompressionType::LZ4)
+					compressedSize = compressLZ4(data + offset, chunkLength, scratch + offset, chunkLength - 1);
+
+				if (compressedSize > 0)
+					storedSizes[i] = compressedSize;
+				else
+				{
+					memcpy(scratch + offset, data + offset, chunkLength);
+					storedSizes[i] = chunkLength | CHUNK_RAW_FLAG;
+				}
+			}
+		};
+
+		if (numChunks > 1 && TaskScheduler::isStarted())
+			TaskScheduler::instance().parallelFor(0, numChunks, 1, compressChunks);
+		else
+			compressChunks(0, numChunks);
+
+		UINT32 totalSize = sizeof(CompressedBlockHeader) + tableSize;
+		for (auto& storedSize : storedSizes)
+			totalSize += storedSize & ~CHUNK_RAW_FLAG;
+
+		UINT8* block = (UINT8*)bs_alloc(totalSize);
+
+		CompressedBlockHeader header;
+		header.type = (UINT32)type;
+		header.size = size;
+		header.chunkSize = chunkSize;
+		header.numChunks = numChunks;
+
+		memcpy(block, &header, sizeof(header));
+		if (numChunks > 0)
+			memcpy(block + sizeof(header), &storedSizes[0], tableSize);
+
+		UINT8* dst = block + sizeof(header) + tableSize;
+		for (UINT32 i = 0; i < numChunks; i++)
+		{
+			UINT32 storedSize = storedSizes[i] & ~CHUNK_RAW_FLAG;
+			memcpy(dst, scratch + i * chunkSize, storedSize);
+			dst += storedSize;
+		}
+
+		bs_free(scratch);
+		return bs_shared_ptr_new<MemoryDataStream>(block, totalSize);
+	}
+
+	UINT32 Compression::getUncompressedSize(const UINT8* block, UINT32 blockSize)
+	{
+		if (blockSize < sizeof(CompressedBlockHeader))
+			return 0;
+
+		CompressedBlockHeader header;
+		memcpy(&header, block, sizeof(header));
+
+		return header.size;
+	}
+
+	bool Compression::decompressBlock(const UINT8* block, UINT32 blockSize, UINT8* output, UINT32 outputSize)
+	{
+		if (blockSize < sizeof(CompressedBlockHeader))
+			return false;
+
+		CompressedBlockHeader header;
+		memcpy(&header, block, sizeof(header));
+
+		if (header.type != (UINT32)CompressionType::None && header.type != (UINT32)CompressionType::LZ4)
+			return false;
+
+		if (header.size != outputSize || header.chunkSize == 0)
+			return false;
+
+		if (header.numChunks != (UINT32)(((UINT64)header.size + header.chunkSize - 1) / header.chunkSize))
+			return false;
+
+		UINT64 tableSize = (UINT64)header.numChunks * sizeof(UINT32);
+		if (tableSize > blockSize - sizeof(header))
+			return false;
+
+		// Find where each chunk starts, making sure they're all within the block
+		const UINT8* table = block + sizeof(header);
+		Vector<UINT32> chunkOffsets(header.numChunks);
+
+		UINT64 offset = sizeof(header) + tableSize;
+		for (UINT32 i = 0; i < header.numChunks; i++)
+		{
+			UINT32 storedSize;
+			memcpy(&storedSize, table + i * sizeof(UINT32), sizeof(storedSize));
+
+			chunkOffsets[i] = (UINT32)offset;
+			offset += storedSize & ~CHUNK_RAW_FLAG;
+		}
+
+		if (offset > blockSize)
+			return false;
+
+		std::atomic<bool> failed(false);
+		auto decompressChunks = [&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+			{
+				UINT32 storedSize;
+				memcpy(&storedSize, table + i * sizeof(UINT32), sizeof(storedSize));
+
+				UINT32 dstOffset = i * header.chunkSize;
+				UINT32 chunkLength = std::min(header.chunkSize, header.size - dstOffset);
+				const UINT8* src = block + chunkOffsets[i];
+
+				if ((storedSize & CHUNK_RAW_FLAG) != 0)
+				{
+					if ((storedSize & ~CHUNK_RAW_FLAG) != chunkLength)
+					{
+						failed = true;
+						return;
+					}
+
+					memcpy(output + dstOffset, src, chunkLength);
+				}
+				else
+				{
+					if (header.type != (UINT32)CompressionType::LZ4 ||
+						!decompressLZ4(src, storedSize, output + dstOffset, chunkLength))
+					{
+						failed = true;
+						return;
+					}
+				}
+			}
+		};
+
+		if (header.numChunks > 1 && TaskScheduler::isStarted())
+			TaskScheduler::instance().parallelFor(0, header.numChunks, 1, decompressChunks);
+		else
+			decompressChunks(0, header.numChunks);
+
+		return !failed;
+	}
+}
@@ -0,0 +1,278 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsCompressionTestSuite.h"
+
+#include "BsCompression.h"
+#include "BsDataStream.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * Generates test data with a mix of repeating runs, short repeating patterns and noise, so all the paths of the
+	 * compressor are exercised.
+	 */
+	Vector<UINT8> generateCompressionData(UINT32 size, UINT32 seed)
+	{
+		Vector<UINT8> data(size);
+
+		UINT32 state = seed * 747796405U + 1;
+		auto random = [&state]()
+		{
+			state = state * 1664525U + 1013904223U;
+			return state >> 16;
+		};
+
+		UINT32 i = 0;
+		while (i < size)
+		{
+			UINT32 length = std::min(size - i, 1 + random() % 300);
+			switch (random() % 3)
+			{
+			case 0: // Run of a single value
+				memset(&data[i], random() & 0xFF, length);
+				break;
+			case 1: // Short repeating pattern
+			{
+				UINT32 period = 1 + random() % 12;
+				for (UINT32 j = 0; j < length; j++)
+					data[i + j] = (UINT8)((j % period) * 31 + period);
+			}
+				break;
+			default: // Noise
+				for (UINT32 j = 0; j < length; j++)
+					data[i + j] = (UINT8)random();
+				break;
+			}
+
+			i += length;
+		}
+
+		return data;
+	}
+
+	/** Compresses the data with LZ4 and checks that it decompresses back to the original. */
+	bool roundtripLZ4(const Vector<UINT8>& data, UINT32* compressedSize = nullptr)
+	{
+		UINT32 size = (UINT32)data.size();
+		const UINT8* input = size > 0 ? &data[0] : nullptr;
+
+		Vector<UINT8> compressed(Compression::getLZ4Bound(size));
+		UINT32 numCompressed = Compression::compressLZ4(input, size, &compressed[0], (UINT32)compressed.size());
+		if (numCompressed == 0)
+			return false;
+
+		if (compressedSize != nullptr)
+			*compressedSize = numCompressed;
+
+		Vector<UINT8> output(size + 1);
+		if (!Compression::decompressLZ4(&compressed[0], numCompressed, &output[0], size))
+			return false;
+
+		// Decompressed size must match exactly
+		if (size > 0 && Compression::decompressLZ4(&compressed[0], numCompressed, &output[0], size - 1))
+			return false;
+
+		if (Compression::decompressLZ4(&compressed[0], numCompressed, &output[0], size + 1))
+			return false;
+
+		return size == 0 || memcmp(&output[0], &data[0], size) == 0;
+	}
+
+	CompressionTestSuite::CompressionTestSuite()
+	{
+		BS_ADD_TEST(CompressionTestSuite::testLZ4);
+		BS_ADD_TEST(CompressionTestSuite::testLZ4_corrupt);
+		BS_ADD_TEST(CompressionTestSuite::testBlock);
+		BS_ADD_TEST(CompressionTestSuite::testBlock_corrupt);
+		BS_ADD_TEST(CompressionTestSuite::testBlock_benchmark);
+	}
+
+	void CompressionTestSuite::testLZ4()
+	{
+		BS_TEST_ASSERT(roundtripLZ4(Vector<UINT8>()));
+
+		for (UINT32 size = 1; size < 64; size++)
+			BS_TEST_ASSERT(roundtripLZ4(generateCompressionData(size, size)));
+
+		for (UINT32 seed = 0; seed < 8; seed++)
+			BS_TEST_ASSERT(roundtripLZ4(generateCompressionData(100000, seed)));
+
+		// Long runs produce matches overlapping their own output, with lengths spanning many extra length bytes
+		UINT32 compressedSize = 0;
+		Vector<UINT8> zeroes(200000, 0);
+		BS_TEST_ASSERT(roundtripLZ4(zeroes, &compressedSize));
+		BS_TEST_ASSERT(compressedSize < 1000);
+
+		// Incompressible data must fit within the bound
+		Vector<UINT8> noise(100000);
+		UINT32 state = 12345;
+		for (auto& entry : noise)
+		{
+			state = state * 1664525U + 1013904223U;
+			entry = (UINT8)(state >> 24);
+		}
+
+		BS_TEST_ASSERT(roundtripLZ4(noise, &compressedSize));
+		BS_TEST_ASSERT(compressedSize <= Compression::getLZ4Bound((UINT32)noise.size()));
+
+		// Compression must fail rather than overflow the output buffer
+		Vector<UINT8> output(100);
+		BS_TEST_ASSERT(Compression::compressLZ4(&noise[0], (UINT32)noise.size(), &output[0], (UINT32)output.size()) == 0);
+	}
+
+	void CompressionTestSuite::testLZ4_corrupt()
+	{
+		Vector<UINT8> data = generateCompressionData(50000, 3);
+		Vector<UINT8> compressed(Compression::getLZ4Bound((UINT32)data.size()));
+		UINT32 compressedSize = Compression::compressLZ4(&data[0], (UINT32)data.size(), &compressed[0],
+			(UINT32)compressed.size());
+
+		Vector<UINT8> output(data.size());
+
+		// Truncated input
+		for (UINT32 size = 0; size < compressedSize; size += 97)
+			BS_TEST_ASSERT(!Compression::decompressLZ4(&compressed[0], size, &output[0], (UINT32)output.size()));
+
+		// Match referencing data before the start of the output
+		UINT8 invalidOffset[] = { 0x10, 'a', 0x10, 0x00, 0x00 };
+		BS_TEST_ASSERT(!Compression::decompressLZ4(invalidOffset, sizeof(invalidOffset), &output[0], 5));
+
+		// Corrupted bytes must never cause reads or writes out of bounds, even when they go undetected
+		UINT32 state = 777;
+		for (UINT32 i = 0; i < 1000; i++)
+		{
+			Vector<UINT8> corrupted(compressed.begin(), compressed.begin() + compressedSize);
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				state = state * 1664525U + 1013904223U;
+				corrupted[(state >> 8) % compressedSize] = (UINT8)(state >> 24);
+			}
+
+			Compression::decompressLZ4(&corrupted[0], compressedSize, &output[0], (UINT32)output.size());
+		}
+	}
+
+	void CompressionTestSuite::testBlock()
+	{
+		Vector<UINT8> data = generateCompressionData(1000000, 7);
+
+		// Last chunk is partial
+		const UINT32 CHUNK_SIZE = 64 * 1024;
+		SPtr<MemoryDataStream> block = Compression::compressBlock(&data[0], (UINT32)data.size(), CompressionType::LZ4,
+			CHUNK_SIZE);
+
+		BS_TEST_ASSERT(block->size() < data.size());
+		BS_TEST_ASSERT(Compression::getUncompressedSize(block->getPtr(), (UINT32)block->size()) == data.size());
+
+		Vector<UINT8> output(data.size());
+		BS_TEST_ASSERT(Compression::decompressBlock(block->getPtr(), (UINT32)block->size(), &output[0],
+			(UINT32)output.size()));
+		BS_TEST_ASSERT(output == data);
+
+		// Uncompressed blocks only add the header and the chunk table
+		SPtr<MemoryDataStream> rawBlock = Compression::compressBlock(&data[0], (UINT32)data.size(), CompressionType::None,
+			CHUNK_SIZE);
+
+		BS_TEST_ASSERT(rawBlock->size() < data.size() + 128 + sizeof(UINT32) * (data.size() / CHUNK_SIZE));
+
+		memset(&output[0], 0, output.size());
+		BS_TEST_ASSERT(Compression::decompressBlock(rawBlock->getPtr(), (UINT32)rawBlock->size(), &output[0],
+			(UINT32)output.size()));
+		BS_TEST_ASSERT(output == data);
+
+		// Empty data
+		SPtr<MemoryDataStream> emptyBlock = Compression::compressBlock(nullptr, 0, CompressionType::LZ4);
+		BS_TEST_ASSERT(Compression::getUncompressedSize(emptyBlock->getPtr(), (UINT32)emptyBlock->size()) == 0);
+		BS_TEST_ASSERT(Compression::decompressBlock(emptyBlock->getPtr(), (UINT32)emptyBlock->size(), nullptr, 0));
+	}
+
+	void CompressionTestSuite::testBlock_corrupt()
+	{
+		Vector<UINT8> data = generateCompressionData(300000, 11);
+		SPtr<MemoryDataStream> block = Compression::compressBlock(&data[0], (UINT32)data.size(), CompressionType::LZ4,
+			32 * 1024);
+
+		Vector<UINT8> output(data.size());
+		BS_TEST_ASSERT(!Compression::decompressBlock(block->getPtr(), (UINT32)block->size(), &output[0],
+			(UINT32)output.size() - 1));
+
+		for (UINT32 size = 0; size < block->size(); size += 1009)
+		{
+			BS_TEST_ASSERT(!Compression::decompressBlock(block->getPtr(), size, &output[0],
+				(UINT32)output.size()));
+		}
+
+		// Chunk table entries pointing past the end of the block
+		Vector<UINT8> corrupted(block->getPtr(), block->getPtr() + block->size());
+		UINT32 invalidSize = 0x7FFFFFFF;
+		memcpy(&corrupted[sizeof(UINT32) * 4], &invalidSize, sizeof(invalidSize));
+
+		BS_TEST_ASSERT(!Compression::decompressBlock(&corrupted[0], (UINT32)corrupted.size(), &output[0],
+			(UINT32)output.size()));
+	}
+
+	void CompressionTestSuite::testBlock_benchmark()
+	{
+		static const UINT32 DATA_SIZE = 16 * 1024 * 1024;
+		static const UINT32 NUM_ITERATIONS = 4;
+
+		// Half text-like data (source files, shaders, serialized names), half the mixed runs, patterns and noise
+		String text;
+		for (UINT32 i = 0; text.size() < DATA_SIZE / 2; i++)
+		{
+			text += "\t\tUINT32 value" + toString(i % 97) + " = getValue(" + toString(i % 13) + ", mData[" +
+				toString(i) + "]);\n";
+		}
+
+		Vector<UINT8> data = generateCompressionData(DATA_SIZE, 5);
+		memcpy(&data[0], text.data(), DATA_SIZE / 2);
+
+		// Throughput in MB/s, of the uncompressed data
+		auto throughput = [](UINT64 time) { return (UINT64)DATA_SIZE * NUM_ITERATIONS / std::max(time, (UINT64)1); };
+
+		Timer timer;
+		Vector<UINT8> compressed(Compression::getLZ4Bound(DATA_SIZE));
+		UINT32 compressedSize = 0;
+
+		UINT64 startTime = timer.getMicroseconds();
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			compressedSize = Compression::compressLZ4(&data[0], DATA_SIZE, &compressed[0], (UINT32)compressed.size());
+
+		UINT64 compressTime = timer.getMicroseconds() - startTime;
+
+		Vector<UINT8> output(DATA_SIZE);
+		bool decompressed = true;
+
+		startTime = timer.getMicroseconds();
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			decompressed &= Compression::decompressLZ4(&compressed[0], compressedSize, &output[0], DATA_SIZE);
+
+		UINT64 decompressTime = timer.getMicroseconds() - startTime;
+
+		BS_TEST_ASSERT(decompressed && memcmp(&output[0], &data[0], DATA_SIZE) == 0);
+
+		SPtr<MemoryDataStream> block;
+
+		startTime = timer.getMicroseconds();
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			block = Compression::compressBlock(&data[0], DATA_SIZE, CompressionType::LZ4);
+
+		UINT64 compressBlockTime = timer.getMicroseconds() - startTime;
+
+		startTime = timer.getMicroseconds();
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			decompressed &= Compression::decompressBlock(block->getPtr(), (UINT32)block->size(), &output[0], DATA_SIZE);
+
+		UINT64 decompressBlockTime = timer.getMicroseconds() - startTime;
+
+		BS_TEST_ASSERT(decompressed && memcmp(&output[0], &data[0], DATA_SIZE) == 0);
+
+		LOGDBG("LZ4 on " + toString(DATA_SIZE / (1024 * 1024)) + " MB: compressed to " +
+			toString(compressedSize * 100.0f / DATA_SIZE) + "%, compress " + toString(throughput(compressTime)) +
+			" MB/s, decompress " + toString(throughput(decompressTime)) + " MB/s. Chunked block: compress " +
+			toString(throughput(compressBlockTime)) + " MB/s, decompress " + toString(throughput(decompressBlockTime)) +
+			" MB/s");
+	}
+}
@@ -101,7 +101,7 @@ namespace BansheeEngine
 			result.write(tempBuffer, numReadBytes);
 		}
 
-		free(tempBuffer);
+		bs_free(tempBuffer);
 		std::string string = result.str();
 
 		UINT32 readBytes = (UINT32)string.size();
@@ -189,7 +189,7 @@ namespace BansheeEngine
 			result.write(tempBuffer, numReadBytes);
 		}
 
-		free(tempBuffer);
+		bs_free(tempBuffer);
 		std::string string = result.str();
 
 		UINT32 readBytes = (UINT32)string.size();
@@ -353,8 +353,11 @@ namespace BansheeEngine
 	{
 		if (!copyData)
 			return bs_shared_ptr_new<MemoryDataStream>(mData, mSize, false);
-		
-		return bs_shared_ptr_new<MemoryDataStream>(*this);
+
+		UINT8* data = (UINT8*)bs_alloc((UINT32)mSize);
+		memcpy(data, mData, mSize);
+
+		return bs_shared_ptr_new<MemoryDataStream>(data, mSize);
 	}
 
     void MemoryDataStream::close()    
@@ -477,4 +480,32 @@ namespace BansheeEngine
             }
         }
     }
+
+	MappedFileDataStream::MappedFileDataStream(const Path& filePath, const SPtr<UINT8>& mapping, size_t size)
+		:MemoryDataStream(mapping.get(), size, false), mPath(filePath), mMapping(mapping)
+	{ }
+
+	MappedFileDataStream::~MappedFileDataStream()
+	{
+		close();
+	}
+
+	SPtr<DataStream> MappedFileDataStream::clone(bool copyData) const
+	{
+		if (!copyData)
+			return bs_shared_ptr_new<MappedFileDataStream>(mPath, mMapping, mSize);
+
+		UINT8* data = (UINT8*)bs_alloc((UINT32)mSize);
+		memcpy(data, mData, mSize);
+
+		return bs_shared_ptr_new<MemoryDataStream>(data, mSize);
+	}
+
+	void MappedFileDataStream::close()
+	{
+		MemoryDataStream::close();
+
+		// Region gets unmapped once the last stream referencing it releases the mapping
+		mMapping = nullptr;
+	}
 }
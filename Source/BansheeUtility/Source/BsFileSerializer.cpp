@@ -23,49 +23,55 @@ namespace BansheeEngine
 		if (!FileSystem::exists(parentDir))
 			FileSystem::createDir(parentDir);
 
-		mOutputStream.open(fileLocation.toPlatformString().c_str(), std::ios::out | std::ios::binary);
-		if (mOutputStream.fail())
-		{
-			LOGWRN("Failed to save file: \"" + fileLocation.toString() + "\". Error: " + strerror(errno) + ".");
-		}
+		mOutputStream = FileSystem::createAndOpenFile(fileLocation);
+		if (mOutputStream == nullptr)
+			LOGWRN("Failed to save file: \"" + fileLocation.toString() + "\".");
+	}
+
+	FileEncoder::FileEncoder(const SPtr<DataStream>& stream)
+		:mOutputStream(stream), mWriteBuffer(nullptr)
+	{
+		mWriteBuffer = (UINT8*)bs_alloc(WRITE_BUFFER_SIZE);
 	}
 
 	FileEncoder::~FileEncoder()
 	{
 		bs_free(mWriteBuffer);
-
-		mOutputStream.close();
-		mOutputStream.clear();
 	}
 
 	void FileEncoder::encode(IReflectable* object, const UnorderedMap<String, UINT64>& params)
 	{
-		if (object == nullptr)
+		if (object == nullptr || mOutputStream == nullptr)
 			return;
 
-		UINT64 curPos = (UINT64)mOutputStream.tellp();
-		mOutputStream.seekp(sizeof(UINT32), std::ios_base::cur);
+		// Reserve space for the object size, which is only known once encoding is done
+		size_t curPos = mOutputStream->tell();
 
-		BinarySerializer bs;
 		UINT32 totalBytesWritten = 0;
+		mOutputStream->write(&totalBytesWritten, sizeof(totalBytesWritten));
+
+		BinarySerializer bs;
 		bs.encode(object, mWriteBuffer, WRITE_BUFFER_SIZE, &totalBytesWritten, 
 			std::bind(&FileEncoder::flushBuffer, this, _1, _2, _3), false, params);
 
-		mOutputStream.seekp(curPos);
-		mOutputStream.write((char*)&totalBytesWritten, sizeof(totalBytesWritten));
-		mOutputStream.seekp(totalBytesWritten, std::ios_base::cur);
+		mOutputStream->seek(curPos);
+		mOutputStream->write(&totalBytesWritten, sizeof(totalBytesWritten));
+		mOutputStream->seek(curPos + sizeof(totalBytesWritten) + totalBytesWritten);
 	}
 
 	UINT8* FileEncoder::flushBuffer(UINT8* bufferStart, UINT32 bytesWritten, UINT32& newBufferSize)
 	{
-		mOutputStream.write((const char*)bufferStart, bytesWritten);
+		mOutputStream->write(bufferStart, bytesWritten);
 
 		return bufferStart;
 	}
 
-	FileDecoder::FileDecoder(const Path& fileLocation)
+	FileDecoder::FileDecoder(const Path& fileLocation, bool mapFile)
 	{
-		mInputStream = FileSystem::openFile(fileLocation, true);
+		if (mapFile)
+			mInputStream = FileSystem::openFileMapped(fileLocation);
+		else
+			mInputStream = FileSystem::openFile(fileLocation, true);
 
 		if (mInputStream == nullptr)
 			return;
@@ -77,6 +83,10 @@ namespace BansheeEngine
 		}
 	}
 
+	FileDecoder::FileDecoder(const SPtr<DataStream>& stream)
+		:mInputStream(stream)
+	{ }
+
 	SPtr<IReflectable> FileDecoder::decode(const UnorderedMap<String, UINT64>& params)
 	{
 		if (mInputStream->eof())
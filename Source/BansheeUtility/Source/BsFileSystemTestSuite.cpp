@@ -5,10 +5,19 @@
 #include "BsDebug.h"
 #include "BsException.h"
 #include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsResourcePackage.h"
+#include "BsAsyncIO.h"
+#include "BsTimer.h"
 
 #include <algorithm>
 #include <fstream>
 
+#if BS_PLATFORM == BS_PLATFORM_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace BansheeEngine
 {
 	const String testDirectoryName = "FileSystemTestDirectory/";
@@ -21,6 +30,28 @@ namespace BansheeEngine
 		fs.close();
 	}
 
+	/** 
+	 * Attempts to evict the contents of the file from the OS file cache, so following reads have to go to the disk.
+	 * Returns false if not supported on the current platform.
+	 */
+	bool evictFromFileCache(const Path& path)
+	{
+#if BS_PLATFORM == BS_PLATFORM_LINUX
+		int fd = open(path.toPlatformString().c_str(), O_RDONLY);
+		if (fd == -1)
+			return false;
+
+		// Dirty pages cannot be evicted
+		fdatasync(fd);
+		bool evicted = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+
+		close(fd);
+		return evicted;
+#else
+		return false;
+#endif
+	}
+
 	void createEmptyFile(Path path)
 	{
 		createFile(path, "");
@@ -50,10 +81,14 @@ namespace BansheeEngine
 			FileSystem::createDir(mTestDirectory);
 			BS_TEST_ASSERT_MSG(FileSystem::exists(mTestDirectory), "FileSystemTestSuite::startUp(): test directory creation failed");
 		}
+
+		AsyncIO::startUp(16);
 	}
 
 	void FileSystemTestSuite::shutDown()
 	{
+		AsyncIO::shutDown();
+
 		FileSystem::remove(mTestDirectory, true);
 		if (FileSystem::exists(mTestDirectory))
 		{
@@ -84,6 +119,14 @@ namespace BansheeEngine
 		BS_ADD_TEST(FileSystemTestSuite::testGetChildren);
 		BS_ADD_TEST(FileSystemTestSuite::testGetLastModifiedTime);
 		BS_ADD_TEST(FileSystemTestSuite::testGetTempDirectoryPath);
+		BS_ADD_TEST(FileSystemTestSuite::testOpenFileMapped);
+		BS_ADD_TEST(FileSystemTestSuite::testOpenFileMapped_empty);
+		BS_ADD_TEST(FileSystemTestSuite::testResourcePackage);
+		BS_ADD_TEST(FileSystemTestSuite::testResourcePackage_invalid);
+		BS_ADD_TEST(FileSystemTestSuite::testResourcePackage_compressed);
+		BS_ADD_TEST(FileSystemTestSuite::testResourcePackage_benchmark);
+		BS_ADD_TEST(FileSystemTestSuite::testAsyncIO);
+		BS_ADD_TEST(FileSystemTestSuite::testAsyncIO_queueDepth);
 	}
 
 	void FileSystemTestSuite::testExists_yes_file()
@@ -299,4 +342,492 @@ namespace BansheeEngine
 		/* No judging. */
 		BS_TEST_ASSERT(!path.toString().empty());
 	}
+
+	void FileSystemTestSuite::testOpenFileMapped()
+	{
+		Path path = mTestDirectory + "mapped-file-test-1";
+		createFile(path, "0123456789");
+
+		SPtr<MappedFileDataStream> stream = FileSystem::openFileMapped(path);
+		BS_TEST_ASSERT(stream != nullptr);
+		BS_TEST_ASSERT(stream->isMapped());
+		BS_TEST_ASSERT(!stream->isFile());
+		BS_TEST_ASSERT(stream->size() == 10);
+
+		UINT8* start = stream->getPtr();
+		BS_TEST_ASSERT(memcmp(start, "0123456789", 10) == 0);
+
+		char buffer[4];
+		stream->seek(3);
+		BS_TEST_ASSERT(stream->read(buffer, 4) == 4);
+		BS_TEST_ASSERT(memcmp(buffer, "3456", 4) == 0);
+		BS_TEST_ASSERT(stream->getCurrentPtr() == start + 7);
+
+		// Clones that don't copy data share the mapping and keep it alive after the original is closed
+		SPtr<DataStream> view = stream->clone(false);
+		BS_TEST_ASSERT(view->isMapped());
+
+		stream->close();
+		stream = nullptr;
+
+		SPtr<MappedFileDataStream> mappedView = std::static_pointer_cast<MappedFileDataStream>(view);
+		BS_TEST_ASSERT(mappedView->getPtr() == start);
+		BS_TEST_ASSERT(memcmp(mappedView->getPtr(), "0123456789", 10) == 0);
+
+		// Writes are private to the mapping and never reach the file
+		mappedView->seek(0);
+		BS_TEST_ASSERT(mappedView->write("abc", 3) == 3);
+		BS_TEST_ASSERT(memcmp(start, "abc3456789", 10) == 0);
+
+		// Copying clones own their data
+		SPtr<DataStream> copy = mappedView->clone(true);
+		BS_TEST_ASSERT(!copy->isMapped());
+		BS_TEST_ASSERT(copy->size() == 10);
+
+		mappedView = nullptr;
+		view = nullptr;
+
+		BS_TEST_ASSERT(readFile(path) == "0123456789");
+		BS_TEST_ASSERT(copy->getAsString() == "abc3456789");
+
+		FileSystem::remove(path);
+	}
+
+	void FileSystemTestSuite::testOpenFileMapped_empty()
+	{
+		Path path = mTestDirectory + "mapped-file-test-2";
+		createEmptyFile(path);
+
+		SPtr<MappedFileDataStream> stream = FileSystem::openFileMapped(path);
+		BS_TEST_ASSERT(stream != nullptr);
+		BS_TEST_ASSERT(stream->size() == 0);
+		BS_TEST_ASSERT(stream->eof());
+
+		char buffer[1];
+		BS_TEST_ASSERT(stream->read(buffer, 1) == 0);
+
+		stream = nullptr;
+		FileSystem::remove(path);
+	}
+
+	void FileSystemTestSuite::testResourcePackage()
+	{
+		const UINT32 NUM_FILES = 20;
+		const UINT32 ALIGNMENT = 64;
+
+		Path packagePath = mTestDirectory + "package-test-1";
+
+		ResourcePackageBuilder builder(ALIGNMENT);
+		for (UINT32 i = 0; i < NUM_FILES; i++)
+		{
+			Path path = mTestDirectory + ("package-test-file-" + toString(i));
+			createFile(path, String(i * 37, (char)('a' + i))); // Includes an empty file
+
+			Vector<String> dependencies;
+			for (UINT32 j = 0; j < i % 3; j++)
+				dependencies.push_back("dependency-" + toString(i + j));
+
+			builder.addFile("uuid-" + toString(i), path, dependencies);
+		}
+
+		BS_TEST_ASSERT(builder.build(packagePath));
+
+		// Package doesn't depend on the original files
+		for (UINT32 i = 0; i < NUM_FILES; i++)
+			FileSystem::remove(mTestDirectory + ("package-test-file-" + toString(i)));
+
+		SPtr<ResourcePackage> package = ResourcePackage::open(packagePath);
+		BS_TEST_ASSERT(package != nullptr);
+		BS_TEST_ASSERT(package->getEntries().size() == NUM_FILES);
+		BS_TEST_ASSERT(!package->contains("uuid-" + toString(NUM_FILES)));
+		BS_TEST_ASSERT(package->openEntry("uuid-" + toString(NUM_FILES)) == nullptr);
+
+		SPtr<MappedFileDataStream> lastEntry;
+		for (UINT32 i = 0; i < NUM_FILES; i++)
+		{
+			String uuid = "uuid-" + toString(i);
+			BS_TEST_ASSERT(package->contains(uuid));
+
+			const ResourcePackageEntry* entry = package->getEntry(uuid);
+			BS_TEST_ASSERT(entry != nullptr);
+			BS_TEST_ASSERT(entry->uuid == uuid);
+			BS_TEST_ASSERT(entry->size == i * 37);
+			BS_TEST_ASSERT(entry->compression == ResourceCompression::None);
+			BS_TEST_ASSERT(entry->offset % ALIGNMENT == 0);
+			BS_TEST_ASSERT(entry->offset >= ResourcePackage::DATA_ALIGNMENT);
+
+			BS_TEST_ASSERT(entry->dependencies.size() == i % 3);
+			for (UINT32 j = 0; j < (UINT32)entry->dependencies.size(); j++)
+				BS_TEST_ASSERT(entry->dependencies[j] == "dependency-" + toString(i + j));
+
+			SPtr<MappedFileDataStream> stream = package->openEntry(uuid);
+			BS_TEST_ASSERT(stream != nullptr);
+			BS_TEST_ASSERT(stream->isMapped());
+			BS_TEST_ASSERT(stream->size() == i * 37);
+			BS_TEST_ASSERT(((size_t)stream->getPtr() % ALIGNMENT) == 0);
+
+			String expected(i * 37, (char)('a' + i));
+			BS_TEST_ASSERT(memcmp(stream->getPtr(), expected.data(), expected.size()) == 0);
+
+			lastEntry = stream;
+		}
+
+		// Entry streams keep the mapping alive
+		package = nullptr;
+
+		String expected((NUM_FILES - 1) * 37, (char)('a' + NUM_FILES - 1));
+		BS_TEST_ASSERT(memcmp(lastEntry->getPtr(), expected.data(), expected.size()) == 0);
+
+		lastEntry = nullptr;
+		FileSystem::remove(packagePath);
+	}
+
+	void FileSystemTestSuite::testResourcePackage_invalid()
+	{
+		Path path = mTestDirectory + "package-test-2";
+		createFile(path, "not-a-resource-package");
+
+		BS_TEST_ASSERT(ResourcePackage::open(path) == nullptr);
+		FileSystem::remove(path);
+
+		// Builds fail if any of the files are missing
+		ResourcePackageBuilder builder;
+		builder.addFile("uuid", mTestDirectory + "package-test-missing", Vector<String>());
+
+		BS_TEST_ASSERT(!builder.build(path));
+		BS_TEST_ASSERT(!FileSystem::exists(path));
+
+		// Truncated packages are rejected
+		Path sourcePath = mTestDirectory + "package-test-file";
+		createFile(sourcePath, "0123456789");
+
+		ResourcePackageBuilder builder2;
+		builder2.addFile("uuid", sourcePath, Vector<String>());
+		BS_TEST_ASSERT(builder2.build(path));
+
+		{
+			SPtr<DataStream> source = FileSystem::openFile(path);
+			SPtr<MemoryDataStream> contents = bs_shared_ptr_new<MemoryDataStream>(source);
+			source->close();
+
+			SPtr<DataStream> truncated = FileSystem::createAndOpenFile(path);
+			truncated->write(contents->getPtr(), contents->size() - 5);
+			truncated->close();
+		}
+
+		BS_TEST_ASSERT(ResourcePackage::open(path) == nullptr);
+
+		FileSystem::remove(path);
+		FileSystem::remove(sourcePath);
+	}
+
+	void FileSystemTestSuite::testResourcePackage_compressed()
+	{
+		Path packagePath = mTestDirectory + "package-test-3";
+
+		// Repetitive data that compresses well, and data that doesn't compress at all
+		String repetitive;
+		for (UINT32 i = 0; i < 10000; i++)
+			repetitive += "resource-data-" + toString(i % 10) + ";";
+
+		String random(1000, 0);
+		UINT32 seed = 1;
+		for (auto& entry : random)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			entry = (char)(seed >> 24);
+		}
+
+		Path repetitivePath = mTestDirectory + "package-test-file-repetitive";
+		Path randomPath = mTestDirectory + "package-test-file-random";
+		createFile(repetitivePath, repetitive);
+		createFile(randomPath, random);
+
+		ResourcePackageBuilder builder;
+		builder.addFile("repetitive", repetitivePath, Vector<String>(), ResourceCompression::LZ4);
+		builder.addFile("random", randomPath, Vector<String>(), ResourceCompression::LZ4);
+		builder.addFile("uncompressed", repetitivePath, Vector<String>());
+		BS_TEST_ASSERT(builder.build(packagePath));
+
+		FileSystem::remove(repetitivePath);
+		FileSystem::remove(randomPath);
+
+		SPtr<ResourcePackage> package = ResourcePackage::open(packagePath);
+		BS_TEST_ASSERT(package != nullptr);
+
+		// Data that doesn't benefit from compression is stored as is
+		const ResourcePackageEntry* repetitiveEntry = package->getEntry("repetitive");
+		const ResourcePackageEntry* randomEntry = package->getEntry("random");
+		const ResourcePackageEntry* uncompressedEntry = package->getEntry("uncompressed");
+
+		BS_TEST_ASSERT(repetitiveEntry->compression == ResourceCompression::LZ4);
+		BS_TEST_ASSERT(repetitiveEntry->size < repetitive.size());
+		BS_TEST_ASSERT(randomEntry->compression == ResourceCompression::None);
+		BS_TEST_ASSERT(randomEntry->size == random.size());
+		BS_TEST_ASSERT(uncompressedEntry->compression == ResourceCompression::None);
+
+		auto readEntry = [&](const ResourcePackageEntry* entry)
+		{
+			SPtr<MemoryDataStream> data = ResourcePackage::decompressEntry(*entry, package->openEntry(entry->uuid));
+
+			// Regular loads copy the data, which must outlive the original
+			SPtr<MemoryDataStream> copy = std::static_pointer_cast<MemoryDataStream>(data->clone(true));
+			data = nullptr;
+
+			return String((const char*)copy->getPtr(), copy->size());
+		};
+
+		BS_TEST_ASSERT(readEntry(repetitiveEntry) == repetitive);
+		BS_TEST_ASSERT(readEntry(randomEntry) == random);
+		BS_TEST_ASSERT(readEntry(uncompressedEntry) == repetitive);
+
+		// Corrupt compressed data is rejected
+		SPtr<MappedFileDataStream> compressed = package->openEntry("repetitive");
+		SPtr<MemoryDataStream> truncated = bs_shared_ptr_new<MemoryDataStream>(compressed->getPtr(),
+			compressed->size() / 2, false);
+
+		BS_TEST_ASSERT(ResourcePackage::decompressEntry(*repetitiveEntry, truncated) == nullptr);
+
+		compressed = nullptr;
+		truncated = nullptr;
+		package = nullptr;
+		FileSystem::remove(packagePath);
+	}
+
+	void FileSystemTestSuite::testResourcePackage_benchmark()
+	{
+		// Reads many small resources from individual files, and from a package with and without compression. Mostly
+		// measures the OS file cache, unless the cache is cleared before running.
+		static const UINT32 NUM_FILES = 10000;
+
+		Path directory = mTestDirectory + "package-benchmark/";
+		FileSystem::createDir(directory);
+
+		UINT32 seed = 1;
+		UINT64 totalSize = 0;
+		Vector<Path> paths(NUM_FILES);
+		for (UINT32 i = 0; i < NUM_FILES; i++)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			UINT32 size = 200 + (seed >> 8) % 301;
+
+			String contents;
+			while ((UINT32)contents.size() < size)
+				contents += "resource-" + toString(i) + "-" + toString((UINT32)contents.size()) + ";";
+
+			contents.resize(size);
+			totalSize += size;
+
+			paths[i] = directory + ("resource-" + toString(i));
+			createFile(paths[i], contents);
+		}
+
+		Path packagePath = mTestDirectory + "package-benchmark.pack";
+		Path compressedPackagePath = mTestDirectory + "package-benchmark-compressed.pack";
+
+		ResourcePackageBuilder builder;
+		ResourcePackageBuilder compressedBuilder;
+		for (UINT32 i = 0; i < NUM_FILES; i++)
+		{
+			builder.addFile(toString(i), paths[i], Vector<String>());
+			compressedBuilder.addFile(toString(i), paths[i], Vector<String>(), ResourceCompression::LZ4);
+		}
+
+		BS_TEST_ASSERT(builder.build(packagePath));
+		BS_TEST_ASSERT(compressedBuilder.build(compressedPackagePath));
+
+		Timer timer;
+		UINT64 startTime = timer.getMicroseconds();
+
+		UINT64 looseSize = 0;
+		for (auto& path : paths)
+		{
+			SPtr<DataStream> stream = FileSystem::openFile(path, true);
+			SPtr<MemoryDataStream> data = bs_shared_ptr_new<MemoryDataStream>(stream);
+			looseSize += data->size();
+		}
+
+		UINT64 looseTime = timer.getMicroseconds() - startTime;
+
+		auto readPackage = [&](const Path& path)
+		{
+			UINT64 packageSize = 0;
+			SPtr<ResourcePackage> package = ResourcePackage::open(path);
+			for (auto& entry : package->getEntries())
+			{
+				SPtr<MemoryDataStream> data = ResourcePackage::decompressEntry(entry, package->openEntry(entry.uuid));
+				SPtr<DataStream> copy = data->clone(true);
+				packageSize += copy->size();
+			}
+
+			return packageSize;
+		};
+
+		startTime = timer.getMicroseconds();
+		UINT64 packageSize = readPackage(packagePath);
+		UINT64 packageTime = timer.getMicroseconds() - startTime;
+
+		startTime = timer.getMicroseconds();
+		UINT64 compressedPackageSize = readPackage(compressedPackagePath);
+		UINT64 compressedPackageTime = timer.getMicroseconds() - startTime;
+
+		BS_TEST_ASSERT(looseSize == totalSize);
+		BS_TEST_ASSERT(packageSize == totalSize);
+		BS_TEST_ASSERT(compressedPackageSize == totalSize);
+
+		LOGDBG("Reading " + toString(NUM_FILES) + " resources (" + toString(totalSize / 1024) + " KB): loose files " +
+			toString(looseTime / 1000.0f) + " ms, package " + toString(packageTime / 1000.0f) + " ms, compressed " +
+			"package (" + toString(FileSystem::getFileSize(compressedPackagePath) / 1024) + " KB) " +
+			toString(compressedPackageTime / 1000.0f) + " ms");
+
+		FileSystem::remove(directory);
+		FileSystem::remove(packagePath);
+		FileSystem::remove(compressedPackagePath);
+	}
+
+	void FileSystemTestSuite::testAsyncIO()
+	{
+		Path path = mTestDirectory + "async-io-test";
+		String contents;
+		for (UINT32 i = 0; i < 1000; i++)
+			contents += toString(i) + ",";
+
+		createFile(path, contents);
+
+		std::atomic<UINT32> numCallbacks(0);
+		AsyncReadCallback callback = [&](const SPtr<MemoryDataStream>& data)
+		{
+			if (data != nullptr)
+				numCallbacks++;
+		};
+
+		// Ranges, including ones that need to be clamped to the end of the file
+		UINT64 fileSize = (UINT64)contents.size();
+		Vector<std::pair<UINT64, UINT64>> ranges = { { 0, AsyncIO::READ_TO_END }, { 10, 100 }, { fileSize - 10, 100 },
+			{ fileSize + 10, 100 }, { 0, 0 } };
+
+		Vector<AsyncOp> ops;
+		for (auto& range : ranges)
+			ops.push_back(AsyncIO::instance().readFile(path, range.first, range.second, callback));
+
+		AsyncOp missingOp = AsyncIO::instance().readFile(mTestDirectory + "async-io-missing");
+
+		for (UINT32 i = 0; i < (UINT32)ranges.size(); i++)
+		{
+			ops[i].blockUntilComplete();
+			BS_TEST_ASSERT(ops[i].hasCompleted());
+
+			SPtr<MemoryDataStream> data = ops[i].getReturnValue<SPtr<MemoryDataStream>>();
+			BS_TEST_ASSERT(data != nullptr);
+
+			if (data != nullptr)
+			{
+				UINT64 offset = std::min(ranges[i].first, fileSize);
+				UINT64 size = std::min(ranges[i].second, fileSize - offset);
+
+				BS_TEST_ASSERT(data->size() == size);
+				BS_TEST_ASSERT(String((char*)data->getPtr(), data->size()) == contents.substr(offset, size));
+			}
+		}
+
+		missingOp.blockUntilComplete();
+		BS_TEST_ASSERT(missingOp.getReturnValue<SPtr<MemoryDataStream>>() == nullptr);
+		BS_TEST_ASSERT(numCallbacks == ranges.size());
+
+		FileSystem::remove(path);
+
+		// Reads larger than the maximum read size must fail, while smaller ranges of the same file can still be read.
+		// File is sparse so it doesn't take up any space.
+		Path largePath = mTestDirectory + "async-io-large-test";
+		{
+			std::ofstream fs(largePath.toPlatformString().c_str(), std::ios::binary);
+			fs.seekp((std::streamoff)AsyncIO::MAX_READ_SIZE);
+			fs.put(5);
+		}
+
+		AsyncOp largeOp = AsyncIO::instance().readFile(largePath);
+		AsyncOp endOp = AsyncIO::instance().readFile(largePath, AsyncIO::MAX_READ_SIZE - 1);
+
+		largeOp.blockUntilComplete();
+		BS_TEST_ASSERT(largeOp.getReturnValue<SPtr<MemoryDataStream>>() == nullptr);
+
+		endOp.blockUntilComplete();
+		SPtr<MemoryDataStream> endData = endOp.getReturnValue<SPtr<MemoryDataStream>>();
+		BS_TEST_ASSERT(endData != nullptr && endData->size() == 2 && endData->getPtr()[1] == 5);
+
+		FileSystem::remove(largePath);
+	}
+
+	void FileSystemTestSuite::testAsyncIO_queueDepth()
+	{
+		// Reads a file in blocks while keeping a different number of reads in flight, and reports the throughput of each
+		// queue depth, both with the file in the OS file cache and with it evicted from the cache. Reads from the cache
+		// are memory copies that don't benefit from being issued in parallel, so only the uncached reads show the effect
+		// of the queue depth.
+		static const UINT32 FILE_SIZE = 32 * 1024 * 1024;
+		static const UINT32 BLOCK_SIZE = 256 * 1024;
+		static const UINT32 NUM_BLOCKS = FILE_SIZE / BLOCK_SIZE;
+		static const UINT32 QUEUE_DEPTHS[] = { 1, 4, 16 };
+
+		Path path = mTestDirectory + "async-io-queue-depth-test";
+		{
+			Vector<UINT8> block(BLOCK_SIZE);
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+			for (UINT32 i = 0; i < NUM_BLOCKS; i++)
+			{
+				memset(block.data(), (int)i, BLOCK_SIZE);
+				stream->write(block.data(), BLOCK_SIZE);
+			}
+
+			stream->close();
+		}
+
+		// Returns the throughput in MB/s
+		auto measure = [&](UINT32 queueDepth, bool& allValid)
+		{
+			Timer timer;
+			UINT64 startTime = timer.getMicroseconds();
+
+			Queue<std::pair<UINT32, AsyncOp>> inFlight;
+			for (UINT32 i = 0; i < NUM_BLOCKS || !inFlight.empty();)
+			{
+				if (i < NUM_BLOCKS && (UINT32)inFlight.size() < queueDepth)
+				{
+					inFlight.push(std::make_pair(i, AsyncIO::instance().readFile(path, (UINT64)i * BLOCK_SIZE, BLOCK_SIZE)));
+					i++;
+					continue;
+				}
+
+				UINT32 blockIdx = inFlight.front().first;
+				AsyncOp op = inFlight.front().second;
+				inFlight.pop();
+
+				op.blockUntilComplete();
+				SPtr<MemoryDataStream> data = op.getReturnValue<SPtr<MemoryDataStream>>();
+
+				allValid &= data != nullptr && data->size() == BLOCK_SIZE && data->getPtr()[0] == (UINT8)blockIdx &&
+					data->getPtr()[BLOCK_SIZE - 1] == (UINT8)blockIdx;
+			}
+
+			UINT64 time = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+			return (UINT64)FILE_SIZE / time;
+		};
+
+		bool allValid = true;
+		for (auto queueDepth : QUEUE_DEPTHS)
+		{
+			UINT64 cached = measure(queueDepth, allValid);
+
+			String uncached = "unsupported";
+			if (evictFromFileCache(path))
+				uncached = toString(measure(queueDepth, allValid)) + " MB/s";
+
+			LOGDBG("AsyncIO queue depth " + toString(queueDepth) + " (" + toString(AsyncIO::instance().getNumThreads()) +
+				" threads): cached " + toString(cached) + " MB/s, uncached " + uncached);
+		}
+
+		BS_TEST_ASSERT(allValid);
+
+		FileSystem::remove(path);
+	}
 }
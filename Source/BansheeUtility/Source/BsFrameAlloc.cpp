@@ -292,4 +292,156 @@ namespace BansheeEngine
 		mOwnerThread = thread;
 #endif
 	}
+
+	ConcurrentFrameAlloc::ConcurrentFrameAlloc(UINT32 blockSize)
+		:mBlockSize(blockSize), mCurrentBlock(nullptr)
+	{
+		allocBlock(mBlockSize);
+	}
+
+	ConcurrentFrameAlloc::~ConcurrentFrameAlloc()
+	{
+		for (auto& block : mBlocks)
+			deallocBlock(block);
+	}
+
+	UINT8* ConcurrentFrameAlloc::alloc(UINT32 amount)
+	{
+		// Keep all allocations on a 16 byte boundary
+		amount = (amount + 15) & ~15;
+
+		while (true)
+		{
+			MemBlock* block = mCurrentBlock.load(std::memory_order_acquire);
+
+			UINT32 freePtr = block->mFreePtr.fetch_add(amount, std::memory_order_relaxed);
+			if (freePtr + amount <= block->mSize)
+				return block->mData + freePtr;
+
+			// Out of space. Other threads might run out at the same time, so only the first one allocates a new block, 
+			// and the rest retry with it.
+			Lock lock(mMutex);
+
+			if (mCurrentBlock.load(std::memory_order_relaxed) == block)
+				allocBlock(amount);
+		}
+	}
+
+	UINT8* ConcurrentFrameAlloc::allocAligned(UINT32 amount, UINT32 alignment)
+	{
+		if (alignment <= 16)
+			return alloc(amount);
+
+		UINT8* data = alloc(amount + alignment - 16);
+		UINT32 alignOffset = (alignment - ((size_t)data & (alignment - 1))) & (alignment - 1);
+
+		return data + alignOffset;
+	}
+
+	void ConcurrentFrameAlloc::clear()
+	{
+		if (mBlocks.size() > 1)
+		{
+			// Merge all blocks into one, so the next frame hopefully fits in a single block
+			UINT32 totalBytes = 0;
+			for (auto& block : mBlocks)
+			{
+				totalBytes += block->mSize;
+				deallocBlock(block);
+			}
+
+			mBlocks.clear();
+			allocBlock(totalBytes);
+		}
+		else
+			mBlocks[0]->mFreePtr.store(0, std::memory_order_relaxed);
+	}
+
+	void ConcurrentFrameAlloc::allocBlock(UINT32 wantedSize)
+	{
+		UINT32 blockSize = std::max(mBlockSize, wantedSize);
+		UINT32 headerSize = (sizeof(MemBlock) + 15) & ~15;
+
+		UINT8* data = (UINT8*)bs_alloc_aligned16(headerSize + blockSize);
+		MemBlock* block = new (data) MemBlock();
+		block->mData = data + headerSize;
+		block->mSize = blockSize;
+		block->mFreePtr.store(0, std::memory_order_relaxed);
+
+		// Remaining space in the previous block is lost until the next clear()
+		mBlocks.push_back(block);
+		mCurrentBlock.store(block, std::memory_order_release);
+	}
+
+	void ConcurrentFrameAlloc::deallocBlock(MemBlock* block)
+	{
+		block->~MemBlock();
+		bs_free_aligned16(block);
+	}
+
+	/** Used for assigning unique identifiers to WorkerFrameAlloc instances. */
+	static std::atomic<UINT64> gNextWorkerFrameAllocId(1);
+
+	/** Last allocator returned by WorkerFrameAlloc::get() on this thread, to avoid looking it up on every call. */
+	static BS_THREADLOCAL UINT64 gCachedWorkerFrameAllocId = 0;
+	static BS_THREADLOCAL FrameAlloc* gCachedWorkerFrameAlloc = nullptr;
+
+	WorkerFrameAlloc::WorkerFrameAlloc(UINT32 blockSize)
+		:mId(gNextWorkerFrameAllocId.fetch_add(1, std::memory_order_relaxed)), mBlockSize(blockSize)
+	{ }
+
+	WorkerFrameAlloc::~WorkerFrameAlloc()
+	{
+		for (auto& entry : mAllocators)
+		{
+			entry.second->setOwnerThread(BS_THREAD_CURRENT_ID);
+			bs_delete(entry.second);
+		}
+	}
+
+	FrameAlloc& WorkerFrameAlloc::get()
+	{
+		// Note: Identifiers are unique for the lifetime of the application, so a cached allocator can't belong to
+		// a destroyed instance that happened to be allocated at the same address
+		if (gCachedWorkerFrameAllocId == mId)
+			return *gCachedWorkerFrameAlloc;
+
+		FrameAlloc* frameAlloc;
+		{
+			Lock lock(mMutex);
+
+			ThreadId threadId = BS_THREAD_CURRENT_ID;
+			auto iterFind = mAllocators.find(threadId);
+			if (iterFind != mAllocators.end())
+				frameAlloc = iterFind->second;
+			else
+			{
+				frameAlloc = bs_new<FrameAlloc>(mBlockSize);
+				mAllocators[threadId] = frameAlloc;
+			}
+		}
+
+		gCachedWorkerFrameAllocId = mId;
+		gCachedWorkerFrameAlloc = frameAlloc;
+
+		return *frameAlloc;
+	}
+
+	void WorkerFrameAlloc::clear()
+	{
+		Lock lock(mMutex);
+
+		for (auto& entry : mAllocators)
+		{
+			entry.second->setOwnerThread(BS_THREAD_CURRENT_ID);
+			entry.second->clear();
+			entry.second->setOwnerThread(entry.first);
+		}
+	}
+
+	UINT32 WorkerFrameAlloc::getNumAllocators() const
+	{
+		Lock lock(mMutex);
+		return (UINT32)mAllocators.size();
+	}
 }
\ No newline at end of file
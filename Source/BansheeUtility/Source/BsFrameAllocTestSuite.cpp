@@ -0,0 +1,147 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsFrameAllocTestSuite.h"
+
+#include "BsFrameAlloc.h"
+
+namespace BansheeEngine
+{
+	FrameAllocTestSuite::FrameAllocTestSuite()
+	{
+		BS_ADD_TEST(FrameAllocTestSuite::testConcurrentFrameAlloc);
+		BS_ADD_TEST(FrameAllocTestSuite::testWorkerFrameAlloc);
+	}
+
+	void FrameAllocTestSuite::testConcurrentFrameAlloc()
+	{
+		const UINT32 NUM_THREADS = 8;
+		const UINT32 NUM_ALLOCS = 5000;
+
+		// Small blocks ensure threads often run out of space at the same time
+		ConcurrentFrameAlloc frameAlloc(4096);
+
+		for (UINT32 frame = 0; frame < 3; frame++)
+		{
+			Vector<Vector<UINT32*>> allocations(NUM_THREADS);
+			Vector<StdFrameVector<UINT32, ConcurrentFrameAlloc>*> vectors(NUM_THREADS);
+			std::atomic<UINT32> numMisaligned(0);
+
+			Vector<Thread> threads;
+			for (UINT32 i = 0; i < NUM_THREADS; i++)
+			{
+				threads.push_back(Thread([&, i]()
+				{
+					for (UINT32 j = 0; j < NUM_ALLOCS; j++)
+					{
+						UINT32 count = 1 + (i * 7 + j * 13) % 64;
+
+						UINT32* data = (UINT32*)frameAlloc.alloc(count * sizeof(UINT32));
+						if (((size_t)data & 15) != 0)
+							numMisaligned++;
+
+						for (UINT32 k = 0; k < count; k++)
+							data[k] = (i << 16) | j;
+
+						allocations[i].push_back(data);
+					}
+
+					// Container filled on this thread, consumed on the main thread
+					StdFrameAlloc<UINT32, ConcurrentFrameAlloc> stdAlloc(&frameAlloc);
+					vectors[i] = frameAlloc.alloc<StdFrameVector<UINT32, ConcurrentFrameAlloc>>(stdAlloc);
+
+					for (UINT32 j = 0; j < NUM_ALLOCS; j++)
+						vectors[i]->push_back(i * NUM_ALLOCS + j);
+				}));
+			}
+
+			for (auto& thread : threads)
+				thread.join();
+
+			BS_TEST_ASSERT(numMisaligned.load() == 0);
+
+			// No allocation may overlap another
+			bool valid = true;
+			for (UINT32 i = 0; i < NUM_THREADS; i++)
+			{
+				for (UINT32 j = 0; j < NUM_ALLOCS; j++)
+				{
+					UINT32 count = 1 + (i * 7 + j * 13) % 64;
+					for (UINT32 k = 0; k < count; k++)
+						valid &= allocations[i][j][k] == ((i << 16) | j);
+				}
+
+				valid &= vectors[i]->size() == NUM_ALLOCS;
+				for (UINT32 j = 0; j < (UINT32)vectors[i]->size(); j++)
+					valid &= (*vectors[i])[j] == i * NUM_ALLOCS + j;
+
+				frameAlloc.dealloc(vectors[i]);
+			}
+
+			BS_TEST_ASSERT(valid);
+
+			UINT8* aligned = frameAlloc.allocAligned(16, 64);
+			BS_TEST_ASSERT(((size_t)aligned & 63) == 0);
+
+			frameAlloc.clear();
+		}
+	}
+
+	void FrameAllocTestSuite::testWorkerFrameAlloc()
+	{
+		const UINT32 NUM_THREADS = 4;
+		const UINT32 NUM_ELEMENTS = 10000;
+
+		WorkerFrameAlloc workerAlloc(1024);
+
+		for (UINT32 frame = 0; frame < 3; frame++)
+		{
+			Vector<FrameAlloc*> threadAllocs(NUM_THREADS);
+			Vector<StdFrameVector<UINT32>*> vectors(NUM_THREADS);
+
+			Vector<Thread> threads;
+			for (UINT32 i = 0; i < NUM_THREADS; i++)
+			{
+				threads.push_back(Thread([&, i]()
+				{
+					FrameAlloc& frameAlloc = workerAlloc.get();
+					threadAllocs[i] = &frameAlloc;
+
+					vectors[i] = frameAlloc.alloc<StdFrameVector<UINT32>>(StdFrameAlloc<UINT32>(&frameAlloc));
+					for (UINT32 j = 0; j < NUM_ELEMENTS; j++)
+						vectors[i]->push_back(i * NUM_ELEMENTS + j);
+
+					// Repeated calls on the same thread must return the same allocator
+					if (&workerAlloc.get() != &frameAlloc)
+						threadAllocs[i] = nullptr;
+				}));
+			}
+
+			for (auto& thread : threads)
+				thread.join();
+
+			// Consume the data on the main thread
+			bool valid = true;
+			for (UINT32 i = 0; i < NUM_THREADS; i++)
+			{
+				valid &= threadAllocs[i] != nullptr;
+				for (UINT32 j = i + 1; j < NUM_THREADS; j++)
+					valid &= threadAllocs[i] != threadAllocs[j];
+
+				valid &= vectors[i]->size() == NUM_ELEMENTS;
+				for (UINT32 j = 0; j < NUM_ELEMENTS; j++)
+					valid &= (*vectors[i])[j] == i * NUM_ELEMENTS + j;
+
+				threadAllocs[i]->dealloc(vectors[i]);
+			}
+
+			BS_TEST_ASSERT(valid);
+
+			// New threads are started every frame. Each gets its own allocator, unless the thread identifier of an exited
+			// thread was reused.
+			BS_TEST_ASSERT(workerAlloc.getNumAllocators() >= NUM_THREADS);
+			BS_TEST_ASSERT(workerAlloc.getNumAllocators() <= (frame + 1) * NUM_THREADS);
+
+			workerAlloc.clear();
+		}
+	}
+}
@@ -30,6 +30,19 @@ namespace BansheeEngine
 
 	RTTITypeBase* IReflectable::_getRTTIfromTypeId(UINT32 rttiTypeId)
 	{
+		// Serializers look up a type for every object they decode, so remember the types found by searching the hierarchy.
+		// Types that weren't found aren't remembered, as they can still be registered later (e.g. by a plugin).
+		static UnorderedMap<UINT32, RTTITypeBase*> foundTypes;
+		static Mutex foundTypesMutex;
+
+		{
+			Lock lock(foundTypesMutex);
+
+			auto iterFind = foundTypes.find(rttiTypeId);
+			if (iterFind != foundTypes.end())
+				return iterFind->second;
+		}
+
 		Stack<RTTITypeBase*> todo;
 		Vector<RTTITypeBase*>& rootClasses = getDerivedClasses();
 
@@ -42,7 +55,12 @@ namespace BansheeEngine
 			todo.pop();
 
 			if(curType->getRTTIId() == rttiTypeId)
+			{
+				Lock lock(foundTypesMutex);
+				foundTypes[rttiTypeId] = curType;
+
 				return curType;
+			}
 
 			Vector<RTTITypeBase*>& derivedClasses = curType->getDerivedClasses();
 			for(auto iter = derivedClasses.begin(); iter != derivedClasses.end(); ++iter)
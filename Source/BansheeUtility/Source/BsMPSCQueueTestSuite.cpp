@@ -0,0 +1,132 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMPSCQueueTestSuite.h"
+
+#include "BsMPSCQueue.h"
+
+namespace BansheeEngine
+{
+	/** Queue element that keeps track of how many instances of it are alive. */
+	struct TrackedElement
+	{
+		TrackedElement(UINT32 producer, UINT32 sequence, std::atomic<INT32>& numAlive)
+			:producer(producer), sequence(sequence), numAlive(numAlive)
+		{
+			numAlive++;
+		}
+
+		~TrackedElement()
+		{
+			numAlive--;
+		}
+
+		UINT32 producer;
+		UINT32 sequence;
+		std::atomic<INT32>& numAlive;
+	};
+
+	/**
+	 * Adds elements to the queue from the provided number of threads, while consuming them on the calling thread. Checks
+	 * that all elements were received exactly once, and in order for each producer.
+	 */
+	bool runProducers(UINT32 numProducers, UINT32 numElementsPerProducer, UINT32 capacity)
+	{
+		std::atomic<INT32> numAlive(0);
+		bool valid = true;
+
+		{
+			MPSCQueue<TrackedElement> queue(capacity);
+
+			Vector<Thread> producers;
+			for (UINT32 i = 0; i < numProducers; i++)
+			{
+				producers.push_back(Thread([&queue, &numAlive, i, numElementsPerProducer]()
+				{
+					for (UINT32 j = 0; j < numElementsPerProducer; j++)
+					{
+						while (!queue.tryEmplace(i, j, numAlive))
+							std::this_thread::yield();
+					}
+				}));
+			}
+
+			Vector<UINT32> nextSequence(numProducers, 0);
+			UINT32 numReceived = 0;
+			UINT32 numExpected = numProducers * numElementsPerProducer;
+
+			auto consume = [&](TrackedElement& element)
+			{
+				valid &= element.producer < numProducers && nextSequence[element.producer] == element.sequence;
+				nextSequence[element.producer]++;
+				numReceived++;
+			};
+
+			while (numReceived < numExpected)
+			{
+				if (!queue.tryConsume(consume))
+					std::this_thread::yield();
+			}
+
+			for (auto& producer : producers)
+				producer.join();
+
+			valid &= queue.isEmpty();
+		}
+
+		return valid && numAlive.load() == 0;
+	}
+
+	MPSCQueueTestSuite::MPSCQueueTestSuite()
+	{
+		BS_ADD_TEST(MPSCQueueTestSuite::testSingleThread);
+		BS_ADD_TEST(MPSCQueueTestSuite::testMultipleProducers);
+	}
+
+	void MPSCQueueTestSuite::testSingleThread()
+	{
+		std::atomic<INT32> numAlive(0);
+
+		{
+			MPSCQueue<TrackedElement> queue(5);
+			BS_TEST_ASSERT(queue.getCapacity() == 8);
+			BS_TEST_ASSERT(queue.isEmpty());
+			BS_TEST_ASSERT(!queue.tryConsume([](TrackedElement& element) { }));
+
+			// Wrap around the ring buffer a few times
+			for (UINT32 lap = 0; lap < 3; lap++)
+			{
+				for (UINT32 i = 0; i < 8; i++)
+					BS_TEST_ASSERT(queue.tryEmplace(0, i, numAlive));
+
+				BS_TEST_ASSERT(!queue.tryEmplace(0, 8, numAlive));
+				BS_TEST_ASSERT(numAlive.load() == 8);
+
+				for (UINT32 i = 0; i < 8; i++)
+				{
+					UINT32 sequence = (UINT32)-1;
+					BS_TEST_ASSERT(queue.tryConsume([&sequence](TrackedElement& element) { sequence = element.sequence; }));
+					BS_TEST_ASSERT(sequence == i);
+				}
+
+				BS_TEST_ASSERT(queue.isEmpty());
+				BS_TEST_ASSERT(numAlive.load() == 0);
+			}
+
+			// Elements left in the queue must be destroyed along with it
+			for (UINT32 i = 0; i < 4; i++)
+				queue.tryEmplace(0, i, numAlive);
+		}
+
+		BS_TEST_ASSERT(numAlive.load() == 0);
+	}
+
+	void MPSCQueueTestSuite::testMultipleProducers()
+	{
+		// Small capacity ensures producers frequently find the queue full
+		for (UINT32 numProducers = 1; numProducers <= 16; numProducers *= 2)
+		{
+			BS_TEST_ASSERT(runProducers(numProducers, 20000, 64));
+			BS_TEST_ASSERT(runProducers(numProducers, 20000, 4096));
+		}
+	}
+}
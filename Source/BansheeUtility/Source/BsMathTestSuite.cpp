@@ -0,0 +1,594 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMathTestSuite.h"
+
+#include "BsMatrix4.h"
+#include "BsQuaternion.h"
+#include "BsAABBTree.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	// Note: References below intentionally use plain scalar code, so the (possibly vectorized) math types can be 
+	// validated against them regardless of the instruction set the library was built with.
+
+	/** Maximum allowed error between the reference and the tested results. */
+	const float TOLERANCE = 1e-4f;
+
+	/** Generates a deterministic sequence of numbers in [-1, 1] range. */
+	float nextRandom(UINT32& seed)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		return (seed >> 8) / (float)(1 << 23) - 1.0f;
+	}
+
+	Vector3 randomVector3(UINT32& seed, float scale)
+	{
+		return Vector3(nextRandom(seed), nextRandom(seed), nextRandom(seed)) * scale;
+	}
+
+	Quaternion randomRotation(UINT32& seed)
+	{
+		Quaternion q(nextRandom(seed), nextRandom(seed), nextRandom(seed), nextRandom(seed));
+		q.normalize();
+
+		return q;
+	}
+
+	Matrix4 randomMatrix(UINT32& seed)
+	{
+		Matrix4 output;
+		for (UINT32 i = 0; i < 4; i++)
+			for (UINT32 j = 0; j < 4; j++)
+				output[i][j] = nextRandom(seed) * 10.0f;
+
+		return output;
+	}
+
+	Matrix4 randomAffineMatrix(UINT32& seed)
+	{
+		Vector3 scale = randomVector3(seed, 1.0f);
+		scale = Vector3(0.5f, 0.5f, 0.5f) + Vector3(Math::abs(scale.x), Math::abs(scale.y), Math::abs(scale.z));
+
+		return Matrix4::TRS(randomVector3(seed, 100.0f), randomRotation(seed), scale);
+	}
+
+	bool approxEquals(float a, float b)
+	{
+		return Math::abs(a - b) <= TOLERANCE * std::max(1.0f, std::max(Math::abs(a), Math::abs(b)));
+	}
+
+	bool approxEquals(const Matrix4& a, const Matrix4& b)
+	{
+		for (UINT32 i = 0; i < 4; i++)
+			for (UINT32 j = 0; j < 4; j++)
+				if (!approxEquals(a[i][j], b[i][j]))
+					return false;
+
+		return true;
+	}
+
+	bool approxEquals(const Vector3& a, const Vector3& b)
+	{
+		return approxEquals(a.x, b.x) && approxEquals(a.y, b.y) && approxEquals(a.z, b.z);
+	}
+
+	bool approxEquals(const Quaternion& a, const Quaternion& b)
+	{
+		return approxEquals(a.x, b.x) && approxEquals(a.y, b.y) && approxEquals(a.z, b.z) && approxEquals(a.w, b.w);
+	}
+
+	Matrix4 referenceMultiply(const Matrix4& a, const Matrix4& b)
+	{
+		Matrix4 output;
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				double sum = 0.0;
+				for (UINT32 k = 0; k < 4; k++)
+					sum += (double)a[i][k] * (double)b[k][j];
+
+				output[i][j] = (float)sum;
+			}
+		}
+
+		return output;
+	}
+
+	Quaternion referenceMultiply(const Quaternion& a, const Quaternion& b)
+	{
+		return Quaternion(
+			a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+			a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+			a.w * b.y + a.y * b.w + a.z * b.x - a.x * b.z,
+			a.w * b.z + a.z * b.w + a.x * b.y - a.y * b.x);
+	}
+
+	Quaternion referenceSlerp(float t, const Quaternion& p, const Quaternion& q)
+	{
+		float cos = p.w * q.w + p.x * q.x + p.y * q.y + p.z * q.z;
+		float sign = 1.0f;
+		if (cos < 0.0f)
+		{
+			cos = -cos;
+			sign = -1.0f;
+		}
+
+		float coeff0, coeff1;
+		bool renormalize = false;
+		if (cos < 1.0f - Quaternion::EPSILON)
+		{
+			float angle = std::atan2(std::sqrt(1.0f - cos * cos), cos);
+			float invSin = 1.0f / std::sin(angle);
+			coeff0 = std::sin((1.0f - t) * angle) * invSin;
+			coeff1 = std::sin(t * angle) * invSin;
+		}
+		else
+		{
+			coeff0 = 1.0f - t;
+			coeff1 = t;
+			renormalize = true;
+		}
+
+		coeff1 *= sign;
+		Quaternion output(
+			coeff0 * p.w + coeff1 * q.w,
+			coeff0 * p.x + coeff1 * q.x,
+			coeff0 * p.y + coeff1 * q.y,
+			coeff0 * p.z + coeff1 * q.z);
+
+		if (renormalize)
+			output.normalize();
+
+		return output;
+	}
+
+	MathTestSuite::MathTestSuite()
+	{
+		BS_ADD_TEST(MathTestSuite::testMatrixMultiply);
+		BS_ADD_TEST(MathTestSuite::testMatrixInverse);
+		BS_ADD_TEST(MathTestSuite::testMatrixBatchTransform);
+		BS_ADD_TEST(MathTestSuite::testQuaternionMultiply);
+		BS_ADD_TEST(MathTestSuite::testQuaternionSlerp);
+		BS_ADD_TEST(MathTestSuite::testMath_benchmark);
+		BS_ADD_TEST(MathTestSuite::testAABBTree);
+		BS_ADD_TEST(MathTestSuite::testAABBTree_benchmark);
+	}
+
+	void MathTestSuite::testMatrixMultiply()
+	{
+		UINT32 seed = 1;
+		for (UINT32 i = 0; i < 100; i++)
+		{
+			Matrix4 a = randomMatrix(seed);
+			Matrix4 b = randomMatrix(seed);
+			BS_TEST_ASSERT(approxEquals(a * b, referenceMultiply(a, b)));
+
+			Matrix4 affineA = randomAffineMatrix(seed);
+			Matrix4 affineB = randomAffineMatrix(seed);
+			Matrix4 concatenated = affineA.concatenateAffine(affineB);
+			BS_TEST_ASSERT(approxEquals(concatenated, referenceMultiply(affineA, affineB)));
+			BS_TEST_ASSERT(concatenated.isAffine());
+		}
+
+		BS_TEST_ASSERT(Matrix4::IDENTITY * Matrix4::IDENTITY == Matrix4::IDENTITY);
+	}
+
+	void MathTestSuite::testMatrixInverse()
+	{
+		UINT32 seed = 2;
+		for (UINT32 i = 0; i < 100; i++)
+		{
+			Matrix4 affine = randomAffineMatrix(seed);
+			Matrix4 inverse = affine.inverse();
+			BS_TEST_ASSERT(approxEquals(inverse, affine.inverseAffine()));
+			BS_TEST_ASSERT(approxEquals(referenceMultiply(affine, inverse), Matrix4::IDENTITY));
+
+			// Skip (nearly) singular matrices
+			Matrix4 general = randomMatrix(seed);
+			if (Math::abs(general.determinant()) < 1.0f)
+				continue;
+
+			BS_TEST_ASSERT(approxEquals(referenceMultiply(general, general.inverse()), Matrix4::IDENTITY));
+		}
+
+		BS_TEST_ASSERT(Matrix4::IDENTITY.inverse() == Matrix4::IDENTITY);
+	}
+
+	void MathTestSuite::testMatrixBatchTransform()
+	{
+		UINT32 seed = 3;
+		Matrix4 transform = randomAffineMatrix(seed);
+
+		// Test all remainder sizes, so both the batched and the per-element paths get validated
+		for (UINT32 count = 0; count < 19; count++)
+		{
+			Vector<Vector3> input(count);
+			for (auto& entry : input)
+				entry = randomVector3(seed, 50.0f);
+
+			Vector<Vector3> points(count);
+			Vector<Vector3> directions(count);
+			transform.multiplyAffine(input.data(), points.data(), count);
+			transform.multiplyDirection(input.data(), directions.data(), count);
+
+			for (UINT32 i = 0; i < count; i++)
+			{
+				const Vector3& v = input[i];
+				Vector3 direction(
+					transform[0][0] * v.x + transform[0][1] * v.y + transform[0][2] * v.z,
+					transform[1][0] * v.x + transform[1][1] * v.y + transform[1][2] * v.z,
+					transform[2][0] * v.x + transform[2][1] * v.y + transform[2][2] * v.z);
+				Vector3 point = direction + transform.getTranslation();
+
+				BS_TEST_ASSERT(approxEquals(points[i], point));
+				BS_TEST_ASSERT(approxEquals(directions[i], direction));
+			}
+
+			// In-place transform
+			transform.multiplyAffine(input.data(), input.data(), count);
+			for (UINT32 i = 0; i < count; i++)
+				BS_TEST_ASSERT(approxEquals(input[i], points[i]));
+		}
+	}
+
+	void MathTestSuite::testQuaternionMultiply()
+	{
+		UINT32 seed = 4;
+		for (UINT32 i = 0; i < 100; i++)
+		{
+			Quaternion a = randomRotation(seed);
+			Quaternion b = randomRotation(seed);
+			Quaternion expected = referenceMultiply(a, b);
+
+			BS_TEST_ASSERT(approxEquals(a * b, expected));
+
+			Quaternion c = a;
+			c *= b;
+			BS_TEST_ASSERT(approxEquals(c, expected));
+
+			// Combined rotation must match applying the rotations in sequence
+			Vector3 v = randomVector3(seed, 10.0f);
+			BS_TEST_ASSERT(approxEquals((a * b).rotate(v), a.rotate(b.rotate(v))));
+		}
+	}
+
+	void MathTestSuite::testQuaternionSlerp()
+	{
+		UINT32 seed = 5;
+		for (UINT32 i = 0; i < 100; i++)
+		{
+			Quaternion p = randomRotation(seed);
+			Quaternion q = randomRotation(seed);
+			float t = nextRandom(seed) * 0.5f + 0.5f;
+
+			BS_TEST_ASSERT(approxEquals(Quaternion::slerp(t, p, q), referenceSlerp(t, p, q)));
+			BS_TEST_ASSERT(approxEquals(Quaternion::slerp(0.0f, p, q), p));
+
+			// Nearly identical rotations take the linear interpolation path
+			Quaternion nearP = Quaternion::normalize(Quaternion(p.w + 1e-5f, p.x, p.y, p.z));
+			BS_TEST_ASSERT(approxEquals(Quaternion::slerp(t, p, nearP), referenceSlerp(t, p, nearP)));
+		}
+	}
+
+	void MathTestSuite::testMath_benchmark()
+	{
+		const UINT32 NUM_ELEMENTS = 1024;
+		const UINT32 NUM_ITERATIONS = 200;
+
+		UINT32 seed = 6;
+		Vector<Matrix4> matrices(NUM_ELEMENTS);
+		Vector<Quaternion> rotations(NUM_ELEMENTS);
+		Vector<Vector3> points(NUM_ELEMENTS);
+		for (UINT32 i = 0; i < NUM_ELEMENTS; i++)
+		{
+			matrices[i] = randomAffineMatrix(seed);
+			rotations[i] = randomRotation(seed);
+			points[i] = randomVector3(seed, 50.0f);
+		}
+
+		Vector<Matrix4> matrixOutput(NUM_ELEMENTS);
+		Vector<Quaternion> rotationOutput(NUM_ELEMENTS);
+		Vector<Vector3> pointOutput(NUM_ELEMENTS);
+
+		// Returns the average time of a single operation in nanoseconds
+		auto measure = [&](const std::function<void()>& operation)
+		{
+			Timer timer;
+			UINT64 startTime = timer.getMicroseconds();
+
+			for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+				operation();
+
+			UINT64 time = timer.getMicroseconds() - startTime;
+			return (time * 1000.0f) / (NUM_ITERATIONS * NUM_ELEMENTS);
+		};
+
+		float multiplyTime = measure([&]()
+		{
+			for (UINT32 i = 0; i < NUM_ELEMENTS; i++)
+				matrixOutput[i] = matrices[i] * matrices[(i + 1) % NUM_ELEMENTS];
+		});
+
+		float concatenateTime = measure([&]()
+		{
+			for (UINT32 i = 0; i < NUM_ELEMENTS; i++)
+				matrixOutput[i] = matrices[i].concatenateAffine(matrices[(i + 1) % NUM_ELEMENTS]);
+		});
+
+		float inverseTime = measure([&]()
+		{
+			for (UINT32 i = 0; i < NUM_ELEMENTS; i++)
+				matrixOutput[i] = matrices[i].inverse();
+		});
+
+		float batchTransformTime = measure([&]()
+		{
+			matrices[0].multiplyAffine(points.data(), pointOutput.data(), NUM_ELEMENTS);
+		});
+
+		float quatMultiplyTime = measure([&]()
+		{
+			for (UINT32 i = 0; i < NUM_ELEMENTS; i++)
+				rotationOutput[i] = rotations[i] * rotations[(i + 1) % NUM_ELEMENTS];
+		});
+
+		float slerpTime = measure([&]()
+		{
+			for (UINT32 i = 0; i < NUM_ELEMENTS; i++)
+				rotationOutput[i] = Quaternion::slerp(0.3f, rotations[i], rotations[(i + 1) % NUM_ELEMENTS]);
+		});
+
+		// Make sure the results are used, so the operations don't get optimized out
+		BS_TEST_ASSERT(!Math::isNaN(matrixOutput[0][0][0] + rotationOutput[0].w + pointOutput[0].x));
+
+		LOGDBG("Math operations with BS_SIMD " + toString(BS_SIMD) + ": matrix multiply " + toString(multiplyTime) +
+			" ns, affine concatenate " + toString(concatenateTime) + " ns, inverse " + toString(inverseTime) + 
+			" ns, batched affine transform " + toString(batchTransformTime) + " ns per vector, quaternion multiply " + 
+			toString(quatMultiplyTime) + " ns, slerp " + toString(slerpTime) + " ns");
+	}
+
+	void MathTestSuite::testAABBTree()
+	{
+		UINT32 seed = 6;
+		AABBTree tree(0.5f);
+
+		// Tree id and bounds for every object, indexed by user data. Removed objects have an invalid id.
+		const UINT32 NUM_OBJECTS = 1000;
+		Vector<UINT32> ids(NUM_OBJECTS, AABBTree::INVALID_ID);
+		Vector<AABox> bounds(NUM_OBJECTS);
+
+		auto randomBox = [&seed]()
+		{
+			Vector3 center = randomVector3(seed, 100.0f);
+			Vector3 extents = randomVector3(seed, 5.0f);
+			extents = Vector3(Math::abs(extents.x), Math::abs(extents.y), Math::abs(extents.z));
+
+			return AABox(center - extents, center + extents);
+		};
+
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			bounds[i] = randomBox();
+			ids[i] = tree.insert(bounds[i], i);
+		}
+
+		// Move, remove and re-add random objects
+		for (UINT32 i = 0; i < NUM_OBJECTS * 2; i++)
+		{
+			UINT32 idx = (UINT32)((nextRandom(seed) * 0.5f + 0.5f) * (NUM_OBJECTS - 1));
+			float action = nextRandom(seed);
+
+			if (ids[idx] == AABBTree::INVALID_ID)
+			{
+				bounds[idx] = randomBox();
+				ids[idx] = tree.insert(bounds[idx], idx);
+			}
+			else if (action < -0.8f)
+			{
+				tree.remove(ids[idx]);
+				ids[idx] = AABBTree::INVALID_ID;
+			}
+			else
+			{
+				Vector3 offset = randomVector3(seed, action < 0.0f ? 0.2f : 20.0f);
+				bounds[idx] = AABox(bounds[idx].getMin() + offset, bounds[idx].getMax() + offset);
+				tree.update(ids[idx], bounds[idx]);
+			}
+		}
+
+		UINT32 numObjects = 0;
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			if (ids[i] == AABBTree::INVALID_ID)
+				continue;
+
+			BS_TEST_ASSERT(tree.getUserData(ids[i]) == i);
+			BS_TEST_ASSERT(tree.getFatBounds(ids[i]).contains(bounds[i]));
+			numObjects++;
+		}
+
+		BS_TEST_ASSERT(tree.getNumObjects() == numObjects);
+
+		// Tree must remain balanced (within a small factor of the optimal height)
+		BS_TEST_ASSERT(tree.getHeight() <= 4 * (UINT32)std::ceil(std::log2((float)numObjects)));
+
+		// Queries must report exactly the objects whose enlarged bounds pass the test
+		Vector<UINT32> found(NUM_OBJECTS);
+		auto verify = [&](std::function<bool(const AABox&)> test)
+		{
+			for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+			{
+				bool expected = ids[i] != AABBTree::INVALID_ID && test(tree.getFatBounds(ids[i]));
+				BS_TEST_ASSERT(found[i] == (expected ? 1u : 0u));
+			}
+		};
+
+		auto record = [&found](UINT32 userData) { found[userData]++; };
+
+		for (UINT32 i = 0; i < 10; i++)
+		{
+			AABox box = randomBox();
+			Sphere sphere(randomVector3(seed, 100.0f), nextRandom(seed) * 10.0f + 20.0f);
+			Ray ray(randomVector3(seed, 100.0f), Vector3::normalize(randomVector3(seed, 1.0f)));
+
+			std::fill(found.begin(), found.end(), 0);
+			tree.query(box, record);
+			verify([&box](const AABox& bounds) { return bounds.intersects(box); });
+
+			std::fill(found.begin(), found.end(), 0);
+			tree.query(sphere, record);
+			verify([&sphere](const AABox& bounds) { return bounds.intersects(sphere); });
+
+			std::fill(found.begin(), found.end(), 0);
+			tree.query(ray, record);
+			verify([&ray](const AABox& bounds) { return bounds.intersects(ray).first; });
+
+			// Frustum-like volume, reporting whether objects are fully inside
+			Vector3 center = randomVector3(seed, 50.0f);
+			Vector<Plane> planes =
+			{
+				Plane(Vector3::normalize(Vector3(1.0f, 0.2f, 0.0f)), center - Vector3(40.0f, 0.0f, 0.0f)),
+				Plane(Vector3::normalize(Vector3(-1.0f, 0.2f, 0.0f)), center + Vector3(40.0f, 0.0f, 0.0f)),
+				Plane(Vector3(0.0f, 1.0f, 0.0f), center - Vector3(0.0f, 30.0f, 0.0f)),
+				Plane(Vector3(0.0f, -1.0f, 0.0f), center + Vector3(0.0f, 30.0f, 0.0f)),
+				Plane(Vector3(0.0f, 0.0f, 1.0f), center - Vector3(0.0f, 0.0f, 50.0f)),
+				Plane(Vector3(0.0f, 0.0f, -1.0f), center + Vector3(0.0f, 0.0f, 50.0f))
+			};
+			ConvexVolume volume(planes);
+
+			std::fill(found.begin(), found.end(), 0);
+			tree.query(volume, [&](UINT32 userData, bool inside)
+			{
+				found[userData]++;
+
+				if (inside)
+				{
+					const AABox& fatBounds = tree.getFatBounds(ids[userData]);
+					for (auto& plane : planes)
+					{
+						for (UINT32 j = 0; j < 8; j++)
+						{
+							Vector3 corner = fatBounds.getCorner((AABox::CornerEnum)j);
+							BS_TEST_ASSERT(plane.getDistance(corner) >= -TOLERANCE);
+						}
+					}
+				}
+			});
+			verify([&volume](const AABox& bounds) { return volume.intersects(bounds); });
+		}
+
+		// Removing everything must leave an empty tree
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			if (ids[i] != AABBTree::INVALID_ID)
+				tree.remove(ids[i]);
+		}
+
+		BS_TEST_ASSERT(tree.getNumObjects() == 0);
+
+		UINT32 numFound = 0;
+		tree.query(AABox(Vector3(-1000.0f, -1000.0f, -1000.0f), Vector3(1000.0f, 1000.0f, 1000.0f)),
+			[&numFound](UINT32 userData) { numFound++; });
+		BS_TEST_ASSERT(numFound == 0);
+	}
+
+	void MathTestSuite::testAABBTree_benchmark()
+	{
+		const UINT32 NUM_QUERIES = 20;
+
+		// Objects are spread so their density stays the same as their number grows, and the query volume is always of the
+		// same size, same as a camera moving through an increasingly large world
+		for (UINT32 numObjects = 1000; numObjects <= 1000000; numObjects *= 10)
+		{
+			UINT32 seed = 6;
+			float worldSize = 10.0f * std::cbrt((float)numObjects);
+
+			Vector<AABox> bounds(numObjects);
+			for (UINT32 i = 0; i < numObjects; i++)
+			{
+				Vector3 center = randomVector3(seed, worldSize);
+				Vector3 extents = randomVector3(seed, 2.0f);
+				extents = Vector3(Math::abs(extents.x), Math::abs(extents.y), Math::abs(extents.z));
+
+				bounds[i] = AABox(center - extents, center + extents);
+			}
+
+			Vector<ConvexVolume> volumes(NUM_QUERIES);
+			for (UINT32 i = 0; i < NUM_QUERIES; i++)
+			{
+				Vector3 center = randomVector3(seed, worldSize);
+				Vector<Plane> planes =
+				{
+					Plane(Vector3(1.0f, 0.0f, 0.0f), center - Vector3(50.0f, 0.0f, 0.0f)),
+					Plane(Vector3(-1.0f, 0.0f, 0.0f), center + Vector3(50.0f, 0.0f, 0.0f)),
+					Plane(Vector3(0.0f, 1.0f, 0.0f), center - Vector3(0.0f, 50.0f, 0.0f)),
+					Plane(Vector3(0.0f, -1.0f, 0.0f), center + Vector3(0.0f, 50.0f, 0.0f)),
+					Plane(Vector3(0.0f, 0.0f, 1.0f), center - Vector3(0.0f, 0.0f, 50.0f)),
+					Plane(Vector3(0.0f, 0.0f, -1.0f), center + Vector3(0.0f, 0.0f, 50.0f))
+				};
+
+				volumes[i] = ConvexVolume(planes);
+			}
+
+			Timer timer;
+			UINT64 startTime = timer.getMicroseconds();
+
+			AABBTree tree;
+			Vector<UINT32> ids(numObjects);
+			for (UINT32 i = 0; i < numObjects; i++)
+				ids[i] = tree.insert(bounds[i], i);
+
+			UINT64 insertTime = timer.getMicroseconds() - startTime;
+
+			// Move a tenth of the objects, most within their enlarged bounds and some far enough to require re-insertion
+			startTime = timer.getMicroseconds();
+
+			UINT32 numMoved = numObjects / 10;
+			for (UINT32 i = 0; i < numMoved; i++)
+			{
+				UINT32 idx = (i * 7919) % numObjects;
+				Vector3 offset = randomVector3(seed, i % 10 == 0 ? 10.0f : 0.05f);
+
+				bounds[idx] = AABox(bounds[idx].getMin() + offset, bounds[idx].getMax() + offset);
+				tree.update(ids[idx], bounds[idx]);
+			}
+
+			UINT64 updateTime = timer.getMicroseconds() - startTime;
+
+			startTime = timer.getMicroseconds();
+
+			UINT32 numFoundTree = 0;
+			for (auto& volume : volumes)
+				tree.query(volume, [&numFoundTree](UINT32 userData, bool inside) { numFoundTree++; });
+
+			UINT64 queryTime = timer.getMicroseconds() - startTime;
+
+			// Linear scan the tree replaces
+			startTime = timer.getMicroseconds();
+
+			UINT32 numFoundLinear = 0;
+			for (auto& volume : volumes)
+			{
+				for (auto& entry : bounds)
+				{
+					if (volume.intersects(entry))
+						numFoundLinear++;
+				}
+			}
+
+			UINT64 linearTime = timer.getMicroseconds() - startTime;
+
+			// Tree reports objects using their enlarged bounds, so it can only find more
+			BS_TEST_ASSERT(numFoundTree >= numFoundLinear);
+
+			LOGDBG("AABB tree with " + toString(numObjects) + " objects: insert " + 
+				toString((insertTime * 1000.0f) / numObjects) + " ns, update " + 
+				toString((updateTime * 1000.0f) / numMoved) + " ns per object, frustum query " + 
+				toString(queryTime / (float)NUM_QUERIES) + " us (linear scan " + toString(linearTime / (float)NUM_QUERIES) + 
+				" us), " + toString(numFoundTree / NUM_QUERIES) + " objects found on average");
+		}
+	}
+}
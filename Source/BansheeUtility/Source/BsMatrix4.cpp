@@ -72,6 +72,89 @@ namespace BansheeEngine
 
     Matrix4 Matrix4::inverse() const
     {
+#if BS_SIMD != BS_SIMD_NONE
+		// Cramer's rule, as described in Intel's "Streaming SIMD Extensions - Inverse of 4x4 Matrix"
+		__m128 row0, row1, row2, row3;
+		__m128 minor0, minor1, minor2, minor3;
+
+		// Load the matrix transposed
+		__m128 tmp = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(_m)), (const __m64*)(_m + 4));
+		row1 = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(_m + 8)), (const __m64*)(_m + 12));
+		row0 = _mm_shuffle_ps(tmp, row1, 0x88);
+		row1 = _mm_shuffle_ps(row1, tmp, 0xDD);
+		tmp = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(_m + 2)), (const __m64*)(_m + 6));
+		row3 = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(_m + 10)), (const __m64*)(_m + 14));
+		row2 = _mm_shuffle_ps(tmp, row3, 0x88);
+		row3 = _mm_shuffle_ps(row3, tmp, 0xDD);
+
+		// Cofactors
+		tmp = _mm_mul_ps(row2, row3);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+		minor0 = _mm_mul_ps(row1, tmp);
+		minor1 = _mm_mul_ps(row0, tmp);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+		minor0 = _mm_sub_ps(_mm_mul_ps(row1, tmp), minor0);
+		minor1 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor1);
+		minor1 = _mm_shuffle_ps(minor1, minor1, 0x4E);
+
+		tmp = _mm_mul_ps(row1, row2);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+		minor0 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor0);
+		minor3 = _mm_mul_ps(row0, tmp);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+		minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row3, tmp));
+		minor3 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor3);
+		minor3 = _mm_shuffle_ps(minor3, minor3, 0x4E);
+
+		tmp = _mm_mul_ps(_mm_shuffle_ps(row1, row1, 0x4E), row3);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+		row2 = _mm_shuffle_ps(row2, row2, 0x4E);
+		minor0 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor0);
+		minor2 = _mm_mul_ps(row0, tmp);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+		minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row2, tmp));
+		minor2 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor2);
+		minor2 = _mm_shuffle_ps(minor2, minor2, 0x4E);
+
+		tmp = _mm_mul_ps(row0, row1);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+		minor2 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor2);
+		minor3 = _mm_sub_ps(_mm_mul_ps(row2, tmp), minor3);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+		minor2 = _mm_sub_ps(_mm_mul_ps(row3, tmp), minor2);
+		minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row2, tmp));
+
+		tmp = _mm_mul_ps(row0, row3);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+		minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row2, tmp));
+		minor2 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor2);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+		minor1 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor1);
+		minor2 = _mm_sub_ps(minor2, _mm_mul_ps(row1, tmp));
+
+		tmp = _mm_mul_ps(row0, row2);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+		minor1 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor1);
+		minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row1, tmp));
+		tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+		minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row3, tmp));
+		minor3 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor3);
+
+		// Determinant (using a full precision division, rather than a reciprocal estimate, to match the scalar version)
+		__m128 det = _mm_mul_ps(row0, minor0);
+		det = _mm_add_ps(_mm_shuffle_ps(det, det, 0x4E), det);
+		det = _mm_add_ss(_mm_shuffle_ps(det, det, 0xB1), det);
+		det = _mm_div_ss(_mm_set_ss(1.0f), det);
+		det = _mm_shuffle_ps(det, det, 0x00);
+
+		Matrix4 output;
+		_mm_storeu_ps(output._m + 0, _mm_mul_ps(det, minor0));
+		_mm_storeu_ps(output._m + 4, _mm_mul_ps(det, minor1));
+		_mm_storeu_ps(output._m + 8, _mm_mul_ps(det, minor2));
+		_mm_storeu_ps(output._m + 12, _mm_mul_ps(det, minor3));
+
+		return output;
+#else
         float m00 = m[0][0], m01 = m[0][1], m02 = m[0][2], m03 = m[0][3];
         float m10 = m[1][0], m11 = m[1][1], m12 = m[1][2], m13 = m[1][3];
         float m20 = m[2][0], m21 = m[2][1], m22 = m[2][2], m23 = m[2][3];
@@ -130,6 +213,7 @@ namespace BansheeEngine
             d10, d11, d12, d13,
             d20, d21, d22, d23,
             d30, d31, d32, d33);
+#endif
     }
 
     Matrix4 Matrix4::inverseAffine() const
@@ -344,6 +428,77 @@ namespace BansheeEngine
 		return mat;
 	}
 
+	void Matrix4::multiplyAffine(const Vector3* input, Vector3* output, UINT32 count) const
+	{
+		BS_ASSERT(isAffine());
+
+		UINT32 i = 0;
+
+#if BS_SIMD != BS_SIMD_NONE
+		// Transform four points at a time, by converting them into a structure-of-arrays layout
+		__m128 m00 = _mm_set1_ps(m[0][0]), m01 = _mm_set1_ps(m[0][1]), m02 = _mm_set1_ps(m[0][2]), m03 = _mm_set1_ps(m[0][3]);
+		__m128 m10 = _mm_set1_ps(m[1][0]), m11 = _mm_set1_ps(m[1][1]), m12 = _mm_set1_ps(m[1][2]), m13 = _mm_set1_ps(m[1][3]);
+		__m128 m20 = _mm_set1_ps(m[2][0]), m21 = _mm_set1_ps(m[2][1]), m22 = _mm_set1_ps(m[2][2]), m23 = _mm_set1_ps(m[2][3]);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const float* src = &input[i].x;
+			float* dst = &output[i].x;
+
+			__m128 x, y, z;
+			simdAoSToSoA(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x, y, z);
+
+			__m128 outX = simdMulAdd(m02, z, simdMulAdd(m01, y, simdMulAdd(m00, x, m03)));
+			__m128 outY = simdMulAdd(m12, z, simdMulAdd(m11, y, simdMulAdd(m10, x, m13)));
+			__m128 outZ = simdMulAdd(m22, z, simdMulAdd(m21, y, simdMulAdd(m20, x, m23)));
+
+			__m128 a, b, c;
+			simdSoAToAoS(outX, outY, outZ, a, b, c);
+
+			_mm_storeu_ps(dst, a);
+			_mm_storeu_ps(dst + 4, b);
+			_mm_storeu_ps(dst + 8, c);
+		}
+#endif
+
+		for (; i < count; i++)
+			output[i] = multiplyAffine(input[i]);
+	}
+
+	void Matrix4::multiplyDirection(const Vector3* input, Vector3* output, UINT32 count) const
+	{
+		UINT32 i = 0;
+
+#if BS_SIMD != BS_SIMD_NONE
+		__m128 m00 = _mm_set1_ps(m[0][0]), m01 = _mm_set1_ps(m[0][1]), m02 = _mm_set1_ps(m[0][2]);
+		__m128 m10 = _mm_set1_ps(m[1][0]), m11 = _mm_set1_ps(m[1][1]), m12 = _mm_set1_ps(m[1][2]);
+		__m128 m20 = _mm_set1_ps(m[2][0]), m21 = _mm_set1_ps(m[2][1]), m22 = _mm_set1_ps(m[2][2]);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const float* src = &input[i].x;
+			float* dst = &output[i].x;
+
+			__m128 x, y, z;
+			simdAoSToSoA(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x, y, z);
+
+			__m128 outX = simdMulAdd(m02, z, simdMulAdd(m01, y, _mm_mul_ps(m00, x)));
+			__m128 outY = simdMulAdd(m12, z, simdMulAdd(m11, y, _mm_mul_ps(m10, x)));
+			__m128 outZ = simdMulAdd(m22, z, simdMulAdd(m21, y, _mm_mul_ps(m20, x)));
+
+			__m128 a, b, c;
+			simdSoAToAoS(outX, outY, outZ, a, b, c);
+
+			_mm_storeu_ps(dst, a);
+			_mm_storeu_ps(dst + 4, b);
+			_mm_storeu_ps(dst + 8, c);
+		}
+#endif
+
+		for (; i < count; i++)
+			output[i] = multiplyDirection(input[i]);
+	}
+
 	Matrix4 Matrix4::inverseTRS(const Vector3& translation, const Quaternion& rotation, const Vector3& scale)
 	{
 		Matrix4 mat;
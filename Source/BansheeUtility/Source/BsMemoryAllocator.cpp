@@ -6,4 +6,276 @@ namespace BansheeEngine
 {
 	UINT64 BS_THREADLOCAL MemoryCounter::Allocs = 0;
 	UINT64 BS_THREADLOCAL MemoryCounter::Frees = 0;
+
+	struct PoolThreadCache;
+
+	/** Header placed in front of every allocation made by the pool allocator. */
+	struct alignas(16) PoolBlockHeader
+	{
+		PoolThreadCache* owner; /**< Cache the block was carved from, or null for large allocations. */
+		UINT32 sizeClass;
+	};
+
+	/** Block sitting in one of the free lists. Link to the next block is stored in place of the user data. */
+	struct PoolFreeBlock
+	{
+		PoolFreeBlock* next;
+	};
+
+	static const UINT32 POOL_NUM_SIZE_CLASSES = 24;
+	static const UINT32 POOL_LARGE_SIZE_CLASS = (UINT32)-1;
+	static const UINT32 POOL_CHUNK_SIZE = 64 * 1024;
+
+	/**
+	 * Maximum allocation size for each size class. Sixteen byte steps for the smallest sizes, and four classes per power
+	 * of two after that, keeping the wasted space below 25%.
+	 */
+	static const UINT32 POOL_CLASS_SIZES[POOL_NUM_SIZE_CLASSES] =
+	{
+		16, 32, 48, 64, 80, 96, 112, 128,
+		160, 192, 224, 256,
+		320, 384, 448, 512,
+		640, 768, 896, 1024,
+		1280, 1536, 1792, 2048
+	};
+
+	static_assert(sizeof(PoolBlockHeader) == 16, "Block header must preserve 16 byte alignment.");
+
+	/** 
+	 * Maps allocation sizes to size classes. Indexed by the allocation size divided by 16, rounded up. Entry N refers to
+	 * the smallest size class that fits N * 16 bytes.
+	 */
+	static const UINT8 POOL_SIZE_CLASS_LOOKUP[MemoryAllocator<PoolAlloc>::MAX_POOLED_SIZE / 16 + 1] =
+	{
+		0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 9, 10, 10, 11,
+		11, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15,
+		15, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17,
+		17, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19,
+		19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+		20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+		21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+		22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+		23
+	};
+
+	/**
+	 * Free lists and statistics for a single thread. Only the thread currently owning the cache accesses the free lists
+	 * and writes to the statistics, except for the remote free lists and the remote free counters.
+	 */
+	struct PoolThreadCache
+	{
+		PoolFreeBlock* freeLists[POOL_NUM_SIZE_CLASSES];
+		std::atomic<PoolFreeBlock*> remoteFreeLists[POOL_NUM_SIZE_CLASSES];
+
+		UINT8* chunkPos;
+		UINT8* chunkEnd;
+
+		std::atomic<UINT64> numAllocs[POOL_NUM_SIZE_CLASSES];
+		std::atomic<UINT64> numFrees[POOL_NUM_SIZE_CLASSES];
+		std::atomic<UINT64> numRemoteFrees[POOL_NUM_SIZE_CLASSES];
+		std::atomic<UINT64> numBlocks[POOL_NUM_SIZE_CLASSES];
+
+		std::atomic<bool> inUse;
+		PoolThreadCache* next;
+	};
+
+	/** List of all caches ever created. Caches are never destroyed, so the list only grows. */
+	static std::atomic<PoolThreadCache*> gPoolThreadCaches(nullptr);
+
+	static BS_THREADLOCAL PoolThreadCache* gPoolCurrentCache = nullptr;
+	static BS_THREADLOCAL bool gPoolThreadExiting = false;
+
+	/** Increments a counter only ever written to by a single thread, avoiding the cost of an atomic read-modify-write. */
+	static void poolIncrement(std::atomic<UINT64>& counter)
+	{
+		counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+
+	/** Reuses a cache of a thread that exited, or creates a new one if none are available. */
+	static PoolThreadCache* poolAcquireCache()
+	{
+		for (PoolThreadCache* cache = gPoolThreadCaches.load(std::memory_order_acquire); cache != nullptr;
+			cache = cache->next)
+		{
+			bool expected = false;
+			if (!cache->inUse.load(std::memory_order_relaxed) &&
+				cache->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+			{
+				return cache;
+			}
+		}
+
+		// Value initialization zeroes out all the lists and counters
+		PoolThreadCache* cache = new (malloc(sizeof(PoolThreadCache))) PoolThreadCache();
+		cache->inUse.store(true, std::memory_order_relaxed);
+
+		cache->next = gPoolThreadCaches.load(std::memory_order_relaxed);
+		while (!gPoolThreadCaches.compare_exchange_weak(cache->next, cache, std::memory_order_release))
+		{ }
+
+		return cache;
+	}
+
+	/** Releases the cache of the current thread when the thread exits, so it can be reused by other threads. */
+	struct PoolThreadCacheRelease
+	{
+		~PoolThreadCacheRelease()
+		{
+			gPoolThreadExiting = true;
+
+			if (gPoolCurrentCache != nullptr)
+			{
+				gPoolCurrentCache->inUse.store(false, std::memory_order_release);
+				gPoolCurrentCache = nullptr;
+			}
+		}
+	};
+
+	// Note: BS_THREADLOCAL doesn't support types with destructors
+	static thread_local PoolThreadCacheRelease gPoolThreadCacheRelease;
+
+	/** Returns the cache for the current thread, or null if the thread is exiting and the cache was already released. */
+	static PoolThreadCache* poolGetCache()
+	{
+		if (gPoolCurrentCache == nullptr && !gPoolThreadExiting)
+		{
+			(void)&gPoolThreadCacheRelease; // Ensures the destructor runs on thread exit
+			gPoolCurrentCache = poolAcquireCache();
+		}
+
+		return gPoolCurrentCache;
+	}
+
+	/** Allocates memory directly from the OS, with a header marking it as such. */
+	static void* poolAllocateLarge(size_t bytes)
+	{
+		PoolBlockHeader* header = (PoolBlockHeader*)platformAlignedAlloc16(sizeof(PoolBlockHeader) + bytes);
+		header->owner = nullptr;
+		header->sizeClass = POOL_LARGE_SIZE_CLASS;
+
+		return header + 1;
+	}
+
+	/** Creates a new block of the provided size class from the cache's current chunk, requesting a new chunk if needed. */
+	static PoolFreeBlock* poolCarveBlock(PoolThreadCache* cache, UINT32 sizeClass)
+	{
+		UINT32 blockSize = sizeof(PoolBlockHeader) + POOL_CLASS_SIZES[sizeClass];
+		if (cache->chunkPos + blockSize > cache->chunkEnd)
+		{
+			// Remainder of the current chunk is wasted, but it is always less than a single block
+			cache->chunkPos = (UINT8*)platformAlignedAlloc16(POOL_CHUNK_SIZE);
+			cache->chunkEnd = cache->chunkPos + POOL_CHUNK_SIZE;
+		}
+
+		PoolBlockHeader* header = (PoolBlockHeader*)cache->chunkPos;
+		header->owner = cache;
+		header->sizeClass = sizeClass;
+
+		cache->chunkPos += blockSize;
+		poolIncrement(cache->numBlocks[sizeClass]);
+
+		PoolFreeBlock* block = (PoolFreeBlock*)(header + 1);
+		block->next = nullptr;
+
+		return block;
+	}
+
+	void* MemoryAllocator<PoolAlloc>::allocate(size_t bytes)
+	{
+#if BS_PROFILING_ENABLED
+		incAllocCount();
+#endif
+
+		if (bytes > MAX_POOLED_SIZE)
+			return poolAllocateLarge(bytes);
+
+		PoolThreadCache* cache = poolGetCache();
+		if (cache == nullptr)
+			return poolAllocateLarge(bytes);
+
+		UINT32 sizeClass = POOL_SIZE_CLASS_LOOKUP[(bytes + 15) / 16];
+
+		PoolFreeBlock* block = cache->freeLists[sizeClass];
+		if (block == nullptr)
+		{
+			// Reclaim blocks freed by other threads, all at once
+			block = cache->remoteFreeLists[sizeClass].exchange(nullptr, std::memory_order_acquire);
+
+			if (block == nullptr)
+				block = poolCarveBlock(cache, sizeClass);
+		}
+
+		cache->freeLists[sizeClass] = block->next;
+		poolIncrement(cache->numAllocs[sizeClass]);
+
+		return block;
+	}
+
+	void MemoryAllocator<PoolAlloc>::free(void* ptr)
+	{
+		if (ptr == nullptr)
+			return;
+
+#if BS_PROFILING_ENABLED
+		incFreeCount();
+#endif
+
+		PoolBlockHeader* header = ((PoolBlockHeader*)ptr) - 1;
+		if (header->sizeClass == POOL_LARGE_SIZE_CLASS)
+		{
+			platformAlignedFree16(header);
+			return;
+		}
+
+		PoolThreadCache* owner = header->owner;
+		UINT32 sizeClass = header->sizeClass;
+		PoolFreeBlock* block = (PoolFreeBlock*)ptr;
+
+		if (owner == gPoolCurrentCache)
+		{
+			block->next = owner->freeLists[sizeClass];
+			owner->freeLists[sizeClass] = block;
+
+			poolIncrement(owner->numFrees[sizeClass]);
+		}
+		else
+		{
+			std::atomic<PoolFreeBlock*>& remoteFreeList = owner->remoteFreeLists[sizeClass];
+
+			block->next = remoteFreeList.load(std::memory_order_relaxed);
+			while (!remoteFreeList.compare_exchange_weak(block->next, block, std::memory_order_release,
+				std::memory_order_relaxed))
+			{ }
+
+			owner->numRemoteFrees[sizeClass].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	UINT32 MemAllocProfiler::getNumPoolSizeClasses()
+	{
+		return POOL_NUM_SIZE_CLASSES;
+	}
+
+	PoolAllocStats MemAllocProfiler::getPoolStats(UINT32 sizeClass)
+	{
+		PoolAllocStats stats;
+		stats.blockSize = POOL_CLASS_SIZES[sizeClass];
+		stats.numAllocs = 0;
+		stats.numFrees = 0;
+		stats.numRemoteFrees = 0;
+		stats.numBlocks = 0;
+
+		for (PoolThreadCache* cache = gPoolThreadCaches.load(std::memory_order_acquire); cache != nullptr;
+			cache = cache->next)
+		{
+			UINT64 numRemoteFrees = cache->numRemoteFrees[sizeClass].load(std::memory_order_relaxed);
+
+			stats.numAllocs += cache->numAllocs[sizeClass].load(std::memory_order_relaxed);
+			stats.numFrees += cache->numFrees[sizeClass].load(std::memory_order_relaxed) + numRemoteFrees;
+			stats.numRemoteFrees += numRemoteFrees;
+			stats.numBlocks += cache->numBlocks[sizeClass].load(std::memory_order_relaxed);
+		}
+
+		return stats;
+	}
 }
\ No newline at end of file
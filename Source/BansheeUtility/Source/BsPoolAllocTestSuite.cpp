@@ -0,0 +1,229 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsPoolAllocTestSuite.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Returns the index of the smallest pool allocator size class that can fit the provided number of bytes. */
+	static UINT32 findSizeClass(UINT32 bytes)
+	{
+		UINT32 numSizeClasses = MemAllocProfiler::getNumPoolSizeClasses();
+		for (UINT32 i = 0; i < numSizeClasses; i++)
+		{
+			if (MemAllocProfiler::getPoolStats(i).blockSize >= bytes)
+				return i;
+		}
+
+		return (UINT32)-1;
+	}
+
+	PoolAllocTestSuite::PoolAllocTestSuite()
+	{
+		BS_ADD_TEST(PoolAllocTestSuite::testSizeClasses);
+		BS_ADD_TEST(PoolAllocTestSuite::testCrossThreadFree);
+		BS_ADD_TEST(PoolAllocTestSuite::testPoolAlloc_benchmark);
+	}
+
+	void PoolAllocTestSuite::testSizeClasses()
+	{
+		UINT32 numSizeClasses = MemAllocProfiler::getNumPoolSizeClasses();
+		BS_TEST_ASSERT(MemAllocProfiler::getPoolStats(0).blockSize == 16);
+		BS_TEST_ASSERT(MemAllocProfiler::getPoolStats(numSizeClasses - 1).blockSize == 
+			MemoryAllocator<PoolAlloc>::MAX_POOLED_SIZE);
+
+		for (UINT32 i = 1; i < numSizeClasses; i++)
+			BS_TEST_ASSERT(MemAllocProfiler::getPoolStats(i - 1).blockSize < MemAllocProfiler::getPoolStats(i).blockSize);
+
+		for (UINT32 size = 0; size <= MemoryAllocator<PoolAlloc>::MAX_POOLED_SIZE + 64; size += 8)
+		{
+			UINT32 sizeClass = findSizeClass(size);
+			bool pooled = sizeClass != (UINT32)-1;
+
+			// Note: Other threads might be allocating as well if the pool is used as the general allocator
+			PoolAllocStats before;
+			if (pooled)
+				before = MemAllocProfiler::getPoolStats(sizeClass);
+
+			UINT8* data = (UINT8*)bs_alloc<PoolAlloc>(size);
+			BS_TEST_ASSERT(((size_t)data & 15) == 0);
+			memset(data, 0xFF, size);
+
+			if (pooled)
+			{
+				PoolAllocStats after = MemAllocProfiler::getPoolStats(sizeClass);
+				BS_TEST_ASSERT(after.numAllocs >= before.numAllocs + 1);
+			}
+
+			bs_free<PoolAlloc>(data);
+
+			if (pooled)
+			{
+				PoolAllocStats after = MemAllocProfiler::getPoolStats(sizeClass);
+				BS_TEST_ASSERT(after.numFrees >= before.numFrees + 1);
+
+				// Most recently freed block of the same size class should be reused
+				UINT8* newData = (UINT8*)bs_alloc<PoolAlloc>(size);
+				BS_TEST_ASSERT(newData == data);
+				bs_free<PoolAlloc>(newData);
+			}
+		}
+
+		// Blocks must not overlap
+		const UINT32 NUM_BLOCKS = 1000;
+		UINT32* blocks[NUM_BLOCKS];
+		for (UINT32 i = 0; i < NUM_BLOCKS; i++)
+		{
+			UINT32 size = 4 + (i * 37) % 3000;
+			blocks[i] = (UINT32*)bs_alloc<PoolAlloc>(size);
+			blocks[i][0] = i;
+			((UINT8*)blocks[i])[size - 1] = (UINT8)i;
+		}
+
+		bool valid = true;
+		for (UINT32 i = 0; i < NUM_BLOCKS; i++)
+		{
+			UINT32 size = 4 + (i * 37) % 3000;
+			valid &= blocks[i][0] == i && ((UINT8*)blocks[i])[size - 1] == (UINT8)i;
+
+			bs_free<PoolAlloc>(blocks[i]);
+		}
+
+		BS_TEST_ASSERT(valid);
+	}
+
+	void PoolAllocTestSuite::testCrossThreadFree()
+	{
+		const UINT32 NUM_THREADS = 4;
+		const UINT32 NUM_BLOCKS = 4000;
+		const UINT32 BLOCK_SIZE = 200;
+		UINT32 sizeClass = findSizeClass(BLOCK_SIZE);
+
+		Vector<void*> blocks(NUM_BLOCKS);
+		for (UINT32 i = 0; i < NUM_BLOCKS; i++)
+			blocks[i] = bs_alloc<PoolAlloc>(BLOCK_SIZE);
+
+		PoolAllocStats before = MemAllocProfiler::getPoolStats(sizeClass);
+
+		// Free the blocks from other threads
+		Vector<Thread> threads;
+		for (UINT32 i = 0; i < NUM_THREADS; i++)
+		{
+			threads.push_back(Thread([&blocks, i]()
+			{
+				for (UINT32 j = i; j < NUM_BLOCKS; j += NUM_THREADS)
+					bs_free<PoolAlloc>(blocks[j]);
+			}));
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		PoolAllocStats afterFree = MemAllocProfiler::getPoolStats(sizeClass);
+		BS_TEST_ASSERT(afterFree.numRemoteFrees == before.numRemoteFrees + NUM_BLOCKS);
+		BS_TEST_ASSERT(afterFree.numFrees == before.numFrees + NUM_BLOCKS);
+
+		// Blocks freed by other threads must be reused by the owner thread, without reserving new ones
+		UnorderedSet<void*> freedBlocks(blocks.begin(), blocks.end());
+
+		bool valid = true;
+		for (UINT32 i = 0; i < NUM_BLOCKS; i++)
+		{
+			blocks[i] = bs_alloc<PoolAlloc>(BLOCK_SIZE);
+			valid &= freedBlocks.erase(blocks[i]) == 1;
+		}
+
+		BS_TEST_ASSERT(valid);
+		BS_TEST_ASSERT(MemAllocProfiler::getPoolStats(sizeClass).numBlocks == afterFree.numBlocks);
+
+		for (UINT32 i = 0; i < NUM_BLOCKS; i++)
+			bs_free<PoolAlloc>(blocks[i]);
+	}
+
+	void PoolAllocTestSuite::testPoolAlloc_benchmark()
+	{
+		const UINT32 NUM_BLOCKS = 20000;
+		const UINT32 NUM_ITERATIONS = 200;
+
+		// Random sizes in the range of typical small allocations (shared pointer control blocks, functors, container nodes)
+		Vector<UINT32> sizes(NUM_BLOCKS);
+		UINT32 seed = 1;
+		for (UINT32 i = 0; i < NUM_BLOCKS; i++)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			sizes[i] = 16 + (seed >> 8) % 241;
+		}
+
+		Vector<void*> blocks(NUM_BLOCKS, nullptr);
+
+		// Per-frame pattern: every block allocated during the frame is freed at its end
+		auto perFrame = [&](auto allocate, auto free)
+		{
+			Timer timer;
+			UINT64 startTime = timer.getMicroseconds();
+
+			for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			{
+				for (UINT32 j = 0; j < NUM_BLOCKS; j++)
+					blocks[j] = allocate(sizes[j]);
+
+				for (UINT32 j = 0; j < NUM_BLOCKS; j++)
+				{
+					free(blocks[j]);
+					blocks[j] = nullptr;
+				}
+			}
+
+			return timer.getMicroseconds() - startTime;
+		};
+
+		// Load pattern: half of the blocks stay alive between iterations, fragmenting the heap
+		auto load = [&](auto allocate, auto free)
+		{
+			Timer timer;
+			UINT64 startTime = timer.getMicroseconds();
+
+			for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			{
+				for (UINT32 j = 0; j < NUM_BLOCKS; j++)
+				{
+					if (blocks[j] == nullptr)
+						blocks[j] = allocate(sizes[(j + i) % NUM_BLOCKS]);
+				}
+
+				for (UINT32 j = i % 2; j < NUM_BLOCKS; j += 2)
+				{
+					free(blocks[j]);
+					blocks[j] = nullptr;
+				}
+			}
+
+			UINT64 time = timer.getMicroseconds() - startTime;
+
+			for (UINT32 j = 0; j < NUM_BLOCKS; j++)
+			{
+				if (blocks[j] != nullptr)
+					free(blocks[j]);
+
+				blocks[j] = nullptr;
+			}
+
+			return time;
+		};
+
+		auto mallocAlloc = [](UINT32 size) { return malloc(size); };
+		auto mallocFree = [](void* data) { ::free(data); };
+		auto poolAlloc = [](UINT32 size) { return bs_alloc<PoolAlloc>(size); };
+		auto poolFree = [](void* data) { bs_free<PoolAlloc>(data); };
+
+		UINT64 perFrameMalloc = perFrame(mallocAlloc, mallocFree);
+		UINT64 perFramePool = perFrame(poolAlloc, poolFree);
+		UINT64 loadMalloc = load(mallocAlloc, mallocFree);
+		UINT64 loadPool = load(poolAlloc, poolFree);
+
+		LOGDBG("Allocating " + toString(NUM_ITERATIONS) + "x" + toString(NUM_BLOCKS) + " blocks: per-frame malloc " + 
+			toString(perFrameMalloc / 1000) + " ms, pool " + toString(perFramePool / 1000) + " ms; load malloc " + 
+			toString(loadMalloc / 1000) + " ms, pool " + toString(loadPool / 1000) + " ms");
+	}
+}
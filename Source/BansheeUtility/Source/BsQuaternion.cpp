@@ -323,6 +323,40 @@ namespace BansheeEngine
 
     Quaternion Quaternion::slerp(float t, const Quaternion& p, const Quaternion& q, bool shortestPath)
     {
+#if BS_SIMD != BS_SIMD_NONE
+		__m128 pVec = _mm_loadu_ps(&p.x);
+		__m128 qVec = _mm_loadu_ps(&q.x);
+
+		float cos = _mm_cvtss_f32(simdDot4(pVec, qVec));
+		if (cos < 0.0f && shortestPath)
+		{
+			cos = -cos;
+			qVec = _mm_xor_ps(qVec, _mm_set1_ps(-0.0f));
+		}
+
+		Quaternion output;
+		if (Math::abs(cos) < 1 - EPSILON)
+		{
+			// Standard case (slerp)
+			float sin = Math::sqrt(1 - Math::sqr(cos));
+			Radian angle = Math::atan2(sin, cos);
+			float invSin = 1.0f / sin;
+			__m128 coeff0 = _mm_set1_ps(Math::sin((1.0f - t) * angle) * invSin);
+			__m128 coeff1 = _mm_set1_ps(Math::sin(t * angle) * invSin);
+
+			_mm_storeu_ps(&output.x, simdMulAdd(coeff0, pVec, _mm_mul_ps(coeff1, qVec)));
+		}
+		else
+		{
+			// Close or inverse quaternions, use linear interpolation and renormalize (see the scalar version below)
+			__m128 lerp = simdMulAdd(_mm_set1_ps(1.0f - t), pVec, _mm_mul_ps(_mm_set1_ps(t), qVec));
+			__m128 invLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(simdDot4(lerp, lerp)));
+
+			_mm_storeu_ps(&output.x, _mm_mul_ps(lerp, invLength));
+		}
+
+		return output;
+#else
         float cos = p.dot(q);
         Quaternion quat;
 
@@ -360,6 +394,7 @@ namespace BansheeEngine
             ret.normalize();
             return ret;
         }
+#endif
     }
 
 	Quaternion Quaternion::getRotationFromTo(const Vector3& from, const Vector3& dest, const Vector3& fallbackAxis)
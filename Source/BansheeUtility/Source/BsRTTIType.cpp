@@ -6,6 +6,7 @@
 namespace BansheeEngine
 {
 	RTTITypeBase::RTTITypeBase()
+		:mPlainFieldsState(0)
 	{ }
 
 	RTTITypeBase::~RTTITypeBase() 
@@ -68,6 +69,33 @@ namespace BansheeEngine
 		mFields.push_back(field);
 	}
 
+	bool RTTITypeBase::_hasOnlyPlainFields()
+	{
+		UINT32 state = mPlainFieldsState.load(std::memory_order_relaxed);
+		if (state == 0)
+		{
+			bool onlyPlain = true;
+			for (auto& field : mFields)
+			{
+				if (field->mType != SerializableFT_Plain && field->mType != SerializableFT_DataBlock)
+				{
+					onlyPlain = false;
+					break;
+				}
+			}
+
+			RTTITypeBase* baseClass = getBaseClass();
+			if (onlyPlain && baseClass != nullptr)
+				onlyPlain = baseClass->_hasOnlyPlainFields();
+
+			// Fields never change after the type is constructed, so it doesn't matter if multiple threads get here
+			state = onlyPlain ? 2 : 1;
+			mPlainFieldsState.store(state, std::memory_order_relaxed);
+		}
+
+		return state == 2;
+	}
+
 	SPtr<IReflectable> rtti_create(UINT32 rttiId)
 	{
 		return IReflectable::createInstanceFromTypeId(rttiId);
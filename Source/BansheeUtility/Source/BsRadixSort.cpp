@@ -0,0 +1,56 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRadixSort.h"
+
+namespace BansheeEngine
+{
+	void RadixSort::sort(RadixSortEntry* entries, RadixSortEntry* scratch, UINT32 count)
+	{
+		static const UINT32 NUM_DIGITS = 8;
+		static const UINT32 NUM_BUCKETS = 256;
+
+		if (count < 2)
+			return;
+
+		// Count occurrences of every digit in a single pass over the keys
+		UINT32 histograms[NUM_DIGITS][NUM_BUCKETS];
+		memset(histograms, 0, sizeof(histograms));
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			UINT64 key = entries[i].key;
+			for (UINT32 j = 0; j < NUM_DIGITS; j++)
+				histograms[j][(key >> (j * 8)) & 0xFF]++;
+		}
+
+		RadixSortEntry* src = entries;
+		RadixSortEntry* dst = scratch;
+		for (UINT32 i = 0; i < NUM_DIGITS; i++)
+		{
+			UINT32* histogram = histograms[i];
+
+			// Skip digits that are the same in all keys, as is the case for unused key bits
+			if (histogram[(src[0].key >> (i * 8)) & 0xFF] == count)
+				continue;
+
+			UINT32 offset = 0;
+			for (UINT32 j = 0; j < NUM_BUCKETS; j++)
+			{
+				UINT32 bucketSize = histogram[j];
+				histogram[j] = offset;
+				offset += bucketSize;
+			}
+
+			for (UINT32 j = 0; j < count; j++)
+			{
+				UINT32 bucket = (src[j].key >> (i * 8)) & 0xFF;
+				dst[histogram[bucket]++] = src[j];
+			}
+
+			std::swap(src, dst);
+		}
+
+		if (src != entries)
+			memcpy(entries, src, count * sizeof(RadixSortEntry));
+	}
+}
@@ -0,0 +1,175 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRadixSortTestSuite.h"
+
+#include "BsRadixSort.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Simple deterministic random number generator used for generating test keys. */
+	struct RadixSortTestRandom
+	{
+		RadixSortTestRandom(UINT64 seed)
+			:state(seed * 6364136223846793005ULL + 1442695040888963407ULL)
+		{ }
+
+		UINT64 next()
+		{
+			state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+			return state ^ (state >> 29);
+		}
+
+		UINT64 state;
+	};
+
+	/** Checks if radix sort results match a stable comparison based sort. */
+	bool radixSortMatchesReference(const Vector<RadixSortEntry>& entries)
+	{
+		Vector<RadixSortEntry> sorted = entries;
+		Vector<RadixSortEntry> scratch(entries.size());
+		RadixSort::sort(sorted.data(), scratch.data(), (UINT32)sorted.size());
+
+		Vector<RadixSortEntry> reference = entries;
+		std::stable_sort(reference.begin(), reference.end(), 
+			[](const RadixSortEntry& a, const RadixSortEntry& b) { return a.key < b.key; });
+
+		for (UINT32 i = 0; i < (UINT32)entries.size(); i++)
+		{
+			if (sorted[i].key != reference[i].key || sorted[i].value != reference[i].value)
+				return false;
+		}
+
+		return true;
+	}
+
+	RadixSortTestSuite::RadixSortTestSuite()
+	{
+		BS_ADD_TEST(RadixSortTestSuite::testSort);
+		BS_ADD_TEST(RadixSortTestSuite::testSort_benchmark);
+	}
+
+	void RadixSortTestSuite::testSort()
+	{
+		RadixSortTestRandom random(1);
+
+		// Fully random keys
+		Vector<RadixSortEntry> entries(5000);
+		for (UINT32 i = 0; i < (UINT32)entries.size(); i++)
+			entries[i] = { random.next(), i };
+
+		BS_TEST_ASSERT(radixSortMatchesReference(entries));
+
+		// Few distinct keys, so stability matters, with only some of the bytes varying
+		for (UINT32 i = 0; i < (UINT32)entries.size(); i++)
+			entries[i] = { (random.next() % 7) << 40 | (random.next() % 3), i };
+
+		BS_TEST_ASSERT(radixSortMatchesReference(entries));
+
+		// All keys equal, and trivial sizes
+		for (UINT32 i = 0; i < (UINT32)entries.size(); i++)
+			entries[i] = { 42, i };
+
+		BS_TEST_ASSERT(radixSortMatchesReference(entries));
+		BS_TEST_ASSERT(radixSortMatchesReference(Vector<RadixSortEntry>()));
+		BS_TEST_ASSERT(radixSortMatchesReference(Vector<RadixSortEntry>(1, { 5, 0 })));
+	}
+
+	void RadixSortTestSuite::testSort_benchmark()
+	{
+		// Sorts keys laid out like render queue sort keys (priority, shader, pass, depth), and compares the time with
+		// sorting indices using a comparator, as done by render queues before. Comparator references the elements rather
+		// than binding a copy of them like render queues did, as the copies would make the comparator sort take minutes.
+		static const UINT32 NUM_ELEMENTS = 100000;
+		static const UINT32 NUM_ITERATIONS = 10;
+
+		struct SortableElement
+		{
+			UINT32 seqIdx;
+			INT32 priority;
+			float distFromCamera;
+			UINT32 shaderId;
+			UINT32 passIdx;
+		};
+
+		RadixSortTestRandom random(2);
+		Vector<SortableElement> elements(NUM_ELEMENTS);
+		Vector<RadixSortEntry> entries(NUM_ELEMENTS);
+		for (UINT32 i = 0; i < NUM_ELEMENTS; i++)
+		{
+			SortableElement& element = elements[i];
+			element.seqIdx = i;
+			element.priority = (random.next() % 4) == 0 ? 90000 : 100000;
+			element.distFromCamera = (float)(random.next() % 10000); // Exact after quantization, so both sorts match
+			element.shaderId = (UINT32)(random.next() % 200);
+			element.passIdx = (UINT32)(random.next() % 2);
+
+			UINT32 depthBits;
+			memcpy(&depthBits, &element.distFromCamera, sizeof(depthBits));
+
+			UINT64 key = (UINT64)(0xFFFFF - element.priority) << 44 | (UINT64)element.shaderId << 28 |
+				(UINT64)element.passIdx << 24 | (depthBits >> 8);
+			entries[i] = { key, i };
+		}
+
+		Timer timer;
+		UINT64 startTime = timer.getMicroseconds();
+
+		Vector<RadixSortEntry> sorted;
+		Vector<RadixSortEntry> scratch(NUM_ELEMENTS);
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+		{
+			sorted = entries;
+			RadixSort::sort(sorted.data(), scratch.data(), NUM_ELEMENTS);
+		}
+
+		UINT64 radixTime = (timer.getMicroseconds() - startTime) / NUM_ITERATIONS;
+
+		bool isSorted = true;
+		for (UINT32 i = 1; i < NUM_ELEMENTS; i++)
+			isSorted &= sorted[i - 1].key <= sorted[i].key;
+
+		BS_TEST_ASSERT(isSorted);
+
+		auto comparator = [](UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
+		{
+			const SortableElement& a = lookup[aIdx];
+			const SortableElement& b = lookup[bIdx];
+
+			UINT8 isHigher = (a.priority > b.priority) << 4 | (a.shaderId < b.shaderId) << 3 | 
+				(a.passIdx < b.passIdx) << 2 | (a.distFromCamera < b.distFromCamera) << 1 | (a.seqIdx < b.seqIdx);
+
+			UINT8 isLower = (a.priority < b.priority) << 4 | (a.shaderId > b.shaderId) << 3 | 
+				(a.passIdx > b.passIdx) << 2 | (a.distFromCamera > b.distFromCamera) << 1 | (a.seqIdx > b.seqIdx);
+
+			return isHigher > isLower;
+		};
+
+		std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod = comparator;
+
+		startTime = timer.getMicroseconds();
+
+		Vector<UINT32> indices(NUM_ELEMENTS);
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+		{
+			for (UINT32 j = 0; j < NUM_ELEMENTS; j++)
+				indices[j] = j;
+
+			std::sort(indices.begin(), indices.end(), 
+				std::bind(sortMethod, std::placeholders::_1, std::placeholders::_2, std::cref(elements)));
+		}
+
+		UINT64 comparatorTime = (timer.getMicroseconds() - startTime) / NUM_ITERATIONS;
+
+		// Both sorts must produce the same order
+		bool isMatching = true;
+		for (UINT32 i = 0; i < NUM_ELEMENTS; i++)
+			isMatching &= sorted[i].value == indices[i];
+
+		BS_TEST_ASSERT(isMatching);
+
+		LOGDBG("Sorting " + toString(NUM_ELEMENTS) + " elements: radix sort " + toString(radixTime) + " us, " + 
+			"comparator sort " + toString(comparatorTime) + " us.");
+	}
+}
@@ -0,0 +1,346 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsResourcePackage.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsCompression.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Header at the start of every resource package file. */
+	struct ResourcePackageHeader
+	{
+		UINT32 magic;
+		UINT32 version;
+		UINT32 numEntries;
+		UINT32 alignment;
+		UINT64 indexSize; /**< Size of the index following the header, in bytes. */
+	};
+
+	/** Returns the size of a string as written in the package index. */
+	static UINT64 getPackageStringSize(const String& value)
+	{
+		return sizeof(UINT32) + value.size();
+	}
+
+	/** Writes a string to the package index. */
+	static void writePackageString(DataStream& stream, const String& value)
+	{
+		UINT32 length = (UINT32)value.size();
+		stream.write(&length, sizeof(length));
+		stream.write(value.data(), length);
+	}
+
+	/** Reads a string from the package index. Returns false if the stream ends before the string does. */
+	static bool readPackageString(DataStream& stream, String& value)
+	{
+		UINT32 length = 0;
+		if (stream.read(&length, sizeof(length)) != sizeof(length))
+			return false;
+
+		if (length > stream.size() - stream.tell())
+			return false;
+
+		value.resize(length);
+		return stream.read(&value[0], length) == length;
+	}
+
+	/** Returns the value rounded up to the provided power of two alignment. */
+	static UINT64 alignPackageOffset(UINT64 value, UINT64 alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	ResourcePackage::ResourcePackage(const SPtr<MappedFileDataStream>& file)
+		:mPath(file->getPath()), mFile(file)
+	{ }
+
+	SPtr<ResourcePackage> ResourcePackage::open(const Path& path)
+	{
+		SPtr<MappedFileDataStream> file = FileSystem::openFileMapped(path);
+		if (file == nullptr)
+			return nullptr;
+
+		SPtr<ResourcePackage> package = bs_shared_ptr<ResourcePackage>(new (bs_alloc<ResourcePackage>()) ResourcePackage(file));
+		if (!package->readIndex())
+		{
+			LOGERR("Unable to open resource package at path \"" + path.toString() + "\". File is not a valid package.");
+			return nullptr;
+		}
+
+		return package;
+	}
+
+	bool ResourcePackage::readIndex()
+	{
+		ResourcePackageHeader header;
+		if (mFile->read(&header, sizeof(header)) != sizeof(header))
+			return false;
+
+		if (header.magic != MAGIC || header.version != VERSION)
+			return false;
+
+		UINT64 fileSize = mFile->size();
+		if (header.indexSize > fileSize - sizeof(header))
+			return false;
+
+		// Don't trust the entry count before checking it against the smallest possible entry size (empty UUID, no
+		// dependencies)
+		UINT64 minEntrySize = sizeof(UINT32) * 3 + sizeof(UINT64) * 2;
+		if (header.numEntries > header.indexSize / minEntrySize)
+			return false;
+
+		mEntries.resize(header.numEntries);
+		for (UINT32 i = 0; i < header.numEntries; i++)
+		{
+			ResourcePackageEntry& entry = mEntries[i];
+			if (!readPackageString(*mFile, entry.uuid))
+				return false;
+
+			UINT32 compression = 0;
+			UINT32 numDependencies = 0;
+			if (mFile->read(&entry.offset, sizeof(entry.offset)) != sizeof(entry.offset) ||
+				mFile->read(&entry.size, sizeof(entry.size)) != sizeof(entry.size) ||
+				mFile->read(&compression, sizeof(compression)) != sizeof(compression) ||
+				mFile->read(&numDependencies, sizeof(numDependencies)) != sizeof(numDependencies))
+			{
+				return false;
+			}
+
+			if (entry.offset > fileSize || entry.size > fileSize - entry.offset)
+				return false;
+
+			if (compression > (UINT32)ResourceCompression::LZ4)
+				return false;
+
+			entry.compression = (ResourceCompression)compression;
+
+			// Each dependency takes at least four bytes
+			if (numDependencies > (mFile->size() - mFile->tell()) / sizeof(UINT32))
+				return false;
+
+			entry.dependencies.resize(numDependencies);
+			for (UINT32 j = 0; j < numDependencies; j++)
+			{
+				if (!readPackageString(*mFile, entry.dependencies[j]))
+					return false;
+			}
+
+			mLookup[entry.uuid] = i;
+		}
+
+		return mFile->tell() == sizeof(header) + header.indexSize;
+	}
+
+	const ResourcePackageEntry* ResourcePackage::getEntry(const String& uuid) const
+	{
+		auto iterFind = mLookup.find(uuid);
+		if (iterFind == mLookup.end())
+			return nullptr;
+
+		return &mEntries[iterFind->second];
+	}
+
+	SPtr<MappedFileDataStream> ResourcePackage::openEntry(const String& uuid) const
+	{
+		const ResourcePackageEntry* entry = getEntry(uuid);
+		if (entry == nullptr)
+			return nullptr;
+
+		// Share ownership of the mapping, so it stays alive for as long as any of the entries are referenced
+		const SPtr<UINT8>& mapping = mFile->getMapping();
+		SPtr<UINT8> data(mapping, mapping.get() + entry->offset);
+
+		return bs_shared_ptr_new<MappedFileDataStream>(mPath, data, (size_t)entry->size);
+	}
+
+	SPtr<MemoryDataStream> ResourcePackage::decompressEntry(const ResourcePackageEntry& entry, 
+		const SPtr<MemoryDataStream>& data)
+	{
+		if (entry.compression == ResourceCompression::None)
+			return data;
+
+		// Builder only compresses data smaller than 4GB
+		if (data == nullptr || data->size() > std::numeric_limits<UINT32>::max())
+			return nullptr;
+
+		UINT32 blockSize = (UINT32)data->size();
+		UINT32 size = Compression::getUncompressedSize(data->getPtr(), blockSize);
+		if (size == 0)
+			return nullptr;
+
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>(bs_alloc(size), size);
+		if (!Compression::decompressBlock(data->getPtr(), blockSize, output->getPtr(), size))
+			return nullptr;
+
+		return output;
+	}
+
+	ResourcePackageBuilder::ResourcePackageBuilder(UINT32 alignment)
+		:mAlignment(alignment)
+	{
+		assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+	}
+
+	void ResourcePackageBuilder::addFile(const String& uuid, const Path& filePath, const Vector<String>& dependencies,
+		ResourceCompression compression)
+	{
+		Entry entry;
+		entry.info.uuid = uuid;
+		entry.info.offset = 0;
+		entry.info.size = 0;
+		entry.info.compression = compression;
+		entry.info.dependencies = dependencies;
+		entry.filePath = filePath;
+
+		mEntries.push_back(entry);
+	}
+
+	bool ResourcePackageBuilder::build(const Path& outputPath)
+	{
+		// Sizes are needed up front, as the index containing the data offsets precedes the data
+		UINT64 indexSize = 0;
+		for (auto& entry : mEntries)
+		{
+			if (!FileSystem::isFile(entry.filePath))
+			{
+				LOGERR("Unable to add resource to package. File \"" + entry.filePath.toString() + "\" doesn't exist.");
+				return false;
+			}
+
+			entry.info.size = FileSystem::getFileSize(entry.filePath);
+
+			if (entry.info.compression != ResourceCompression::None)
+			{
+				// Keep the data uncompressed if it doesn't fit in a compressed block, or if compression doesn't help
+				entry.info.compression = ResourceCompression::None;
+
+				if (entry.info.size > 0 && entry.info.size <= std::numeric_limits<UINT32>::max())
+				{
+					SPtr<DataStream> input = FileSystem::openFile(entry.filePath, true);
+					if (input == nullptr)
+						return false;
+
+					MemoryDataStream data(input);
+					SPtr<MemoryDataStream> compressedData = Compression::compressBlock(data.getPtr(), (UINT32)data.size(),
+						CompressionType::LZ4);
+
+					if (compressedData->size() < data.size())
+					{
+						entry.info.compression = ResourceCompression::LZ4;
+						entry.info.size = compressedData->size();
+						entry.compressedData = compressedData;
+					}
+				}
+			}
+
+			indexSize += getPackageStringSize(entry.info.uuid);
+			indexSize += sizeof(entry.info.offset) + sizeof(entry.info.size) + sizeof(UINT32) * 2;
+
+			for (auto& dependency : entry.info.dependencies)
+				indexSize += getPackageStringSize(dependency);
+		}
+
+		UINT64 offset = alignPackageOffset(sizeof(ResourcePackageHeader) + indexSize, ResourcePackage::DATA_ALIGNMENT);
+		for (auto& entry : mEntries)
+		{
+			offset = alignPackageOffset(offset, mAlignment);
+			entry.info.offset = offset;
+
+			offset += entry.info.size;
+		}
+
+		SPtr<DataStream> output = FileSystem::createAndOpenFile(outputPath);
+		if (output == nullptr)
+			return false;
+
+		ResourcePackageHeader header;
+		header.magic = ResourcePackage::MAGIC;
+		header.version = ResourcePackage::VERSION;
+		header.numEntries = (UINT32)mEntries.size();
+		header.alignment = mAlignment;
+		header.indexSize = indexSize;
+
+		output->write(&header, sizeof(header));
+
+		for (auto& entry : mEntries)
+		{
+			UINT32 compression = (UINT32)entry.info.compression;
+			UINT32 numDependencies = (UINT32)entry.info.dependencies.size();
+
+			writePackageString(*output, entry.info.uuid);
+			output->write(&entry.info.offset, sizeof(entry.info.offset));
+			output->write(&entry.info.size, sizeof(entry.info.size));
+			output->write(&compression, sizeof(compression));
+			output->write(&numDependencies, sizeof(numDependencies));
+
+			for (auto& dependency : entry.info.dependencies)
+				writePackageString(*output, dependency);
+		}
+
+		const UINT32 BUFFER_SIZE = 64 * 1024;
+		UINT8* buffer = (UINT8*)bs_alloc(BUFFER_SIZE);
+
+		bool success = true;
+		UINT64 writeOffset = sizeof(ResourcePackageHeader) + indexSize;
+		for (auto& entry : mEntries)
+		{
+			// Zero out the padding
+			while (writeOffset < entry.info.offset)
+			{
+				UINT64 paddingSize = std::min((UINT64)BUFFER_SIZE, entry.info.offset - writeOffset);
+				memset(buffer, 0, (size_t)paddingSize);
+				output->write(buffer, (size_t)paddingSize);
+
+				writeOffset += paddingSize;
+			}
+
+			if (entry.compressedData != nullptr)
+			{
+				output->write(entry.compressedData->getPtr(), entry.compressedData->size());
+				writeOffset += entry.compressedData->size();
+
+				entry.compressedData = nullptr;
+				continue;
+			}
+
+			SPtr<DataStream> input = FileSystem::openFile(entry.filePath, true);
+			if (input == nullptr)
+			{
+				success = false;
+				break;
+			}
+
+			UINT64 numCopied = 0;
+			while (numCopied < entry.info.size)
+			{
+				size_t numRead = input->read(buffer, (size_t)std::min((UINT64)BUFFER_SIZE, entry.info.size - numCopied));
+				if (numRead == 0)
+					break;
+
+				output->write(buffer, numRead);
+				numCopied += numRead;
+			}
+
+			if (numCopied != entry.info.size)
+			{
+				LOGERR("Unable to add resource to package. File \"" + entry.filePath.toString() + "\" changed while "
+					"the package was being built.");
+
+				success = false;
+				break;
+			}
+
+			writeOffset += numCopied;
+		}
+
+		bs_free(buffer);
+		output->close();
+
+		if (!success)
+			FileSystem::remove(outputPath);
+
+		return success;
+	}
+}
@@ -0,0 +1,749 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsSerializationTestSuite.h"
+
+#include "BsRTTIType.h"
+#include "BsBinarySerializer.h"
+#include "BsMemorySerializer.h"
+#include "BsFileSerializer.h"
+#include "BsBinaryDiff.h"
+#include "BsSerializedObject.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Plain type larger than four bytes, so array elements straddle the encode buffer boundaries. */
+	struct SerializationTestPoint
+	{
+		UINT32 x, y, z;
+	};
+
+	BS_ALLOW_MEMCPY_SERIALIZATION(SerializationTestPoint);
+
+	class SerializationTestBase : public IReflectable
+	{
+	public:
+		UINT32 baseValue = 0;
+		Vector<float> baseArray;
+
+		/** Order in which the serialization callbacks were triggered during deserialization. Not serialized. */
+		Vector<UINT32> callbacks;
+
+		friend class SerializationTestBaseRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	class SerializationTestPlain : public SerializationTestBase
+	{
+	public:
+		UINT32 value = 0;
+		String name;
+		Vector<SerializationTestPoint> points;
+		Vector<String> strings;
+		Vector<UINT8> data;
+
+		friend class SerializationTestPlainRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	class SerializationTestComplex : public IReflectable
+	{
+	public:
+		UINT32 value = 0;
+		SerializationTestPlain embedded;
+		SPtr<SerializationTestPlain> ptr;
+		Vector<SerializationTestPlain> embeddedArray;
+		Vector<SPtr<SerializationTestPlain>> ptrArray;
+
+		friend class SerializationTestComplexRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	/** 
+	 * Keeps track of how much data block data has been read by the encoder, and how much encoded data it has written. The
+	 * difference is the amount of data the encoder is holding on to.
+	 */
+	struct SerializationTestStreamStats
+	{
+		INT64 bytesRead = 0;
+		INT64 bytesWritten = 0;
+		INT64 peakBuffered = 0;
+
+		void update() { peakBuffered = std::max(peakBuffered, bytesRead - bytesWritten); }
+	};
+
+	/** Returns the value of a byte at the specified offset in the data generated by SerializationTestSourceStream. */
+	UINT8 getSerializationTestByte(UINT64 offset)
+	{
+		return (UINT8)((offset * 31) ^ (offset >> 13));
+	}
+
+	/** Read-only stream that generates its data on the fly, so arbitrarily large data blocks take no memory. */
+	class SerializationTestSourceStream : public DataStream
+	{
+	public:
+		SerializationTestSourceStream(size_t size, SerializationTestStreamStats* stats)
+			:mPos(0), mStats(stats)
+		{
+			mSize = size;
+		}
+
+		bool isFile() const override { return false; }
+
+		size_t read(void* buf, size_t count) override
+		{
+			count = std::min(count, mSize - mPos);
+
+			UINT8* dst = (UINT8*)buf;
+			for (size_t i = 0; i < count; i++)
+				dst[i] = getSerializationTestByte(mPos + i);
+
+			mPos += count;
+			if (mStats != nullptr)
+			{
+				mStats->bytesRead += count;
+				mStats->update();
+			}
+
+			return count;
+		}
+
+		void skip(size_t count) override { mPos = std::min(mPos + count, mSize); }
+		void seek(size_t pos) override { mPos = std::min(pos, mSize); }
+		size_t tell() const override { return mPos; }
+		bool eof() const override { return mPos >= mSize; }
+		SPtr<DataStream> clone(bool copyData = true) const override { return nullptr; }
+		void close() override { }
+
+	private:
+		size_t mPos;
+		SerializationTestStreamStats* mStats;
+	};
+
+	/** Forwards all operations to another stream, while counting the written bytes. */
+	class SerializationTestTrackingStream : public DataStream
+	{
+	public:
+		SerializationTestTrackingStream(const SPtr<DataStream>& stream, SerializationTestStreamStats* stats)
+			:DataStream(READ | WRITE), mStream(stream), mStats(stats)
+		{ }
+
+		bool isFile() const override { return mStream->isFile(); }
+		size_t read(void* buf, size_t count) override { return mStream->read(buf, count); }
+
+		size_t write(const void* buf, size_t count) override
+		{
+			size_t written = mStream->write(buf, count);
+
+			mStats->bytesWritten += written;
+			mStats->update();
+
+			return written;
+		}
+
+		void skip(size_t count) override { mStream->skip(count); }
+		void seek(size_t pos) override { mStream->seek(pos); }
+		size_t tell() const override { return mStream->tell(); }
+		bool eof() const override { return mStream->eof(); }
+		SPtr<DataStream> clone(bool copyData = true) const override { return mStream->clone(copyData); }
+		void close() override { mStream->close(); }
+
+	private:
+		SPtr<DataStream> mStream;
+		SerializationTestStreamStats* mStats;
+	};
+
+	/** Object with a large data block, whose contents are generated when encoding and validated when decoding. */
+	class SerializationTestBlob : public IReflectable
+	{
+	public:
+		UINT32 size = 0;
+		SerializationTestStreamStats* stats = nullptr;
+
+		/** Size of the decoded data block, and is its contents what was expected. Not serialized. */
+		UINT32 decodedSize = 0;
+		bool decodedValid = false;
+
+		friend class SerializationTestBlobRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	class SerializationTestBaseRTTI : public RTTIType<SerializationTestBase, IReflectable, SerializationTestBaseRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(baseValue, 0)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(baseArray, 1)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		SerializationTestBaseRTTI()
+			:mInitMembers(this)
+		{ }
+
+		void onDeserializationStarted(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
+		{
+			static_cast<SerializationTestBase*>(obj)->callbacks.push_back(0);
+		}
+
+		void onDeserializationEnded(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
+		{
+			static_cast<SerializationTestBase*>(obj)->callbacks.push_back(2);
+		}
+
+		const String& getRTTIName() override
+		{
+			static String name = "SerializationTestBase";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_SerializationTestBase;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<SerializationTestBase>();
+		}
+	};
+
+	class SerializationTestPlainRTTI : public RTTIType<SerializationTestPlain, SerializationTestBase, SerializationTestPlainRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(value, 0)
+			BS_RTTI_MEMBER_PLAIN(name, 1)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(points, 2)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(strings, 3)
+		BS_END_RTTI_MEMBERS
+
+		SPtr<DataStream> getData(SerializationTestPlain* obj, UINT32& size)
+		{
+			size = (UINT32)obj->data.size();
+			return bs_shared_ptr_new<MemoryDataStream>(obj->data.data(), size, false);
+		}
+
+		void setData(SerializationTestPlain* obj, const SPtr<DataStream>& value, UINT32 size)
+		{
+			obj->data.resize(size);
+			value->read(obj->data.data(), size);
+		}
+
+	public:
+		SerializationTestPlainRTTI()
+			:mInitMembers(this)
+		{
+			addDataBlockField("data", 4, &SerializationTestPlainRTTI::getData, &SerializationTestPlainRTTI::setData);
+		}
+
+		void onDeserializationStarted(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
+		{
+			static_cast<SerializationTestPlain*>(obj)->callbacks.push_back(1);
+		}
+
+		void onDeserializationEnded(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
+		{
+			static_cast<SerializationTestPlain*>(obj)->callbacks.push_back(3);
+		}
+
+		const String& getRTTIName() override
+		{
+			static String name = "SerializationTestPlain";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_SerializationTestPlain;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<SerializationTestPlain>();
+		}
+	};
+
+	class SerializationTestComplexRTTI : public RTTIType<SerializationTestComplex, IReflectable, SerializationTestComplexRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(value, 0)
+			BS_RTTI_MEMBER_REFL(embedded, 1)
+			BS_RTTI_MEMBER_REFLPTR(ptr, 2)
+			BS_RTTI_MEMBER_REFL_ARRAY(embeddedArray, 3)
+			BS_RTTI_MEMBER_REFLPTR_ARRAY(ptrArray, 4)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		SerializationTestComplexRTTI()
+			:mInitMembers(this)
+		{ }
+
+		const String& getRTTIName() override
+		{
+			static String name = "SerializationTestComplex";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_SerializationTestComplex;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<SerializationTestComplex>();
+		}
+	};
+
+	class SerializationTestBlobRTTI : public RTTIType<SerializationTestBlob, IReflectable, SerializationTestBlobRTTI>
+	{
+	private:
+		SPtr<DataStream> getData(SerializationTestBlob* obj, UINT32& size)
+		{
+			size = obj->size;
+			return bs_shared_ptr_new<SerializationTestSourceStream>(size, obj->stats);
+		}
+
+		void setData(SerializationTestBlob* obj, const SPtr<DataStream>& value, UINT32 size)
+		{
+			UINT8 buffer[4096];
+
+			obj->decodedSize = 0;
+			obj->decodedValid = true;
+			while (obj->decodedSize < size)
+			{
+				UINT32 readSize = std::min(size - obj->decodedSize, (UINT32)sizeof(buffer));
+				if (value->read(buffer, readSize) != readSize)
+				{
+					obj->decodedValid = false;
+					return;
+				}
+
+				for (UINT32 i = 0; i < readSize; i++)
+				{
+					if (buffer[i] != getSerializationTestByte(obj->decodedSize + i))
+						obj->decodedValid = false;
+				}
+
+				obj->decodedSize += readSize;
+			}
+		}
+
+	public:
+		SerializationTestBlobRTTI()
+		{
+			addDataBlockField("data", 0, &SerializationTestBlobRTTI::getData, &SerializationTestBlobRTTI::setData);
+		}
+
+		const String& getRTTIName() override
+		{
+			static String name = "SerializationTestBlob";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_SerializationTestBlob;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<SerializationTestBlob>();
+		}
+	};
+
+	RTTITypeBase* SerializationTestBase::getRTTIStatic() { return SerializationTestBaseRTTI::instance(); }
+	RTTITypeBase* SerializationTestBase::getRTTI() const { return getRTTIStatic(); }
+	RTTITypeBase* SerializationTestPlain::getRTTIStatic() { return SerializationTestPlainRTTI::instance(); }
+	RTTITypeBase* SerializationTestPlain::getRTTI() const { return getRTTIStatic(); }
+	RTTITypeBase* SerializationTestComplex::getRTTIStatic() { return SerializationTestComplexRTTI::instance(); }
+	RTTITypeBase* SerializationTestComplex::getRTTI() const { return getRTTIStatic(); }
+	RTTITypeBase* SerializationTestBlob::getRTTIStatic() { return SerializationTestBlobRTTI::instance(); }
+	RTTITypeBase* SerializationTestBlob::getRTTI() const { return getRTTIStatic(); }
+
+	/** Fills the object with values derived from the seed. */
+	void initSerializationTestPlain(SerializationTestPlain& object, UINT32 seed, UINT32 numPoints)
+	{
+		object.baseValue = seed * 7;
+		for (UINT32 i = 0; i < seed % 5 + 1; i++)
+			object.baseArray.push_back(seed + i * 0.5f);
+
+		object.value = seed;
+		object.name = "Object " + toString(seed);
+
+		for (UINT32 i = 0; i < numPoints; i++)
+			object.points.push_back({ i, seed, i * seed });
+
+		for (UINT32 i = 0; i < seed % 4; i++)
+			object.strings.push_back(String(i * 3 + seed % 7, (char)('a' + i)));
+
+		for (UINT32 i = 0; i < seed * 13; i++)
+			object.data.push_back((UINT8)(i * seed));
+	}
+
+	/** Checks are values of two objects equal, and were the deserialization callbacks triggered in the expected order. */
+	bool compareSerializationTestPlain(const SerializationTestPlain& a, const SerializationTestPlain& b)
+	{
+		if (a.baseValue != b.baseValue || a.baseArray != b.baseArray || a.value != b.value || a.name != b.name ||
+			a.strings != b.strings || a.data != b.data || a.points.size() != b.points.size())
+			return false;
+
+		for (UINT32 i = 0; i < (UINT32)a.points.size(); i++)
+		{
+			if (memcmp(&a.points[i], &b.points[i], sizeof(SerializationTestPoint)) != 0)
+				return false;
+		}
+
+		Vector<UINT32> expectedCallbacks = { 0, 1, 2, 3 };
+		return b.callbacks == expectedCallbacks;
+	}
+
+	/** Encodes the object and decodes it through the intermediate representation, without decoding any objects directly. */
+	SPtr<IReflectable> decodeThroughIntermediate(IReflectable* object)
+	{
+		MemorySerializer ms;
+		UINT32 size = 0;
+		UINT8* data = ms.encode(object, size);
+
+		SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(data, size);
+
+		BinarySerializer bs;
+		SPtr<SerializedObject> intermediate = bs._decodeToIntermediate(stream, size);
+		return bs._decodeFromIntermediate(intermediate);
+	}
+
+	/** Checks does the object encode to the same data as the reference object. */
+	bool compareEncoded(IReflectable* reference, IReflectable* object)
+	{
+		MemorySerializer ms;
+		UINT32 referenceSize = 0;
+		UINT8* referenceData = ms.encode(reference, referenceSize);
+
+		UINT32 size = 0;
+		UINT8* data = ms.encode(object, size);
+
+		bool equal = size == referenceSize && memcmp(data, referenceData, size) == 0;
+
+		bs_free(referenceData);
+		bs_free(data);
+
+		return equal;
+	}
+
+	SerializationTestSuite::SerializationTestSuite()
+	{
+		BS_ADD_TEST(SerializationTestSuite::testPlainFields);
+		BS_ADD_TEST(SerializationTestSuite::testNestedObjects);
+		BS_ADD_TEST(SerializationTestSuite::testIntermediate);
+		BS_ADD_TEST(SerializationTestSuite::testFileStream);
+		BS_ADD_TEST(SerializationTestSuite::testStreamingEncode);
+		BS_ADD_TEST(SerializationTestSuite::testDiff);
+		BS_ADD_TEST(SerializationTestSuite::testSerialization_benchmark);
+	}
+
+	void SerializationTestSuite::startUp()
+	{
+		// Serializer uses stack allocations for temporary buffers
+		MemStack::beginThread();
+	}
+
+	void SerializationTestSuite::shutDown()
+	{
+		MemStack::endThread();
+	}
+
+	void SerializationTestSuite::testPlainFields()
+	{
+		BS_TEST_ASSERT(SerializationTestPlain::getRTTIStatic()->_hasOnlyPlainFields());
+		BS_TEST_ASSERT(!SerializationTestComplex::getRTTIStatic()->_hasOnlyPlainFields());
+
+		// Enough points for the array to span multiple encode buffers
+		SerializationTestPlain object;
+		initSerializationTestPlain(object, 11, 5000);
+
+		MemorySerializer ms;
+		UINT32 size = 0;
+		UINT8* data = ms.encode(&object, size);
+
+		SPtr<SerializationTestPlain> decoded = std::static_pointer_cast<SerializationTestPlain>(ms.decode(data, size));
+		BS_TEST_ASSERT(decoded != nullptr);
+		BS_TEST_ASSERT(compareSerializationTestPlain(object, *decoded));
+		BS_TEST_ASSERT(compareEncoded(&object, decoded.get()));
+
+		bs_free(data);
+	}
+
+	void SerializationTestSuite::testNestedObjects()
+	{
+		SerializationTestComplex object;
+		object.value = 5;
+		initSerializationTestPlain(object.embedded, 1, 3);
+
+		object.ptr = bs_shared_ptr_new<SerializationTestPlain>();
+		initSerializationTestPlain(*object.ptr, 2, 0);
+
+		object.embeddedArray.resize(3);
+		for (UINT32 i = 0; i < 3; i++)
+			initSerializationTestPlain(object.embeddedArray[i], 3 + i, i * 10);
+
+		object.ptrArray.push_back(object.ptr);
+		object.ptrArray.push_back(nullptr);
+		object.ptrArray.push_back(bs_shared_ptr_new<SerializationTestPlain>());
+		initSerializationTestPlain(*object.ptrArray.back(), 9, 100);
+
+		MemorySerializer ms;
+		UINT32 size = 0;
+		UINT8* data = ms.encode(&object, size);
+
+		SPtr<SerializationTestComplex> decoded = std::static_pointer_cast<SerializationTestComplex>(ms.decode(data, size));
+		BS_TEST_ASSERT(decoded != nullptr);
+		BS_TEST_ASSERT(decoded->value == 5);
+		BS_TEST_ASSERT(compareSerializationTestPlain(object.embedded, decoded->embedded));
+
+		BS_TEST_ASSERT(decoded->ptr != nullptr);
+		BS_TEST_ASSERT(compareSerializationTestPlain(*object.ptr, *decoded->ptr));
+
+		BS_TEST_ASSERT(decoded->embeddedArray.size() == 3);
+		for (UINT32 i = 0; i < 3; i++)
+			BS_TEST_ASSERT(compareSerializationTestPlain(object.embeddedArray[i], decoded->embeddedArray[i]));
+
+		// Objects referenced from multiple places must remain shared
+		BS_TEST_ASSERT(decoded->ptrArray.size() == 3);
+		BS_TEST_ASSERT(decoded->ptrArray[0] == decoded->ptr);
+		BS_TEST_ASSERT(decoded->ptrArray[1] == nullptr);
+		BS_TEST_ASSERT(decoded->ptrArray[2] != nullptr);
+		BS_TEST_ASSERT(compareSerializationTestPlain(*object.ptrArray[2], *decoded->ptrArray[2]));
+
+		BS_TEST_ASSERT(compareEncoded(&object, decoded.get()));
+
+		bs_free(data);
+	}
+
+	void SerializationTestSuite::testIntermediate()
+	{
+		SerializationTestComplex object;
+		initSerializationTestPlain(object.embedded, 4, 20);
+
+		object.ptr = bs_shared_ptr_new<SerializationTestPlain>();
+		initSerializationTestPlain(*object.ptr, 6, 2000);
+
+		object.ptrArray.push_back(object.ptr);
+
+		// Objects decoded directly and decoded through the intermediate representation must be the same
+		SPtr<SerializationTestComplex> decoded = std::static_pointer_cast<SerializationTestComplex>(
+			decodeThroughIntermediate(&object));
+
+		BS_TEST_ASSERT(decoded != nullptr);
+		BS_TEST_ASSERT(compareSerializationTestPlain(object.embedded, decoded->embedded));
+		BS_TEST_ASSERT(compareSerializationTestPlain(*object.ptr, *decoded->ptr));
+		BS_TEST_ASSERT(decoded->ptrArray.size() == 1 && decoded->ptrArray[0] == decoded->ptr);
+		BS_TEST_ASSERT(compareEncoded(&object, decoded.get()));
+
+		SPtr<SerializationTestPlain> decodedPlain = std::static_pointer_cast<SerializationTestPlain>(
+			decodeThroughIntermediate(object.ptr.get()));
+
+		BS_TEST_ASSERT(decodedPlain != nullptr);
+		BS_TEST_ASSERT(compareSerializationTestPlain(*object.ptr, *decodedPlain));
+	}
+
+	void SerializationTestSuite::testFileStream()
+	{
+		SerializationTestComplex object;
+		initSerializationTestPlain(object.embedded, 7, 1000);
+
+		object.ptr = bs_shared_ptr_new<SerializationTestPlain>();
+		initSerializationTestPlain(*object.ptr, 8, 3);
+
+		Path path = FileSystem::getTempDirectoryPath() + "BsSerializationTest.asset";
+
+		{
+			FileEncoder encoder(path);
+			encoder.encode(&object);
+		}
+
+		// Plain data of file streams is read into a temporary buffer, rather than referenced
+		SPtr<SerializationTestComplex> decoded;
+		{
+			FileDecoder decoder(path);
+			decoded = std::static_pointer_cast<SerializationTestComplex>(decoder.decode());
+		}
+
+		BS_TEST_ASSERT(decoded != nullptr);
+		BS_TEST_ASSERT(compareSerializationTestPlain(object.embedded, decoded->embedded));
+		BS_TEST_ASSERT(decoded->ptr != nullptr);
+		BS_TEST_ASSERT(compareSerializationTestPlain(*object.ptr, *decoded->ptr));
+
+		FileSystem::remove(path);
+	}
+
+	void SerializationTestSuite::testStreamingEncode()
+	{
+		// Data block is much larger than the budget, so it cannot be staged in memory as a whole
+		const UINT32 BLOB_SIZE = 16 * 1024 * 1024;
+		const INT64 MEMORY_BUDGET = 64 * 1024;
+
+		SerializationTestStreamStats stats;
+
+		SerializationTestBlob object;
+		object.size = BLOB_SIZE;
+		object.stats = &stats;
+
+		Path path = FileSystem::getTempDirectoryPath() + "BsSerializationStreamTest.asset";
+
+		{
+			SPtr<DataStream> file = FileSystem::createAndOpenFile(path);
+			SPtr<DataStream> stream = bs_shared_ptr_new<SerializationTestTrackingStream>(file, &stats);
+
+			FileEncoder encoder(stream);
+			encoder.encode(&object);
+		}
+
+		BS_TEST_ASSERT(stats.bytesRead == BLOB_SIZE);
+		BS_TEST_ASSERT(stats.bytesWritten > BLOB_SIZE);
+		BS_TEST_ASSERT(stats.peakBuffered <= MEMORY_BUDGET);
+
+		// Data block is streamed from the file to the setter
+		SPtr<SerializationTestBlob> decoded;
+		{
+			FileDecoder decoder(path);
+			decoded = std::static_pointer_cast<SerializationTestBlob>(decoder.decode());
+		}
+
+		BS_TEST_ASSERT(decoded != nullptr);
+		BS_TEST_ASSERT(decoded->decodedSize == BLOB_SIZE);
+		BS_TEST_ASSERT(decoded->decodedValid);
+
+		FileSystem::remove(path);
+	}
+
+	void SerializationTestSuite::testDiff()
+	{
+		SerializationTestComplex original;
+		initSerializationTestPlain(original.embedded, 2, 10);
+		original.ptr = bs_shared_ptr_new<SerializationTestPlain>();
+		initSerializationTestPlain(*original.ptr, 3, 20);
+
+		SerializationTestComplex modified;
+		initSerializationTestPlain(modified.embedded, 2, 10);
+		modified.ptr = bs_shared_ptr_new<SerializationTestPlain>();
+		initSerializationTestPlain(*modified.ptr, 3, 20);
+
+		BinarySerializer bs;
+		SPtr<SerializedObject> originalData = bs._encodeToIntermediate(&original);
+		SPtr<SerializedObject> modifiedData = bs._encodeToIntermediate(&modified);
+
+		// Equal objects have equal hashes, and no differences
+		IDiff& diffHandler = SerializationTestComplex::getRTTIStatic()->getDiffHandler();
+		BS_TEST_ASSERT(originalData->getHash() == modifiedData->getHash());
+		BS_TEST_ASSERT(diffHandler.generateDiff(originalData, modifiedData) == nullptr);
+
+		modified.ptr->points[3].y = 99;
+		modifiedData = bs._encodeToIntermediate(&modified);
+		BS_TEST_ASSERT(originalData->getHash() != modifiedData->getHash());
+
+		// Unchanged child objects must keep the same hash
+		auto getChild = [](const SPtr<SerializedObject>& object, UINT32 fieldId)
+		{
+			return std::static_pointer_cast<SerializedObject>(object->subObjects[0].entries[fieldId].serialized);
+		};
+
+		BS_TEST_ASSERT(getChild(originalData, 1)->getHash() == getChild(modifiedData, 1)->getHash());
+		BS_TEST_ASSERT(getChild(originalData, 2)->getHash() != getChild(modifiedData, 2)->getHash());
+
+		SPtr<SerializedObject> diff = diffHandler.generateDiff(originalData, modifiedData);
+		BS_TEST_ASSERT(diff != nullptr);
+
+		// Only the modified object should be recorded in the diff
+		BS_TEST_ASSERT(diff->subObjects.size() == 1);
+		BS_TEST_ASSERT(diff->subObjects[0].entries.size() == 1);
+		BS_TEST_ASSERT(diff->subObjects[0].entries.find(2) != diff->subObjects[0].entries.end());
+
+		MemorySerializer ms;
+		UINT32 size = 0;
+		UINT8* data = ms.encode(&original, size);
+		SPtr<IReflectable> patched = ms.decode(data, size);
+		bs_free(data);
+
+		diffHandler.applyDiff(patched, diff);
+		BS_TEST_ASSERT(compareEncoded(&modified, patched.get()));
+	}
+
+	void SerializationTestSuite::testSerialization_benchmark()
+	{
+		const UINT32 NUM_ITERATIONS = 20;
+
+		// Mesh-like object: a single object with a large plain array and a data block
+		SerializationTestPlain mesh;
+		initSerializationTestPlain(mesh, 3, 40000);
+		mesh.data.resize(480 * 1024);
+
+		// Prefab-like object: many small referenced objects
+		SerializationTestComplex prefab;
+		initSerializationTestPlain(prefab.embedded, 1, 10);
+		prefab.ptr = bs_shared_ptr_new<SerializationTestPlain>();
+		initSerializationTestPlain(*prefab.ptr, 2, 10);
+
+		for (UINT32 i = 0; i < 2000; i++)
+		{
+			prefab.ptrArray.push_back(bs_shared_ptr_new<SerializationTestPlain>());
+			initSerializationTestPlain(*prefab.ptrArray.back(), i % 11 + 1, 4);
+		}
+
+		// Material-like object: many small strings and values
+		SerializationTestPlain material;
+		initSerializationTestPlain(material, 6, 64);
+		for (UINT32 i = 0; i < 256; i++)
+		{
+			material.baseArray.push_back(i * 0.25f);
+			material.strings.push_back("param" + toString(i));
+		}
+
+		// Best of all iterations, in microseconds
+		auto measure = [&](const String& name, IReflectable* object)
+		{
+			MemorySerializer ms;
+			UINT64 encodeTime = std::numeric_limits<UINT64>::max();
+			UINT64 decodeTime = std::numeric_limits<UINT64>::max();
+			UINT64 intermediateTime = std::numeric_limits<UINT64>::max();
+			UINT32 size = 0;
+
+			Timer timer;
+			for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			{
+				UINT64 startTime = timer.getMicroseconds();
+				UINT8* data = ms.encode(object, size);
+				encodeTime = std::min(encodeTime, timer.getMicroseconds() - startTime);
+
+				startTime = timer.getMicroseconds();
+				SPtr<IReflectable> decoded = ms.decode(data, size);
+				decodeTime = std::min(decodeTime, timer.getMicroseconds() - startTime);
+				decoded = nullptr;
+
+				// Old path, decoding everything through the intermediate representation
+				SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(data, size);
+
+				startTime = timer.getMicroseconds();
+				BinarySerializer bs;
+				SPtr<SerializedObject> intermediate = bs._decodeToIntermediate(stream, size);
+				decoded = bs._decodeFromIntermediate(intermediate);
+				intermediateTime = std::min(intermediateTime, timer.getMicroseconds() - startTime);
+			}
+
+			LOGDBG(name + " (" + toString(size / 1024) + " KB): encode " + toString(encodeTime) + " us, decode " +
+				toString(decodeTime) + " us, decode through intermediate " + toString(intermediateTime) + " us");
+		};
+
+		measure("Mesh", &mesh);
+		measure("Prefab", &prefab);
+		measure("Material", &material);
+	}
+}
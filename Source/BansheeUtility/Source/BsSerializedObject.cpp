@@ -2,9 +2,28 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsSerializedObject.h"
 #include "BsSerializedObjectRTTI.h"
+#include "BsDataStream.h"
 
 namespace BansheeEngine
 {
+	/** Combines a key (e.g. field ID or array index) with the hash of the value stored under it. */
+	static UINT64 mixHash(UINT64 key, UINT64 value)
+	{
+		UINT64 h = (key + 0x9e3779b97f4a7c15ULL) ^ value;
+		h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+		return h ^ (h >> 31);
+	}
+
+	/** Returns a hash of an instance that may be null. */
+	static UINT64 getInstanceHash(const SPtr<SerializedInstance>& instance, UINT32& numCycles)
+	{
+		if (instance == nullptr)
+			return 0;
+
+		return instance->_calculateHash(numCycles);
+	}
+
 	SPtr<SerializedInstance> SerializedField::clone(bool cloneData)
 	{
 		SPtr<SerializedField> copy = bs_shared_ptr_new<SerializedField>();
@@ -25,6 +44,11 @@ namespace BansheeEngine
 		return copy;
 	}
 
+	UINT64 SerializedField::_calculateHash(UINT32& numCycles)
+	{
+		return hash64(value, size, size);
+	}
+
 	SPtr<SerializedInstance> SerializedDataBlock::clone(bool cloneData)
 	{
 		SPtr<SerializedDataBlock> copy = bs_shared_ptr_new<SerializedDataBlock>();
@@ -50,6 +74,44 @@ namespace BansheeEngine
 		return copy;
 	}
 
+	UINT64 SerializedDataBlock::_calculateHash(UINT32& numCycles)
+	{
+		// Hash in fixed size pieces regardless of the stream type, so equal data results in equal hashes
+		static const UINT32 CHUNK_SIZE = 4096;
+
+		UINT64 hash = size;
+		if (stream == nullptr)
+			return hash;
+
+		if (stream->isMemory())
+		{
+			SPtr<MemoryDataStream> memStream = std::static_pointer_cast<MemoryDataStream>(stream);
+			UINT8* data = memStream->getPtr() + offset;
+
+			for (UINT32 i = 0; i < size; i += CHUNK_SIZE)
+				hash = hash64(data + i, std::min(CHUNK_SIZE, size - i), hash);
+		}
+		else
+		{
+			UINT8 buffer[CHUNK_SIZE];
+
+			size_t curPos = stream->tell();
+			stream->seek(offset);
+
+			for (UINT32 i = 0; i < size; i += CHUNK_SIZE)
+			{
+				UINT32 chunkSize = std::min(CHUNK_SIZE, size - i);
+				stream->read(buffer, chunkSize);
+
+				hash = hash64(buffer, chunkSize, hash);
+			}
+
+			stream->seek(curPos);
+		}
+
+		return hash;
+	}
+
 	SPtr<SerializedInstance> SerializedObject::clone(bool cloneData)
 	{
 		SPtr<SerializedObject> copy = bs_shared_ptr_new<SerializedObject>();
@@ -76,6 +138,41 @@ namespace BansheeEngine
 		return copy;
 	}
 
+	UINT64 SerializedObject::_calculateHash(UINT32& numCycles)
+	{
+		if (mHashState == HashState::Cached)
+			return mHash;
+
+		// Object references itself somewhere in its hierarchy
+		if (mHashState == HashState::InProgress)
+		{
+			numCycles++;
+			return mixHash(getRootTypeId(), 0);
+		}
+
+		mHashState = HashState::InProgress;
+		UINT32 prevNumCycles = numCycles;
+
+		UINT64 hash = subObjects.size();
+		for (auto& subObject : subObjects)
+		{
+			// Entries are unordered, so their hashes are combined in an order independent way
+			UINT64 entriesHash = 0;
+			for (auto& entryPair : subObject.entries)
+				entriesHash += mixHash(entryPair.first, getInstanceHash(entryPair.second.serialized, numCycles));
+
+			hash = mixHash(hash, mixHash(subObject.typeId, entriesHash));
+		}
+
+		mHash = hash;
+		if (numCycles == prevNumCycles)
+			mHashState = HashState::Cached;
+		else
+			mHashState = HashState::None;
+
+		return hash;
+	}
+
 	SPtr<SerializedInstance> SerializedArray::clone(bool cloneData)
 	{
 		SPtr<SerializedArray> copy = bs_shared_ptr_new<SerializedArray>();
@@ -92,6 +189,15 @@ namespace BansheeEngine
 		return copy;
 	}
 
+	UINT64 SerializedArray::_calculateHash(UINT32& numCycles)
+	{
+		UINT64 entriesHash = 0;
+		for (auto& entryPair : entries)
+			entriesHash += mixHash(entryPair.first, getInstanceHash(entryPair.second.serialized, numCycles));
+
+		return mixHash(numElements, entriesHash);
+	}
+
 	RTTITypeBase* SerializedInstance::getRTTIStatic()
 	{
 		return SerializedInstanceRTTI::instance();
@@ -6,143 +6,192 @@ namespace BansheeEngine
 {
 	const StringID StringID::NONE = StringID();
 
-	volatile StringID::InitStatics StringID::mInitStatics = StringID::InitStatics();
-
-	StringID::InternalData* StringID::mStringHashTable[HASH_TABLE_SIZE];
-	StringID::InternalData* StringID::mChunks[MAX_CHUNK_COUNT];
-
-	UINT32 StringID::mNextId = 0;
-	UINT32 StringID::mNumChunks = 0;
-	SpinLock StringID::mSync;
-
-	StringID::InitStatics::InitStatics()
-	{
-		ScopedSpinLock lock(mSync);
-
-		memset(mStringHashTable, 0, sizeof(mStringHashTable));
-		memset(mChunks, 0, sizeof(mChunks));
-
-		mChunks[0] = (InternalData*)bs_alloc(sizeof(InternalData) * ELEMENTS_PER_CHUNK);
-		memset(mChunks[0], 0, sizeof(InternalData) * ELEMENTS_PER_CHUNK);
-
-		mNumChunks++;
-	}
+	StringID::Shard StringID::mShards[NUM_SHARDS];
+	std::atomic<UINT32> StringID::mNextId;
 
 	StringID::StringID()
 		:mData(nullptr)
 	{ }
 
-	template<class T>
-	void StringID::construct(T const& name)
+	void StringID::construct(const char* name, UINT32 length)
 	{
-		assert(StringIDUtil<T>::size(name) <= STRING_SIZE);
+		UINT32 hash = calcHash(name, length);
+		Shard& shard = getShard(hash);
 
-		UINT32 hash = calcHash(name) & (sizeof(mStringHashTable) / sizeof(mStringHashTable[0]) - 1);
-		InternalData* existingEntry = mStringHashTable[hash];
+		mData = find(shard, hash, name, length);
+		if (mData != nullptr)
+			return;
 		
-		while (existingEntry != nullptr)
+		ScopedSpinLock lock(shard.lock);
+		mData = findOrInsert(shard, hash, name, length);
+	}
+
+	Vector<StringID> StringID::create(const Vector<String>& names)
+	{
+		UINT32 numNames = (UINT32)names.size();
+		Vector<StringID> output(numNames);
+
+		struct MissingEntry
 		{
-			if (StringIDUtil<T>::compare(name, existingEntry->chars))
-			{
-				mData = existingEntry;
-				return;
-			}
+			UINT32 idx;
+			UINT32 hash;
+		};
+
+		// Find existing strings without locking, and group the rest by shard
+		Vector<MissingEntry> missing;
+		for (UINT32 i = 0; i < numNames; i++)
+		{
+			const String& name = names[i];
+			UINT32 hash = calcHash(name.data(), (UINT32)name.size());
 
-			existingEntry = existingEntry->next;
+			output[i].mData = find(getShard(hash), hash, name.data(), (UINT32)name.size());
+			if (output[i].mData == nullptr)
+				missing.push_back({ i, hash });
 		}
 
-		ScopedSpinLock lock(mSync);
+		std::sort(missing.begin(), missing.end(),
+			[](const MissingEntry& a, const MissingEntry& b) { return a.hash < b.hash; });
 
-		// Search for the value again in case other thread just added it
-		existingEntry = mStringHashTable[hash];
-		InternalData* lastEntry = nullptr;
-		while (existingEntry != nullptr)
+		UINT32 numMissing = (UINT32)missing.size();
+		UINT32 groupStart = 0;
+		while (groupStart < numMissing)
 		{
-			if (StringIDUtil<T>::compare(name, existingEntry->chars))
+			Shard& shard = getShard(missing[groupStart].hash);
+
+			ScopedSpinLock lock(shard.lock);
+
+			UINT32 i = groupStart;
+			for (; i < numMissing && &getShard(missing[i].hash) == &shard; i++)
 			{
-				mData = existingEntry;
-				return;
+				const String& name = names[missing[i].idx];
+				output[missing[i].idx].mData = findOrInsert(shard, missing[i].hash, name.data(), (UINT32)name.size());
 			}
 
-			lastEntry = existingEntry;
-			existingEntry = existingEntry->next;
+			groupStart = i;
 		}
 
-		mData = allocEntry();
-		StringIDUtil<T>::copy(name, mData->chars);
+		return output;
+	}
 
-		if (lastEntry == nullptr)
-			mStringHashTable[hash] = mData;
-		else
-			lastEntry->next = mData;
+	UINT32 StringID::calcHash(const char* name, UINT32 length)
+	{
+		UINT64 hash = hash64(name, length);
+
+		// High bits select the shard, so make sure they depend on the entire hash
+		return (UINT32)(hash ^ (hash >> 32));
 	}
 
-	template<class T>
-	UINT32 StringID::calcHash(T const& input)
+	StringID::InternalData* StringID::find(Shard& shard, UINT32 hash, const char* name, UINT32 length)
 	{
-		UINT32 size = StringIDUtil<T>::size(input);
+		HashTable* table = shard.table.load(std::memory_order_acquire);
+		if (table == nullptr)
+			return nullptr;
 
-		UINT32 hash = 0;
-		for (UINT32 i = 0; i < size; i++)
-			hash = hash * 101 + input[i];
+		// Entries are never removed, and tables are never more than half full, so an empty slot ends the search
+		UINT32 mask = table->size - 1;
+		for (UINT32 i = hash & mask; ; i = (i + 1) & mask)
+		{
+			InternalData* entry = table->entries[i].load(std::memory_order_acquire);
+			if (entry == nullptr)
+				return nullptr;
 
-		return hash;
+			if (entry->hash == hash && entry->length == length && memcmp(entry->chars, name, length) == 0)
+				return entry;
+		}
 	}
 
-	StringID::InternalData* StringID::allocEntry()
+	StringID::InternalData* StringID::findOrInsert(Shard& shard, UINT32 hash, const char* name, UINT32 length)
 	{
-		UINT32 chunkIdx = mNextId / ELEMENTS_PER_CHUNK;
+		// Search again in case another thread just added the string, or grew the table
+		InternalData* existingEntry = find(shard, hash, name, length);
+		if (existingEntry != nullptr)
+			return existingEntry;
 
-		assert(chunkIdx < MAX_CHUNK_COUNT);
-		assert(chunkIdx <= mNumChunks); // Can only increment sequentially
+		HashTable* table = shard.table.load(std::memory_order_relaxed);
+		if (table == nullptr || (table->numEntries + 1) * 2 > table->size)
+			table = growTable(shard);
 
-		if (chunkIdx >= mNumChunks)
+		InternalData* newEntry = allocEntry(shard, hash, name, length);
+
+		UINT32 mask = table->size - 1;
+		UINT32 i = hash & mask;
+		while (table->entries[i].load(std::memory_order_relaxed) != nullptr)
+			i = (i + 1) & mask;
+
+		// Entry contents must be visible before the entry itself is
+		table->entries[i].store(newEntry, std::memory_order_release);
+		table->numEntries++;
+
+		return newEntry;
+	}
+
+	StringID::InternalData* StringID::allocEntry(Shard& shard, UINT32 hash, const char* name, UINT32 length)
+	{
+		UINT32 entrySize = (UINT32)offsetof(InternalData, chars) + length + 1;
+		entrySize = (entrySize + 7) & ~7U;
+
+		UINT8* entryMemory;
+		if (entrySize > CHUNK_SIZE)
+			entryMemory = (UINT8*)bs_alloc(entrySize);
+		else
 		{
-			mChunks[chunkIdx] = (InternalData*)bs_alloc(sizeof(InternalData) * ELEMENTS_PER_CHUNK);
-			memset(mChunks[chunkIdx], 0, sizeof(InternalData) * ELEMENTS_PER_CHUNK);
+			if (shard.chunk == nullptr || shard.chunkOffset + entrySize > CHUNK_SIZE)
+			{
+				shard.chunk = (UINT8*)bs_alloc(CHUNK_SIZE);
+				shard.chunkOffset = 0;
+			}
 
-			mNumChunks++;
+			entryMemory = shard.chunk + shard.chunkOffset;
+			shard.chunkOffset += entrySize;
 		}
 
-		InternalData* chunk = mChunks[chunkIdx];
-		UINT32 chunkSpecificIndex = mNextId % ELEMENTS_PER_CHUNK;
+		InternalData* newEntry = (InternalData*)entryMemory;
+		newEntry->id = mNextId.fetch_add(1, std::memory_order_relaxed);
+		newEntry->hash = hash;
+		newEntry->length = length;
 
-		InternalData* newEntry = &chunk[chunkSpecificIndex];
-		newEntry->id = mNextId++;
-		newEntry->next = nullptr;
+		memcpy(newEntry->chars, name, length);
+		newEntry->chars[length] = '\0';
 
 		return newEntry;
 	}
 
-	template<>
-	class StringID::StringIDUtil<const char*>
-	{
-	public:
-		static UINT32 size(const char* const& input) { return (UINT32)strlen(input); }
-		static void copy(const char* const& input, char* dest) { memcpy(dest, input, strlen(input) + 1); }
-		static bool compare(const char* const& a, char* b) { return strcmp(a, b) == 0; }
-	};
-
-	template<>
-	class StringID::StringIDUtil <String>
+	StringID::HashTable* StringID::growTable(Shard& shard)
 	{
-	public:
-		static UINT32 size(String const& input) { return (UINT32)input.length(); }
-		static void copy(String const& input, char* dest)
+		HashTable* oldTable = shard.table.load(std::memory_order_relaxed);
+		UINT32 newSize = oldTable != nullptr ? oldTable->size * 2 : INITIAL_TABLE_SIZE;
+
+		UINT8* tableMemory = (UINT8*)bs_alloc(sizeof(HashTable) + sizeof(std::atomic<InternalData*>) * newSize);
+
+		HashTable* newTable = (HashTable*)tableMemory;
+		newTable->size = newSize;
+		newTable->numEntries = 0;
+		newTable->entries = (std::atomic<InternalData*>*)(tableMemory + sizeof(HashTable));
+
+		for (UINT32 i = 0; i < newSize; i++)
+			new (&newTable->entries[i]) std::atomic<InternalData*>(nullptr);
+
+		if (oldTable != nullptr)
 		{ 
-			UINT32 len = (UINT32)input.length();
-			input.copy(dest, len);
-			dest[len] = '\0';
-		}
-		static bool compare(String const& a, char* b) { return a.compare(b) == 0; }
-	};
+			UINT32 mask = newSize - 1;
+			for (UINT32 i = 0; i < oldTable->size; i++)
+			{
+				InternalData* entry = oldTable->entries[i].load(std::memory_order_relaxed);
+				if (entry == nullptr)
+					continue;
 
-	template class StringID::StringIDUtil <const char*>;
-	template class StringID::StringIDUtil <String>;
+				UINT32 j = entry->hash & mask;
+				while (newTable->entries[j].load(std::memory_order_relaxed) != nullptr)
+					j = (j + 1) & mask;
 
-	template BS_UTILITY_EXPORT void StringID::construct(const char* const&);
-	template BS_UTILITY_EXPORT void StringID::construct(String const&);
-	
-	template BS_UTILITY_EXPORT UINT32 StringID::calcHash(const char* const&);
-	template BS_UTILITY_EXPORT UINT32 StringID::calcHash(String const&);
+				newTable->entries[j].store(entry, std::memory_order_relaxed);
+			}
+
+			newTable->numEntries = oldTable->numEntries;
+		}
+
+		// Readers that already hold the old table will simply miss entries added from now on, and fall back to locking
+		shard.table.store(newTable, std::memory_order_release);
+		return newTable;
+	}
 }
\ No newline at end of file
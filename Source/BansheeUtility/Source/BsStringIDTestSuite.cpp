@@ -0,0 +1,149 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsStringIDTestSuite.h"
+
+#include "BsStringID.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Generates a list of unique names with the provided prefix. */
+	Vector<String> generateStringIDNames(const String& prefix, UINT32 count)
+	{
+		Vector<String> names(count);
+		for (UINT32 i = 0; i < count; i++)
+			names[i] = prefix + toString(i);
+
+		return names;
+	}
+
+	StringIDTestSuite::StringIDTestSuite()
+	{
+		BS_ADD_TEST(StringIDTestSuite::testCreate);
+		BS_ADD_TEST(StringIDTestSuite::testCreateMultiple);
+		BS_ADD_TEST(StringIDTestSuite::testContention);
+	}
+
+	void StringIDTestSuite::testCreate()
+	{
+		StringID a("StringIDTest");
+		StringID b(String("StringIDTest"));
+		StringID c("StringIDTest2");
+
+		BS_TEST_ASSERT(a == b);
+		BS_TEST_ASSERT(a != c);
+		BS_TEST_ASSERT(strcmp(a.cstr(), "StringIDTest") == 0);
+		BS_TEST_ASSERT(StringID::NONE.empty());
+		BS_TEST_ASSERT(!StringID("").empty());
+
+		// Strings have no length limit
+		String longName(5000, 'x');
+		StringID longId(longName);
+		BS_TEST_ASSERT(longName == longId.cstr());
+		BS_TEST_ASSERT(longId == StringID(longName));
+
+		// More strings than the table initially fits
+		Vector<String> names = generateStringIDNames("StringIDTestCreate", 50000);
+		Vector<StringID> ids;
+		for (auto& name : names)
+			ids.push_back(StringID(name));
+
+		bool allValid = true;
+		for (UINT32 i = 0; i < (UINT32)names.size(); i++)
+			allValid &= ids[i] == StringID(names[i]) && names[i] == ids[i].cstr();
+
+		BS_TEST_ASSERT(allValid);
+		BS_TEST_ASSERT(ids[0] != ids[1]);
+	}
+
+	void StringIDTestSuite::testCreateMultiple()
+	{
+		// Half of the strings already exist
+		Vector<String> names = generateStringIDNames("StringIDTestMultiple", 2000);
+		for (UINT32 i = 0; i < (UINT32)names.size(); i += 2)
+			StringID existing(names[i]);
+
+		names.push_back(names[5]);
+
+		Vector<StringID> ids = StringID::create(names);
+		BS_TEST_ASSERT(ids.size() == names.size());
+
+		bool allValid = true;
+		for (UINT32 i = 0; i < (UINT32)names.size(); i++)
+			allValid &= ids[i] == StringID(names[i]) && names[i] == ids[i].cstr();
+
+		BS_TEST_ASSERT(allValid);
+		BS_TEST_ASSERT(ids[5] == ids.back());
+	}
+
+	void StringIDTestSuite::testContention()
+	{
+		// Many threads creating the same new strings at once, followed by many threads looking up existing strings. 
+		// Reports the time taken, so it can also be used to measure contention.
+		static const UINT32 NUM_NAMES = 8192;
+		static const UINT32 NUM_LOOKUP_PASSES = 16;
+		UINT32 numThreads = std::max(4U, (UINT32)BS_THREAD_HARDWARE_CONCURRENCY);
+
+		Vector<String> names = generateStringIDNames("StringIDTestContention", NUM_NAMES);
+		Vector<Vector<StringID>> results(numThreads);
+
+		auto runThreads = [&](const std::function<void(UINT32)>& worker)
+		{
+			Timer timer;
+			UINT64 startTime = timer.getMicroseconds();
+
+			Vector<Thread> threads;
+			for (UINT32 i = 0; i < numThreads; i++)
+				threads.push_back(Thread(worker, i));
+
+			for (auto& thread : threads)
+				thread.join();
+
+			return timer.getMicroseconds() - startTime;
+		};
+
+		UINT64 createTime = runThreads([&](UINT32 threadIdx)
+		{
+			// Each thread goes through the names in a different order, so threads race on creating the same strings
+			Vector<StringID>& ids = results[threadIdx];
+			ids.resize(NUM_NAMES);
+
+			UINT32 stride = 2 * threadIdx + 1;
+			for (UINT32 i = 0; i < NUM_NAMES; i++)
+			{
+				UINT32 idx = (i * stride) % NUM_NAMES;
+				ids[idx] = StringID(names[idx]);
+			}
+		});
+
+		bool allMatching = true;
+		for (UINT32 i = 1; i < numThreads; i++)
+			allMatching &= results[i] == results[0];
+
+		BS_TEST_ASSERT(allMatching);
+
+		std::atomic<UINT32> numMismatches(0);
+		UINT64 lookupTime = runThreads([&](UINT32 threadIdx)
+		{
+			UINT32 mismatches = 0;
+			for (UINT32 pass = 0; pass < NUM_LOOKUP_PASSES; pass++)
+			{
+				for (UINT32 i = 0; i < NUM_NAMES; i++)
+				{
+					if (StringID(names[i]) != results[0][i])
+						mismatches++;
+				}
+			}
+
+			numMismatches += mismatches;
+		});
+
+		BS_TEST_ASSERT(numMismatches == 0);
+
+		UINT64 numLookups = (UINT64)numThreads * NUM_NAMES * NUM_LOOKUP_PASSES;
+		LOGDBG("StringID contention (" + toString(numThreads) + " threads): created " + toString(NUM_NAMES) + 
+			" strings in " + toString(createTime) + " us, " + toString(numLookups) + " lookups in " + 
+			toString(lookupTime) + " us.");
+	}
+}
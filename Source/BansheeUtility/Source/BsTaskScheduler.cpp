@@ -5,17 +5,122 @@
 
 namespace BansheeEngine
 {
+	/**
+	 * Fixed size lock-free double ended queue of tasks (Chase-Lev). Only the owner thread may push and pop tasks from the
+	 * bottom of the queue, while any thread may steal tasks from the top of the queue.
+	 */
+	class TaskDeque
+	{
+	public:
+		static const INT64 CAPACITY = 4096;
+		static const INT64 MASK = CAPACITY - 1;
+
+		TaskDeque()
+			:mTop(0), mBottom(0)
+		{
+			for (INT64 i = 0; i < CAPACITY; i++)
+				mTasks[i].store(nullptr, std::memory_order_relaxed);
+		}
+
+		/** Pushes a task to the bottom of the queue. Returns false if queue is full. Owner thread only. */
+		bool push(Task* task)
+		{
+			INT64 bottom = mBottom.load(std::memory_order_relaxed);
+			INT64 top = mTop.load(std::memory_order_acquire);
+
+			if ((bottom - top) >= CAPACITY)
+				return false;
+
+			mTasks[bottom & MASK].store(task, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+
+			return true;
+		}
+
+		/** Pops the most recently pushed task from the bottom of the queue. Owner thread only. */
+		Task* pop()
+		{
+			INT64 bottom = mBottom.load(std::memory_order_relaxed) - 1;
+			mBottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			INT64 top = mTop.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			Task* task = mTasks[bottom & MASK].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// Last element, race against stealers
+				if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					task = nullptr;
+
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return task;
+		}
+
+		/** Steals the least recently pushed task from the top of the queue. Can be called from any thread. */
+		Task* steal()
+		{
+			INT64 top = mTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			INT64 bottom = mBottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return nullptr;
+
+			Task* task = mTasks[top & MASK].load(std::memory_order_relaxed);
+			if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+
+			return task;
+		}
+
+	private:
+		std::atomic<INT64> mTop;
+		UINT8 mPadding[64]; // Keep top and bottom on separate cache lines
+		std::atomic<INT64> mBottom;
+		std::atomic<Task*> mTasks[CAPACITY];
+	};
+
+	/** Data about a single work stealing worker thread. */
+	struct TaskScheduler::WorkerData
+	{
+		TaskDeque tasks;
+		HThread thread;
+		UINT32 stealIdx = 0;
+		TaskScheduler* owner = nullptr;
+	};
+
+	BS_THREADLOCAL TaskScheduler::WorkerData* TaskScheduler::ActiveWorker = nullptr;
+
 	Task::Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker, 
-		TaskPriority priority, SPtr<Task> dependency)
-		:mName(name), mPriority(priority), mTaskId(0), mTaskWorker(taskWorker), mTaskDependency(dependency),
-		mParent(nullptr)
+		TaskPriority priority, const Vector<SPtr<Task>>& dependencies)
+		:mName(name), mPriority(priority), mTaskId(0), mTaskWorker(taskWorker), mTaskDependencies(dependencies),
+		mState(0), mNumPendingDependencies(0), mParent(nullptr)
 	{
 
 	}
 
 	SPtr<Task> Task::create(const String& name, std::function<void()> taskWorker, TaskPriority priority, SPtr<Task> dependency)
 	{
-		return bs_shared_ptr_new<Task>(PrivatelyConstruct(), name, taskWorker, priority, dependency);
+		Vector<SPtr<Task>> dependencies;
+		if (dependency != nullptr)
+			dependencies.push_back(dependency);
+
+		return bs_shared_ptr_new<Task>(PrivatelyConstruct(), name, taskWorker, priority, dependencies);
+	}
+
+	SPtr<Task> Task::create(const String& name, std::function<void()> taskWorker, TaskPriority priority,
+		const Vector<SPtr<Task>>& dependencies)
+	{
+		return bs_shared_ptr_new<Task>(PrivatelyConstruct(), name, taskWorker, priority, dependencies);
 	}
 
 	bool Task::isComplete() const
@@ -36,19 +141,123 @@ namespace BansheeEngine
 
 	void Task::cancel()
 	{
-		mState.store(3);
+		Vector<SPtr<Task>> dependants;
+		{
+			ScopedSpinLock lock(mDependantsSync);
+			mState.store(3);
+			std::swap(dependants, mDependants);
+		}
+
+		// The task might have been canceled before it was queued, in which case it never gets executed and its dependants
+		// must be released here
+		TaskScheduler::releaseDependants(dependants);
+
+		if (mParent != nullptr)
+			mParent->notifyWaiters();
+	}
+
+	bool Task::areDependenciesComplete() const
+	{
+		for (auto& dependency : mTaskDependencies)
+		{
+			if (!dependency->isComplete() && !dependency->isCanceled())
+				return false;
+		}
+
+		return true;
+	}
+
+	TaskGroup::TaskGroup()
+		:mScheduler(TaskScheduler::instance())
+	{ }
+
+	TaskGroup::TaskGroup(TaskScheduler& scheduler)
+		:mScheduler(scheduler)
+	{ }
+
+	void TaskGroup::add(const SPtr<Task>& task)
+	{
+		mTasks.push_back(task);
+		mScheduler.addTask(task);
+	}
+
+	bool TaskGroup::isComplete() const
+	{
+		for (auto& task : mTasks)
+		{
+			if (!task->isComplete() && !task->isCanceled())
+				return false;
+		}
+
+		return true;
+	}
+
+	void TaskGroup::wait()
+	{
+		for (auto& task : mTasks)
+			task->wait();
 	}
 
-	TaskScheduler::TaskScheduler()
-		:mTaskQueue(&TaskScheduler::taskCompare), mMaxActiveTasks(0), mNextTaskId(0), mShutdown(false)
+	TaskScheduler::TaskScheduler(TaskSchedulerMode mode)
+		: mMode(mode), mTaskQueue(&TaskScheduler::taskCompare), mMaxActiveTasks(0), mNextTaskId(0), mCheckTasks(false)
+		, mShutdown(false), mWorkers(nullptr), mNumWorkerSlots(0), mNumSpawnedWorkers(0), mNumQueuedTasks(0)
+		, mNumRunningTasks(0), mNumIdleWorkers(0), mNumWaiters(0), mNumHighPriorityTasks(0)
 	{
 		mMaxActiveTasks = BS_THREAD_HARDWARE_CONCURRENCY;
 
-		mTaskSchedulerThread = ThreadPool::instance().run("TaskScheduler", std::bind(&TaskScheduler::runMain, this));
+		if (mMode == TaskSchedulerMode::WorkStealing)
+		{
+			// Worker data must never be reallocated as other threads access it without locking, so leave some room for
+			// workers added while threads are blocked
+			mNumWorkerSlots = mMaxActiveTasks + 4;
+			mWorkers = bs_newN<WorkerData>(mNumWorkerSlots);
+
+			spawnWorkers();
+		}
+		else
+			mTaskSchedulerThread = ThreadPool::instance().run("TaskScheduler", std::bind(&TaskScheduler::runMain, this));
 	}
 
 	TaskScheduler::~TaskScheduler()
 	{
+		if (mMode == TaskSchedulerMode::WorkStealing)
+		{
+			// Wait until all tasks complete
+			while (mNumQueuedTasks.load() > 0 || mNumRunningTasks.load() > 0)
+			{
+				Task* task = findTask(getActiveWorker());
+				if (task != nullptr)
+				{
+					executeTask(task);
+					continue;
+				}
+
+				// Nothing to help with, sleep until a running task finishes or a new one gets queued
+				mNumWaiters++;
+				{
+					Lock lock(mCompleteMutex);
+					while (mNumQueuedTasks.load() == 0 && mNumRunningTasks.load() > 0)
+						mTaskCompleteCond.wait(lock);
+				}
+				mNumWaiters--;
+			}
+
+			{
+				Lock lock(mReadyMutex);
+				mShutdown = true;
+			}
+
+			mTaskReadyCond.notify_all();
+			mWorkerAddedCond.notify_all();
+
+			UINT32 numWorkers = mNumSpawnedWorkers.load();
+			for (UINT32 i = 0; i < numWorkers; i++)
+				mWorkers[i].thread.blockUntilComplete();
+
+			bs_deleteN(mWorkers, mNumWorkerSlots);
+			return;
+		}
+
 		// Wait until all tasks complete
 		{
 			Lock activeTaskLock(mReadyMutex);
@@ -77,15 +286,42 @@ namespace BansheeEngine
 
 	void TaskScheduler::addTask(const SPtr<Task>& task)
 	{
-		Lock lock(mReadyMutex);
-
 		assert(task->mState != 1 && "Task is already executing, it cannot be executed again until it finishes.");
 
+		if (mMode == TaskSchedulerMode::WorkStealing)
+		{
+			task->mParent = this;
+			task->mState.store(0); // Reset state in case the task is getting re-queued
+			task->mSelfRef = task;
+
+			// One extra dependency so the task doesn't get released before all dependencies are registered
+			task->mNumPendingDependencies.store(1);
+			for (auto& dependency : task->mTaskDependencies)
+			{
+				ScopedSpinLock lock(dependency->mDependantsSync);
+
+				UINT32 state = dependency->mState.load();
+				if (state == 2 || state == 3)
+					continue;
+
+				task->mNumPendingDependencies++;
+				dependency->mDependants.push_back(task);
+			}
+
+			if (--task->mNumPendingDependencies == 0)
+				pushTask(task.get());
+
+			return;
+		}
+
+		Lock lock(mReadyMutex);
+
 		task->mParent = this;
 		task->mTaskId = mNextTaskId++;
 		task->mState.store(0); // Reset state in case the task is getting re-queued
 
 		mTaskQueue.insert(task);
+		mCheckTasks = true;
 
 		// Wake main scheduler thread
 		mTaskReadyCond.notify_one();
@@ -96,9 +332,15 @@ namespace BansheeEngine
 		Lock lock(mReadyMutex);
 
 		mMaxActiveTasks++;
+		mCheckTasks = true;
 
-		// A spot freed up, queue new tasks on main scheduler thread if they exist
-		mTaskReadyCond.notify_one();
+		if (mMode == TaskSchedulerMode::WorkStealing)
+		{
+			spawnWorkers();
+			mWorkerAddedCond.notify_all();
+		}
+		else // A spot freed up, queue new tasks on main scheduler thread if they exist
+			mTaskReadyCond.notify_one();
 	}
 
 	void TaskScheduler::removeWorker()
@@ -107,6 +349,52 @@ namespace BansheeEngine
 
 		if(mMaxActiveTasks > 0)
 			mMaxActiveTasks--;
+
+		// Let idle workers over the limit know they should stop
+		if (mMode == TaskSchedulerMode::WorkStealing)
+			mTaskReadyCond.notify_all();
+	}
+
+	void TaskScheduler::parallelFor(UINT32 start, UINT32 end, UINT32 grainSize,
+		const std::function<void(UINT32, UINT32)>& worker, TaskPriority priority)
+	{
+		if (end <= start)
+			return;
+
+		grainSize = std::max(grainSize, 1U);
+		UINT32 numChunks = (end - start + grainSize - 1) / grainSize;
+		if (numChunks == 1)
+		{
+			worker(start, end);
+			return;
+		}
+
+		// Rather than creating a task per chunk, create a task per worker and have each of them grab chunks until the range
+		// is exhausted. The calling thread acts as one of the workers.
+		std::atomic<UINT32> nextChunk(0);
+		auto processChunks = [&]()
+		{
+			while (true)
+			{
+				UINT32 chunkIdx = nextChunk.fetch_add(1);
+				if (chunkIdx >= numChunks)
+					break;
+
+				UINT32 chunkStart = start + chunkIdx * grainSize;
+				UINT32 chunkEnd = std::min(end, chunkStart + grainSize);
+
+				worker(chunkStart, chunkEnd);
+			}
+		};
+
+		UINT32 numTasks = std::min(numChunks, getNumWorkers() + 1) - 1;
+
+		TaskGroup group(*this);
+		for (UINT32 i = 0; i < numTasks; i++)
+			group.add(Task::create("ParallelFor", processChunks, priority));
+
+		processChunks();
+		group.wait();
 	}
 
 	void TaskScheduler::runMain()
@@ -115,22 +403,31 @@ namespace BansheeEngine
 		{
 			Lock lock(mReadyMutex);
 
-			while((mTaskQueue.size() == 0 || (UINT32)mActiveTasks.size() >= mMaxActiveTasks) && !mShutdown)
+			while((!mCheckTasks || mTaskQueue.size() == 0 || (UINT32)mActiveTasks.size() >= mMaxActiveTasks) && !mShutdown)
 				mTaskReadyCond.wait(lock);
 
 			if(mShutdown)
 				break;
 
-			for(UINT32 i = 0; (i < mTaskQueue.size()) && ((UINT32)mActiveTasks.size() < mMaxActiveTasks); i++)
+			mCheckTasks = false;
+			for(auto iter = mTaskQueue.begin(); iter != mTaskQueue.end() && ((UINT32)mActiveTasks.size() < mMaxActiveTasks);)
 			{
-				SPtr<Task> curTask = *mTaskQueue.begin();
-				mTaskQueue.erase(mTaskQueue.begin());
+				SPtr<Task> curTask = *iter;
 
 				if(curTask->isCanceled())
+				{
+					iter = mTaskQueue.erase(iter);
 					continue;
+				}
 
-				if(curTask->mTaskDependency != nullptr && !curTask->mTaskDependency->isComplete())
+				// Keep the task queued until its dependencies complete
+				if(!curTask->areDependenciesComplete())
+				{
+					++iter;
 					continue;
+				}
+
+				iter = mTaskQueue.erase(iter);
 
 				curTask->mState.store(1);
 				mActiveTasks.push_back(curTask);
@@ -150,6 +447,11 @@ namespace BansheeEngine
 			auto findIter = std::find(mActiveTasks.begin(), mActiveTasks.end(), task);
 			if (findIter != mActiveTasks.end())
 				mActiveTasks.erase(findIter);
+
+			// Possibly this task was someones dependency, so wake the main scheduler thread. Done before marking the task
+			// as complete, as the scheduler may be destroyed as soon as it's notified of completion.
+			mCheckTasks = true;
+			mTaskReadyCond.notify_one();
 		}
 
 		{
@@ -158,9 +460,6 @@ namespace BansheeEngine
 
 			mTaskCompleteCond.notify_all();
 		}
-
-		// Possibly this task was someones dependency, so wake the main scheduler thread
-		mTaskReadyCond.notify_one();
 	}
 
 	void TaskScheduler::waitUntilComplete(const Task* task)
@@ -168,6 +467,12 @@ namespace BansheeEngine
 		if(task->isCanceled())
 			return;
 
+		if (mMode == TaskSchedulerMode::WorkStealing)
+		{
+			helpUntilComplete(task);
+			return;
+		}
+
 		{
 			Lock lock(mCompleteMutex);
 			
@@ -189,4 +494,226 @@ namespace BansheeEngine
 		// Otherwise we go by smaller id, as that task was queued earlier than the other
 		return lhs->mTaskId < rhs->mTaskId;
 	}
+
+	void TaskScheduler::runWorker(UINT32 workerIdx)
+	{
+		WorkerData* worker = &mWorkers[workerIdx];
+		ActiveWorker = worker;
+
+		while (true)
+		{
+			// Wait until the worker is allowed to run, if number of workers was reduced
+			if (workerIdx >= mMaxActiveTasks.load())
+			{
+				Lock lock(mReadyMutex);
+
+				// This worker might have been woken up to process a new task, pass the notification along
+				if (mNumQueuedTasks.load() > 0)
+					mTaskReadyCond.notify_one();
+
+				while (workerIdx >= mMaxActiveTasks.load() && !mShutdown)
+					mWorkerAddedCond.wait(lock);
+			}
+
+			Task* task = findTask(worker);
+			if (task != nullptr)
+			{
+				executeTask(task);
+				continue;
+			}
+
+			Lock lock(mReadyMutex);
+			if (mShutdown)
+				break;
+
+			mNumIdleWorkers++;
+			while (mNumQueuedTasks.load() == 0 && workerIdx < mMaxActiveTasks.load() && !mShutdown)
+				mTaskReadyCond.wait(lock);
+			mNumIdleWorkers--;
+		}
+
+		ActiveWorker = nullptr;
+	}
+
+	void TaskScheduler::spawnWorkers()
+	{
+		UINT32 numWorkers = std::min(mMaxActiveTasks.load(), mNumWorkerSlots);
+		for (UINT32 i = mNumSpawnedWorkers.load(); i < numWorkers; i++)
+		{
+			mWorkers[i].stealIdx = i + 1;
+			mWorkers[i].owner = this;
+			mWorkers[i].thread = ThreadPool::instance().run("TaskWorker", std::bind(&TaskScheduler::runWorker, this, i));
+
+			mNumSpawnedWorkers++;
+		}
+	}
+
+	void TaskScheduler::pushTask(Task* task)
+	{
+		mNumQueuedTasks++;
+
+		if (task->mPriority > TaskPriority::Normal)
+		{
+			Lock lock(mGlobalTasksMutex);
+
+			UINT32 queueIdx = task->mPriority >= TaskPriority::VeryHigh ? 0 : 1;
+			mHighPriorityTasks[queueIdx].push(task);
+			mNumHighPriorityTasks++;
+		}
+		else
+		{
+			// Low priority tasks skip the worker queues, so workers only get to them once they run out of their own tasks
+			WorkerData* worker = task->mPriority == TaskPriority::Normal ? getActiveWorker() : nullptr;
+			if (worker == nullptr || !worker->tasks.push(task))
+			{
+				Lock lock(mGlobalTasksMutex);
+				mGlobalTasks.push(task);
+			}
+		}
+
+		if (mNumIdleWorkers.load() > 0)
+		{
+			Lock lock(mReadyMutex);
+			mTaskReadyCond.notify_one();
+		}
+
+		// Threads blocked in helpUntilComplete() can help with the new task
+		notifyWaiters();
+	}
+
+	Task* TaskScheduler::findTask(WorkerData* worker)
+	{
+		if (mNumQueuedTasks.load() == 0)
+			return nullptr;
+
+		Task* task = nullptr;
+		if (mNumHighPriorityTasks.load() > 0)
+		{
+			Lock lock(mGlobalTasksMutex);
+			for (auto& queue : mHighPriorityTasks)
+			{
+				if (queue.empty())
+					continue;
+
+				task = queue.front();
+				queue.pop();
+				mNumHighPriorityTasks--;
+
+				return task;
+			}
+		}
+
+		if (worker != nullptr)
+		{
+			task = worker->tasks.pop();
+			if (task != nullptr)
+				return task;
+		}
+
+		{
+			Lock lock(mGlobalTasksMutex);
+			if (!mGlobalTasks.empty())
+			{
+				task = mGlobalTasks.front();
+				mGlobalTasks.pop();
+
+				return task;
+			}
+		}
+
+		UINT32 numWorkers = mNumSpawnedWorkers.load();
+		UINT32 stealIdx = worker != nullptr ? worker->stealIdx++ : 0;
+		for (UINT32 i = 0; i < numWorkers; i++)
+		{
+			WorkerData* victim = &mWorkers[(stealIdx + i) % numWorkers];
+			if (victim == worker)
+				continue;
+
+			task = victim->tasks.steal();
+			if (task != nullptr)
+				return task;
+		}
+
+		return nullptr;
+	}
+
+	void TaskScheduler::executeTask(Task* taskPtr)
+	{
+		// Take over the reference from the queue, the task might otherwise get destroyed as soon as it completes
+		SPtr<Task> task = std::move(taskPtr->mSelfRef);
+
+		mNumRunningTasks++;
+		mNumQueuedTasks--;
+
+		Vector<SPtr<Task>> dependants;
+		if (!task->isCanceled())
+		{
+			task->mState.store(1);
+			task->mTaskWorker();
+
+			ScopedSpinLock lock(task->mDependantsSync);
+			task->mState.store(2);
+			std::swap(dependants, task->mDependants);
+		}
+		else
+		{
+			ScopedSpinLock lock(task->mDependantsSync);
+			std::swap(dependants, task->mDependants);
+		}
+
+		releaseDependants(dependants);
+
+		mNumRunningTasks--;
+		notifyWaiters();
+	}
+
+	void TaskScheduler::releaseDependants(const Vector<SPtr<Task>>& dependants)
+	{
+		for (auto& dependant : dependants)
+		{
+			// Dependants can belong to a different scheduler than the task they depend on
+			if (--dependant->mNumPendingDependencies == 0)
+				dependant->mParent->pushTask(dependant.get());
+		}
+	}
+
+	void TaskScheduler::notifyWaiters()
+	{
+		if (mNumWaiters.load() > 0)
+		{
+			Lock lock(mCompleteMutex);
+			mTaskCompleteCond.notify_all();
+		}
+	}
+
+	void TaskScheduler::helpUntilComplete(const Task* task)
+	{
+		while (!task->isComplete() && !task->isCanceled())
+		{
+			Task* otherTask = findTask(getActiveWorker());
+			if (otherTask != nullptr)
+			{
+				executeTask(otherTask);
+				continue;
+			}
+
+			// Nothing to do, sleep until some task completes, gets canceled or a new task gets queued
+			mNumWaiters++;
+			{
+				Lock lock(mCompleteMutex);
+				while (!task->isComplete() && !task->isCanceled() && mNumQueuedTasks.load() == 0)
+					mTaskCompleteCond.wait(lock);
+			}
+			mNumWaiters--;
+		}
+	}
+
+	TaskScheduler::WorkerData* TaskScheduler::getActiveWorker() const
+	{
+		// Worker threads are tied to a single scheduler, and must not use their queue for tasks of another scheduler
+		if (ActiveWorker == nullptr || ActiveWorker->owner != this)
+			return nullptr;
+
+		return ActiveWorker;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,322 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsTaskSchedulerTestSuite.h"
+
+#include "BsTaskScheduler.h"
+#include "BsThreadPool.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Queues a large number of independent tasks and checks that all of them ran exactly once. */
+	bool runIndependentTasks(TaskSchedulerMode mode, UINT32 numTasks)
+	{
+		TaskScheduler* scheduler = bs_new<TaskScheduler>(mode);
+
+		std::atomic<UINT32> counter(0);
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 0; i < numTasks; i++)
+		{
+			SPtr<Task> task = Task::create("Test", [&counter]() { counter++; });
+			scheduler->addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		bool allComplete = true;
+		for (auto& task : tasks)
+		{
+			task->wait();
+			allComplete &= task->isComplete();
+		}
+
+		bs_delete(scheduler);
+		return allComplete && counter.load() == numTasks;
+	}
+
+	/** Queues a task depending on multiple other tasks and checks that it runs only after all of them complete. */
+	bool runDependentTasks(TaskSchedulerMode mode)
+	{
+		TaskScheduler* scheduler = bs_new<TaskScheduler>(mode);
+
+		const UINT32 NUM_DEPENDENCIES = 32;
+		std::atomic<UINT32> counter(0);
+		std::atomic<UINT32> counterOnRun(0);
+
+		Vector<SPtr<Task>> dependencies;
+		for (UINT32 i = 0; i < NUM_DEPENDENCIES; i++)
+		{
+			dependencies.push_back(Task::create("Dependency",
+				[&counter]() { BS_THREAD_SLEEP(1); counter++; }));
+		}
+
+		// Queue the dependant before its dependencies, to ensure it waits on them even when they haven't been queued yet
+		SPtr<Task> dependant = Task::create("Dependant",
+			[&counter, &counterOnRun]() { counterOnRun = counter.load(); }, TaskPriority::VeryHigh, dependencies);
+		scheduler->addTask(dependant);
+
+		for (auto& dependency : dependencies)
+			scheduler->addTask(dependency);
+
+		dependant->wait();
+
+		bs_delete(scheduler);
+		return dependant->isComplete() && counterOnRun.load() == NUM_DEPENDENCIES;
+	}
+
+	/** Queues a number of small tasks and returns the time it took for all of them to complete, in microseconds. */
+	UINT64 measureTaskThroughput(TaskSchedulerMode mode, UINT32 numTasks)
+	{
+		TaskScheduler* scheduler = bs_new<TaskScheduler>(mode);
+
+		std::atomic<UINT32> counter(0);
+		Vector<SPtr<Task>> tasks(numTasks);
+		for (UINT32 i = 0; i < numTasks; i++)
+			tasks[i] = Task::create("Benchmark", [&counter]() { counter++; });
+
+		Timer timer;
+		UINT64 startTime = timer.getMicroseconds();
+
+		for (auto& task : tasks)
+			scheduler->addTask(task);
+
+		for (auto& task : tasks)
+			task->wait();
+
+		UINT64 time = timer.getMicroseconds() - startTime;
+
+		bs_delete(scheduler);
+		return time;
+	}
+
+	/** Runs a parallel for loop and checks that every element was processed exactly once. */
+	bool runParallelFor(TaskSchedulerMode mode)
+	{
+		TaskScheduler* scheduler = bs_new<TaskScheduler>(mode);
+
+		const UINT32 NUM_ELEMENTS = 100000;
+		Vector<UINT32> elements(NUM_ELEMENTS, 0);
+
+		scheduler->parallelFor(0, NUM_ELEMENTS, 64, [&elements](UINT32 first, UINT32 last)
+		{
+			for (UINT32 i = first; i < last; i++)
+				elements[i]++;
+		});
+
+		// Empty and single chunk ranges
+		scheduler->parallelFor(10, 10, 64, [&elements](UINT32 first, UINT32 last) { elements[0]++; });
+		scheduler->parallelFor(0, 1, 64, [&elements](UINT32 first, UINT32 last) { elements[0]++; });
+
+		bs_delete(scheduler);
+
+		bool valid = elements[0] == 2;
+		for (UINT32 i = 1; i < NUM_ELEMENTS; i++)
+			valid &= elements[i] == 1;
+
+		return valid;
+	}
+
+	void TaskSchedulerTestSuite::startUp()
+	{
+		UINT32 numThreads = BS_THREAD_HARDWARE_CONCURRENCY;
+		ThreadPool::startUp<TThreadPool<>>(numThreads, 256);
+	}
+
+	void TaskSchedulerTestSuite::shutDown()
+	{
+		ThreadPool::shutDown();
+	}
+
+	TaskSchedulerTestSuite::TaskSchedulerTestSuite()
+	{
+		BS_ADD_TEST(TaskSchedulerTestSuite::testRunTasks_global_queue);
+		BS_ADD_TEST(TaskSchedulerTestSuite::testRunTasks_work_stealing);
+		BS_ADD_TEST(TaskSchedulerTestSuite::testMultipleDependencies_global_queue);
+		BS_ADD_TEST(TaskSchedulerTestSuite::testMultipleDependencies_work_stealing);
+		BS_ADD_TEST(TaskSchedulerTestSuite::testNestedTasks_work_stealing);
+		BS_ADD_TEST(TaskSchedulerTestSuite::testParallelFor_global_queue);
+		BS_ADD_TEST(TaskSchedulerTestSuite::testParallelFor_work_stealing);
+		BS_ADD_TEST(TaskSchedulerTestSuite::testCanceledDependency_work_stealing);
+		BS_ADD_TEST(TaskSchedulerTestSuite::testMultipleSchedulers_work_stealing);
+		BS_ADD_TEST(TaskSchedulerTestSuite::testPriority_work_stealing);
+		BS_ADD_TEST(TaskSchedulerTestSuite::testThroughput_benchmark);
+	}
+
+	void TaskSchedulerTestSuite::testRunTasks_global_queue()
+	{
+		BS_TEST_ASSERT(runIndependentTasks(TaskSchedulerMode::GlobalQueue, 256));
+	}
+
+	void TaskSchedulerTestSuite::testRunTasks_work_stealing()
+	{
+		BS_TEST_ASSERT(runIndependentTasks(TaskSchedulerMode::WorkStealing, 20000));
+	}
+
+	void TaskSchedulerTestSuite::testMultipleDependencies_global_queue()
+	{
+		BS_TEST_ASSERT(runDependentTasks(TaskSchedulerMode::GlobalQueue));
+	}
+
+	void TaskSchedulerTestSuite::testMultipleDependencies_work_stealing()
+	{
+		BS_TEST_ASSERT(runDependentTasks(TaskSchedulerMode::WorkStealing));
+	}
+
+	void TaskSchedulerTestSuite::testNestedTasks_work_stealing()
+	{
+		TaskScheduler* scheduler = bs_new<TaskScheduler>(TaskSchedulerMode::WorkStealing);
+
+		// Tasks queued from within tasks end up in the workers local queue, and waiting on them from a worker executes them
+		const UINT32 NUM_OUTER = 64;
+		const UINT32 NUM_INNER = 64;
+		std::atomic<UINT32> counter(0);
+
+		TaskGroup outerGroup(*scheduler);
+		for (UINT32 i = 0; i < NUM_OUTER; i++)
+		{
+			outerGroup.add(Task::create("Outer", [&counter, scheduler]()
+			{
+				TaskGroup innerGroup(*scheduler);
+				for (UINT32 j = 0; j < NUM_INNER; j++)
+					innerGroup.add(Task::create("Inner", [&counter]() { counter++; }));
+
+				innerGroup.wait();
+			}));
+		}
+
+		outerGroup.wait();
+		BS_TEST_ASSERT(outerGroup.isComplete());
+		BS_TEST_ASSERT(counter.load() == NUM_OUTER * NUM_INNER);
+
+		bs_delete(scheduler);
+	}
+
+	void TaskSchedulerTestSuite::testParallelFor_global_queue()
+	{
+		BS_TEST_ASSERT(runParallelFor(TaskSchedulerMode::GlobalQueue));
+	}
+
+	void TaskSchedulerTestSuite::testParallelFor_work_stealing()
+	{
+		BS_TEST_ASSERT(runParallelFor(TaskSchedulerMode::WorkStealing));
+	}
+
+	void TaskSchedulerTestSuite::testCanceledDependency_work_stealing()
+	{
+		TaskScheduler* scheduler = bs_new<TaskScheduler>(TaskSchedulerMode::WorkStealing);
+
+		// Canceled dependency shouldn't block the dependant
+		std::atomic<bool> dependencyRan(false);
+		SPtr<Task> dependency = Task::create("Dependency", [&dependencyRan]() { dependencyRan = true; });
+		SPtr<Task> dependant = Task::create("Dependant", []() { }, TaskPriority::Normal, dependency);
+
+		dependency->cancel();
+		scheduler->addTask(dependant);
+
+		dependant->wait();
+		BS_TEST_ASSERT(dependant->isComplete());
+
+		// Dependency canceled after the dependant was queued, but before the dependency itself was ever queued
+		SPtr<Task> unqueuedDependency = Task::create("Dependency", [&dependencyRan]() { dependencyRan = true; });
+		SPtr<Task> waitingDependant = Task::create("Dependant", []() { }, TaskPriority::Normal, unqueuedDependency);
+
+		scheduler->addTask(waitingDependant);
+		unqueuedDependency->cancel();
+
+		waitingDependant->wait();
+		BS_TEST_ASSERT(waitingDependant->isComplete());
+
+		bs_delete(scheduler);
+		BS_TEST_ASSERT(!dependencyRan.load());
+	}
+
+	void TaskSchedulerTestSuite::testMultipleSchedulers_work_stealing()
+	{
+		TaskScheduler* schedulers[2];
+		for (auto& scheduler : schedulers)
+			scheduler = bs_new<TaskScheduler>(TaskSchedulerMode::WorkStealing);
+
+		// Tasks queued from a worker of one scheduler must end up in the other scheduler's queues, otherwise its own
+		// workers never find them
+		const UINT32 NUM_TASKS = 64;
+		std::atomic<UINT32> counter(0);
+		Vector<SPtr<Task>> innerTasks(NUM_TASKS);
+
+		SPtr<Task> outerTask = Task::create("Outer", [&]()
+		{
+			for (UINT32 i = 0; i < NUM_TASKS; i++)
+			{
+				innerTasks[i] = Task::create("Inner", [&counter]() { counter++; });
+				schedulers[1]->addTask(innerTasks[i]);
+			}
+		});
+
+		schedulers[0]->addTask(outerTask);
+		outerTask->wait();
+
+		bool allComplete = true;
+		for (auto& task : innerTasks)
+		{
+			task->wait();
+			allComplete &= task->isComplete();
+		}
+
+		BS_TEST_ASSERT(allComplete);
+		BS_TEST_ASSERT(counter.load() == NUM_TASKS);
+
+		for (auto& scheduler : schedulers)
+			bs_delete(scheduler);
+	}
+
+	void TaskSchedulerTestSuite::testPriority_work_stealing()
+	{
+		TaskScheduler* scheduler = bs_new<TaskScheduler>(TaskSchedulerMode::WorkStealing);
+
+		// Leave a single worker, so the order tasks get executed in is predictable
+		UINT32 numWorkers = scheduler->getNumWorkers();
+		for (UINT32 i = 1; i < numWorkers; i++)
+			scheduler->removeWorker();
+
+		// High priority task is queued first, so it would be executed last if it was placed in the worker's own queue
+		const UINT32 NUM_TASKS = 64;
+		std::atomic<UINT32> counter(0);
+		std::atomic<UINT32> counterOnRun(0);
+
+		SPtr<Task> outerTask = Task::create("Outer", [&]()
+		{
+			TaskGroup group(*scheduler);
+			group.add(Task::create("High", [&counter, &counterOnRun]() { counterOnRun = counter.load(); },
+				TaskPriority::VeryHigh));
+
+			for (UINT32 i = 0; i < NUM_TASKS; i++)
+				group.add(Task::create("Normal", [&counter]() { counter++; }));
+
+			group.wait();
+		});
+
+		scheduler->addTask(outerTask);
+
+		// Don't help with executing the tasks, only the worker should run them
+		while (!outerTask->isComplete())
+			BS_THREAD_SLEEP(1);
+
+		BS_TEST_ASSERT(counter.load() == NUM_TASKS);
+		BS_TEST_ASSERT(counterOnRun.load() <= 1);
+
+		bs_delete(scheduler);
+	}
+
+	void TaskSchedulerTestSuite::testThroughput_benchmark()
+	{
+		// Small enough for the global queue to finish in reasonable time, it sorts every task into a set and dispatches
+		// them one by one from its scheduler thread
+		const UINT32 NUM_TASKS = 20000;
+
+		UINT64 globalQueueTime = measureTaskThroughput(TaskSchedulerMode::GlobalQueue, NUM_TASKS);
+		UINT64 workStealingTime = measureTaskThroughput(TaskSchedulerMode::WorkStealing, NUM_TASKS);
+
+		LOGDBG("Running " + toString(NUM_TASKS) + " small tasks: global queue " + toString(globalQueueTime) +
+			" us, work stealing " + toString(workStealingTime) + " us");
+	}
+}
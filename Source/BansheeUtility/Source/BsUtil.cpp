@@ -38,4 +38,46 @@ namespace BansheeEngine
 
 		return String(buf);
 	}
+
+	UINT64 hash64(const void* data, size_t size, UINT64 seed)
+	{
+		// MurmurHash64A
+		const UINT64 m = 0xc6a4a7935bd1e995ULL;
+		const int r = 47;
+
+		UINT64 h = seed ^ (size * m);
+
+		const UINT8* bytes = (const UINT8*)data;
+		const UINT8* end = bytes + (size & ~(size_t)7);
+		for (; bytes != end; bytes += 8)
+		{
+			UINT64 k;
+			memcpy(&k, bytes, sizeof(k));
+
+			k *= m;
+			k ^= k >> r;
+			k *= m;
+
+			h ^= k;
+			h *= m;
+		}
+
+		switch (size & 7)
+		{
+		case 7: h ^= UINT64(bytes[6]) << 48;
+		case 6: h ^= UINT64(bytes[5]) << 40;
+		case 5: h ^= UINT64(bytes[4]) << 32;
+		case 4: h ^= UINT64(bytes[3]) << 24;
+		case 3: h ^= UINT64(bytes[2]) << 16;
+		case 2: h ^= UINT64(bytes[1]) << 8;
+		case 1: h ^= UINT64(bytes[0]);
+			h *= m;
+		};
+
+		h ^= h >> r;
+		h *= m;
+		h ^= h >> r;
+
+		return h;
+	}
 }
\ No newline at end of file
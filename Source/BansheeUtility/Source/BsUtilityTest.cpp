@@ -1,6 +1,15 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsFileSystemTestSuite.h"
+#include "BsTaskSchedulerTestSuite.h"
+#include "BsMathTestSuite.h"
+#include "BsMPSCQueueTestSuite.h"
+#include "BsPoolAllocTestSuite.h"
+#include "BsFrameAllocTestSuite.h"
+#include "BsCompressionTestSuite.h"
+#include "BsSerializationTestSuite.h"
+#include "BsStringIDTestSuite.h"
+#include "BsRadixSortTestSuite.h"
 #include "BsConsoleTestOutput.h"
 
 using namespace BansheeEngine;
@@ -8,6 +17,15 @@ using namespace BansheeEngine;
 int main()
 {
 	SPtr<TestSuite> tests = FileSystemTestSuite::create<FileSystemTestSuite>();
+	tests->add(TaskSchedulerTestSuite::create<TaskSchedulerTestSuite>());
+	tests->add(MathTestSuite::create<MathTestSuite>());
+	tests->add(MPSCQueueTestSuite::create<MPSCQueueTestSuite>());
+	tests->add(PoolAllocTestSuite::create<PoolAllocTestSuite>());
+	tests->add(FrameAllocTestSuite::create<FrameAllocTestSuite>());
+	tests->add(CompressionTestSuite::create<CompressionTestSuite>());
+	tests->add(SerializationTestSuite::create<SerializationTestSuite>());
+	tests->add(StringIDTestSuite::create<StringIDTestSuite>());
+	tests->add(RadixSortTestSuite::create<RadixSortTestSuite>());
 	ConsoleTestOutput testOutput;
 	tests->run(testOutput);
 
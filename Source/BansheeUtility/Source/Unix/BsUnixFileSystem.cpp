@@ -8,6 +8,8 @@
 
 #include <dirent.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -128,6 +130,47 @@ namespace BansheeEngine
 		return bs_shared_ptr_new<FileDataStream>(path, accessMode, true);
 	}
 
+	SPtr<MappedFileDataStream> FileSystem::openFileMapped(const Path& path)
+	{
+		String pathString = path.toString();
+
+		int fd = open(pathString.c_str(), O_RDONLY);
+		if (fd == -1)
+		{
+			HANDLE_PATH_ERROR(pathString, errno);
+			return nullptr;
+		}
+
+		struct stat st_buf;
+		if (fstat(fd, &st_buf) != 0)
+		{
+			HANDLE_PATH_ERROR(pathString, errno);
+			::close(fd);
+			return nullptr;
+		}
+
+		// Empty files cannot be mapped
+		size_t size = (size_t)st_buf.st_size;
+		SPtr<UINT8> mapping;
+		if (size > 0)
+		{
+			void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+			if (data == MAP_FAILED)
+			{
+				HANDLE_PATH_ERROR(pathString, errno);
+				::close(fd);
+				return nullptr;
+			}
+
+			mapping = SPtr<UINT8>((UINT8*)data, [size](UINT8* ptr) { munmap(ptr, size); }, StdAlloc<UINT8>());
+		}
+
+		// Mapping remains valid after the descriptor is closed
+		::close(fd);
+
+		return bs_shared_ptr_new<MappedFileDataStream>(path, mapping, size);
+	}
+
 	SPtr<DataStream> FileSystem::createAndOpenFile(const Path& path)
 	{
 		return bs_shared_ptr_new<FileDataStream>(path, DataStream::AccessMode::WRITE, true);
@@ -283,6 +283,60 @@ namespace BansheeEngine
 		return bs_shared_ptr_new<FileDataStream>(fullPath, accessMode, true);
 	}
 
+	SPtr<MappedFileDataStream> FileSystem::openFileMapped(const Path& fullPath)
+	{
+		WString pathWString = fullPath.toWString();
+		const wchar_t* pathString = pathWString.c_str();
+
+		HANDLE file = CreateFileW(pathString, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+			nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			win32_handleError(GetLastError(), pathWString);
+			return nullptr;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize))
+		{
+			win32_handleError(GetLastError(), pathWString);
+			CloseHandle(file);
+			return nullptr;
+		}
+
+		// Empty files cannot be mapped
+		size_t size = (size_t)fileSize.QuadPart;
+		SPtr<UINT8> mapping;
+		if (size > 0)
+		{
+			HANDLE fileMapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+			if (fileMapping == nullptr)
+			{
+				win32_handleError(GetLastError(), pathWString);
+				CloseHandle(file);
+				return nullptr;
+			}
+
+			void* data = MapViewOfFile(fileMapping, FILE_MAP_COPY, 0, 0, 0);
+			if (data == nullptr)
+			{
+				win32_handleError(GetLastError(), pathWString);
+				CloseHandle(fileMapping);
+				CloseHandle(file);
+				return nullptr;
+			}
+
+			// View keeps the mapping object alive after its handle is closed
+			CloseHandle(fileMapping);
+
+			mapping = SPtr<UINT8>((UINT8*)data, [](UINT8* ptr) { UnmapViewOfFile(ptr); }, StdAlloc<UINT8>());
+		}
+
+		CloseHandle(file);
+
+		return bs_shared_ptr_new<MappedFileDataStream>(fullPath, mapping, size);
+	}
+
 	SPtr<DataStream> FileSystem::createAndOpenFile(const Path& fullPath)
 	{
 		return bs_shared_ptr_new<FileDataStream>(fullPath, DataStream::AccessMode::WRITE, true);
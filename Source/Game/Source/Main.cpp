@@ -8,6 +8,7 @@
 #include "BsFileSystem.h"
 #include "BsResources.h"
 #include "BsResourceManifest.h"
+#include "BsResourcePackage.h"
 #include "BsPrefab.h"
 #include "BsSceneObject.h"
 #include "BsSceneManager.h"
@@ -43,6 +44,17 @@ int CALLBACK WinMain(
 
 	return 0;
 }
+#else
+using namespace BansheeEngine;
+
+int main()
+{
+	CrashHandler::startUp();
+	runApplication();
+	CrashHandler::shutDown();
+
+	return 0;
+}
 #endif // End BS_PLATFORM
 
 using namespace BansheeEngine;
@@ -139,6 +151,14 @@ void runApplication()
 		gResources().registerResourceManifest(manifest);
 	}
 
+	Path resourcePackagePath = resourcesPath + GAME_RESOURCE_PACKAGE_NAME;
+	if (FileSystem::exists(resourcePackagePath))
+	{
+		SPtr<ResourcePackage> package = ResourcePackage::open(resourcePackagePath);
+		if (package != nullptr)
+			gResources().registerResourcePackage(package);
+	}
+
 	{
 		HPrefab mainScene = static_resource_cast<Prefab>(gResources().loadFromUUID(gameSettings->mainSceneUUID, 
 			false, ResourceLoadFlag::LoadDependencies));
@@ -0,0 +1,9 @@
+set(BS_HEADLESSBENCHMARK_SRC_NOFILTER
+	"Source/Main.cpp"
+)
+
+source_group("Source Files" FILES ${BS_HEADLESSBENCHMARK_SRC_NOFILTER})
+
+set(BS_HEADLESSBENCHMARK_SRC
+	${BS_HEADLESSBENCHMARK_SRC_NOFILTER}
+)
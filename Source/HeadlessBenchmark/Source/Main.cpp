@@ -0,0 +1,122 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsApplication.h"
+#include "BsCrashHandler.h"
+#include "BsSceneObject.h"
+#include "BsComponent.h"
+#include "BsCCamera.h"
+#include "BsCRenderable.h"
+#include "BsMaterial.h"
+#include "BsBuiltinResources.h"
+#include "BsRenderWindow.h"
+#include "BsTimer.h"
+
+namespace BansheeEngine
+{
+	/** 
+	 * Component that spins its scene object every frame, so transforms of all its children need to be updated, and
+	 * stops the main loop after a set number of frames. Reports the average time taken by a frame.
+	 */
+	class FrameBenchmark : public Component
+	{
+	public:
+		FrameBenchmark(const HSceneObject& parent, UINT32 numWarmUpFrames, UINT32 numFrames)
+			:Component(parent), mNumWarmUpFrames(numWarmUpFrames), mNumFrames(numFrames), mCurrentFrame(0)
+		{
+			setName("FrameBenchmark");
+		}
+
+		/** Triggered once per frame. */
+		void update() override
+		{
+			SO()->yaw(Degree(1.0f));
+
+			mCurrentFrame++;
+			if (mCurrentFrame == mNumWarmUpFrames)
+				mTimer.reset();
+			else if (mCurrentFrame == mNumWarmUpFrames + mNumFrames)
+			{
+				float frameTime = mTimer.getMicroseconds() / (float)mNumFrames;
+				LOGDBG("Headless frame time over " + toString(mNumFrames) + " frames: " + toString(frameTime) + " us.");
+
+				gApplication().stopMainLoop();
+			}
+		}
+
+	private:
+		UINT32 mNumWarmUpFrames;
+		UINT32 mNumFrames;
+		UINT32 mCurrentFrame;
+		Timer mTimer;
+	};
+
+	/** Creates a camera rendering to the primary window, and a grid of renderables in front of it. */
+	void setUpScene(UINT32 gridSize)
+	{
+		SPtr<RenderWindow> window = gApplication().getPrimaryWindow();
+
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		HCamera camera = cameraSO->addComponent<CCamera>(window);
+		camera->setNearClipDistance(0.5f);
+		camera->setFarClipDistance(1000.0f);
+		camera->setAspectRatio(window->getProperties().getWidth() / (float)window->getProperties().getHeight());
+
+		cameraSO->setPosition(Vector3(0.0f, gridSize * 1.5f, gridSize * 2.0f));
+		cameraSO->lookAt(Vector3::ZERO);
+
+		HMesh mesh = BuiltinResources::instance().getMesh(BuiltinMesh::Box);
+		HMaterial material = Material::create(BuiltinResources::instance().getBuiltinShader(BuiltinShader::Standard));
+
+		HSceneObject gridSO = SceneObject::create("Grid");
+		for (UINT32 x = 0; x < gridSize; x++)
+		{
+			for (UINT32 z = 0; z < gridSize; z++)
+			{
+				HSceneObject boxSO = SceneObject::create("Box");
+				boxSO->setParent(gridSO);
+				boxSO->setPosition(Vector3((x - gridSize * 0.5f) * 2.0f, 0.0f, (z - gridSize * 0.5f) * 2.0f));
+
+				HRenderable renderable = boxSO->addComponent<CRenderable>();
+				renderable->setMesh(mesh);
+				renderable->setMaterial(material);
+			}
+		}
+
+		gridSO->addComponent<FrameBenchmark>(10, 200);
+	}
+}
+
+using namespace BansheeEngine;
+
+/** 
+ * Boots the engine with the null render API, which needs no GPU or OS window, and renders a fixed number of frames
+ * of a simple scene. Meant as a smoke test and a benchmark of the CPU side of the frame (scene, renderer and core 
+ * thread).
+ */
+int main()
+{
+	CrashHandler::startUp();
+
+	START_UP_DESC startUpDesc;
+	startUpDesc.renderAPI = "BansheeNullRenderAPI";
+	startUpDesc.renderer = BS_RENDERER_MODULE;
+	startUpDesc.audio = BS_AUDIO_MODULE;
+	startUpDesc.physics = BS_PHYSICS_MODULE;
+	startUpDesc.input = BS_INPUT_MODULE;
+
+	startUpDesc.primaryWindowDesc.videoMode = VideoMode(1280, 720);
+	startUpDesc.primaryWindowDesc.title = "Banshee Headless Benchmark";
+	startUpDesc.primaryWindowDesc.fullscreen = false;
+	startUpDesc.primaryWindowDesc.hidden = true;
+	startUpDesc.primaryWindowDesc.depthBuffer = true;
+
+	Application::startUp(startUpDesc);
+
+	setUpScene(32);
+	Application::instance().runMainLoop();
+
+	Application::shutDown();
+	CrashHandler::shutDown();
+
+	return 0;
+}
@@ -11,6 +11,7 @@ set(BS_RENDERBEAST_INC_NOFILTER
 	"Include/BsPostProcessing.h"
 	"Include/BsRendererCamera.h"
 	"Include/BsRendererObject.h"
+	"Include/BsRendererBounds.h"
 )
 
 set(BS_RENDERBEAST_SRC_NOFILTER
@@ -24,12 +25,25 @@ set(BS_RENDERBEAST_SRC_NOFILTER
 	"Source/BsLightRendering.cpp"
 	"Source/BsPostProcessing.cpp"
 	"Source/BsRendererCamera.cpp"
+	"Source/BsRendererBounds.cpp"
+)
+
+set(BS_RENDERBEAST_INC_TESTING
+	"Include/BsRendererBoundsTestSuite.h"
+)
+
+set(BS_RENDERBEAST_SRC_TESTING
+	"Source/BsRendererBoundsTestSuite.cpp"
 )
 
 source_group("Header Files" FILES ${BS_RENDERBEAST_INC_NOFILTER})
 source_group("Source Files" FILES ${BS_RENDERBEAST_SRC_NOFILTER})
+source_group("Header Files\\Testing" FILES ${BS_RENDERBEAST_INC_TESTING})
+source_group("Source Files\\Testing" FILES ${BS_RENDERBEAST_SRC_TESTING})
 
 set(BS_RENDERBEAST_SRC
 	${BS_RENDERBEAST_INC_NOFILTER}
 	${BS_RENDERBEAST_SRC_NOFILTER}
+	${BS_RENDERBEAST_INC_TESTING}
+	${BS_RENDERBEAST_SRC_TESTING}
 )
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "BsRendererMaterial.h"
 #include "BsParamBlocks.h"
 #include "BsRendererObject.h"
+#include "BsGpuParamBlockRing.h"
 
 namespace BansheeEngine
 {
@@ -73,12 +74,25 @@ namespace BansheeEngine
 	class BS_BSRND_EXPORT ObjectRenderer
 	{
 	public:
+		/** Maximum number of elements that may be rendered using a single instanced draw call. */
+		static const UINT32 MAX_INSTANCES_PER_DRAW = 256;
+
+		/** 
+		 * Number of 4-component vectors used for storing a single instance in the per-instance buffer: world view 
+		 * projection matrix (4), world, inverse world, world without scale and inverse world without scale matrices
+		 * (3 each, as they are affine) and world determinant sign (1).
+		 */
+		static const UINT32 INSTANCE_DATA_NUM_VECTORS = 17;
+
 		ObjectRenderer();
 
 		/** Initializes the specified renderable element, making it ready to be used. */
 		void initElement(BeastRenderableElement& element);
 
-		/** Updates global per frame parameter buffers with new values. To be called at the start of every frame. */
+		/** 
+		 * Updates global per frame parameter buffers with new values, and recycles per-object parameter buffers used by
+		 * older frames. To be called at the start of every frame. 
+		 */
 		void setParamFrameParams(float time);
 
 		/**
@@ -88,18 +102,34 @@ namespace BansheeEngine
 		void setPerCameraParams(const CameraShaderData& cameraData);
 
 		/**
-		 * Updates object specific parameter buffers with new values. To be called whenever object specific values change.
+		 * Updates object specific parameter buffers with new values. To be called before every draw of the element.
+		 * Values are written to a parameter buffer taken from the per-object ring, which is then assigned to the element.
 		 */
 		void setPerObjectParams(const BeastRenderableElement& element, const RenderableShaderData& data,
 			const Matrix4& wvpMatrix, const SPtr<GpuBufferCore>& boneMatrices = nullptr);
 
+		/**
+		 * Updates the per-instance buffer with data for a group of elements that are to be rendered using a single 
+		 * instanced draw call. Should only be used with elements using an instanced technique.
+		 *
+		 * @param[in]	data			Shader data of each of the instances, in the order they are to be rendered in.
+		 * @param[in]	numInstances	Number of entries in @p data. Must not be larger than MAX_INSTANCES_PER_DRAW.
+		 * @param[in]	viewProj		View projection matrix of the camera the elements are being rendered with.
+		 */
+		void setPerInstanceParams(const RenderableShaderData* const* data, UINT32 numInstances, const Matrix4& viewProj);
+
 		/** Returns a buffer that stores per-camera parameters. */
 		const PerCameraParamBuffer& getPerCameraParams() const { return mPerCameraParams; }
 
+		/** Returns the ring providing per-object parameter buffers. Can be used for querying upload statistics. */
+		const GpuParamBlockRing& getPerObjectRing() const { return mPerObjectRing; }
+
 	protected:
 		PerFrameParamBuffer mPerFrameParams;
 		PerCameraParamBuffer mPerCameraParams;
 		PerObjectParamBuffer mPerObjectParams;
+		GpuParamBlockRing mPerObjectRing;
+		SPtr<GpuBufferCore> mInstanceBuffer;
 	};
 
 	/** Basic shader that is used when no other is available. */
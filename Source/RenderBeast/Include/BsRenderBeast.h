@@ -26,6 +26,7 @@ namespace BansheeEngine
 	static StringID RPS_GBufferB = "GBufferB";
 	static StringID RPS_GBufferDepth = "GBufferDepth";
 	static StringID RPS_BoneMatrices = "BoneMatrices";
+	static StringID RPS_InstanceData = "InstanceData";
 
 	/**
 	 * Default renderer for Banshee. Performs frustum culling, sorting and renders objects in custom ways determine by
@@ -55,6 +56,7 @@ namespace BansheeEngine
 		struct RendererLight
 		{
 			LightCore* internal;
+			UINT32 treeId;
 		};
 
 		/** Renderer information for a single material. */
@@ -178,6 +180,27 @@ namespace BansheeEngine
 		void renderElement(const BeastRenderableElement& element, UINT32 passIdx, bool bindPass, 
 			const RendererFrame& frameInfo, const Matrix4& viewProj);
 
+		/**
+		 * Renders a group of elements sharing the same mesh, sub-mesh and material using a single instanced draw call.
+		 * All the elements must be using an instanced technique.
+		 *
+		 * @param[in]	elements		First of the render queue entries to render.
+		 * @param[in]	numInstances	Number of sequential render queue entries to render, starting with @p elements.
+		 * @param[in]	viewProj		View projection matrix of the camera the elements are being rendered with.
+		 */
+		void renderInstancedElements(const RenderQueueElement* elements, UINT32 numInstances, const Matrix4& viewProj);
+
+		/**
+		 * Renders all elements in a sorted render queue. Sequential elements that can be instanced are merged into a
+		 * single draw call.
+		 *
+		 * @param[in]	elements	Sorted render queue entries to render.
+		 * @param[in]	frameInfo	Renderer information specific to this frame.
+		 * @param[in]	viewProj	View projection matrix of the camera the elements are being rendered with.
+		 */
+		void renderElements(const Vector<RenderQueueElement>& elements, const RendererFrame& frameInfo, 
+			const Matrix4& viewProj);
+
 		/**	Creates data used by the renderer on the core thread. */
 		void initializeCore();
 
@@ -199,12 +222,16 @@ namespace BansheeEngine
 
 		Vector<RendererObject> mRenderables;
 		Vector<RenderableShaderData> mRenderableShaderData;
-		Vector<Bounds> mWorldBounds;
+		RendererBounds mWorldBounds;
+		AABBTree mRenderableTree;
 		Vector<bool> mVisibility; // Transient
 
 		Vector<RendererLight> mDirectionalLights;
 		Vector<RendererLight> mPointLights;
 		Vector<Sphere> mLightWorldBounds;
+		AABBTree mPointLightTree;
+		Vector<UINT32> mVisiblePointLights; // Transient
+		Vector<const RenderableShaderData*> mInstanceShaderData; // Transient
 
 		SPtr<RenderBeastOptions> mCoreOptions;
 
@@ -0,0 +1,73 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "BsBounds.h"
+#include "BsConvexVolume.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Stores world bounds of a set of objects in structure-of-arrays layout, so that large amounts of bounds can be tested
+	 * for visibility in parallel using vector instructions.
+	 */
+	class RendererBounds
+	{
+	public:
+		/** Appends new bounds at the end of the array. */
+		void add(const Bounds& bounds);
+
+		/** Updates the bounds at the specified index. */
+		void set(UINT32 idx, const Bounds& bounds);
+
+		/** Swaps the bounds at the two provided indices. */
+		void swap(UINT32 lhs, UINT32 rhs);
+
+		/** Removes the bounds at the end of the array. */
+		void removeLast();
+
+		/** Removes all bounds. */
+		void clear();
+
+		/** Returns the number of stored bounds. */
+		UINT32 size() const { return (UINT32)mRadius.size(); }
+
+		/** Returns the center of the bounding box at the specified index. */
+		Vector3 getBoxCenter(UINT32 idx) const { return Vector3(mBoxX[idx], mBoxY[idx], mBoxZ[idx]); }
+
+		/**
+		 * Tests a set of bounds against the provided volume. An entry is considered visible only if both its bounding
+		 * sphere and its bounding box intersect the volume.
+		 *
+		 * @param[in]	volume		Volume to test the bounds against, normally a camera frustum.
+		 * @param[in]	indices		Indices of the bounds to test.
+		 * @param[in]	count		Number of entries in the @p indices array.
+		 * @param[out]	visibility	Array that will receive 1 for each visible, and 0 for each culled entry, indexed the
+		 *							same as the bounds. Only entries referenced by @p indices are written to, so it is safe
+		 *							to process separate sets of indices from different threads.
+		 */
+		void cull(const ConvexVolume& volume, const UINT32* indices, UINT32 count, UINT8* visibility) const;
+
+	private:
+		// Bounding spheres
+		Vector<float> mSphereX;
+		Vector<float> mSphereY;
+		Vector<float> mSphereZ;
+		Vector<float> mRadius;
+
+		// Bounding boxes, stored as center and (absolute) half-size
+		Vector<float> mBoxX;
+		Vector<float> mBoxY;
+		Vector<float> mBoxZ;
+		Vector<float> mExtentX;
+		Vector<float> mExtentY;
+		Vector<float> mExtentZ;
+	};
+
+	/** @} */
+}
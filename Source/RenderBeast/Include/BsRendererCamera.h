@@ -7,7 +7,8 @@
 #include "BsObjectRendering.h"
 #include "BsRenderQueue.h"
 #include "BsRendererObject.h"
-#include "BsBounds.h"
+#include "BsRendererBounds.h"
+#include "BsAABBTree.h"
 
 namespace BansheeEngine
 {
@@ -58,15 +59,20 @@ namespace BansheeEngine
 		 * Populates camera render queues by determining visible renderable objects. 
 		 *
 		 * @param[in]	renderables			A set of renderable objects to iterate over and determine visibility for.
+		 * @param[in]	renderableTree		Spatial tree containing bounds of the provided renderable objects, with the
+		 *									index of the renderable object as user data. Only objects found by querying the
+		 *									tree with the camera frustum are tested for visibility.
 		 * @param[in]	renderableBounds	A set of world bounds for the provided renderable objects. Must be the same size
 		 *									as the @p renderables array.
 		 * @param[in]	visibility			Output parameter that will have the true bit set for any visible renderable
 		 *									object. If the bit for an object is already set to true, the method will never
 		 *									change it to false which allows the same bitfield to be provided to multiple
 		 *									renderer cameras. Must be the same size as the @p renderables array.
+		 *
+		 * @note	Frustum culling is split over multiple worker threads if there are enough renderables.
 		 */
-		void determineVisible(Vector<RendererObject>& renderables, const Vector<Bounds>& renderableBounds, 
-			Vector<bool>& visibility);
+		void determineVisible(Vector<RendererObject>& renderables, const AABBTree& renderableTree, 
+			const RendererBounds& renderableBounds, Vector<bool>& visibility);
 
 		/** 
 		 * Returns a structure containing information about post-processing effects. This structure will be modified and
@@ -78,6 +84,9 @@ namespace BansheeEngine
 		CameraShaderData getShaderData();
 
 	private:
+		/** Number of renderables processed by a single task when frustum culling. */
+		static const UINT32 CULLING_BATCH_SIZE = 2048;
+
 		/**
 		 * Extracts the necessary values from the projection matrix that allow you to transform device Z value into
 		 * world Z value.
@@ -95,6 +104,10 @@ namespace BansheeEngine
 		SPtr<RenderTargets> mRenderTargets;
 		PostProcessInfo mPostProcessInfo;
 		bool mUsingRenderTargets;
+
+		Vector<UINT8> mCullingResults; // Transient
+		Vector<UINT32> mVisibleCandidates; // Transient
+		Vector<UINT32> mIntersectingCandidates; // Transient
 	};
 
 	/** @} */
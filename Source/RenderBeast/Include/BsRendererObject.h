@@ -43,6 +43,15 @@ namespace BansheeEngine
 		/** Index of the technique in the material to render the element with. */
 		UINT32 techniqueIdx;
 
+		/** Index of the per-object parameter block buffer in @p params, or -1 if the element's material has none. */
+		UINT32 perObjectParamBlockIdx;
+
+		/** 
+		 * True if the element's technique reads per-object data from the per-instance buffer, allowing the element to be
+		 * rendered in the same draw call as other elements sharing its mesh and material.
+		 */
+		bool instanced;
+
 		/** 
 		 * Parameter for setting global bone pose transforms used for an element with skeletal animation, null otherwise. 
 		 */
@@ -66,6 +75,7 @@ namespace BansheeEngine
 	{
 		RenderableCore* renderable;
 		Vector<BeastRenderableElement> elements;
+		UINT32 treeId;
 	};
 
 	/** @} */
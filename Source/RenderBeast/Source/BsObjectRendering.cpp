@@ -15,7 +15,17 @@
 namespace BansheeEngine
 {
 	ObjectRenderer::ObjectRenderer()
-	{ }
+		:mPerObjectRing(mPerObjectParams.getBuffer()->getSize())
+	{
+		GPU_BUFFER_DESC desc;
+		desc.elementCount = MAX_INSTANCES_PER_DRAW * INSTANCE_DATA_NUM_VECTORS;
+		desc.elementSize = 0;
+		desc.type = GBT_STANDARD;
+		desc.format = BF_32X4F;
+		desc.usage = GBU_DYNAMIC;
+
+		mInstanceBuffer = GpuBufferCore::create(desc);
+	}
 
 	void ObjectRenderer::initElement(BeastRenderableElement& element)
 	{
@@ -29,6 +39,7 @@ namespace BansheeEngine
 		// Note: Perhaps perform buffer validation to ensure expected buffer has the same size and layout as the provided
 		// buffer, and show a warning otherwise. But this is perhaps better handled on a higher level.
 		const Map<String, SHADER_PARAM_BLOCK_DESC>& paramBlockDescs = shader->getParamBlocks();
+		element.perObjectParamBlockIdx = (UINT32)-1;
 
 		for (auto& paramBlockDesc : paramBlockDescs)
 		{
@@ -37,16 +48,23 @@ namespace BansheeEngine
 			else if (paramBlockDesc.second.rendererSemantic == RBS_PerCamera)
 				element.params->setParamBlockBuffer(paramBlockDesc.second.name, mPerCameraParams.getBuffer(), true);
 			else if (paramBlockDesc.second.rendererSemantic == RBS_PerObject)
+			{
+				// Actual buffer is assigned from the per-object ring before every draw
 				element.params->setParamBlockBuffer(paramBlockDesc.second.name, mPerObjectParams.getBuffer(), true);
+				element.perObjectParamBlockIdx = element.params->getParamBlockBufferIndex(paramBlockDesc.second.name);
+			}
 		}
 
 		const Map<String, SHADER_OBJECT_PARAM_DESC>& bufferDescs = shader->getBufferParams();
 		String boneMatricesParamName;
+		String instanceDataParamName;
 
 		for(auto& entry : bufferDescs)
 		{
 			if (entry.second.rendererSemantic == RPS_BoneMatrices)
 				boneMatricesParamName = entry.second.name;
+			else if (entry.second.rendererSemantic == RPS_InstanceData)
+				instanceDataParamName = entry.second.name;
 		}
 		
 		if (!boneMatricesParamName.empty())
@@ -55,11 +73,25 @@ namespace BansheeEngine
 			// on a per-Renderable basis, rather than per-element?
 			element.boneMatricesParam = element.material->getParamBuffer(boneMatricesParamName);
 		}
+
+		if (element.instanced)
+		{
+			// Instance buffer is shared by all instanced elements, so it only needs to be assigned once
+			if (!instanceDataParamName.empty())
+				element.material->getParamBuffer(instanceDataParamName).set(mInstanceBuffer);
+			else
+			{
+				LOGWRN("Instanced technique is missing the per-instance data buffer parameter. Element will not be "
+					"rendered using instancing.");
+				element.instanced = false;
+			}
+		}
 	}
 
 	void ObjectRenderer::setParamFrameParams(float time)
 	{
 		mPerFrameParams.gTime.set(time);
+		mPerObjectRing.beginFrame();
 	}
 
 	void ObjectRenderer::setPerCameraParams(const CameraShaderData& cameraData)
@@ -91,6 +123,53 @@ namespace BansheeEngine
 		mPerObjectParams.gMatWorldViewProj.set(wvpMatrix);
 
 		element.boneMatricesParam.set(boneMatrices);
+
+		// Per-object buffer is only used as a staging area, while the data is uploaded through a buffer from the ring
+		if (element.perObjectParamBlockIdx != (UINT32)-1)
+		{
+			const UINT8* data = mPerObjectParams.getBuffer()->getCachedData();
+			SPtr<GpuParamBlockBufferCore> buffer = mPerObjectRing.allocate(data);
+
+			element.params->setParamBlockBuffer(element.perObjectParamBlockIdx, buffer, true);
+		}
+	}
+
+	void ObjectRenderer::setPerInstanceParams(const RenderableShaderData* const* data, UINT32 numInstances, 
+		const Matrix4& viewProj)
+	{
+		assert(numInstances <= MAX_INSTANCES_PER_DRAW);
+
+		// Affine matrices only need their first three rows. All matrices are assumed to be in row-major format.
+		const UINT32 affineSize = 12 * sizeof(float);
+
+		UINT32 size = numInstances * INSTANCE_DATA_NUM_VECTORS * sizeof(Vector4);
+		UINT8* dest = (UINT8*)mInstanceBuffer->lock(0, size, GBL_WRITE_ONLY_DISCARD);
+		for (UINT32 i = 0; i < numInstances; i++)
+		{
+			const RenderableShaderData& entry = *data[i];
+
+			Matrix4 worldViewProj = viewProj * entry.worldTransform;
+			memcpy(dest, &worldViewProj, sizeof(Matrix4));
+			dest += sizeof(Matrix4);
+
+			memcpy(dest, &entry.worldTransform, affineSize);
+			dest += affineSize;
+
+			memcpy(dest, &entry.invWorldTransform, affineSize);
+			dest += affineSize;
+
+			memcpy(dest, &entry.worldNoScaleTransform, affineSize);
+			dest += affineSize;
+
+			memcpy(dest, &entry.invWorldNoScaleTransform, affineSize);
+			dest += affineSize;
+
+			Vector4 misc(entry.worldDeterminantSign, 0.0f, 0.0f, 0.0f);
+			memcpy(dest, &misc, sizeof(misc));
+			dest += sizeof(misc);
+		}
+
+		mInstanceBuffer->unlock();
 	}
 
 	void DefaultMaterial::_initDefines(ShaderDefines& defines)
@@ -35,6 +35,13 @@ using namespace std::placeholders;
 
 namespace BansheeEngine
 {
+	/** Returns a box encompassing the bounds of a point light. */
+	static AABox getLightBox(const Sphere& bounds)
+	{
+		Vector3 extents(bounds.getRadius(), bounds.getRadius(), bounds.getRadius());
+		return AABox(bounds.getCenter() - extents, bounds.getCenter() + extents);
+	}
+
 	RenderBeast::RendererFrame::RendererFrame(float delta, const RendererAnimationData& animData)
 		:delta(delta), animData(animData)
 	{ }
@@ -89,6 +96,7 @@ namespace BansheeEngine
 		mRenderTargets.clear();
 		mCameras.clear();
 		mRenderables.clear();
+		mRenderableTree.clear();
 		mVisibility.clear();
 
 		PostProcessing::shutDown();
@@ -112,11 +120,12 @@ namespace BansheeEngine
 
 		mRenderables.push_back(RendererObject());
 		mRenderableShaderData.push_back(RenderableShaderData());
-		mWorldBounds.push_back(renderable->getBounds());
+		mWorldBounds.add(renderable->getBounds());
 		mVisibility.push_back(false);
 
 		RendererObject& rendererObject = mRenderables.back();
 		rendererObject.renderable = renderable;
+		rendererObject.treeId = mRenderableTree.insert(renderable->getBounds().getBox(), renderableId);
 
 		RenderableShaderData& shaderData = mRenderableShaderData.back();
 		shaderData.worldTransform = renderable->getTransform();
@@ -165,6 +174,10 @@ namespace BansheeEngine
 				RenderableAnimType animType = renderable->getAnimType();
 				if(animType != RenderableAnimType::None)
 					techniqueIdx = renElement.material->findTechnique(techniqueIDLookup[(int)animType]);
+				else // Animated elements have unique per-object buffers and cannot be instanced
+					techniqueIdx = renElement.material->findTechnique(RTag_Instanced);
+
+				renElement.instanced = animType == RenderableAnimType::None && techniqueIdx != (UINT32)-1;
 
 				if (techniqueIdx == (UINT32)-1)
 					techniqueIdx = renElement.material->getDefaultTechnique();
@@ -291,14 +304,17 @@ namespace BansheeEngine
 			element.samplerOverrides = nullptr;
 		}
 
+		mRenderableTree.remove(mRenderables[renderableId].treeId);
+
 		if (renderableId != lastRenderableId)
 		{
 			// Swap current last element with the one we want to erase
 			std::swap(mRenderables[renderableId], mRenderables[lastRenderableId]);
-			std::swap(mWorldBounds[renderableId], mWorldBounds[lastRenderableId]);
+			mWorldBounds.swap(renderableId, lastRenderableId);
 			std::swap(mRenderableShaderData[renderableId], mRenderableShaderData[lastRenderableId]);
 
 			lastRenerable->setRendererId(renderableId);
+			mRenderableTree.setUserData(mRenderables[renderableId].treeId, renderableId);
 
 			for (auto& element : elements)
 				element.renderableId = renderableId;
@@ -306,7 +322,7 @@ namespace BansheeEngine
 
 		// Last element is the one we want to erase
 		mRenderables.erase(mRenderables.end() - 1);
-		mWorldBounds.erase(mWorldBounds.end() - 1);
+		mWorldBounds.removeLast();
 		mRenderableShaderData.erase(mRenderableShaderData.end() - 1);
 		mVisibility.erase(mVisibility.end() - 1);
 	}
@@ -322,7 +338,8 @@ namespace BansheeEngine
 		shaderData.invWorldNoScaleTransform = shaderData.worldNoScaleTransform.inverseAffine();
 		shaderData.worldDeterminantSign = shaderData.worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f;
 
-		mWorldBounds[renderableId] = renderable->getBounds();
+		mWorldBounds.set(renderableId, renderable->getBounds());
+		mRenderableTree.update(mRenderables[renderableId].treeId, renderable->getBounds().getBox());
 	}
 
 	void RenderBeast::notifyLightAdded(LightCore* light)
@@ -348,6 +365,7 @@ namespace BansheeEngine
 
 			RendererLight& lightData = mPointLights.back();
 			lightData.internal = light;
+			lightData.treeId = mPointLightTree.insert(getLightBox(light->getBounds()), lightId);
 		}
 	}
 
@@ -356,7 +374,10 @@ namespace BansheeEngine
 		UINT32 lightId = light->getRendererId();
 
 		if (light->getType() != LightType::Directional)
+		{
 			mLightWorldBounds[lightId] = light->getBounds();
+			mPointLightTree.update(mPointLights[lightId].treeId, getLightBox(light->getBounds()));
+		}
 	}
 
 	void RenderBeast::notifyLightRemoved(LightCore* light)
@@ -382,6 +403,8 @@ namespace BansheeEngine
 			LightCore* lastLight = mPointLights.back().internal;
 			UINT32 lastLightId = lastLight->getRendererId();
 
+			mPointLightTree.remove(mPointLights[lightId].treeId);
+
 			if (lightId != lastLightId)
 			{
 				// Swap current last element with the one we want to erase
@@ -389,6 +412,7 @@ namespace BansheeEngine
 				std::swap(mLightWorldBounds[lightId], mLightWorldBounds[lastLightId]);
 
 				lastLight->setRendererId(lightId);
+				mPointLightTree.setUserData(mPointLights[lightId].treeId, lightId);
 			}
 
 			// Last element is the one we want to erase
@@ -562,7 +586,7 @@ namespace BansheeEngine
 		mVisibility.assign(mVisibility.size(), false);
 
 		for (auto& entry : mCameras)
-			entry.second.determineVisible(mRenderables, mWorldBounds, mVisibility);
+			entry.second.determineVisible(mRenderables, mRenderableTree, mWorldBounds, mVisibility);
 
 		AnimationManager::instance().waitUntilComplete();
 		const RendererAnimationData& animData = AnimationManager::instance().getRendererData();
@@ -645,11 +669,7 @@ namespace BansheeEngine
 		
 		//// Render base pass
 		const Vector<RenderQueueElement>& opaqueElements = rendererCam.getOpaqueQueue()->getSortedElements();
-		for (auto iter = opaqueElements.begin(); iter != opaqueElements.end(); ++iter)
-		{
-			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
-			renderElement(*renderElem, iter->passIdx, iter->applyPass, frameInfo, cameraShaderData.viewProj);
-		}
+		renderElements(opaqueElements, frameInfo, cameraShaderData.viewProj);
 
 		renderTargets->bindSceneColor(true);
 
@@ -667,13 +687,18 @@ namespace BansheeEngine
 				gRendererUtility().drawScreenQuad();
 			}
 
+			// Find point lights overlapping the camera frustum
+			mVisiblePointLights.clear();
+			mPointLightTree.query(camera->getWorldFrustum(), 
+				[this](UINT32 lightId, bool inside) { mVisiblePointLights.push_back(lightId); });
+
 			// Draw point lights which our camera is within
 			// TODO - Possibly use instanced drawing here as only two meshes are drawn with various properties
 			mPointLightInMat->bind(renderTargets, perCameraBuffer);
 
-			// TODO - Cull lights based on visibility, right now I just iterate over all of them. 
-			for (auto& light : mPointLights)
+			for (auto& lightId : mVisiblePointLights)
 			{
+				const RendererLight& light = mPointLights[lightId];
 				if (!light.internal->getIsActive())
 					continue;
 
@@ -693,8 +718,9 @@ namespace BansheeEngine
 			// Draw other point lights
 			mPointLightOutMat->bind(renderTargets, perCameraBuffer);
 
-			for (auto& light : mPointLights)
+			for (auto& lightId : mVisiblePointLights)
 			{
+				const RendererLight& light = mPointLights[lightId];
 				if (!light.internal->getIsActive())
 					continue;
 
@@ -716,11 +742,7 @@ namespace BansheeEngine
 		
 		// Render transparent objects (TODO - No lighting yet)
 		const Vector<RenderQueueElement>& transparentElements = rendererCam.getTransparentQueue()->getSortedElements();
-		for (auto iter = transparentElements.begin(); iter != transparentElements.end(); ++iter)
-		{
-			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
-			renderElement(*renderElem, iter->passIdx, iter->applyPass, frameInfo, cameraShaderData.viewProj);
-		}
+		renderElements(transparentElements, frameInfo, cameraShaderData.viewProj);
 
 		// Render non-overlay post-scene callbacks
 		if (iterCameraCallbacks != mRenderCallbacks.end())
@@ -842,6 +864,72 @@ namespace BansheeEngine
 				element.morphVertexDeclaration);
 	}
 
+	void RenderBeast::renderInstancedElements(const RenderQueueElement* elements, UINT32 numInstances, 
+		const Matrix4& viewProj)
+	{
+		const BeastRenderableElement& element = *static_cast<BeastRenderableElement*>(elements[0].renderElem);
+		SPtr<MaterialCore> material = element.material;
+
+		mInstanceShaderData.resize(numInstances);
+		for (UINT32 i = 0; i < numInstances; i++)
+		{
+			UINT32 rendererId = static_cast<BeastRenderableElement*>(elements[i].renderElem)->renderableId;
+			mInstanceShaderData[i] = &mRenderableShaderData[rendererId];
+		}
+
+		mObjectRenderer->setPerInstanceParams(mInstanceShaderData.data(), numInstances, viewProj);
+		material->updateParamsSet(element.params, element.techniqueIdx);
+
+		if (elements[0].applyPass)
+			gRendererUtility().setPass(material, elements[0].passIdx, element.techniqueIdx);
+
+		gRendererUtility().setPassParams(element.params, elements[0].passIdx);
+		gRendererUtility().draw(element.mesh, element.subMesh, numInstances);
+	}
+
+	void RenderBeast::renderElements(const Vector<RenderQueueElement>& elements, const RendererFrame& frameInfo, 
+		const Matrix4& viewProj)
+	{
+		UINT32 numElements = (UINT32)elements.size();
+		UINT32 idx = 0;
+		while (idx < numElements)
+		{
+			const RenderQueueElement& queueElem = elements[idx];
+			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(queueElem.renderElem);
+
+			if (!renderElem->instanced)
+			{
+				renderElement(*renderElem, queueElem.passIdx, queueElem.applyPass, frameInfo, viewProj);
+				idx++;
+
+				continue;
+			}
+
+			// Merge following elements that use the same mesh, sub-mesh and material into the same draw call
+			UINT32 numInstances = 1;
+			while (idx + numInstances < numElements && numInstances < ObjectRenderer::MAX_INSTANCES_PER_DRAW)
+			{
+				const RenderQueueElement& otherQueueElem = elements[idx + numInstances];
+				BeastRenderableElement* otherElem = static_cast<BeastRenderableElement*>(otherQueueElem.renderElem);
+
+				bool canMerge = otherElem->instanced && otherQueueElem.passIdx == queueElem.passIdx &&
+					otherElem->material == renderElem->material && otherElem->params == renderElem->params &&
+					otherElem->mesh == renderElem->mesh && 
+					otherElem->subMesh.indexOffset == renderElem->subMesh.indexOffset &&
+					otherElem->subMesh.indexCount == renderElem->subMesh.indexCount &&
+					otherElem->subMesh.drawOp == renderElem->subMesh.drawOp;
+
+				if (!canMerge)
+					break;
+
+				numInstances++;
+			}
+
+			renderInstancedElements(&elements[idx], numInstances, viewProj);
+			idx += numInstances;
+		}
+	}
+
 	void RenderBeast::refreshSamplerOverrides(bool force)
 	{
 		bool anyDirty = false;
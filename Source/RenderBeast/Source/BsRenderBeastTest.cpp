@@ -0,0 +1,15 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRendererBoundsTestSuite.h"
+#include "BsConsoleTestOutput.h"
+
+using namespace BansheeEngine;
+
+int main()
+{
+	SPtr<TestSuite> tests = RendererBoundsTestSuite::create<RendererBoundsTestSuite>();
+	ConsoleTestOutput testOutput;
+	tests->run(testOutput);
+
+	return 0;
+}
@@ -0,0 +1,287 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRendererBounds.h"
+#include "BsMath.h"
+#include "BsPlane.h"
+#include "BsSIMD.h"
+
+namespace BansheeEngine
+{
+	void RendererBounds::add(const Bounds& bounds)
+	{
+		mSphereX.push_back(0.0f);
+		mSphereY.push_back(0.0f);
+		mSphereZ.push_back(0.0f);
+		mRadius.push_back(0.0f);
+
+		mBoxX.push_back(0.0f);
+		mBoxY.push_back(0.0f);
+		mBoxZ.push_back(0.0f);
+		mExtentX.push_back(0.0f);
+		mExtentY.push_back(0.0f);
+		mExtentZ.push_back(0.0f);
+
+		set(size() - 1, bounds);
+	}
+
+	void RendererBounds::set(UINT32 idx, const Bounds& bounds)
+	{
+		const Sphere& sphere = bounds.getSphere();
+		const Vector3& sphereCenter = sphere.getCenter();
+
+		mSphereX[idx] = sphereCenter.x;
+		mSphereY[idx] = sphereCenter.y;
+		mSphereZ[idx] = sphereCenter.z;
+		mRadius[idx] = sphere.getRadius();
+
+		const AABox& box = bounds.getBox();
+		Vector3 boxCenter = box.getCenter();
+		Vector3 boxExtents = box.getHalfSize();
+
+		mBoxX[idx] = boxCenter.x;
+		mBoxY[idx] = boxCenter.y;
+		mBoxZ[idx] = boxCenter.z;
+		mExtentX[idx] = Math::abs(boxExtents.x);
+		mExtentY[idx] = Math::abs(boxExtents.y);
+		mExtentZ[idx] = Math::abs(boxExtents.z);
+	}
+
+	void RendererBounds::swap(UINT32 lhs, UINT32 rhs)
+	{
+		std::swap(mSphereX[lhs], mSphereX[rhs]);
+		std::swap(mSphereY[lhs], mSphereY[rhs]);
+		std::swap(mSphereZ[lhs], mSphereZ[rhs]);
+		std::swap(mRadius[lhs], mRadius[rhs]);
+
+		std::swap(mBoxX[lhs], mBoxX[rhs]);
+		std::swap(mBoxY[lhs], mBoxY[rhs]);
+		std::swap(mBoxZ[lhs], mBoxZ[rhs]);
+		std::swap(mExtentX[lhs], mExtentX[rhs]);
+		std::swap(mExtentY[lhs], mExtentY[rhs]);
+		std::swap(mExtentZ[lhs], mExtentZ[rhs]);
+	}
+
+	void RendererBounds::removeLast()
+	{
+		mSphereX.pop_back();
+		mSphereY.pop_back();
+		mSphereZ.pop_back();
+		mRadius.pop_back();
+
+		mBoxX.pop_back();
+		mBoxY.pop_back();
+		mBoxZ.pop_back();
+		mExtentX.pop_back();
+		mExtentY.pop_back();
+		mExtentZ.pop_back();
+	}
+
+	void RendererBounds::clear()
+	{
+		mSphereX.clear();
+		mSphereY.clear();
+		mSphereZ.clear();
+		mRadius.clear();
+
+		mBoxX.clear();
+		mBoxY.clear();
+		mBoxZ.clear();
+		mExtentX.clear();
+		mExtentY.clear();
+		mExtentZ.clear();
+	}
+
+	void RendererBounds::cull(const ConvexVolume& volume, const UINT32* indices, UINT32 count, UINT8* visibility) const
+	{
+		// Note: Same tests as ConvexVolume::intersects(const Sphere&) and ConvexVolume::intersects(const AABox&). Objects
+		// are only culled when they are provably outside of a plane, and comparisons against NaN are always false, so 
+		// bounds containing NaNs are considered visible by both the vectorized and the scalar path.
+		const Vector<Plane>& planes = volume.getPlanes();
+		UINT32 numPlanes = (UINT32)planes.size();
+
+		UINT32 i = 0;
+
+#if BS_SIMD != BS_SIMD_NONE
+		struct SIMDPlane
+		{
+			__m128 normalX, normalY, normalZ;
+			__m128 absNormalX, absNormalY, absNormalZ;
+			__m128 d;
+		};
+
+		// Camera frustums have six planes, volumes with more planes (rare) are handled by the scalar path below
+		const UINT32 MAX_SIMD_PLANES = 8;
+		SIMDPlane simdPlanes[MAX_SIMD_PLANES];
+
+		UINT32 simdEnd = numPlanes <= MAX_SIMD_PLANES ? count - (count % 4) : 0;
+		for (UINT32 j = 0; j < std::min(numPlanes, MAX_SIMD_PLANES); j++)
+		{
+			const Plane& plane = planes[j];
+
+			simdPlanes[j].normalX = _mm_set1_ps(plane.normal.x);
+			simdPlanes[j].normalY = _mm_set1_ps(plane.normal.y);
+			simdPlanes[j].normalZ = _mm_set1_ps(plane.normal.z);
+			simdPlanes[j].absNormalX = _mm_set1_ps(Math::abs(plane.normal.x));
+			simdPlanes[j].absNormalY = _mm_set1_ps(Math::abs(plane.normal.y));
+			simdPlanes[j].absNormalZ = _mm_set1_ps(Math::abs(plane.normal.z));
+			simdPlanes[j].d = _mm_set1_ps(plane.d);
+		}
+
+		// Bounds referenced by the indices are tested in blocks. Blocks referencing a contiguous range of bounds are loaded
+		// directly from the stored arrays, while others are first compacted into contiguous arrays, so they can be tested
+		// using full vector loads instead of being assembled one lane at a time.
+		const UINT32 BLOCK_SIZE = 64;
+		struct CompactBounds
+		{
+			float sphereX[BLOCK_SIZE], sphereY[BLOCK_SIZE], sphereZ[BLOCK_SIZE], radius[BLOCK_SIZE];
+			float boxX[BLOCK_SIZE], boxY[BLOCK_SIZE], boxZ[BLOCK_SIZE];
+			float extentX[BLOCK_SIZE], extentY[BLOCK_SIZE], extentZ[BLOCK_SIZE];
+		};
+
+		CompactBounds compact;
+		while (i < simdEnd)
+		{
+			const UINT32* blockIndices = indices + i;
+			UINT32 blockCount = std::min(BLOCK_SIZE, simdEnd - i);
+
+			bool contiguous = true;
+			for (UINT32 k = 1; k < blockCount; k++)
+				contiguous &= blockIndices[k] == blockIndices[0] + k;
+
+			const float* sphereX;
+			const float* sphereY;
+			const float* sphereZ;
+			const float* radius;
+			const float* boxX;
+			const float* boxY;
+			const float* boxZ;
+			const float* extentX;
+			const float* extentY;
+			const float* extentZ;
+
+			if (contiguous)
+			{
+				UINT32 first = blockIndices[0];
+
+				sphereX = &mSphereX[first];
+				sphereY = &mSphereY[first];
+				sphereZ = &mSphereZ[first];
+				radius = &mRadius[first];
+				boxX = &mBoxX[first];
+				boxY = &mBoxY[first];
+				boxZ = &mBoxZ[first];
+				extentX = &mExtentX[first];
+				extentY = &mExtentY[first];
+				extentZ = &mExtentZ[first];
+			}
+			else
+			{
+				for (UINT32 k = 0; k < blockCount; k++)
+				{
+					UINT32 idx = blockIndices[k];
+
+					compact.sphereX[k] = mSphereX[idx];
+					compact.sphereY[k] = mSphereY[idx];
+					compact.sphereZ[k] = mSphereZ[idx];
+					compact.radius[k] = mRadius[idx];
+					compact.boxX[k] = mBoxX[idx];
+					compact.boxY[k] = mBoxY[idx];
+					compact.boxZ[k] = mBoxZ[idx];
+					compact.extentX[k] = mExtentX[idx];
+					compact.extentY[k] = mExtentY[idx];
+					compact.extentZ[k] = mExtentZ[idx];
+				}
+
+				sphereX = compact.sphereX;
+				sphereY = compact.sphereY;
+				sphereZ = compact.sphereZ;
+				radius = compact.radius;
+				boxX = compact.boxX;
+				boxY = compact.boxY;
+				boxZ = compact.boxZ;
+				extentX = compact.extentX;
+				extentY = compact.extentY;
+				extentZ = compact.extentZ;
+			}
+
+			// Test four objects at a time
+			for (UINT32 k = 0; k < blockCount / 4; k++)
+			{
+				UINT32 offset = k * 4;
+
+				__m128 centerX = _mm_loadu_ps(sphereX + offset);
+				__m128 centerY = _mm_loadu_ps(sphereY + offset);
+				__m128 centerZ = _mm_loadu_ps(sphereZ + offset);
+				__m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius + offset));
+
+				__m128 boxCenterX = _mm_loadu_ps(boxX + offset);
+				__m128 boxCenterY = _mm_loadu_ps(boxY + offset);
+				__m128 boxCenterZ = _mm_loadu_ps(boxZ + offset);
+				__m128 boxExtentX = _mm_loadu_ps(extentX + offset);
+				__m128 boxExtentY = _mm_loadu_ps(extentY + offset);
+				__m128 boxExtentZ = _mm_loadu_ps(extentZ + offset);
+
+				__m128 outside = _mm_setzero_ps();
+				for (UINT32 j = 0; j < numPlanes; j++)
+				{
+					const SIMDPlane& plane = simdPlanes[j];
+
+					__m128 sphereDist = _mm_mul_ps(centerX, plane.normalX);
+					sphereDist = simdMulAdd(centerY, plane.normalY, sphereDist);
+					sphereDist = simdMulAdd(centerZ, plane.normalZ, sphereDist);
+					sphereDist = _mm_sub_ps(sphereDist, plane.d);
+
+					__m128 boxDist = _mm_mul_ps(boxCenterX, plane.normalX);
+					boxDist = simdMulAdd(boxCenterY, plane.normalY, boxDist);
+					boxDist = simdMulAdd(boxCenterZ, plane.normalZ, boxDist);
+					boxDist = _mm_sub_ps(boxDist, plane.d);
+
+					__m128 effectiveRadius = _mm_mul_ps(boxExtentX, plane.absNormalX);
+					effectiveRadius = simdMulAdd(boxExtentY, plane.absNormalY, effectiveRadius);
+					effectiveRadius = simdMulAdd(boxExtentZ, plane.absNormalZ, effectiveRadius);
+					__m128 negEffectiveRadius = _mm_sub_ps(_mm_setzero_ps(), effectiveRadius);
+
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(sphereDist, negRadius));
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(boxDist, negEffectiveRadius));
+
+					// All four culled, no need to test the remaining planes
+					if (_mm_movemask_ps(outside) == 0xF)
+						break;
+				}
+
+				int mask = _mm_movemask_ps(outside);
+				const UINT32* quadIndices = blockIndices + offset;
+				visibility[quadIndices[0]] = ((mask >> 0) & 1) ^ 1;
+				visibility[quadIndices[1]] = ((mask >> 1) & 1) ^ 1;
+				visibility[quadIndices[2]] = ((mask >> 2) & 1) ^ 1;
+				visibility[quadIndices[3]] = ((mask >> 3) & 1) ^ 1;
+			}
+
+			i += blockCount;
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			UINT32 idx = indices[i];
+
+			bool outside = false;
+			for (UINT32 j = 0; j < numPlanes && !outside; j++)
+			{
+				const Plane& plane = planes[j];
+
+				float sphereDist = mSphereX[idx] * plane.normal.x + mSphereY[idx] * plane.normal.y + 
+					mSphereZ[idx] * plane.normal.z - plane.d;
+
+				float boxDist = mBoxX[idx] * plane.normal.x + mBoxY[idx] * plane.normal.y +
+					mBoxZ[idx] * plane.normal.z - plane.d;
+				float effectiveRadius = mExtentX[idx] * Math::abs(plane.normal.x) +
+					mExtentY[idx] * Math::abs(plane.normal.y) + mExtentZ[idx] * Math::abs(plane.normal.z);
+
+				outside = sphereDist < -mRadius[idx] || boxDist < -effectiveRadius;
+			}
+
+			visibility[idx] = outside ? 0 : 1;
+		}
+	}
+}
@@ -0,0 +1,168 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRendererBoundsTestSuite.h"
+
+#include "BsRendererBounds.h"
+#include "BsPlane.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Generates a deterministic sequence of numbers in [0, 1) range. */
+	float nextBoundsRandom(UINT32& seed)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		return (seed >> 8) / (float)(1 << 24);
+	}
+
+	/** Creates bounds of a random size at a random position within [-range, range] on each axis. */
+	Bounds randomBounds(UINT32& seed, float range)
+	{
+		Vector3 center(
+			(nextBoundsRandom(seed) * 2.0f - 1.0f) * range,
+			(nextBoundsRandom(seed) * 2.0f - 1.0f) * range,
+			(nextBoundsRandom(seed) * 2.0f - 1.0f) * range);
+
+		Vector3 halfSize = Vector3::ONE * 0.1f + Vector3(nextBoundsRandom(seed), nextBoundsRandom(seed),
+			nextBoundsRandom(seed)) * 5.0f;
+
+		AABox box(center - halfSize, center + halfSize);
+		return Bounds(box, Sphere(center, halfSize.length()));
+	}
+
+	/** Creates a volume in the shape of an axis aligned box spanning [-halfSize, halfSize] on each axis. */
+	ConvexVolume boxVolume(float halfSize)
+	{
+		Vector<Plane> planes =
+		{
+			Plane(Vector3(1.0f, 0.0f, 0.0f), -halfSize), Plane(Vector3(-1.0f, 0.0f, 0.0f), -halfSize),
+			Plane(Vector3(0.0f, 1.0f, 0.0f), -halfSize), Plane(Vector3(0.0f, -1.0f, 0.0f), -halfSize),
+			Plane(Vector3(0.0f, 0.0f, 1.0f), -halfSize), Plane(Vector3(0.0f, 0.0f, -1.0f), -halfSize)
+		};
+
+		return ConvexVolume(planes);
+	}
+
+	RendererBoundsTestSuite::RendererBoundsTestSuite()
+	{
+		BS_ADD_TEST(RendererBoundsTestSuite::testCull);
+		BS_ADD_TEST(RendererBoundsTestSuite::testCullInvalidBounds);
+		BS_ADD_TEST(RendererBoundsTestSuite::testCull_benchmark);
+	}
+
+	void RendererBoundsTestSuite::testCull()
+	{
+		const UINT32 NUM_BOUNDS = 1000;
+
+		UINT32 seed = 1;
+		Vector<Bounds> bounds(NUM_BOUNDS);
+		RendererBounds rendererBounds;
+		for (UINT32 i = 0; i < NUM_BOUNDS; i++)
+		{
+			bounds[i] = randomBounds(seed, 100.0f);
+			rendererBounds.add(bounds[i]);
+		}
+
+		ConvexVolume volume = boxVolume(50.0f);
+
+		// Every other object in reverse order, with a count that's not a multiple of the vector width, so both the
+		// vectorized and the scalar path process some of the objects
+		Vector<UINT32> indices;
+		for (UINT32 i = NUM_BOUNDS - 1; i > 2; i -= 2)
+			indices.push_back(i);
+
+		Vector<UINT8> visibility(NUM_BOUNDS, 2);
+		rendererBounds.cull(volume, indices.data(), (UINT32)indices.size(), visibility.data());
+
+		bool allMatch = true;
+		for (auto& idx : indices)
+		{
+			bool expected = volume.intersects(bounds[idx].getSphere()) && volume.intersects(bounds[idx].getBox());
+			allMatch &= visibility[idx] == (expected ? 1 : 0);
+		}
+
+		BS_TEST_ASSERT(allMatch);
+
+		// Objects not referenced by the indices must not be touched
+		bool untouched = true;
+		for (UINT32 i = 0; i < NUM_BOUNDS; i += 2)
+			untouched &= visibility[i] == 2;
+
+		BS_TEST_ASSERT(untouched);
+	}
+
+	void RendererBoundsTestSuite::testCullInvalidBounds()
+	{
+		const UINT32 NUM_BOUNDS = 7;
+
+		// Bounds far outside of the volume, except every other one has a NaN position. Invalid bounds must be reported
+		// as visible (same as ConvexVolume::intersects), regardless if they end up in the vectorized or the scalar path.
+		float nan = std::numeric_limits<float>::quiet_NaN();
+		RendererBounds rendererBounds;
+		for (UINT32 i = 0; i < NUM_BOUNDS; i++)
+		{
+			Vector3 center(1000.0f, 1000.0f, 1000.0f);
+			if (i % 2 == 0)
+				center = Vector3(nan, nan, nan);
+
+			AABox box(center - Vector3::ONE, center + Vector3::ONE);
+			rendererBounds.add(Bounds(box, Sphere(center, 1.0f)));
+		}
+
+		ConvexVolume volume = boxVolume(50.0f);
+
+		Vector<UINT32> indices(NUM_BOUNDS);
+		for (UINT32 i = 0; i < NUM_BOUNDS; i++)
+			indices[i] = i;
+
+		Vector<UINT8> visibility(NUM_BOUNDS, 2);
+		rendererBounds.cull(volume, indices.data(), NUM_BOUNDS, visibility.data());
+
+		for (UINT32 i = 0; i < NUM_BOUNDS; i++)
+			BS_TEST_ASSERT(visibility[i] == (i % 2 == 0 ? 1 : 0));
+	}
+
+	void RendererBoundsTestSuite::testCull_benchmark()
+	{
+		const UINT32 NUM_BOUNDS = 100000;
+		const UINT32 NUM_ITERATIONS = 50;
+
+		UINT32 seed = 2;
+		RendererBounds rendererBounds;
+		for (UINT32 i = 0; i < NUM_BOUNDS; i++)
+			rendererBounds.add(randomBounds(seed, 100.0f));
+
+		ConvexVolume volume = boxVolume(50.0f);
+		Vector<UINT8> visibility(NUM_BOUNDS);
+
+		// Sequential indices, as well as half of the objects in random order (as returned by a spatial tree query)
+		Vector<UINT32> sequential(NUM_BOUNDS);
+		for (UINT32 i = 0; i < NUM_BOUNDS; i++)
+			sequential[i] = i;
+
+		Vector<UINT32> shuffled = sequential;
+		for (UINT32 i = NUM_BOUNDS - 1; i > 0; i--)
+			std::swap(shuffled[i], shuffled[(UINT32)(nextBoundsRandom(seed) * (i + 1))]);
+
+		shuffled.resize(NUM_BOUNDS / 2);
+
+		auto measure = [&](const Vector<UINT32>& indices)
+		{
+			Timer timer;
+			UINT64 startTime = timer.getMicroseconds();
+
+			for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+				rendererBounds.cull(volume, indices.data(), (UINT32)indices.size(), visibility.data());
+
+			UINT64 time = timer.getMicroseconds() - startTime;
+			return (time * 1000.0f) / (NUM_ITERATIONS * (UINT32)indices.size());
+		};
+
+		float sequentialTime = measure(sequential);
+		float shuffledTime = measure(shuffled);
+
+		LOGDBG("Culling " + toString(NUM_BOUNDS) + " bounds with BS_SIMD " + toString(BS_SIMD) + ": sequential " +
+			toString(sequentialTime) + " ns, shuffled " + toString(shuffledTime) + " ns per object");
+	}
+}
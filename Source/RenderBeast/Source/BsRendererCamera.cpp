@@ -6,6 +6,9 @@
 #include "BsMaterial.h"
 #include "BsShader.h"
 #include "BsRenderTargets.h"
+#include "BsRenderStats.h"
+#include "BsProfilerCPU.h"
+#include "BsTaskScheduler.h"
 
 namespace BansheeEngine
 {
@@ -78,8 +81,8 @@ namespace BansheeEngine
 		}
 	}
 
-	void RendererCamera::determineVisible(Vector<RendererObject>& renderables, const Vector<Bounds>& renderableBounds, 
-		Vector<bool>& visibility)
+	void RendererCamera::determineVisible(Vector<RendererObject>& renderables, const AABBTree& renderableTree, 
+		const RendererBounds& renderableBounds, Vector<bool>& visibility)
 	{
 		bool isOverlayCamera = mCamera->getFlags().isSet(CameraFlag::Overlay);
 		if (isOverlayCamera)
@@ -88,44 +91,71 @@ namespace BansheeEngine
 		UINT64 cameraLayers = mCamera->getLayers();
 		ConvexVolume worldFrustum = mCamera->getWorldFrustum();
 
+		// Do frustum culling
+		gProfilerCPU().beginSample("Culling");
+
+		UINT32 numRenderables = (UINT32)renderables.size();
+		mCullingResults.resize(numRenderables);
+		mVisibleCandidates.clear();
+		mIntersectingCandidates.clear();
+
+		// Find potentially visible objects using the spatial tree. Objects whose tree bounds are fully within the frustum
+		// are visible without further testing, while the rest need to be tested using their precise bounds.
+		UINT8* cullingResults = mCullingResults.data();
+		renderableTree.query(worldFrustum, [&](UINT32 idx, bool inside)
+		{
+			mVisibleCandidates.push_back(idx);
+
+			if (inside)
+				cullingResults[idx] = 1;
+			else
+				mIntersectingCandidates.push_back(idx);
+		});
+
+		UINT32 numIntersecting = (UINT32)mIntersectingCandidates.size();
+		const UINT32* intersecting = mIntersectingCandidates.data();
+		auto cullRange = [&](UINT32 start, UINT32 end)
+		{
+			renderableBounds.cull(worldFrustum, intersecting + start, end - start, cullingResults);
+		};
+
+		if (numIntersecting > CULLING_BATCH_SIZE)
+			TaskScheduler::instance().parallelFor(0, numIntersecting, CULLING_BATCH_SIZE, cullRange);
+		else
+			cullRange(0, numIntersecting);
+
+		gProfilerCPU().endSample("Culling");
+
 		// Update per-object param buffers and queue render elements
-		for(UINT32 i = 0; i < (UINT32)renderables.size(); i++)
+		UINT32 numVisible = 0;
+		for(auto& i : mVisibleCandidates)
 		{
-			RenderableCore* renderable = renderables[i].renderable;
-			UINT32 rendererId = renderable->getRendererId();
+			if (!cullingResults[i])
+				continue;
 
+			RenderableCore* renderable = renderables[i].renderable;
 			if ((renderable->getLayer() & cameraLayers) == 0)
 				continue;
 
-			// Do frustum culling
-			// Note: This is bound to be a bottleneck at some point. When it is ensure that intersect methods use vector
-			// operations, as it is trivial to update them. Also consider spatial partitioning.
-			const Sphere& boundingSphere = renderableBounds[rendererId].getSphere();
-			if (worldFrustum.intersects(boundingSphere))
-			{
-				// More precise with the box
-				const AABox& boundingBox = renderableBounds[rendererId].getBox();
+			visibility[i] = true;
+			numVisible++;
 
-				if (worldFrustum.intersects(boundingBox))
-				{
-					visibility[i] = true;
+			float distanceToCamera = (mCamera->getPosition() - renderableBounds.getBoxCenter(i)).length();
 
-					float distanceToCamera = (mCamera->getPosition() - boundingBox.getCenter()).length();
-
-					for (auto& renderElem : renderables[i].elements)
-					{
-						bool isTransparent = (renderElem.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
-
-						if (isTransparent)
-							mTransparentQueue->add(&renderElem, distanceToCamera);
-						else
-							mOpaqueQueue->add(&renderElem, distanceToCamera);
-					}
+			for (auto& renderElem : renderables[i].elements)
+			{
+				bool isTransparent = (renderElem.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
 
-				}
+				if (isTransparent)
+					mTransparentQueue->add(&renderElem, distanceToCamera);
+				else
+					mOpaqueQueue->add(&renderElem, distanceToCamera);
 			}
 		}
 
+		BS_ADD_RENDER_STAT(NumVisibleObjects, numVisible);
+		BS_ADD_RENDER_STAT(NumCulledObjects, numRenderables - numVisible);
+
 		mOpaqueQueue->sort();
 		mTransparentQueue->sort();
 	}
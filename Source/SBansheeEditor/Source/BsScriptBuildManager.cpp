@@ -300,6 +300,10 @@ namespace BansheeEngine
 
 		FileSystem::createDir(outputPath);
 
+		// Resources are packed into a single package, rather than copied into individual files
+		Map<String, Path> packagedResources;
+		Vector<Path> temporaryFiles;
+
 		Path libraryDir = gProjectLibrary().getResourcesFolder();
 		for (auto& entry : usedResources)
 		{
@@ -356,6 +360,9 @@ namespace BansheeEngine
 
 				gResources().save(prefab, destPath, false);
 
+				packagedResources[uuid] = destPath;
+				temporaryFiles.push_back(destPath);
+
 				// Need to unload this one as we modified it in memory, and we don't want to persist those changes past
 				// this point
 				gResources().release(prefab);
@@ -364,7 +371,35 @@ namespace BansheeEngine
 					gProjectLibrary().load(sourcePath);
 			}
 			else
-				FileSystem::copy(entry, destPath);
+				packagedResources[uuid] = entry;
+		}
+
+		Path packagePath = outputPath;
+		packagePath.append(GAME_RESOURCE_PACKAGE_NAME);
+
+		if (BuildManager::instance().packageResources(packagedResources, packagePath))
+		{
+			for (auto& entry : temporaryFiles)
+				FileSystem::remove(entry);
+		}
+		else
+		{
+			// Game loads the individual files through the resource manifest if there's no package, so fall back to
+			// copying them instead (the modified prefabs are already saved to the output folder)
+			LOGWRN("Failed to create the resource package at path: " + packagePath.toString() + ". Copying individual "
+				"resource files instead.");
+
+			if (FileSystem::exists(packagePath))
+				FileSystem::remove(packagePath);
+
+			for (auto& entry : packagedResources)
+			{
+				Path destPath = outputPath;
+				destPath.setFilename(entry.second.getFilename());
+
+				if (entry.second != destPath)
+					FileSystem::copy(entry.second, destPath);
+			}
 		}
 
 		// Save icon